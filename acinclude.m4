@@ -6,6 +6,68 @@ dnl Function to detect if libfsxfs dependencies are available
 AC_DEFUN([AX_LIBFSXFS_CHECK_LOCAL],
   [dnl Check for internationalization functions in libfsxfs/libfsxfs_i18n.c
   AC_CHECK_FUNCS([bindtextdomain])
+
+  dnl Check for CRC-32C instructions support in libfsxfs/libfsxfs_checksum.c
+  AX_LIBFSXFS_CHECK_CRC32C_INSTRUCTIONS
+])
+
+dnl Function to detect if the CRC-32C instructions of the processor can be used
+AC_DEFUN([AX_LIBFSXFS_CHECK_CRC32C_INSTRUCTIONS],
+  [AC_CACHE_CHECK(
+    [whether SSE4.2 CRC32 instructions are supported],
+    [ac_cv_libfsxfs_crc32c_sse42],
+    [AC_LANG_PUSH(C)
+    AC_LINK_IFELSE(
+      [AC_LANG_PROGRAM(
+        [[#include <nmmintrin.h>
+
+__attribute__((target("sse4.2")))
+unsigned int test_crc32c( unsigned int checksum, unsigned char value )
+{
+	return( _mm_crc32_u8( checksum, value ) );
+}]],
+        [[if( __builtin_cpu_supports( "sse4.2" ) )
+{
+	return( (int) test_crc32c( 0, 1 ) );
+}]] )],
+      [ac_cv_libfsxfs_crc32c_sse42=yes],
+      [ac_cv_libfsxfs_crc32c_sse42=no])
+    AC_LANG_POP(C)])
+
+  AS_IF(
+    [test "x$ac_cv_libfsxfs_crc32c_sse42" = xyes],
+    [AC_DEFINE(
+      [HAVE_LIBFSXFS_CRC32C_SSE42_SUPPORT],
+      [1],
+      [Define to 1 if the SSE4.2 CRC32 instructions are supported.])
+    ac_cv_libfsxfs_crc32c_instructions=sse4.2
+    ],
+    [AC_CACHE_CHECK(
+      [whether ARMv8 CRC32 instructions are supported],
+      [ac_cv_libfsxfs_crc32c_armv8],
+      [AC_LANG_PUSH(C)
+      AC_LINK_IFELSE(
+        [AC_LANG_PROGRAM(
+          [[#include <arm_acle.h>
+
+#if !defined( __ARM_FEATURE_CRC32 )
+#error Missing ARMv8 CRC32 instructions
+#endif]],
+          [[return( (int) __crc32cd( 0, 1 ) );]] )],
+        [ac_cv_libfsxfs_crc32c_armv8=yes],
+        [ac_cv_libfsxfs_crc32c_armv8=no])
+      AC_LANG_POP(C)])
+
+    AS_IF(
+      [test "x$ac_cv_libfsxfs_crc32c_armv8" = xyes],
+      [AC_DEFINE(
+        [HAVE_LIBFSXFS_CRC32C_ARMV8_SUPPORT],
+        [1],
+        [Define to 1 if the ARMv8 CRC32 instructions are supported.])
+      ac_cv_libfsxfs_crc32c_instructions=armv8
+      ],
+      [ac_cv_libfsxfs_crc32c_instructions=no])
+    ])
 ])
 
 dnl Function to detect if fsxfstools dependencies are available
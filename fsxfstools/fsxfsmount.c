@@ -367,6 +367,10 @@ int main( int argc, char * const argv[] )
 	fsxfsmount_fuse_operations.readlink   = &mount_fuse_readlink;
 	fsxfsmount_fuse_operations.destroy    = &mount_fuse_destroy;
 
+#if defined( MOUNT_FUSE_HAVE_LSEEK )
+	fsxfsmount_fuse_operations.lseek      = &mount_fuse_lseek;
+#endif
+
 #if defined( HAVE_LIBFUSE3 )
 	fsxfsmount_fuse_handle = fuse_new(
 	                          &fsxfsmount_fuse_arguments,
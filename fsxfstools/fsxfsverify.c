@@ -0,0 +1,451 @@
+/*
+ * Verifies the metadata of a X File System (XFS) volume.
+ *
+ * Copyright (C) 2020-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#include <stdio.h>
+
+#if defined( HAVE_IO_H ) || defined( WINAPI )
+#include <io.h>
+#endif
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "fsxfstools_getopt.h"
+#include "fsxfstools_libcerror.h"
+#include "fsxfstools_libclocale.h"
+#include "fsxfstools_libcnotify.h"
+#include "fsxfstools_libfsxfs.h"
+#include "fsxfstools_output.h"
+#include "fsxfstools_signal.h"
+#include "fsxfstools_unused.h"
+#include "verify_handle.h"
+
+verify_handle_t *fsxfsverify_verify_handle = NULL;
+int fsxfsverify_abort                      = 0;
+
+/* Prints usage information
+ */
+void usage_fprint(
+      FILE *stream )
+{
+	if( stream == NULL )
+	{
+		return;
+	}
+	fprintf( stream, "Use fsxfsverify to verify the metadata of a X File System (XFS) volume.\n\n" );
+
+	fprintf( stream, "Usage: fsxfsverify [ -o offset ] [ -t threads ] [ -hjvV ] source\n\n" );
+
+	fprintf( stream, "\tsource: the source file or device\n\n" );
+
+	fprintf( stream, "\t-h:     shows this help\n" );
+	fprintf( stream, "\t-j:     output the summary in JSON\n" );
+	fprintf( stream, "\t-o:     specify the volume offset\n" );
+	fprintf( stream, "\t-t:     specify the number of worker threads, where each worker\n"
+	                 "\t        verifies one allocation group at a time (default is 4)\n" );
+	fprintf( stream, "\t-v:     verbose output to stderr\n" );
+	fprintf( stream, "\t-V:     print version\n" );
+}
+
+/* Signal handler for fsxfsverify
+ */
+void fsxfsverify_signal_handler(
+      fsxfstools_signal_t signal FSXFSTOOLS_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+	static char *function   = "fsxfsverify_signal_handler";
+
+	FSXFSTOOLS_UNREFERENCED_PARAMETER( signal )
+
+	fsxfsverify_abort = 1;
+
+	if( fsxfsverify_verify_handle != NULL )
+	{
+		if( verify_handle_signal_abort(
+		     fsxfsverify_verify_handle,
+		     &error ) != 1 )
+		{
+			libcnotify_printf(
+			 "%s: unable to signal verify handle to abort.\n",
+			 function );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	/* Force stdin to close otherwise any function reading it will remain blocked
+	 */
+#if defined( WINAPI ) && !defined( __CYGWIN__ )
+	if( _close(
+	     0 ) != 0 )
+#else
+	if( close(
+	     0 ) != 0 )
+#endif
+	{
+		libcnotify_printf(
+		 "%s: unable to close stdin.\n",
+		 function );
+	}
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain( int argc, wchar_t * const argv[] )
+#else
+int main( int argc, char * const argv[] )
+#endif
+{
+	libfsxfs_error_t *error                      = NULL;
+	system_character_t *option_number_of_threads = NULL;
+	system_character_t *option_volume_offset     = NULL;
+	system_character_t *source                   = NULL;
+	char *program                                = "fsxfsverify";
+	system_integer_t option                      = 0;
+	uint64_t number_of_inodes                    = 0;
+	uint64_t metadata_size                       = 0;
+	uint32_t number_of_failed                    = 0;
+	uint32_t number_of_not_verified              = 0;
+	uint32_t number_of_verified                  = 0;
+	uint8_t output_json                          = 0;
+	int verbose                                  = 0;
+
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+	libcnotify_verbose_set(
+	 1 );
+
+	if( libclocale_initialize(
+	     "fsxfstools",
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize locale values.\n" );
+
+		goto on_error;
+	}
+	if( fsxfstools_output_initialize(
+	     _IONBF,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize output settings.\n" );
+
+		goto on_error;
+	}
+	while( ( option = fsxfstools_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "hjo:t:vV" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fsxfstools_output_version_fprint(
+				 stdout,
+				 program );
+
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM "\n",
+				 argv[ optind - 1 ] );
+
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'h':
+				fsxfstools_output_version_fprint(
+				 stdout,
+				 program );
+
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'j':
+				output_json = 1;
+
+				break;
+
+			case (system_integer_t) 'o':
+				option_volume_offset = optarg;
+
+				break;
+
+			case (system_integer_t) 't':
+				option_number_of_threads = optarg;
+
+				break;
+
+			case (system_integer_t) 'v':
+				verbose = 1;
+
+				break;
+
+			case (system_integer_t) 'V':
+				fsxfstools_output_version_fprint(
+				 stdout,
+				 program );
+
+				fsxfstools_output_copyright_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+		}
+	}
+	/* The version is not printed when the output is JSON
+	 * to keep the standard output machine readable
+	 */
+	if( output_json == 0 )
+	{
+		fsxfstools_output_version_fprint(
+		 stdout,
+		 program );
+	}
+	if( optind == argc )
+	{
+		fprintf(
+		 stderr,
+		 "Missing source file or device.\n" );
+
+		usage_fprint(
+		 stdout );
+
+		return( EXIT_FAILURE );
+	}
+	source = argv[ optind ];
+
+	libcnotify_verbose_set(
+	 verbose );
+	libfsxfs_notify_set_stream(
+	 stderr,
+	 NULL );
+	libfsxfs_notify_set_verbose(
+	 verbose );
+
+	if( verify_handle_initialize(
+	     &fsxfsverify_verify_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize verify handle.\n" );
+
+		goto on_error;
+	}
+	if( option_volume_offset != NULL )
+	{
+		if( verify_handle_set_volume_offset(
+		     fsxfsverify_verify_handle,
+		     option_volume_offset,
+		     &error ) != 1 )
+		{
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+
+			fprintf(
+			 stderr,
+			 "Unsupported volume offset defaulting to: %" PRIi64 ".\n",
+			 fsxfsverify_verify_handle->volume_offset );
+		}
+	}
+	if( option_number_of_threads != NULL )
+	{
+		if( verify_handle_set_number_of_threads(
+		     fsxfsverify_verify_handle,
+		     option_number_of_threads,
+		     &error ) != 1 )
+		{
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+
+			fprintf(
+			 stderr,
+			 "Unsupported number of threads defaulting to: %d.\n",
+			 fsxfsverify_verify_handle->number_of_threads );
+		}
+	}
+	if( fsxfstools_signal_attach(
+	     fsxfsverify_signal_handler,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to attach signal handler.\n" );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( verify_handle_open_input(
+	     fsxfsverify_verify_handle,
+	     source,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to open: %" PRIs_SYSTEM ".\n",
+		 source );
+
+		goto on_error;
+	}
+	if( verify_handle_verify_volume(
+	     fsxfsverify_verify_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to verify volume.\n" );
+
+		goto on_error;
+	}
+	if( output_json != 0 )
+	{
+		if( verify_handle_summary_json_fprint(
+		     fsxfsverify_verify_handle,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to print summary.\n" );
+
+			goto on_error;
+		}
+	}
+	else
+	{
+		if( verify_handle_summary_fprint(
+		     fsxfsverify_verify_handle,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to print summary.\n" );
+
+			goto on_error;
+		}
+	}
+	if( verify_handle_get_totals(
+	     fsxfsverify_verify_handle,
+	     &number_of_verified,
+	     &number_of_failed,
+	     &number_of_not_verified,
+	     &number_of_inodes,
+	     &metadata_size,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to retrieve totals.\n" );
+
+		goto on_error;
+	}
+	if( fsxfstools_signal_detach(
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to detach signal handler.\n" );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( verify_handle_close_input(
+	     fsxfsverify_verify_handle,
+	     &error ) != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to close verify handle.\n" );
+
+		goto on_error;
+	}
+	if( verify_handle_free(
+	     &fsxfsverify_verify_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free verify handle.\n" );
+
+		goto on_error;
+	}
+	if( fsxfsverify_abort != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "%s: ABORTED\n",
+		 program );
+
+		return( EXIT_FAILURE );
+	}
+	if( ( number_of_failed != 0 )
+	 || ( number_of_not_verified != 0 ) )
+	{
+		return( EXIT_FAILURE );
+	}
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( fsxfsverify_verify_handle != NULL )
+	{
+		verify_handle_free(
+		 &fsxfsverify_verify_handle,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
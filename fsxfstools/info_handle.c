@@ -649,9 +649,13 @@ int info_handle_file_entry_calculate_md5(
 
 	libhmac_md5_context_t *md5_context = NULL;
 	static char *function              = "info_handle_file_entry_calculate_md5";
+	size64_t data_range_size           = 0;
 	size64_t data_size                 = 0;
 	size_t read_size                   = 0;
 	ssize_t read_count                 = 0;
+	off64_t data_range_offset          = 0;
+	off64_t offset                     = 0;
+	int result                         = 0;
 
 	if( info_handle == NULL )
 	{
@@ -706,47 +710,140 @@ int info_handle_file_entry_calculate_md5(
 
 		goto on_error;
 	}
-	while( data_size > 0 )
+	while( (size64_t) offset < data_size )
 	{
-		read_size = 4096;
-
-		if( (size64_t) read_size > data_size )
-		{
-			read_size = (size_t) data_size;
-		}
-		read_count = libfsxfs_file_entry_read_buffer(
-		              file_entry,
-		              read_buffer,
-		              read_size,
-		              error );
+		/* Holes are hashed as zero bytes without reading the data
+		 */
+		result = libfsxfs_file_entry_get_next_data_range(
+		          file_entry,
+		          offset,
+		          &data_range_offset,
+		          &data_range_size,
+		          error );
 
-		if( read_count != (ssize_t) read_size )
+		if( result == -1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read from file entry.",
-			 function );
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve next data range at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 offset,
+			 offset );
 
 			goto on_error;
 		}
-		data_size -= read_size;
+		else if( result == 0 )
+		{
+			data_range_offset = (off64_t) data_size;
+			data_range_size   = 0;
+		}
+		if( offset < data_range_offset )
+		{
+			if( memory_set(
+			     read_buffer,
+			     0,
+			     4096 ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+				 "%s: unable to clear read buffer.",
+				 function );
 
-		if( libhmac_md5_update(
-		     md5_context,
-		     read_buffer,
-		     read_size,
-		     error ) != 1 )
+				goto on_error;
+			}
+			while( offset < data_range_offset )
+			{
+				read_size = 4096;
+
+				if( (size64_t) read_size > (size64_t) ( data_range_offset - offset ) )
+				{
+					read_size = (size_t) ( data_range_offset - offset );
+				}
+				if( libhmac_md5_update(
+				     md5_context,
+				     read_buffer,
+				     read_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to update MD5 hash.",
+					 function );
+
+					goto on_error;
+				}
+				offset += read_size;
+			}
+			if( data_range_size == 0 )
+			{
+				break;
+			}
+			if( libfsxfs_file_entry_seek_offset(
+			     file_entry,
+			     offset,
+			     SEEK_SET,
+			     error ) == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_SEEK_FAILED,
+				 "%s: unable to seek offset: %" PRIi64 " in file entry.",
+				 function,
+				 offset );
+
+				goto on_error;
+			}
+		}
+		while( data_range_size > 0 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to update MD5 hash.",
-			 function );
+			read_size = 4096;
 
-			goto on_error;
+			if( (size64_t) read_size > data_range_size )
+			{
+				read_size = (size_t) data_range_size;
+			}
+			read_count = libfsxfs_file_entry_read_buffer(
+			              file_entry,
+			              read_buffer,
+			              read_size,
+			              error );
+
+			if( read_count != (ssize_t) read_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read from file entry.",
+				 function );
+
+				goto on_error;
+			}
+			data_range_size -= read_size;
+			offset          += read_size;
+
+			if( libhmac_md5_update(
+			     md5_context,
+			     read_buffer,
+			     read_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to update MD5 hash.",
+				 function );
+
+				goto on_error;
+			}
 		}
 	}
 	if( libhmac_md5_finalize(
@@ -1868,6 +1965,161 @@ on_error:
 	return( -1 );
 }
 
+/* Prints the name of a sub file entry as part of the file system hierarchy
+ * The name is retrieved from the directory entry without reading the inode of the sub file entry
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_file_system_hierarchy_fprint_sub_file_entry_name(
+     info_handle_t *info_handle,
+     libfsxfs_file_entry_t *file_entry,
+     int sub_file_entry_index,
+     const system_character_t *path,
+     size_t path_length,
+     libcerror_error_t **error )
+{
+	system_character_t *sub_file_entry_name = NULL;
+	static char *function                    = "info_handle_file_system_hierarchy_fprint_sub_file_entry_name";
+	size_t sub_file_entry_name_size          = 0;
+	int result                               = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libfsxfs_file_entry_get_sub_file_entry_utf16_name_size_by_index(
+	          file_entry,
+	          sub_file_entry_index,
+	          &sub_file_entry_name_size,
+	          error );
+#else
+	result = libfsxfs_file_entry_get_sub_file_entry_utf8_name_size_by_index(
+	          file_entry,
+	          sub_file_entry_index,
+	          &sub_file_entry_name_size,
+	          error );
+#endif
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve sub file entry: %d name string size.",
+		 function,
+		 sub_file_entry_index );
+
+		goto on_error;
+	}
+	if( ( sub_file_entry_name_size == 0 )
+	 || ( sub_file_entry_name_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid sub file entry: %d name string size value out of bounds.",
+		 function,
+		 sub_file_entry_index );
+
+		goto on_error;
+	}
+	sub_file_entry_name = system_string_allocate(
+	                       sub_file_entry_name_size );
+
+	if( sub_file_entry_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create sub file entry name string.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libfsxfs_file_entry_get_sub_file_entry_utf16_name_by_index(
+	          file_entry,
+	          sub_file_entry_index,
+	          (uint16_t *) sub_file_entry_name,
+	          sub_file_entry_name_size,
+	          error );
+#else
+	result = libfsxfs_file_entry_get_sub_file_entry_utf8_name_by_index(
+	          file_entry,
+	          sub_file_entry_index,
+	          (uint8_t *) sub_file_entry_name,
+	          sub_file_entry_name_size,
+	          error );
+#endif
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve sub file entry: %d name string.",
+		 function,
+		 sub_file_entry_index );
+
+		goto on_error;
+	}
+	if( info_handle_name_value_fprint(
+	     info_handle,
+	     path,
+	     path_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+		 "%s: unable to print path string.",
+		 function );
+
+		goto on_error;
+	}
+	if( info_handle_name_value_fprint(
+	     info_handle,
+	     sub_file_entry_name,
+	     sub_file_entry_name_size - 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+		 "%s: unable to print sub file entry name string.",
+		 function );
+
+		goto on_error;
+	}
+	fprintf(
+	 info_handle->notify_stream,
+	 "\n" );
+
+	memory_free(
+	 sub_file_entry_name );
+
+	return( 1 );
+
+on_error:
+	if( sub_file_entry_name != NULL )
+	{
+		memory_free(
+		 sub_file_entry_name );
+	}
+	return( -1 );
+}
+
 /* Prints file entry information as part of the file system hierarchy
  * Returns 1 if successful or -1 on error
  */
@@ -1886,6 +2138,7 @@ int info_handle_file_system_hierarchy_fprint_file_entry(
 	size_t file_entry_name_size           = 0;
 	size_t sub_path_size                  = 0;
 	uint64_t file_entry_identifier        = 0;
+	uint16_t sub_file_entry_type          = 0;
 	int number_of_sub_file_entries        = 0;
 	int result                            = 0;
 	int sub_file_entry_index              = 0;
@@ -2136,6 +2389,53 @@ int info_handle_file_system_hierarchy_fprint_file_entry(
 		     sub_file_entry_index < number_of_sub_file_entries;
 		     sub_file_entry_index++ )
 		{
+			sub_file_entry_type = 0;
+
+			if( info_handle->bodyfile_stream == NULL )
+			{
+				if( libfsxfs_file_entry_get_sub_file_entry_file_type_by_index(
+				     file_entry,
+				     sub_file_entry_index,
+				     &sub_file_entry_type,
+				     error ) == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve sub file entry: %d file type.",
+					 function,
+					 sub_file_entry_index );
+
+					goto on_error;
+				}
+			}
+			/* Sub file entries that are known not to be directories only need their name printed,
+			 * which does not require their inode to be read
+			 */
+			if( ( sub_file_entry_type != 0 )
+			 && ( sub_file_entry_type != LIBFSXFS_FILE_TYPE_DIRECTORY ) )
+			{
+				if( info_handle_file_system_hierarchy_fprint_sub_file_entry_name(
+				     info_handle,
+				     file_entry,
+				     sub_file_entry_index,
+				     sub_path,
+				     sub_path_size - 1,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+					 "%s: unable to print sub file entry: %d name.",
+					 function,
+					 sub_file_entry_index );
+
+					goto on_error;
+				}
+				continue;
+			}
 			if( libfsxfs_file_entry_get_sub_file_entry_by_index(
 			     file_entry,
 			     sub_file_entry_index,
@@ -2228,33 +2528,75 @@ int info_handle_file_entries_fprint(
      info_handle_t *info_handle,
      libcerror_error_t **error )
 {
-	static char *function           = "info_handle_file_entries_fprint";
-	uint64_t file_entry_identifier  = 0;
-	uint32_t number_of_file_entries = 0;
+	libfsxfs_file_entry_t *file_entry = NULL;
+	static char *function             = "info_handle_file_entries_fprint";
+	uint64_t cookie                   = 0;
+	uint64_t inode_number             = 0;
+	int result                        = 0;
 
-#ifdef TODO
-	if( libfsxfs_volume_get_number_of_file_entries(
-	     info_handle->input_volume,
-	     &number_of_file_entries,
-	     error ) != 1 )
+	if( info_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of file entries.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	for( file_entry_identifier = 0;
-	     file_entry_identifier < (uint64_t) number_of_file_entries;
-	     file_entry_identifier++ )
+	/* The file entries are retrieved in inode number order, which allows
+	 * the inode chunks to be read sequentially
+	 */
+	do
 	{
-		if( info_handle_file_entry_fprint_by_identifier(
+		result = libfsxfs_volume_get_next_file_entry(
+		          info_handle->input_volume,
+		          &cookie,
+		          &file_entry,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve next file entry.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		if( libfsxfs_file_entry_get_inode_number(
+		     file_entry,
+		     &inode_number,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve inode number.",
+			 function );
+
+			goto on_error;
+		}
+		fprintf(
+		 info_handle->notify_stream,
+		 "File entry: %" PRIu64 " information:\n",
+		 inode_number );
+
+		if( info_handle_file_entry_value_with_name_fprint(
 		     info_handle,
-		     file_entry_identifier,
+		     file_entry,
+		     NULL,
+		     0,
+		     NULL,
+		     0,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -2263,12 +2605,39 @@ int info_handle_file_entries_fprint(
 			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
 			 "%s: unable to print file entry: %" PRIu64 " information.",
 			 function,
-			 file_entry_identifier );
+			 inode_number );
 
-			return( -1 );
+			goto on_error;
+		}
+		if( libfsxfs_file_entry_free(
+		     &file_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file entry.",
+			 function );
+
+			goto on_error;
 		}
+		fprintf(
+		 info_handle->notify_stream,
+		 "\n" );
 	}
+	while( result != 0 );
+
 	return( 1 );
+
+on_error:
+	if( file_entry != NULL )
+	{
+		libfsxfs_file_entry_free(
+		 &file_entry,
+		 NULL );
+	}
+	return( -1 );
 }
 
 /* Prints the file entry information for a specific identifier
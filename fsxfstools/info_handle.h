@@ -133,6 +133,14 @@ int info_handle_file_entry_value_with_name_fprint(
      size_t file_entry_name_length,
      libcerror_error_t **error );
 
+int info_handle_file_system_hierarchy_fprint_sub_file_entry_name(
+     info_handle_t *info_handle,
+     libfsxfs_file_entry_t *file_entry,
+     int sub_file_entry_index,
+     const system_character_t *path,
+     size_t path_length,
+     libcerror_error_t **error );
+
 int info_handle_file_system_hierarchy_fprint_file_entry(
      info_handle_t *info_handle,
      libfsxfs_file_entry_t *file_entry,
@@ -34,6 +34,7 @@
 #include "fsxfstools_libfsxfs.h"
 #include "mount_file_entry.h"
 #include "mount_file_system.h"
+#include "mount_path_string.h"
 
 #if !defined( S_IFDIR )
 #define S_IFDIR 0x4000
@@ -898,6 +899,215 @@ on_error:
 	return( -1 );
 }
 
+/* Retrieves the next sub file entry
+ * The cookie is used to resume iterating the sub file entries, where 0 represents the first sub file entry
+ * Returns 1 if successful, 0 if there are no more sub file entries or -1 on error
+ */
+int mount_file_entry_get_next_sub_file_entry(
+     mount_file_entry_t *file_entry,
+     uint64_t *cookie,
+     mount_file_entry_t **sub_file_entry,
+     libcerror_error_t **error )
+{
+	libfsxfs_file_entry_t *sub_fsxfs_file_entry = NULL;
+	system_character_t *filename                  = NULL;
+	static char *function                         = "mount_file_entry_get_next_sub_file_entry";
+	size_t filename_size                          = 0;
+	int result                                    = 0;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( sub_file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sub file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *sub_file_entry != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid sub file entry value already set.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfsxfs_file_entry_get_next_sub_file_entry(
+	          file_entry->fsxfs_file_entry,
+	          cookie,
+	          &sub_fsxfs_file_entry,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve next sub file entry.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( mount_file_system_get_filename_from_file_entry(
+	     file_entry->file_system,
+	     sub_fsxfs_file_entry,
+	     &filename,
+	     &filename_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve filename of sub file entry.",
+		 function );
+
+		goto on_error;
+	}
+	if( mount_file_entry_initialize(
+	     sub_file_entry,
+	     file_entry->file_system,
+	     filename,
+	     filename_size - 1,
+	     sub_fsxfs_file_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize sub file entry.",
+		 function );
+
+		goto on_error;
+	}
+	if( filename != NULL )
+	{
+		memory_free(
+		 filename );
+	}
+	return( 1 );
+
+on_error:
+	if( filename != NULL )
+	{
+		memory_free(
+		 filename );
+	}
+	if( sub_fsxfs_file_entry != NULL )
+	{
+		libfsxfs_file_entry_free(
+		 &sub_fsxfs_file_entry,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the name and file type of the next sub file entry
+ * This does not read the inode of the sub file entry
+ * The cookie is used to resume iterating the sub file entries, where 0 represents the first sub file entry
+ * The file type is 0 if not stored in the directory entry
+ * Returns 1 if successful, 0 if there are no more sub file entries or -1 on error
+ */
+int mount_file_entry_get_next_sub_file_entry_name(
+     mount_file_entry_t *file_entry,
+     uint64_t *cookie,
+     system_character_t **name,
+     size_t *name_size,
+     uint16_t *file_type,
+     libcerror_error_t **error )
+{
+	/* A name is at most 255 bytes which in the worst case is 3 UTF-8 bytes per byte
+	 */
+	system_character_t file_entry_name[ 768 ];
+
+	static char *function = "mount_file_entry_get_next_sub_file_entry_name";
+	int result            = 0;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libfsxfs_file_entry_get_next_sub_file_entry_utf16_name(
+	          file_entry->fsxfs_file_entry,
+	          cookie,
+	          (uint16_t *) file_entry_name,
+	          sizeof( file_entry_name ) / sizeof( system_character_t ),
+	          file_type,
+	          error );
+#else
+	result = libfsxfs_file_entry_get_next_sub_file_entry_utf8_name(
+	          file_entry->fsxfs_file_entry,
+	          cookie,
+	          (uint8_t *) file_entry_name,
+	          sizeof( file_entry_name ) / sizeof( system_character_t ),
+	          file_type,
+	          error );
+#endif
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve next sub file entry name.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( mount_path_string_copy_from_file_entry_path(
+	     name,
+	     name_size,
+	     file_entry_name,
+	     system_string_length(
+	      file_entry_name ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy name from the sub file entry name.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
 /* Reads data at a specific offset
  * Returns the number of bytes read or -1 on error
  */
@@ -945,6 +1155,53 @@ ssize_t mount_file_entry_read_buffer_at_offset(
 	return( read_count );
 }
 
+/* Retrieves the next data range at or after a specific offset
+ * Returns 1 if successful, 0 if no data range was found or -1 on error
+ */
+int mount_file_entry_get_next_data_range(
+     mount_file_entry_t *file_entry,
+     off64_t offset,
+     off64_t *data_range_offset,
+     size64_t *data_range_size,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_file_entry_get_next_data_range";
+	int result            = 0;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfsxfs_file_entry_get_next_data_range(
+	          file_entry->fsxfs_file_entry,
+	          offset,
+	          data_range_offset,
+	          data_range_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve next data range at offset: %" PRIi64 " (0x%08" PRIx64 ") from file entry.",
+		 function,
+		 offset,
+		 offset );
+
+		return( -1 );
+	}
+	return( result );
+}
+
 /* Retrieves the size
  * Returns 1 if successful or -1 on error
  */
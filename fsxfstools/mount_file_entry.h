@@ -119,6 +119,20 @@ int mount_file_entry_get_sub_file_entry_by_index(
      mount_file_entry_t **sub_file_entry,
      libcerror_error_t **error );
 
+int mount_file_entry_get_next_sub_file_entry(
+     mount_file_entry_t *file_entry,
+     uint64_t *cookie,
+     mount_file_entry_t **sub_file_entry,
+     libcerror_error_t **error );
+
+int mount_file_entry_get_next_sub_file_entry_name(
+     mount_file_entry_t *file_entry,
+     uint64_t *cookie,
+     system_character_t **name,
+     size_t *name_size,
+     uint16_t *file_type,
+     libcerror_error_t **error );
+
 ssize_t mount_file_entry_read_buffer_at_offset(
          mount_file_entry_t *file_entry,
          void *buffer,
@@ -126,6 +140,13 @@ ssize_t mount_file_entry_read_buffer_at_offset(
          off64_t offset,
          libcerror_error_t **error );
 
+int mount_file_entry_get_next_data_range(
+     mount_file_entry_t *file_entry,
+     off64_t offset,
+     off64_t *data_range_offset,
+     size64_t *data_range_size,
+     libcerror_error_t **error );
+
 int mount_file_entry_get_size(
      mount_file_entry_t *file_entry,
      size64_t *size,
@@ -126,7 +126,9 @@ int mount_fuse_set_stat_info(
 }
 
 /* Fills a directory entry
- * Returns 1 if successful or -1 on error
+ * The next offset is the offset of the directory entry that follows
+ * The file type is used when no file entry is provided
+ * Returns 1 if successful, 0 if the buffer is full or -1 on error
  */
 int mount_fuse_filldir(
      void *buffer,
@@ -134,6 +136,8 @@ int mount_fuse_filldir(
      const char *name,
      struct stat *stat_info,
      mount_file_entry_t *file_entry,
+     uint16_t file_type,
+     off_t next_offset,
      libcerror_error_t **error )
 {
 	static char *function      = "mount_fuse_filldir";
@@ -227,6 +231,10 @@ int mount_fuse_filldir(
 			return( -1 );
 		}
 	}
+	else
+	{
+		file_mode = file_type;
+	}
 	if( memory_set(
 	     stat_info,
 	     0,
@@ -264,24 +272,17 @@ int mount_fuse_filldir(
 	     buffer,
 	     name,
 	     stat_info,
-	     0,
+	     next_offset,
 	     0 ) == 1 )
 #else
 	if( filler(
 	     buffer,
 	     name,
 	     stat_info,
-	     0 ) == 1 )
+	     next_offset ) == 1 )
 #endif
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set directory entry.",
-		 function );
-
-		return( -1 );
+		return( 0 );
 	}
 	return( 1 );
 }
@@ -498,6 +499,163 @@ on_error:
 	return( result );
 }
 
+#if defined( MOUNT_FUSE_HAVE_LSEEK )
+
+/* Seeks the next data or hole offset
+ * Only SEEK_DATA and SEEK_HOLE are passed to this function
+ * Returns the resulting offset if successful or a negative errno value otherwise
+ */
+off_t mount_fuse_lseek(
+       const char *path,
+       off_t offset,
+       int whence,
+       struct fuse_file_info *file_info )
+{
+	libcerror_error_t *error       = NULL;
+	mount_file_entry_t *file_entry = NULL;
+	static char *function          = "mount_fuse_lseek";
+	size64_t data_range_size       = 0;
+	size64_t size                  = 0;
+	off64_t data_range_offset      = 0;
+	int result                     = 0;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: %s\n",
+		 function,
+		 path );
+	}
+#endif
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		result = -EINVAL;
+
+		goto on_error;
+	}
+	if( ( whence != SEEK_DATA )
+	 && ( whence != SEEK_HOLE ) )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported whence.",
+		 function );
+
+		result = -EINVAL;
+
+		goto on_error;
+	}
+	if( file_info == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file information.",
+		 function );
+
+		result = -EINVAL;
+
+		goto on_error;
+	}
+	if( file_info->fh == (uint64_t) NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file information - missing file handle.",
+		 function );
+
+		result = -EINVAL;
+
+		goto on_error;
+	}
+	file_entry = (mount_file_entry_t *) file_info->fh;
+
+	if( mount_file_entry_get_size(
+	     file_entry,
+	     &size,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file entry size.",
+		 function );
+
+		result = -EIO;
+
+		goto on_error;
+	}
+	/* Offsets at or beyond the end of the data have neither data nor holes
+	 */
+	if( ( offset < 0 )
+	 || ( (size64_t) offset >= size ) )
+	{
+		return( -ENXIO );
+	}
+	result = mount_file_entry_get_next_data_range(
+	          file_entry,
+	          (off64_t) offset,
+	          &data_range_offset,
+	          &data_range_size,
+	          &error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve next data range.",
+		 function );
+
+		result = -EIO;
+
+		goto on_error;
+	}
+	if( whence == SEEK_DATA )
+	{
+		if( result == 0 )
+		{
+			return( -ENXIO );
+		}
+		return( (off_t) data_range_offset );
+	}
+	/* The end of the data is considered an implicit hole
+	 */
+	if( ( result == 0 )
+	 || ( data_range_offset > (off64_t) offset ) )
+	{
+		return( offset );
+	}
+	return( (off_t) ( data_range_offset + data_range_size ) );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	return( (off_t) result );
+}
+
+#endif /* defined( MOUNT_FUSE_HAVE_LSEEK ) */
+
 /* Releases a file entry
  * Returns 0 if successful or a negative errno value otherwise
  */
@@ -1150,6 +1308,9 @@ on_error:
 }
 
 /* Reads a directory
+ * The offset is used to resume reading the directory, where offset 1 and 2
+ * refer to the self and parent directory entries and other offsets refer to
+ * the cookie of the sub file entries
  * Returns 0 if successful or a negative errno value otherwise
  */
 #if defined( HAVE_LIBFUSE3 )
@@ -1157,7 +1318,7 @@ int mount_fuse_readdir(
      const char *path,
      void *buffer,
      fuse_fill_dir_t filler,
-     off_t offset FSXFSTOOLS_ATTRIBUTE_UNUSED,
+     off_t offset,
      struct fuse_file_info *file_info FSXFSTOOLS_ATTRIBUTE_UNUSED,
      enum fuse_readdir_flags flags FSXFSTOOLS_ATTRIBUTE_UNUSED )
 #else
@@ -1165,7 +1326,7 @@ int mount_fuse_readdir(
      const char *path,
      void *buffer,
      fuse_fill_dir_t filler,
-     off_t offset FSXFSTOOLS_ATTRIBUTE_UNUSED,
+     off_t offset,
      struct fuse_file_info *file_info FSXFSTOOLS_ATTRIBUTE_UNUSED )
 #endif
 {
@@ -1175,11 +1336,10 @@ int mount_fuse_readdir(
 	static char *function              = "mount_fuse_readdir";
 	char *name                         = NULL;
 	size_t name_size                   = 0;
-	int number_of_sub_file_entries     = 0;
+	uint64_t cookie                    = 0;
+	uint64_t previous_cookie           = 0;
+	uint16_t file_type                 = 0;
 	int result                         = 0;
-	int sub_file_entry_index           = 0;
-
-	FSXFSTOOLS_UNREFERENCED_PARAMETER( offset )
 
 #if defined( HAVE_LIBFUSE3 )
 	FSXFSTOOLS_UNREFERENCED_PARAMETER( flags )
@@ -1249,140 +1409,143 @@ int mount_fuse_readdir(
 
 		goto on_error;
 	}
-	if( mount_fuse_filldir(
-	     buffer,
-	     filler,
-	     ".",
-	     stat_info,
-	     (mount_file_entry_t *) file_info->fh,
-	     &error ) != 1 )
-	{
-		libcerror_error_set(
-		 &error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set self directory entry.",
-		 function );
-
-		result = -EIO;
-
-		goto on_error;
-	}
-	if( mount_fuse_filldir(
-	     buffer,
-	     filler,
-	     "..",
-	     stat_info,
-	     NULL,
-	     &error ) != 1 )
-	{
-		libcerror_error_set(
-		 &error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set parent directory entry.",
-		 function );
-
-		result = -EIO;
-
-		goto on_error;
-	}
-	if( mount_file_entry_get_number_of_sub_file_entries(
-	     (mount_file_entry_t *) file_info->fh,
-	     &number_of_sub_file_entries,
-	     &error ) != 1 )
+	if( offset < 1 )
 	{
-		libcerror_error_set(
-		 &error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of sub file entries.",
-		 function );
-
-		result = -EIO;
+		result = mount_fuse_filldir(
+		          buffer,
+		          filler,
+		          ".",
+		          stat_info,
+		          (mount_file_entry_t *) file_info->fh,
+		          0,
+		          1,
+		          &error );
 
-		goto on_error;
-	}
-	for( sub_file_entry_index = 0;
-	     sub_file_entry_index < number_of_sub_file_entries;
-	     sub_file_entry_index++ )
-	{
-		if( mount_file_entry_get_sub_file_entry_by_index(
-		     (mount_file_entry_t *) file_info->fh,
-		     sub_file_entry_index,
-		     &sub_file_entry,
-		     &error ) != 1 )
+		if( result == -1 )
 		{
 			libcerror_error_set(
 			 &error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve sub file entry: %d.",
-			 function,
-			 sub_file_entry_index );
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set self directory entry.",
+			 function );
 
 			result = -EIO;
 
 			goto on_error;
 		}
-		if( mount_file_entry_get_name_size(
-		     sub_file_entry,
-		     &name_size,
-		     &error ) != 1 )
+		else if( result == 0 )
 		{
-			libcerror_error_set(
-			 &error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve sub file entry: %d name size.",
-			 function,
-			 sub_file_entry_index );
-
-			result = -EIO;
+			memory_free(
+			 stat_info );
 
-			goto on_error;
+			return( 0 );
 		}
-		name = narrow_string_allocate(
-		        name_size );
+	}
+	if( offset < 2 )
+	{
+		result = mount_fuse_filldir(
+		          buffer,
+		          filler,
+		          "..",
+		          stat_info,
+		          NULL,
+		          0,
+		          2,
+		          &error );
 
-		if( name == NULL )
+		if( result == -1 )
 		{
 			libcerror_error_set(
 			 &error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to create sub file entry: %d name.",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set parent directory entry.",
 			 function );
 
 			result = -EIO;
 
 			goto on_error;
 		}
-		if( mount_file_entry_get_name(
-		     sub_file_entry,
-		     name,
-		     name_size,
-		     &error ) != 1 )
+		else if( result == 0 )
+		{
+			memory_free(
+			 stat_info );
+
+			return( 0 );
+		}
+	}
+	if( offset > 2 )
+	{
+		cookie = (uint64_t) offset - 2;
+	}
+	do
+	{
+		previous_cookie = cookie;
+
+		result = mount_file_entry_get_next_sub_file_entry_name(
+		          (mount_file_entry_t *) file_info->fh,
+		          &cookie,
+		          &name,
+		          &name_size,
+		          &file_type,
+		          &error );
+
+		if( result == -1 )
 		{
 			libcerror_error_set(
 			 &error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve sub file entry: %d name.",
-			 function,
-			 sub_file_entry_index );
+			 "%s: unable to retrieve next sub file entry name.",
+			 function );
 
 			result = -EIO;
 
 			goto on_error;
 		}
-		if( mount_fuse_filldir(
-		     buffer,
-		     filler,
-		     name,
-		     stat_info,
-		     sub_file_entry,
-		     &error ) != 1 )
+		else if( result == 0 )
+		{
+			break;
+		}
+		/* Only read the inode of the sub file entry if the directory entry
+		 * does not contain the file type
+		 */
+		if( file_type == 0 )
+		{
+			cookie = previous_cookie;
+
+			if( mount_file_entry_get_next_sub_file_entry(
+			     (mount_file_entry_t *) file_info->fh,
+			     &cookie,
+			     &sub_file_entry,
+			     &error ) != 1 )
+			{
+				libcerror_error_set(
+				 &error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve next sub file entry.",
+				 function );
+
+				result = -EIO;
+
+				goto on_error;
+			}
+		}
+		/* The offset of the next directory entry is the cookie of the next sub file entry
+		 */
+		result = mount_fuse_filldir(
+		          buffer,
+		          filler,
+		          name,
+		          stat_info,
+		          sub_file_entry,
+		          file_type,
+		          (off_t) ( cookie + 2 ),
+		          &error );
+
+		if( result == -1 )
 		{
 			libcerror_error_set(
 			 &error,
@@ -1400,23 +1563,27 @@ int mount_fuse_readdir(
 
 		name = NULL;
 
-		if( mount_file_entry_free(
-		     &sub_file_entry,
-		     &error ) != 1 )
+		if( sub_file_entry != NULL )
 		{
-			libcerror_error_set(
-			 &error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free sub file entry: %d.",
-			 function,
-			 sub_file_entry_index );
+			if( mount_file_entry_free(
+			     &sub_file_entry,
+			     &error ) != 1 )
+			{
+				libcerror_error_set(
+				 &error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free sub file entry.",
+				 function );
 
-			result = -EIO;
+				result = -EIO;
 
-			goto on_error;
+				goto on_error;
+			}
 		}
 	}
+	while( result == 1 );
+
 	memory_free(
 	 stat_info );
 
@@ -45,6 +45,12 @@
 #include <osxfuse/fuse.h>
 #endif
 
+/* The lseek operation is supported as of libfuse 3.8
+ */
+#if defined( HAVE_LIBFUSE3 ) && defined( SEEK_DATA ) && defined( SEEK_HOLE ) && defined( FUSE_MINOR_VERSION ) && ( FUSE_MINOR_VERSION >= 8 )
+#define MOUNT_FUSE_HAVE_LSEEK	1
+#endif
+
 #endif /* defined( HAVE_LIBFUSE ) || defined( HAVE_LIBFUSE3 ) || defined( HAVE_LIBOSXFUSE ) */
 
 #include "fsxfstools_libcerror.h"
@@ -73,6 +79,8 @@ int mount_fuse_filldir(
      const char *name,
      struct stat *stat_info,
      mount_file_entry_t *file_entry,
+     uint16_t file_type,
+     off_t next_offset,
      libcerror_error_t **error );
 
 int mount_fuse_open(
@@ -86,6 +94,14 @@ int mount_fuse_read(
      off_t offset,
      struct fuse_file_info *file_info );
 
+#if defined( MOUNT_FUSE_HAVE_LSEEK )
+off_t mount_fuse_lseek(
+       const char *path,
+       off_t offset,
+       int whence,
+       struct fuse_file_info *file_info );
+#endif
+
 int mount_fuse_release(
      const char *path,
      struct fuse_file_info *file_info );
@@ -0,0 +1,1907 @@
+/*
+ * Verify handle
+ *
+ * Copyright (C) 2020-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+#include <wide_string.h>
+
+#if defined( HAVE_SYS_TIME_H )
+#include <sys/time.h>
+#endif
+
+#include <time.h>
+
+#include "fsxfstools_libbfio.h"
+#include "fsxfstools_libcerror.h"
+#include "fsxfstools_libcnotify.h"
+#include "fsxfstools_libcthreads.h"
+#include "fsxfstools_libfsxfs.h"
+#include "verify_handle.h"
+
+#if !defined( LIBFSXFS_HAVE_BFIO )
+
+extern \
+int libfsxfs_volume_open_file_io_handle(
+     libfsxfs_volume_t *volume,
+     libbfio_handle_t *file_io_handle,
+     int access_flags,
+     libfsxfs_error_t **error );
+
+#endif /* !defined( LIBFSXFS_HAVE_BFIO ) */
+
+#define VERIFY_HANDLE_NOTIFY_STREAM	stdout
+#define VERIFY_HANDLE_ERROR_STREAM	stderr
+
+/* Copies a string of a decimal value to a 64-bit value
+ * Returns 1 if successful or -1 on error
+ */
+int verify_handle_system_string_copy_from_64_bit_in_decimal(
+     const system_character_t *string,
+     size_t string_size,
+     uint64_t *value_64bit,
+     libcerror_error_t **error )
+{
+	static char *function              = "verify_handle_system_string_copy_from_64_bit_in_decimal";
+	size_t string_index                = 0;
+	system_character_t character_value = 0;
+	uint8_t maximum_string_index       = 20;
+	int8_t sign                        = 1;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_64bit == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value 64-bit.",
+		 function );
+
+		return( -1 );
+	}
+	*value_64bit = 0;
+
+	if( string[ string_index ] == (system_character_t) '-' )
+	{
+		string_index++;
+		maximum_string_index++;
+
+		sign = -1;
+	}
+	else if( string[ string_index ] == (system_character_t) '+' )
+	{
+		string_index++;
+		maximum_string_index++;
+	}
+	while( string_index < string_size )
+	{
+		if( string[ string_index ] == 0 )
+		{
+			break;
+		}
+		if( string_index > (size_t) maximum_string_index )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_LARGE,
+			 "%s: string too large.",
+			 function );
+
+			return( -1 );
+		}
+		*value_64bit *= 10;
+
+		if( ( string[ string_index ] >= (system_character_t) '0' )
+		 && ( string[ string_index ] <= (system_character_t) '9' ) )
+		{
+			character_value = (system_character_t) ( string[ string_index ] - (system_character_t) '0' );
+		}
+		else
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported character value: %" PRIc_SYSTEM " at index: %d.",
+			 function,
+			 string[ string_index ],
+			 string_index );
+
+			return( -1 );
+		}
+		*value_64bit += character_value;
+
+		string_index++;
+	}
+	if( sign == -1 )
+	{
+		*value_64bit *= (uint64_t) -1;
+	}
+	return( 1 );
+}
+
+/* Creates a verify handle
+ * Make sure the value verify_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int verify_handle_initialize(
+     verify_handle_t **verify_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "verify_handle_initialize";
+
+	if( verify_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verify handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *verify_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid verify handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*verify_handle = memory_allocate_structure(
+	                  verify_handle_t );
+
+	if( *verify_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create verify handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *verify_handle,
+	     0,
+	     sizeof( verify_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear verify handle.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *verify_handle )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	( *verify_handle )->number_of_threads = VERIFY_HANDLE_DEFAULT_NUMBER_OF_THREADS;
+	( *verify_handle )->notify_stream     = VERIFY_HANDLE_NOTIFY_STREAM;
+	( *verify_handle )->error_stream      = VERIFY_HANDLE_ERROR_STREAM;
+
+	return( 1 );
+
+on_error:
+	if( *verify_handle != NULL )
+	{
+		memory_free(
+		 *verify_handle );
+
+		*verify_handle = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a verify handle
+ * Returns 1 if successful or -1 on error
+ */
+int verify_handle_free(
+     verify_handle_t **verify_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "verify_handle_free";
+	int result            = 1;
+
+	if( verify_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verify handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *verify_handle != NULL )
+	{
+		if( ( *verify_handle )->workers != NULL )
+		{
+			if( verify_handle_close_input(
+			     *verify_handle,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close input.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *verify_handle )->allocation_group_statuses != NULL )
+		{
+			memory_free(
+			 ( *verify_handle )->allocation_group_statuses );
+		}
+		if( ( *verify_handle )->allocation_group_number_of_inodes != NULL )
+		{
+			memory_free(
+			 ( *verify_handle )->allocation_group_number_of_inodes );
+		}
+		if( ( *verify_handle )->allocation_group_metadata_sizes != NULL )
+		{
+			memory_free(
+			 ( *verify_handle )->allocation_group_metadata_sizes );
+		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_free(
+		     &( ( *verify_handle )->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		memory_free(
+		 *verify_handle );
+
+		*verify_handle = NULL;
+	}
+	return( result );
+}
+
+/* Signals the verify handle to abort
+ * Returns 1 if successful or -1 on error
+ */
+int verify_handle_signal_abort(
+     verify_handle_t *verify_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "verify_handle_signal_abort";
+	int worker_index      = 0;
+
+	if( verify_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verify handle.",
+		 function );
+
+		return( -1 );
+	}
+	verify_handle->abort = 1;
+
+	if( verify_handle->workers != NULL )
+	{
+		for( worker_index = 0;
+		     worker_index < verify_handle->number_of_workers;
+		     worker_index++ )
+		{
+			if( verify_handle->workers[ worker_index ].input_volume == NULL )
+			{
+				continue;
+			}
+			if( libfsxfs_volume_signal_abort(
+			     verify_handle->workers[ worker_index ].input_volume,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to signal input volume: %d to abort.",
+				 function,
+				 worker_index );
+
+				return( -1 );
+			}
+		}
+	}
+	return( 1 );
+}
+
+/* Sets the volume offset
+ * Returns 1 if successful or -1 on error
+ */
+int verify_handle_set_volume_offset(
+     verify_handle_t *verify_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "verify_handle_set_volume_offset";
+	size_t string_length  = 0;
+	uint64_t value_64bit  = 0;
+
+	if( verify_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verify handle.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( verify_handle_system_string_copy_from_64_bit_in_decimal(
+	     string,
+	     string_length + 1,
+	     &value_64bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy string to 64-bit decimal.",
+		 function );
+
+		return( -1 );
+	}
+	verify_handle->volume_offset = (off64_t) value_64bit;
+
+	return( 1 );
+}
+
+/* Sets the number of worker threads
+ * Returns 1 if successful or -1 on error
+ */
+int verify_handle_set_number_of_threads(
+     verify_handle_t *verify_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "verify_handle_set_number_of_threads";
+	size_t string_length  = 0;
+	uint64_t value_64bit  = 0;
+
+	if( verify_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verify handle.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( verify_handle_system_string_copy_from_64_bit_in_decimal(
+	     string,
+	     string_length + 1,
+	     &value_64bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy string to 64-bit decimal.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( value_64bit == 0 )
+	 || ( value_64bit > (uint64_t) VERIFY_HANDLE_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	verify_handle->number_of_threads = (int) value_64bit;
+
+	return( 1 );
+}
+
+/* Opens the input for a specific worker
+ * Returns 1 if successful or -1 on error
+ */
+int verify_handle_open_worker_input(
+     verify_handle_t *verify_handle,
+     verify_handle_worker_t *worker,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function  = "verify_handle_open_worker_input";
+	size_t filename_length = 0;
+
+	if( verify_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verify handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid worker.",
+		 function );
+
+		return( -1 );
+	}
+	filename_length = system_string_length(
+	                   filename );
+
+	if( libbfio_file_range_initialize(
+	     &( worker->input_file_io_handle ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize input file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libbfio_file_range_set_name_wide(
+	     worker->input_file_io_handle,
+	     filename,
+	     filename_length,
+	     error ) != 1 )
+#else
+	if( libbfio_file_range_set_name(
+	     worker->input_file_io_handle,
+	     filename,
+	     filename_length,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set file name.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_file_range_set(
+	     worker->input_file_io_handle,
+	     verify_handle->volume_offset,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set range.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsxfs_volume_initialize(
+	     &( worker->input_volume ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize input volume.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsxfs_volume_set_verify_checksums(
+	     worker->input_volume,
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to enable checksum verification.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsxfs_volume_open_file_io_handle(
+	     worker->input_volume,
+	     worker->input_file_io_handle,
+	     LIBFSXFS_OPEN_READ,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open input volume.",
+		 function );
+
+		goto on_error;
+	}
+	worker->verify_handle = verify_handle;
+
+	return( 1 );
+
+on_error:
+	if( worker->input_volume != NULL )
+	{
+		libfsxfs_volume_free(
+		 &( worker->input_volume ),
+		 NULL );
+	}
+	if( worker->input_file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &( worker->input_file_io_handle ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Opens the input
+ * Every worker opens its own input file IO handle and volume
+ * Returns 1 if successful or -1 on error
+ */
+int verify_handle_open_input(
+     verify_handle_t *verify_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function                = "verify_handle_open_input";
+	size_t workers_size                  = 0;
+	uint32_t number_of_allocation_groups = 0;
+	int number_of_workers                = 0;
+	int worker_index                     = 0;
+
+	if( verify_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verify handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( verify_handle->workers != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid verify handle - workers value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( verify_handle->allocation_group_statuses != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid verify handle - allocation group statuses value already set.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	number_of_workers = verify_handle->number_of_threads;
+#else
+	number_of_workers = 1;
+#endif
+	workers_size = sizeof( verify_handle_worker_t ) * number_of_workers;
+
+	verify_handle->workers = (verify_handle_worker_t *) memory_allocate(
+	                                                     workers_size );
+
+	if( verify_handle->workers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create workers.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     verify_handle->workers,
+	     0,
+	     workers_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear workers.",
+		 function );
+
+		goto on_error;
+	}
+	/* Open the first worker to determine the number of allocation groups
+	 */
+	if( verify_handle_open_worker_input(
+	     verify_handle,
+	     &( verify_handle->workers[ 0 ] ),
+	     filename,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open input of worker: 0.",
+		 function );
+
+		goto on_error;
+	}
+	verify_handle->number_of_workers = 1;
+
+	if( libfsxfs_volume_get_number_of_allocation_groups(
+	     verify_handle->workers[ 0 ].input_volume,
+	     &number_of_allocation_groups,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of allocation groups.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_allocation_groups == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of allocation groups value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	/* There is no need for more workers than allocation groups
+	 */
+	if( (uint32_t) number_of_workers > number_of_allocation_groups )
+	{
+		number_of_workers = (int) number_of_allocation_groups;
+	}
+	for( worker_index = 1;
+	     worker_index < number_of_workers;
+	     worker_index++ )
+	{
+		if( verify_handle_open_worker_input(
+		     verify_handle,
+		     &( verify_handle->workers[ worker_index ] ),
+		     filename,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open input of worker: %d.",
+			 function,
+			 worker_index );
+
+			goto on_error;
+		}
+		verify_handle->number_of_workers += 1;
+	}
+	verify_handle->allocation_group_statuses = (uint8_t *) memory_allocate(
+	                                                        sizeof( uint8_t ) * number_of_allocation_groups );
+
+	if( verify_handle->allocation_group_statuses == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create allocation group statuses.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     verify_handle->allocation_group_statuses,
+	     VERIFY_HANDLE_ALLOCATION_GROUP_STATUS_NOT_VERIFIED,
+	     sizeof( uint8_t ) * number_of_allocation_groups ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear allocation group statuses.",
+		 function );
+
+		goto on_error;
+	}
+	verify_handle->allocation_group_number_of_inodes = (uint64_t *) memory_allocate(
+	                                                                 sizeof( uint64_t ) * number_of_allocation_groups );
+
+	if( verify_handle->allocation_group_number_of_inodes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create allocation group number of inodes.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     verify_handle->allocation_group_number_of_inodes,
+	     0,
+	     sizeof( uint64_t ) * number_of_allocation_groups ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear allocation group number of inodes.",
+		 function );
+
+		goto on_error;
+	}
+	verify_handle->allocation_group_metadata_sizes = (uint64_t *) memory_allocate(
+	                                                               sizeof( uint64_t ) * number_of_allocation_groups );
+
+	if( verify_handle->allocation_group_metadata_sizes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create allocation group metadata sizes.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     verify_handle->allocation_group_metadata_sizes,
+	     0,
+	     sizeof( uint64_t ) * number_of_allocation_groups ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear allocation group metadata sizes.",
+		 function );
+
+		goto on_error;
+	}
+	verify_handle->number_of_allocation_groups = number_of_allocation_groups;
+	verify_handle->next_allocation_group_index = 0;
+
+	return( 1 );
+
+on_error:
+	if( verify_handle->allocation_group_metadata_sizes != NULL )
+	{
+		memory_free(
+		 verify_handle->allocation_group_metadata_sizes );
+
+		verify_handle->allocation_group_metadata_sizes = NULL;
+	}
+	if( verify_handle->allocation_group_number_of_inodes != NULL )
+	{
+		memory_free(
+		 verify_handle->allocation_group_number_of_inodes );
+
+		verify_handle->allocation_group_number_of_inodes = NULL;
+	}
+	if( verify_handle->allocation_group_statuses != NULL )
+	{
+		memory_free(
+		 verify_handle->allocation_group_statuses );
+
+		verify_handle->allocation_group_statuses = NULL;
+	}
+	if( verify_handle->workers != NULL )
+	{
+		verify_handle_close_input(
+		 verify_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Closes the input
+ * Returns the 0 if succesful or -1 on error
+ */
+int verify_handle_close_input(
+     verify_handle_t *verify_handle,
+     libcerror_error_t **error )
+{
+	verify_handle_worker_t *worker = NULL;
+	static char *function          = "verify_handle_close_input";
+	int result                     = 0;
+	int worker_index               = 0;
+
+	if( verify_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verify handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( verify_handle->workers == NULL )
+	{
+		return( 0 );
+	}
+	for( worker_index = 0;
+	     worker_index < verify_handle->number_of_workers;
+	     worker_index++ )
+	{
+		worker = &( verify_handle->workers[ worker_index ] );
+
+		if( worker->input_volume != NULL )
+		{
+			if( libfsxfs_volume_close(
+			     worker->input_volume,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close input volume of worker: %d.",
+				 function,
+				 worker_index );
+
+				result = -1;
+			}
+			if( libfsxfs_volume_free(
+			     &( worker->input_volume ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free input volume of worker: %d.",
+				 function,
+				 worker_index );
+
+				result = -1;
+			}
+		}
+		if( worker->input_file_io_handle != NULL )
+		{
+			if( libbfio_handle_free(
+			     &( worker->input_file_io_handle ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free input file IO handle of worker: %d.",
+				 function,
+				 worker_index );
+
+				result = -1;
+			}
+		}
+	}
+	memory_free(
+	 verify_handle->workers );
+
+	verify_handle->workers           = NULL;
+	verify_handle->number_of_workers = 0;
+
+	return( result );
+}
+
+/* Retrieves the current time in nano seconds
+ * The value is only used to determine elapsed time
+ * Returns 1 if successful or -1 on error
+ */
+int verify_handle_get_current_time(
+     uint64_t *current_time,
+     libcerror_error_t **error )
+{
+#if defined( WINAPI )
+	FILETIME filetime;
+
+#elif defined( HAVE_CLOCK_GETTIME )
+	struct timespec time_structure;
+#endif
+
+	static char *function = "verify_handle_get_current_time";
+
+#if !defined( WINAPI ) && !defined( HAVE_CLOCK_GETTIME )
+	int64_t timestamp     = 0;
+#endif
+
+	if( current_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid current time.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI )
+	GetSystemTimeAsFileTime(
+	 &filetime );
+
+	*current_time = ( ( (uint64_t) filetime.dwHighDateTime << 32 ) | filetime.dwLowDateTime ) * 100;
+
+#elif defined( HAVE_CLOCK_GETTIME )
+	if( clock_gettime(
+	     CLOCK_MONOTONIC,
+	     &time_structure ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve current time structure.",
+		 function );
+
+		return( -1 );
+	}
+	*current_time = ( (uint64_t) time_structure.tv_sec * 1000000000 ) + time_structure.tv_nsec;
+
+#else
+	timestamp = (int64_t) time( NULL );
+
+	if( timestamp == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve current time.",
+		 function );
+
+		return( -1 );
+	}
+	*current_time = (uint64_t) timestamp * 1000000000;
+
+#endif /* defined( WINAPI ) */
+
+	return( 1 );
+}
+
+/* Retrieves the index of the next allocation group to verify
+ * Returns 1 if successful, 0 if no more allocation groups are available or -1 on error
+ */
+int verify_handle_get_next_allocation_group_index(
+     verify_handle_t *verify_handle,
+     uint32_t *allocation_group_index,
+     libcerror_error_t **error )
+{
+	static char *function = "verify_handle_get_next_allocation_group_index";
+	int result            = 0;
+
+	if( verify_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verify handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( allocation_group_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid allocation group index.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     verify_handle->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( ( verify_handle->abort == 0 )
+	 && ( verify_handle->next_allocation_group_index < verify_handle->number_of_allocation_groups ) )
+	{
+		*allocation_group_index = verify_handle->next_allocation_group_index;
+
+		verify_handle->next_allocation_group_index += 1;
+
+		result = 1;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     verify_handle->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Verifies a specific allocation group
+ * A failed verification is recorded in the allocation group status and
+ * reported on the error stream, it is not considered an error of this function
+ * Returns 1 if successful or -1 on error
+ */
+int verify_handle_verify_allocation_group(
+     verify_handle_t *verify_handle,
+     libfsxfs_volume_t *volume,
+     uint32_t allocation_group_index,
+     libcerror_error_t **error )
+{
+	libfsxfs_error_t *verify_error = NULL;
+	static char *function          = "verify_handle_verify_allocation_group";
+	uint64_t metadata_size         = 0;
+	uint64_t number_of_inodes      = 0;
+
+	if( verify_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verify handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( verify_handle->allocation_group_statuses == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid verify handle - missing allocation group statuses.",
+		 function );
+
+		return( -1 );
+	}
+	if( allocation_group_index >= verify_handle->number_of_allocation_groups )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid allocation group index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsxfs_volume_verify_allocation_group(
+	     volume,
+	     allocation_group_index,
+	     &number_of_inodes,
+	     &metadata_size,
+	     &verify_error ) == 1 )
+	{
+		verify_handle->allocation_group_statuses[ allocation_group_index ]         = VERIFY_HANDLE_ALLOCATION_GROUP_STATUS_VERIFIED;
+		verify_handle->allocation_group_number_of_inodes[ allocation_group_index ] = number_of_inodes;
+		verify_handle->allocation_group_metadata_sizes[ allocation_group_index ]   = metadata_size;
+
+		return( 1 );
+	}
+	/* An allocation group interrupted by an abort is left as not verified
+	 */
+	if( verify_handle->abort != 0 )
+	{
+		libcerror_error_free(
+		 &verify_error );
+
+		return( 1 );
+	}
+	verify_handle->allocation_group_statuses[ allocation_group_index ] = VERIFY_HANDLE_ALLOCATION_GROUP_STATUS_FAILED;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     verify_handle->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		libcerror_error_free(
+		 &verify_error );
+
+		return( -1 );
+	}
+#endif
+	fprintf(
+	 verify_handle->error_stream,
+	 "Allocation group: %" PRIu32 " failed verification.\n",
+	 allocation_group_index );
+
+	libcerror_error_backtrace_fprint(
+	 verify_error,
+	 verify_handle->error_stream );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     verify_handle->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		libcerror_error_free(
+		 &verify_error );
+
+		return( -1 );
+	}
+#endif
+	libcerror_error_free(
+	 &verify_error );
+
+	return( 1 );
+}
+
+/* Runs a worker
+ * The worker verifies allocation groups until no more are available
+ * Returns 1 if successful or -1 on error
+ */
+int verify_handle_worker_run(
+     verify_handle_worker_t *worker )
+{
+	libcerror_error_t *error        = NULL;
+	static char *function           = "verify_handle_worker_run";
+	uint32_t allocation_group_index = 0;
+	int result                      = 0;
+
+	if( worker == NULL )
+	{
+		return( -1 );
+	}
+	do
+	{
+		result = verify_handle_get_next_allocation_group_index(
+		          worker->verify_handle,
+		          &allocation_group_index,
+		          &error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve next allocation group index.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			if( verify_handle_verify_allocation_group(
+			     worker->verify_handle,
+			     worker->input_volume,
+			     allocation_group_index,
+			     &error ) != 1 )
+			{
+				libcerror_error_set(
+				 &error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to verify allocation group: %" PRIu32 ".",
+				 function,
+				 allocation_group_index );
+
+				goto on_error;
+			}
+		}
+	}
+	while( result != 0 );
+
+	worker->result = 1;
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	worker->result = -1;
+
+	return( -1 );
+}
+
+/* Verifies the volume
+ * The allocation groups are distributed over the workers
+ * Returns 1 if successful or -1 on error
+ */
+int verify_handle_verify_volume(
+     verify_handle_t *verify_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "verify_handle_verify_volume";
+	uint64_t end_time     = 0;
+	uint64_t start_time   = 0;
+	int result            = 1;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	int worker_index      = 0;
+#endif
+
+	if( verify_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verify handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( verify_handle->workers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid verify handle - missing workers.",
+		 function );
+
+		return( -1 );
+	}
+	if( verify_handle_get_current_time(
+	     &start_time,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve start time.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( verify_handle->number_of_workers > 1 )
+	{
+		for( worker_index = 0;
+		     worker_index < verify_handle->number_of_workers;
+		     worker_index++ )
+		{
+			if( libcthreads_thread_create(
+			     &( verify_handle->workers[ worker_index ].thread ),
+			     NULL,
+			     (int (*)(void *)) &verify_handle_worker_run,
+			     (void *) &( verify_handle->workers[ worker_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create thread of worker: %d.",
+				 function,
+				 worker_index );
+
+				/* Stop the workers that were already started
+				 */
+				verify_handle->abort = 1;
+
+				result = -1;
+
+				break;
+			}
+		}
+		while( worker_index > 0 )
+		{
+			worker_index--;
+
+			if( libcthreads_thread_join(
+			     &( verify_handle->workers[ worker_index ].thread ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to join thread of worker: %d.",
+				 function,
+				 worker_index );
+
+				result = -1;
+			}
+			else if( verify_handle->workers[ worker_index ].result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to run worker: %d.",
+				 function,
+				 worker_index );
+
+				result = -1;
+			}
+		}
+	}
+	else
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+	if( verify_handle_worker_run(
+	     &( verify_handle->workers[ 0 ] ) ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to run worker: 0.",
+		 function );
+
+		result = -1;
+	}
+	if( verify_handle_get_current_time(
+	     &end_time,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve end time.",
+		 function );
+
+		return( -1 );
+	}
+	if( end_time > start_time )
+	{
+		verify_handle->elapsed_time = end_time - start_time;
+	}
+	return( result );
+}
+
+/* Retrieves the totals of the verification
+ * Returns 1 if successful or -1 on error
+ */
+int verify_handle_get_totals(
+     verify_handle_t *verify_handle,
+     uint32_t *number_of_verified,
+     uint32_t *number_of_failed,
+     uint32_t *number_of_not_verified,
+     uint64_t *number_of_inodes,
+     uint64_t *metadata_size,
+     libcerror_error_t **error )
+{
+	static char *function           = "verify_handle_get_totals";
+	uint32_t allocation_group_index = 0;
+
+	if( verify_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verify handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( verify_handle->allocation_group_statuses == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid verify handle - missing allocation group statuses.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_verified == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of verified.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_failed == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of failed.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_not_verified == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of not verified.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_inodes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of inodes.",
+		 function );
+
+		return( -1 );
+	}
+	if( metadata_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid metadata size.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_verified     = 0;
+	*number_of_failed       = 0;
+	*number_of_not_verified = 0;
+	*number_of_inodes       = 0;
+	*metadata_size          = 0;
+
+	for( allocation_group_index = 0;
+	     allocation_group_index < verify_handle->number_of_allocation_groups;
+	     allocation_group_index++ )
+	{
+		if( verify_handle->allocation_group_statuses[ allocation_group_index ] == VERIFY_HANDLE_ALLOCATION_GROUP_STATUS_VERIFIED )
+		{
+			*number_of_verified += 1;
+		}
+		else if( verify_handle->allocation_group_statuses[ allocation_group_index ] == VERIFY_HANDLE_ALLOCATION_GROUP_STATUS_FAILED )
+		{
+			*number_of_failed += 1;
+		}
+		else
+		{
+			*number_of_not_verified += 1;
+		}
+		*number_of_inodes += verify_handle->allocation_group_number_of_inodes[ allocation_group_index ];
+		*metadata_size    += verify_handle->allocation_group_metadata_sizes[ allocation_group_index ];
+	}
+	return( 1 );
+}
+
+/* Prints the verification summary
+ * Returns 1 if successful or -1 on error
+ */
+int verify_handle_summary_fprint(
+     verify_handle_t *verify_handle,
+     libcerror_error_t **error )
+{
+	static char *function               = "verify_handle_summary_fprint";
+	double allocation_groups_per_second = 0.0;
+	double elapsed_seconds              = 0.0;
+	double mebibytes_per_second         = 0.0;
+	uint64_t metadata_size              = 0;
+	uint64_t number_of_inodes           = 0;
+	uint32_t allocation_group_index     = 0;
+	uint32_t number_of_failed           = 0;
+	uint32_t number_of_not_verified     = 0;
+	uint32_t number_of_verified         = 0;
+
+	if( verify_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verify handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( verify_handle_get_totals(
+	     verify_handle,
+	     &number_of_verified,
+	     &number_of_failed,
+	     &number_of_not_verified,
+	     &number_of_inodes,
+	     &metadata_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve totals.",
+		 function );
+
+		return( -1 );
+	}
+	elapsed_seconds = (double) verify_handle->elapsed_time / 1000000000.0;
+
+	if( elapsed_seconds > 0.0 )
+	{
+		allocation_groups_per_second = (double) ( number_of_verified + number_of_failed ) / elapsed_seconds;
+		mebibytes_per_second         = (double) metadata_size / ( elapsed_seconds * 1048576.0 );
+	}
+	fprintf(
+	 verify_handle->notify_stream,
+	 "X File System verification:\n" );
+
+	fprintf(
+	 verify_handle->notify_stream,
+	 "\tNumber of allocation groups\t: %" PRIu32 "\n",
+	 verify_handle->number_of_allocation_groups );
+
+	fprintf(
+	 verify_handle->notify_stream,
+	 "\tVerified\t\t\t: %" PRIu32 "\n",
+	 number_of_verified );
+
+	fprintf(
+	 verify_handle->notify_stream,
+	 "\tFailed\t\t\t\t: %" PRIu32 "\n",
+	 number_of_failed );
+
+	fprintf(
+	 verify_handle->notify_stream,
+	 "\tNot verified\t\t\t: %" PRIu32 "\n",
+	 number_of_not_verified );
+
+	fprintf(
+	 verify_handle->notify_stream,
+	 "\tNumber of inodes\t\t: %" PRIu64 "\n",
+	 number_of_inodes );
+
+	fprintf(
+	 verify_handle->notify_stream,
+	 "\tMetadata size\t\t\t: %" PRIu64 " bytes\n",
+	 metadata_size );
+
+	fprintf(
+	 verify_handle->notify_stream,
+	 "\tNumber of workers\t\t: %d\n",
+	 verify_handle->number_of_workers );
+
+	fprintf(
+	 verify_handle->notify_stream,
+	 "\tElapsed time\t\t\t: %.3f seconds\n",
+	 elapsed_seconds );
+
+	fprintf(
+	 verify_handle->notify_stream,
+	 "\tAllocation groups per second\t: %.2f\n",
+	 allocation_groups_per_second );
+
+	fprintf(
+	 verify_handle->notify_stream,
+	 "\tMetadata throughput\t\t: %.2f MiB/s\n",
+	 mebibytes_per_second );
+
+	if( number_of_failed > 0 )
+	{
+		fprintf(
+		 verify_handle->notify_stream,
+		 "\nFailed allocation groups:\n" );
+
+		for( allocation_group_index = 0;
+		     allocation_group_index < verify_handle->number_of_allocation_groups;
+		     allocation_group_index++ )
+		{
+			if( verify_handle->allocation_group_statuses[ allocation_group_index ] == VERIFY_HANDLE_ALLOCATION_GROUP_STATUS_FAILED )
+			{
+				fprintf(
+				 verify_handle->notify_stream,
+				 "\t%" PRIu32 "\n",
+				 allocation_group_index );
+			}
+		}
+	}
+	fprintf(
+	 verify_handle->notify_stream,
+	 "\n" );
+
+	return( 1 );
+}
+
+/* Prints the verification summary in JSON
+ * Returns 1 if successful or -1 on error
+ */
+int verify_handle_summary_json_fprint(
+     verify_handle_t *verify_handle,
+     libcerror_error_t **error )
+{
+	const char *status_string           = NULL;
+	static char *function               = "verify_handle_summary_json_fprint";
+	double allocation_groups_per_second = 0.0;
+	double elapsed_seconds              = 0.0;
+	double mebibytes_per_second         = 0.0;
+	uint64_t metadata_size              = 0;
+	uint64_t number_of_inodes           = 0;
+	uint32_t allocation_group_index     = 0;
+	uint32_t number_of_failed           = 0;
+	uint32_t number_of_not_verified     = 0;
+	uint32_t number_of_verified         = 0;
+
+	if( verify_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verify handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( verify_handle_get_totals(
+	     verify_handle,
+	     &number_of_verified,
+	     &number_of_failed,
+	     &number_of_not_verified,
+	     &number_of_inodes,
+	     &metadata_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve totals.",
+		 function );
+
+		return( -1 );
+	}
+	elapsed_seconds = (double) verify_handle->elapsed_time / 1000000000.0;
+
+	if( elapsed_seconds > 0.0 )
+	{
+		allocation_groups_per_second = (double) ( number_of_verified + number_of_failed ) / elapsed_seconds;
+		mebibytes_per_second         = (double) metadata_size / ( elapsed_seconds * 1048576.0 );
+	}
+	fprintf(
+	 verify_handle->notify_stream,
+	 "{\n" );
+
+	fprintf(
+	 verify_handle->notify_stream,
+	 "\t\"number_of_allocation_groups\": %" PRIu32 ",\n",
+	 verify_handle->number_of_allocation_groups );
+
+	fprintf(
+	 verify_handle->notify_stream,
+	 "\t\"number_of_verified\": %" PRIu32 ",\n",
+	 number_of_verified );
+
+	fprintf(
+	 verify_handle->notify_stream,
+	 "\t\"number_of_failed\": %" PRIu32 ",\n",
+	 number_of_failed );
+
+	fprintf(
+	 verify_handle->notify_stream,
+	 "\t\"number_of_not_verified\": %" PRIu32 ",\n",
+	 number_of_not_verified );
+
+	fprintf(
+	 verify_handle->notify_stream,
+	 "\t\"number_of_inodes\": %" PRIu64 ",\n",
+	 number_of_inodes );
+
+	fprintf(
+	 verify_handle->notify_stream,
+	 "\t\"metadata_size\": %" PRIu64 ",\n",
+	 metadata_size );
+
+	fprintf(
+	 verify_handle->notify_stream,
+	 "\t\"number_of_workers\": %d,\n",
+	 verify_handle->number_of_workers );
+
+	fprintf(
+	 verify_handle->notify_stream,
+	 "\t\"elapsed_time\": %.3f,\n",
+	 elapsed_seconds );
+
+	fprintf(
+	 verify_handle->notify_stream,
+	 "\t\"allocation_groups_per_second\": %.2f,\n",
+	 allocation_groups_per_second );
+
+	fprintf(
+	 verify_handle->notify_stream,
+	 "\t\"metadata_mib_per_second\": %.2f,\n",
+	 mebibytes_per_second );
+
+	fprintf(
+	 verify_handle->notify_stream,
+	 "\t\"allocation_groups\": [" );
+
+	for( allocation_group_index = 0;
+	     allocation_group_index < verify_handle->number_of_allocation_groups;
+	     allocation_group_index++ )
+	{
+		if( verify_handle->allocation_group_statuses[ allocation_group_index ] == VERIFY_HANDLE_ALLOCATION_GROUP_STATUS_VERIFIED )
+		{
+			status_string = "verified";
+		}
+		else if( verify_handle->allocation_group_statuses[ allocation_group_index ] == VERIFY_HANDLE_ALLOCATION_GROUP_STATUS_FAILED )
+		{
+			status_string = "failed";
+		}
+		else
+		{
+			status_string = "not_verified";
+		}
+		if( allocation_group_index > 0 )
+		{
+			fprintf(
+			 verify_handle->notify_stream,
+			 "," );
+		}
+		fprintf(
+		 verify_handle->notify_stream,
+		 "\n\t\t{ \"index\": %" PRIu32 ", \"status\": \"%s\", \"number_of_inodes\": %" PRIu64 ", \"metadata_size\": %" PRIu64 " }",
+		 allocation_group_index,
+		 status_string,
+		 verify_handle->allocation_group_number_of_inodes[ allocation_group_index ],
+		 verify_handle->allocation_group_metadata_sizes[ allocation_group_index ] );
+	}
+	fprintf(
+	 verify_handle->notify_stream,
+	 "\n\t]\n}\n" );
+
+	return( 1 );
+}
+
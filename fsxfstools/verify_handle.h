@@ -0,0 +1,225 @@
+/*
+ * Verify handle
+ *
+ * Copyright (C) 2020-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _VERIFY_HANDLE_H )
+#define _VERIFY_HANDLE_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "fsxfstools_libbfio.h"
+#include "fsxfstools_libcerror.h"
+#include "fsxfstools_libcthreads.h"
+#include "fsxfstools_libfsxfs.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#define VERIFY_HANDLE_DEFAULT_NUMBER_OF_THREADS		4
+#define VERIFY_HANDLE_MAXIMUM_NUMBER_OF_THREADS		64
+
+enum VERIFY_HANDLE_ALLOCATION_GROUP_STATUSES
+{
+	VERIFY_HANDLE_ALLOCATION_GROUP_STATUS_NOT_VERIFIED	= 0,
+	VERIFY_HANDLE_ALLOCATION_GROUP_STATUS_VERIFIED		= 1,
+	VERIFY_HANDLE_ALLOCATION_GROUP_STATUS_FAILED		= 2
+};
+
+typedef struct verify_handle verify_handle_t;
+
+typedef struct verify_handle_worker verify_handle_worker_t;
+
+struct verify_handle_worker
+{
+	/* The verify handle
+	 */
+	verify_handle_t *verify_handle;
+
+	/* The libbfio input file IO handle
+	 */
+	libbfio_handle_t *input_file_io_handle;
+
+	/* The libfsxfs input volume
+	 */
+	libfsxfs_volume_t *input_volume;
+
+	/* The result of the worker run
+	 */
+	int result;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The thread
+	 */
+	libcthreads_thread_t *thread;
+#endif
+};
+
+struct verify_handle
+{
+	/* The volume offset
+	 */
+	off64_t volume_offset;
+
+	/* The number of worker threads
+	 */
+	int number_of_threads;
+
+	/* The workers, each with its own input file IO handle and volume
+	 */
+	verify_handle_worker_t *workers;
+
+	/* The number of workers
+	 */
+	int number_of_workers;
+
+	/* The number of allocation groups
+	 */
+	uint32_t number_of_allocation_groups;
+
+	/* The index of the next allocation group to verify
+	 */
+	uint32_t next_allocation_group_index;
+
+	/* The status per allocation group
+	 */
+	uint8_t *allocation_group_statuses;
+
+	/* The number of inodes verified per allocation group
+	 */
+	uint64_t *allocation_group_number_of_inodes;
+
+	/* The size of the metadata verified per allocation group
+	 */
+	uint64_t *allocation_group_metadata_sizes;
+
+	/* The elapsed time of the verification in nano seconds
+	 */
+	uint64_t elapsed_time;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The mutex, protecting the next allocation group index and the error stream
+	 */
+	libcthreads_mutex_t *mutex;
+#endif
+
+	/* The notification output stream
+	 */
+	FILE *notify_stream;
+
+	/* The error output stream
+	 */
+	FILE *error_stream;
+
+	/* Value to indicate if abort was signalled
+	 */
+	int abort;
+};
+
+int verify_handle_system_string_copy_from_64_bit_in_decimal(
+     const system_character_t *string,
+     size_t string_size,
+     uint64_t *value_64bit,
+     libcerror_error_t **error );
+
+int verify_handle_initialize(
+     verify_handle_t **verify_handle,
+     libcerror_error_t **error );
+
+int verify_handle_free(
+     verify_handle_t **verify_handle,
+     libcerror_error_t **error );
+
+int verify_handle_signal_abort(
+     verify_handle_t *verify_handle,
+     libcerror_error_t **error );
+
+int verify_handle_set_volume_offset(
+     verify_handle_t *verify_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int verify_handle_set_number_of_threads(
+     verify_handle_t *verify_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int verify_handle_open_input(
+     verify_handle_t *verify_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int verify_handle_open_worker_input(
+     verify_handle_t *verify_handle,
+     verify_handle_worker_t *worker,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int verify_handle_close_input(
+     verify_handle_t *verify_handle,
+     libcerror_error_t **error );
+
+int verify_handle_get_current_time(
+     uint64_t *current_time,
+     libcerror_error_t **error );
+
+int verify_handle_get_next_allocation_group_index(
+     verify_handle_t *verify_handle,
+     uint32_t *allocation_group_index,
+     libcerror_error_t **error );
+
+int verify_handle_verify_allocation_group(
+     verify_handle_t *verify_handle,
+     libfsxfs_volume_t *volume,
+     uint32_t allocation_group_index,
+     libcerror_error_t **error );
+
+int verify_handle_worker_run(
+     verify_handle_worker_t *worker );
+
+int verify_handle_verify_volume(
+     verify_handle_t *verify_handle,
+     libcerror_error_t **error );
+
+int verify_handle_get_totals(
+     verify_handle_t *verify_handle,
+     uint32_t *number_of_verified,
+     uint32_t *number_of_failed,
+     uint32_t *number_of_not_verified,
+     uint64_t *number_of_inodes,
+     uint64_t *metadata_size,
+     libcerror_error_t **error );
+
+int verify_handle_summary_fprint(
+     verify_handle_t *verify_handle,
+     libcerror_error_t **error );
+
+int verify_handle_summary_json_fprint(
+     verify_handle_t *verify_handle,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _VERIFY_HANDLE_H ) */
+
@@ -0,0 +1,1100 @@
+/*
+ * Metadata block cache functions
+ *
+ * Copyright (C) 2020-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfsxfs_block_cache.h"
+#include "libfsxfs_definitions.h"
+#include "libfsxfs_libbfio.h"
+#include "libfsxfs_libcerror.h"
+#include "libfsxfs_libcthreads.h"
+
+/* Creates a block cache
+ * Make sure the value block_cache is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_block_cache_initialize(
+     libfsxfs_block_cache_t **block_cache,
+     size_t maximum_cache_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_block_cache_initialize";
+
+	if( block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *block_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid block cache value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_cache_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid maximum cache size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	*block_cache = memory_allocate_structure(
+	                libfsxfs_block_cache_t );
+
+	if( *block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create block cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *block_cache,
+	     0,
+	     sizeof( libfsxfs_block_cache_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear block cache.",
+		 function );
+
+		memory_free(
+		 *block_cache );
+
+		*block_cache = NULL;
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( ( *block_cache )->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	( *block_cache )->maximum_cache_size = maximum_cache_size;
+
+	return( 1 );
+
+on_error:
+	if( *block_cache != NULL )
+	{
+		memory_free(
+		 *block_cache );
+
+		*block_cache = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a block cache
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_block_cache_free(
+     libfsxfs_block_cache_t **block_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_block_cache_free";
+	int result            = 1;
+
+	if( block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *block_cache != NULL )
+	{
+		while( ( *block_cache )->clock_hand != NULL )
+		{
+			if( libfsxfs_block_cache_remove_value(
+			     *block_cache,
+			     ( *block_cache )->clock_hand,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+				 "%s: unable to remove value.",
+				 function );
+
+				result = -1;
+
+				break;
+			}
+		}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( ( *block_cache )->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		memory_free(
+		 *block_cache );
+
+		*block_cache = NULL;
+	}
+	return( result );
+}
+
+/* Empties a block cache
+ * The maximum cache size is retained and the statistics are reset
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_block_cache_empty(
+     libfsxfs_block_cache_t *block_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_block_cache_empty";
+	int result            = 1;
+
+	if( block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block cache.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     block_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	while( block_cache->clock_hand != NULL )
+	{
+		if( libfsxfs_block_cache_remove_value(
+		     block_cache,
+		     block_cache->clock_hand,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to remove value.",
+			 function );
+
+			result = -1;
+
+			break;
+		}
+	}
+	block_cache->number_of_hits   = 0;
+	block_cache->number_of_misses = 0;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     block_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Removes a value from the block cache and frees it
+ * The caller is expected to hold the lock for writing
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_block_cache_remove_value(
+     libfsxfs_block_cache_t *block_cache,
+     libfsxfs_block_cache_value_t *value,
+     libcerror_error_t **error )
+{
+	libfsxfs_block_cache_value_t *bucket_value = NULL;
+	static char *function                      = "libfsxfs_block_cache_remove_value";
+	uint32_t hash_value                        = 0;
+	int bucket_index                           = 0;
+
+	if( block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	/* The file offset in sectors is hashed with the golden ratio multiplier and folded
+	 * so that offsets of blocks larger than a sector are distributed over all buckets
+	 */
+	hash_value   = (uint32_t) ( ( (uint64_t) value->file_offset >> 9 ) * 0x9e3779b1UL );
+	bucket_index = (int) ( ( hash_value ^ ( hash_value >> 16 ) ) % LIBFSXFS_BLOCK_CACHE_NUMBER_OF_BUCKETS );
+
+	if( block_cache->buckets[ bucket_index ] == value )
+	{
+		block_cache->buckets[ bucket_index ] = value->next_bucket_value;
+	}
+	else
+	{
+		bucket_value = block_cache->buckets[ bucket_index ];
+
+		while( bucket_value != NULL )
+		{
+			if( bucket_value->next_bucket_value == value )
+			{
+				bucket_value->next_bucket_value = value->next_bucket_value;
+
+				break;
+			}
+			bucket_value = bucket_value->next_bucket_value;
+		}
+	}
+	if( value->next_value == value )
+	{
+		block_cache->clock_hand = NULL;
+	}
+	else
+	{
+		value->previous_value->next_value = value->next_value;
+		value->next_value->previous_value = value->previous_value;
+
+		if( block_cache->clock_hand == value )
+		{
+			block_cache->clock_hand = value->next_value;
+		}
+	}
+	block_cache->current_cache_size -= value->data_size;
+	block_cache->number_of_values   -= 1;
+
+	memory_free(
+	 value->data );
+	memory_free(
+	 value );
+
+	return( 1 );
+}
+
+/* Evicts values from the block cache until the size of the cached data
+ * does not exceed the maximum cache size
+ * Values are evicted using the CLOCK algorithm: the clock hand passes over the values
+ * and clears their referenced flag, a value that was not referenced since the clock hand
+ * last passed it is evicted
+ * The caller is expected to hold the lock for writing
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_block_cache_evict_values(
+     libfsxfs_block_cache_t *block_cache,
+     size_t maximum_cache_size,
+     libcerror_error_t **error )
+{
+	libfsxfs_block_cache_value_t *value = NULL;
+	static char *function               = "libfsxfs_block_cache_evict_values";
+
+	if( block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block cache.",
+		 function );
+
+		return( -1 );
+	}
+	while( ( block_cache->clock_hand != NULL )
+	    && ( block_cache->current_cache_size > maximum_cache_size ) )
+	{
+		value = block_cache->clock_hand;
+
+		if( value->is_referenced != 0 )
+		{
+			value->is_referenced = 0;
+
+			block_cache->clock_hand = value->next_value;
+		}
+		else if( libfsxfs_block_cache_remove_value(
+		          block_cache,
+		          value,
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to remove value.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Retrieves the maximum size of the cached data
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_block_cache_get_maximum_cache_size(
+     libfsxfs_block_cache_t *block_cache,
+     size_t *maximum_cache_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_block_cache_get_maximum_cache_size";
+
+	if( block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_cache_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid maximum cache size.",
+		 function );
+
+		return( -1 );
+	}
+	*maximum_cache_size = block_cache->maximum_cache_size;
+
+	return( 1 );
+}
+
+/* Sets the maximum size of the cached data
+ * Values are evicted when the cache exceeds the new maximum size
+ * A maximum size of 0 disables the cache
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_block_cache_set_maximum_cache_size(
+     libfsxfs_block_cache_t *block_cache,
+     size_t maximum_cache_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_block_cache_set_maximum_cache_size";
+	int result            = 1;
+
+	if( block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_cache_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid maximum cache size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     block_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	block_cache->maximum_cache_size = maximum_cache_size;
+
+	if( libfsxfs_block_cache_evict_values(
+	     block_cache,
+	     maximum_cache_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+		 "%s: unable to evict values.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     block_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the block cache statistics
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_block_cache_get_statistics(
+     libfsxfs_block_cache_t *block_cache,
+     uint64_t *number_of_hits,
+     uint64_t *number_of_misses,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_block_cache_get_statistics";
+
+	if( block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_hits == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of hits.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_misses == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of misses.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     block_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*number_of_hits   = block_cache->number_of_hits;
+	*number_of_misses = block_cache->number_of_misses;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     block_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the data of a specific block from the cache
+ * The data is copied into the buffer
+ * Returns 1 if successful, 0 if not cached or -1 on error
+ */
+int libfsxfs_block_cache_get_data(
+     libfsxfs_block_cache_t *block_cache,
+     off64_t file_offset,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libfsxfs_block_cache_value_t *value = NULL;
+	static char *function               = "libfsxfs_block_cache_get_data";
+	uint32_t hash_value                 = 0;
+	int bucket_index                    = 0;
+	int result                          = 0;
+
+	if( block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid file offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	/* The file offset in sectors is hashed with the golden ratio multiplier and folded
+	 * so that offsets of blocks larger than a sector are distributed over all buckets
+	 */
+	hash_value   = (uint32_t) ( ( (uint64_t) file_offset >> 9 ) * 0x9e3779b1UL );
+	bucket_index = (int) ( ( hash_value ^ ( hash_value >> 16 ) ) % LIBFSXFS_BLOCK_CACHE_NUMBER_OF_BUCKETS );
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     block_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	value = block_cache->buckets[ bucket_index ];
+
+	while( value != NULL )
+	{
+		if( ( value->file_offset == file_offset )
+		 && ( value->data_size == data_size ) )
+		{
+			break;
+		}
+		value = value->next_bucket_value;
+	}
+	if( value == NULL )
+	{
+		block_cache->number_of_misses += 1;
+	}
+	else if( memory_copy(
+	          data,
+	          value->data,
+	          data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy data.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		value->is_referenced = 1;
+
+		block_cache->number_of_hits += 1;
+
+		result = 1;
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     block_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Inserts the data of a specific block into the cache
+ * The data is copied and values are evicted when needed
+ * Returns 1 if successful, 0 if the block is already cached or does not fit in the cache or -1 on error
+ */
+int libfsxfs_block_cache_insert_data(
+     libfsxfs_block_cache_t *block_cache,
+     off64_t file_offset,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libfsxfs_block_cache_value_t *value = NULL;
+	static char *function               = "libfsxfs_block_cache_insert_data";
+	uint32_t hash_value                 = 0;
+	int bucket_index                    = 0;
+	int result                          = 0;
+
+	if( block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid file offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size == 0 )
+	 || ( data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* The file offset in sectors is hashed with the golden ratio multiplier and folded
+	 * so that offsets of blocks larger than a sector are distributed over all buckets
+	 */
+	hash_value   = (uint32_t) ( ( (uint64_t) file_offset >> 9 ) * 0x9e3779b1UL );
+	bucket_index = (int) ( ( hash_value ^ ( hash_value >> 16 ) ) % LIBFSXFS_BLOCK_CACHE_NUMBER_OF_BUCKETS );
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     block_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( data_size > block_cache->maximum_cache_size )
+	{
+		goto on_exit;
+	}
+	value = block_cache->buckets[ bucket_index ];
+
+	while( value != NULL )
+	{
+		if( ( value->file_offset == file_offset )
+		 && ( value->data_size == data_size ) )
+		{
+			break;
+		}
+		value = value->next_bucket_value;
+	}
+	if( value != NULL )
+	{
+		value = NULL;
+
+		goto on_exit;
+	}
+	if( libfsxfs_block_cache_evict_values(
+	     block_cache,
+	     block_cache->maximum_cache_size - data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+		 "%s: unable to evict values.",
+		 function );
+
+		result = -1;
+
+		goto on_exit;
+	}
+	value = memory_allocate_structure(
+	         libfsxfs_block_cache_value_t );
+
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create value.",
+		 function );
+
+		result = -1;
+
+		goto on_exit;
+	}
+	value->data = (uint8_t *) memory_allocate(
+	                           sizeof( uint8_t ) * data_size );
+
+	if( value->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create value data.",
+		 function );
+
+		result = -1;
+
+		goto on_exit;
+	}
+	if( memory_copy(
+	     value->data,
+	     data,
+	     data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy data.",
+		 function );
+
+		result = -1;
+
+		goto on_exit;
+	}
+	value->file_offset       = file_offset;
+	value->data_size         = data_size;
+	value->is_referenced     = 0;
+	value->next_bucket_value = block_cache->buckets[ bucket_index ];
+
+	block_cache->buckets[ bucket_index ] = value;
+
+	/* Insert the value just behind the clock hand so it is the last to be considered for eviction
+	 */
+	if( block_cache->clock_hand == NULL )
+	{
+		value->previous_value = value;
+		value->next_value     = value;
+
+		block_cache->clock_hand = value;
+	}
+	else
+	{
+		value->previous_value = block_cache->clock_hand->previous_value;
+		value->next_value     = block_cache->clock_hand;
+
+		block_cache->clock_hand->previous_value->next_value = value;
+		block_cache->clock_hand->previous_value             = value;
+	}
+	block_cache->current_cache_size += data_size;
+	block_cache->number_of_values   += 1;
+
+	value  = NULL;
+	result = 1;
+
+on_exit:
+	if( value != NULL )
+	{
+		if( value->data != NULL )
+		{
+			memory_free(
+			 value->data );
+		}
+		memory_free(
+		 value );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     block_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Reads a buffer at a specific offset using the block cache
+ * The buffer is read from the file IO handle if not cached and
+ * afterwards added to the cache
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libfsxfs_block_cache_read_buffer_at_offset(
+         libfsxfs_block_cache_t *block_cache,
+         libbfio_handle_t *file_io_handle,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t file_offset,
+         libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_block_cache_read_buffer_at_offset";
+	ssize_t read_count    = 0;
+	int result            = 0;
+
+	if( block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( buffer_size > 0 )
+	 && ( buffer_size <= block_cache->maximum_cache_size ) )
+	{
+		result = libfsxfs_block_cache_get_data(
+		          block_cache,
+		          file_offset,
+		          buffer,
+		          buffer_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve data at offset: %" PRIi64 " (0x%08" PRIx64 ") from cache.",
+			 function,
+			 file_offset,
+			 file_offset );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			return( (ssize_t) buffer_size );
+		}
+	}
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              buffer,
+	              buffer_size,
+	              file_offset,
+	              error );
+
+	if( read_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read buffer at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 file_offset,
+		 file_offset );
+
+		return( -1 );
+	}
+	if( ( read_count > 0 )
+	 && ( (size_t) read_count == buffer_size )
+	 && ( buffer_size <= block_cache->maximum_cache_size ) )
+	{
+		if( libfsxfs_block_cache_insert_data(
+		     block_cache,
+		     file_offset,
+		     buffer,
+		     buffer_size,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to insert data at offset: %" PRIi64 " (0x%08" PRIx64 ") into cache.",
+			 function,
+			 file_offset,
+			 file_offset );
+
+			return( -1 );
+		}
+	}
+	return( read_count );
+}
+
@@ -0,0 +1,175 @@
+/*
+ * Metadata block cache functions
+ *
+ * Copyright (C) 2020-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSXFS_BLOCK_CACHE_H )
+#define _LIBFSXFS_BLOCK_CACHE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsxfs_definitions.h"
+#include "libfsxfs_libbfio.h"
+#include "libfsxfs_libcerror.h"
+#include "libfsxfs_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfsxfs_block_cache_value libfsxfs_block_cache_value_t;
+
+struct libfsxfs_block_cache_value
+{
+	/* The file offset
+	 */
+	off64_t file_offset;
+
+	/* The data
+	 */
+	uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* Value to indicate the value was used since the clock hand last passed it
+	 */
+	uint8_t is_referenced;
+
+	/* The previous value in the clock
+	 */
+	libfsxfs_block_cache_value_t *previous_value;
+
+	/* The next value in the clock
+	 */
+	libfsxfs_block_cache_value_t *next_value;
+
+	/* The next value in the same hash bucket
+	 */
+	libfsxfs_block_cache_value_t *next_bucket_value;
+};
+
+typedef struct libfsxfs_block_cache libfsxfs_block_cache_t;
+
+struct libfsxfs_block_cache
+{
+	/* The hash buckets
+	 */
+	libfsxfs_block_cache_value_t *buckets[ LIBFSXFS_BLOCK_CACHE_NUMBER_OF_BUCKETS ];
+
+	/* The clock hand, the next value to consider for eviction
+	 */
+	libfsxfs_block_cache_value_t *clock_hand;
+
+	/* The number of values
+	 */
+	int number_of_values;
+
+	/* The current size of the cached data
+	 */
+	size_t current_cache_size;
+
+	/* The maximum size of the cached data
+	 */
+	size_t maximum_cache_size;
+
+	/* The number of cache hits
+	 */
+	uint64_t number_of_hits;
+
+	/* The number of cache misses
+	 */
+	uint64_t number_of_misses;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
+};
+
+int libfsxfs_block_cache_initialize(
+     libfsxfs_block_cache_t **block_cache,
+     size_t maximum_cache_size,
+     libcerror_error_t **error );
+
+int libfsxfs_block_cache_free(
+     libfsxfs_block_cache_t **block_cache,
+     libcerror_error_t **error );
+
+int libfsxfs_block_cache_empty(
+     libfsxfs_block_cache_t *block_cache,
+     libcerror_error_t **error );
+
+int libfsxfs_block_cache_remove_value(
+     libfsxfs_block_cache_t *block_cache,
+     libfsxfs_block_cache_value_t *value,
+     libcerror_error_t **error );
+
+int libfsxfs_block_cache_evict_values(
+     libfsxfs_block_cache_t *block_cache,
+     size_t maximum_cache_size,
+     libcerror_error_t **error );
+
+int libfsxfs_block_cache_get_maximum_cache_size(
+     libfsxfs_block_cache_t *block_cache,
+     size_t *maximum_cache_size,
+     libcerror_error_t **error );
+
+int libfsxfs_block_cache_set_maximum_cache_size(
+     libfsxfs_block_cache_t *block_cache,
+     size_t maximum_cache_size,
+     libcerror_error_t **error );
+
+int libfsxfs_block_cache_get_statistics(
+     libfsxfs_block_cache_t *block_cache,
+     uint64_t *number_of_hits,
+     uint64_t *number_of_misses,
+     libcerror_error_t **error );
+
+int libfsxfs_block_cache_get_data(
+     libfsxfs_block_cache_t *block_cache,
+     off64_t file_offset,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libfsxfs_block_cache_insert_data(
+     libfsxfs_block_cache_t *block_cache,
+     off64_t file_offset,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+ssize_t libfsxfs_block_cache_read_buffer_at_offset(
+         libfsxfs_block_cache_t *block_cache,
+         libbfio_handle_t *file_io_handle,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t file_offset,
+         libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSXFS_BLOCK_CACHE_H ) */
+
@@ -24,6 +24,7 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libfsxfs_checksum.h"
 #include "libfsxfs_debug.h"
 #include "libfsxfs_definitions.h"
 #include "libfsxfs_directory_entry.h"
@@ -212,6 +213,8 @@ int libfsxfs_block_directory_free(
 }
 
 /* Reads the block directory
+ * The offset of the directory entries is relative to the start of the block
+ * The directory entries are stored in the directory arena if provided
  * Returns 1 if successful or -1 on error
  */
 int libfsxfs_block_directory_read_data(
@@ -220,6 +223,7 @@ int libfsxfs_block_directory_read_data(
      const uint8_t *data,
      size_t data_size,
      libcdata_array_t *entries_array,
+     libfsxfs_directory_arena_t *directory_arena,
      libcerror_error_t **error )
 {
 	libfsxfs_directory_entry_t *directory_entry = NULL;
@@ -227,6 +231,7 @@ int libfsxfs_block_directory_read_data(
 	size_t alignment_padding_size               = 0;
 	size_t data_offset                          = 0;
 	size_t entries_data_end_offset              = 0;
+	size_t entry_data_offset                    = 0;
 	size_t entry_data_size                      = 0;
 	size_t hash_values_data_size                = 0;
 	uint64_t inode_number                       = 0;
@@ -234,6 +239,7 @@ int libfsxfs_block_directory_read_data(
 	uint16_t free_tag                           = 0;
 	uint8_t name_size                           = 0;
 	int entry_index                             = 0;
+	int result                                  = 0;
 
 #if defined( HAVE_DEBUG_OUTPUT )
 	uint16_t value_16bit                        = 0;
@@ -347,6 +353,25 @@ int libfsxfs_block_directory_read_data(
 
 		goto on_error;
 	}
+	if( ( io_handle->verify_checksums != 0 )
+	 && ( block_directory->header->format_version == 3 ) )
+	{
+		if( libfsxfs_checksum_verify_metadata_checksum(
+		     data,
+		     data_size,
+		     4,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_INPUT,
+			 LIBCERROR_INPUT_ERROR_CHECKSUM_MISMATCH,
+			 "%s: unable to verify block directory checksum.",
+			 function );
+
+			goto on_error;
+		}
+	}
 	if( block_directory->header->has_footer != 0 )
 	{
 		if( libfsxfs_block_directory_footer_initialize(
@@ -471,7 +496,8 @@ int libfsxfs_block_directory_read_data(
 
 			goto on_error;
 		}
-		name_size = data[ data_offset + 8 ];
+		entry_data_offset = data_offset;
+		name_size         = data[ data_offset + 8 ];
 
 		entry_data_size = 9 + name_size + 2;
 
@@ -564,9 +590,21 @@ int libfsxfs_block_directory_read_data(
 		}
 		else
 		{
-			if( libfsxfs_directory_entry_initialize(
-			     &directory_entry,
-			     error ) != 1 )
+			if( directory_arena != NULL )
+			{
+				result = libfsxfs_directory_entry_initialize_from_arena(
+				          &directory_entry,
+				          directory_arena,
+				          name_size,
+				          error );
+			}
+			else
+			{
+				result = libfsxfs_directory_entry_initialize(
+				          &directory_entry,
+				          error );
+			}
+			if( result != 1 )
 			{
 				libcerror_error_set(
 				 error,
@@ -579,6 +617,7 @@ int libfsxfs_block_directory_read_data(
 				goto on_error;
 			}
 			directory_entry->inode_number = inode_number;
+			directory_entry->offset       = (uint64_t) entry_data_offset;
 
 			if( memory_copy(
 			     directory_entry->name,
@@ -611,6 +650,10 @@ int libfsxfs_block_directory_read_data(
 			}
 #endif /* defined( HAVE_DEBUG_OUTPUT ) */
 
+			if( directory_entry != NULL )
+			{
+				directory_entry->file_type = data[ data_offset ];
+			}
 			data_offset++;
 		}
 		if( alignment_padding_size > 0 )
@@ -723,10 +766,13 @@ int libfsxfs_block_directory_read_file_io_handle(
      libbfio_handle_t *file_io_handle,
      off64_t file_offset,
      libcdata_array_t *entries_array,
+     libfsxfs_directory_arena_t *directory_arena,
      libcerror_error_t **error )
 {
+	const uint8_t *data   = NULL;
 	static char *function = "libfsxfs_block_directory_read_file_io_handle";
 	ssize_t read_count    = 0;
+	int result            = 0;
 
 	if( block_directory == NULL )
 	{
@@ -760,32 +806,60 @@ int libfsxfs_block_directory_read_file_io_handle(
 		 file_offset );
 	}
 #endif
-	read_count = libbfio_handle_read_buffer_at_offset(
-	              file_io_handle,
-	              block_directory->data,
-	              block_directory->data_size,
-	              file_offset,
-	              error );
+	/* If the volume is mapped the block directory is read directly from the memory map
+	 */
+	result = libfsxfs_io_handle_get_mapped_data(
+	          io_handle,
+	          file_offset,
+	          block_directory->data_size,
+	          &data,
+	          error );
 
-	if( read_count != (ssize_t) block_directory->data_size )
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read block directory data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve mapped block directory data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
 		 function,
 		 file_offset,
 		 file_offset );
 
 		return( -1 );
 	}
+	else if( result == 0 )
+	{
+		read_count = libfsxfs_io_handle_read_buffer_at_offset(
+		              io_handle,
+		              file_io_handle,
+		              block_directory->data,
+		              block_directory->data_size,
+		              file_offset,
+		              error );
+
+		if( read_count != (ssize_t) block_directory->data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read block directory data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 file_offset,
+			 file_offset );
+
+			return( -1 );
+		}
+		data = block_directory->data;
+	}
 	if( libfsxfs_block_directory_read_data(
 	     block_directory,
 	     io_handle,
-	     block_directory->data,
+	     data,
 	     block_directory->data_size,
 	     entries_array,
+	     directory_arena,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -27,6 +27,7 @@
 
 #include "libfsxfs_block_directory_footer.h"
 #include "libfsxfs_block_directory_header.h"
+#include "libfsxfs_directory_arena.h"
 #include "libfsxfs_io_handle.h"
 #include "libfsxfs_libbfio.h"
 #include "libfsxfs_libcdata.h"
@@ -72,6 +73,7 @@ int libfsxfs_block_directory_read_data(
      const uint8_t *data,
      size_t data_size,
      libcdata_array_t *entries_array,
+     libfsxfs_directory_arena_t *directory_arena,
      libcerror_error_t **error );
 
 int libfsxfs_block_directory_read_file_io_handle(
@@ -80,6 +82,7 @@ int libfsxfs_block_directory_read_file_io_handle(
      libbfio_handle_t *file_io_handle,
      off64_t file_offset,
      libcdata_array_t *entries_array,
+     libfsxfs_directory_arena_t *directory_arena,
      libcerror_error_t **error );
 
 #if defined( __cplusplus )
@@ -24,6 +24,7 @@
 #include <types.h>
 
 #include "libfsxfs_btree_block.h"
+#include "libfsxfs_checksum.h"
 #include "libfsxfs_io_handle.h"
 #include "libfsxfs_libbfio.h"
 #include "libfsxfs_libcerror.h"
@@ -110,20 +111,8 @@ int libfsxfs_btree_block_initialize(
 
 		return( -1 );
 	}
-	( *btree_block )->data = (uint8_t *) memory_allocate(
-	                                      sizeof( uint8_t ) * block_size );
-
-	if( ( *btree_block )->data == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create B+ tree block data.",
-		 function );
-
-		goto on_error;
-	}
+	/* The data is allocated when the B+ tree block is read and is not mapped
+	 */
 	( *btree_block )->data_size              = block_size;
 	( *btree_block )->block_number_data_size = block_number_data_size;
 
@@ -179,9 +168,11 @@ int libfsxfs_btree_block_free(
 				result = -1;
 			}
 		}
-		memory_free(
-		 ( *btree_block )->data );
-
+		if( ( *btree_block )->data != NULL )
+		{
+			memory_free(
+			 ( *btree_block )->data );
+		}
 		memory_free(
 		 *btree_block );
 
@@ -201,6 +192,7 @@ int libfsxfs_btree_block_read_data(
      libcerror_error_t **error )
 {
 	static char *function   = "libfsxfs_btree_block_read_data";
+	size_t checksum_offset  = 0;
 	size_t header_data_size = 0;
 
 	if( btree_block == NULL )
@@ -311,6 +303,33 @@ int libfsxfs_btree_block_read_data(
 
 		goto on_error;
 	}
+	if( ( io_handle->verify_checksums != 0 )
+	 && ( io_handle->format_version == 5 ) )
+	{
+		if( btree_block->block_number_data_size == 8 )
+		{
+			checksum_offset = 64;
+		}
+		else
+		{
+			checksum_offset = 52;
+		}
+		if( libfsxfs_checksum_verify_metadata_checksum(
+		     data,
+		     data_size,
+		     checksum_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_INPUT,
+			 LIBCERROR_INPUT_ERROR_CHECKSUM_MISMATCH,
+			 "%s: unable to verify B+ tree block checksum.",
+			 function );
+
+			goto on_error;
+		}
+	}
 	btree_block->records_data      = &( data[ header_data_size ] );
 	btree_block->records_data_size = data_size - header_data_size;
 
@@ -349,8 +368,10 @@ int libfsxfs_btree_block_read_file_io_handle(
      off64_t file_offset,
      libcerror_error_t **error )
 {
+	const uint8_t *data   = NULL;
 	static char *function = "libfsxfs_btree_block_read_file_io_handle";
 	ssize_t read_count    = 0;
+	int result            = 0;
 
 	if( btree_block == NULL )
 	{
@@ -384,30 +405,74 @@ int libfsxfs_btree_block_read_file_io_handle(
 		 file_offset );
 	}
 #endif
-	read_count = libbfio_handle_read_buffer_at_offset(
-	              file_io_handle,
-	              btree_block->data,
-	              btree_block->data_size,
-	              file_offset,
-	              error );
-
-	if( read_count != (ssize_t) btree_block->data_size )
+	/* If the volume is mapped the B+ tree block is read directly from the memory map
+	 */
+	result = libfsxfs_io_handle_get_mapped_data(
+	          io_handle,
+	          file_offset,
+	          btree_block->data_size,
+	          &data,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read B+ tree block data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve mapped B+ tree block data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
 		 function,
 		 file_offset,
 		 file_offset );
 
 		return( -1 );
 	}
+	else if( result == 0 )
+	{
+		if( btree_block->data == NULL )
+		{
+			btree_block->data = (uint8_t *) memory_allocate(
+			                                 sizeof( uint8_t ) * btree_block->data_size );
+
+			if( btree_block->data == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create B+ tree block data.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		read_count = libfsxfs_io_handle_read_buffer_at_offset(
+		              io_handle,
+		              file_io_handle,
+		              btree_block->data,
+		              btree_block->data_size,
+		              file_offset,
+		              error );
+
+		if( read_count != (ssize_t) btree_block->data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read B+ tree block data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 file_offset,
+			 file_offset );
+
+			return( -1 );
+		}
+		data = btree_block->data;
+	}
 	if( libfsxfs_btree_block_read_data(
 	     btree_block,
 	     io_handle,
-	     btree_block->data,
+	     data,
 	     btree_block->data_size,
 	     error ) != 1 )
 	{
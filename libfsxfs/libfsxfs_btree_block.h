@@ -38,7 +38,7 @@ typedef struct libfsxfs_btree_block libfsxfs_btree_block_t;
 
 struct libfsxfs_btree_block
 {
-	/* Data
+	/* Data or NULL if the B+ tree block was read from the memory map
 	 */
 	uint8_t *data;
 
@@ -0,0 +1,728 @@
+/*
+ * Checksum functions
+ *
+ * Copyright (C) 2020-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <types.h>
+
+#include "libfsxfs_checksum.h"
+#include "libfsxfs_libcerror.h"
+
+/* Table of the CRC-32C (Castagnoli) values for slicing-by-8
+ * The table is based on the reversed polynomial 0x82f63b78
+ */
+static const uint32_t libfsxfs_checksum_crc32c_table[ 8 ][ 256 ] = {
+	{
+		0x00000000UL, 0xf26b8303UL, 0xe13b70f7UL, 0x1350f3f4UL, 0xc79a971fUL, 0x35f1141cUL,
+		0x26a1e7e8UL, 0xd4ca64ebUL, 0x8ad958cfUL, 0x78b2dbccUL, 0x6be22838UL, 0x9989ab3bUL,
+		0x4d43cfd0UL, 0xbf284cd3UL, 0xac78bf27UL, 0x5e133c24UL, 0x105ec76fUL, 0xe235446cUL,
+		0xf165b798UL, 0x030e349bUL, 0xd7c45070UL, 0x25afd373UL, 0x36ff2087UL, 0xc494a384UL,
+		0x9a879fa0UL, 0x68ec1ca3UL, 0x7bbcef57UL, 0x89d76c54UL, 0x5d1d08bfUL, 0xaf768bbcUL,
+		0xbc267848UL, 0x4e4dfb4bUL, 0x20bd8edeUL, 0xd2d60dddUL, 0xc186fe29UL, 0x33ed7d2aUL,
+		0xe72719c1UL, 0x154c9ac2UL, 0x061c6936UL, 0xf477ea35UL, 0xaa64d611UL, 0x580f5512UL,
+		0x4b5fa6e6UL, 0xb93425e5UL, 0x6dfe410eUL, 0x9f95c20dUL, 0x8cc531f9UL, 0x7eaeb2faUL,
+		0x30e349b1UL, 0xc288cab2UL, 0xd1d83946UL, 0x23b3ba45UL, 0xf779deaeUL, 0x05125dadUL,
+		0x1642ae59UL, 0xe4292d5aUL, 0xba3a117eUL, 0x4851927dUL, 0x5b016189UL, 0xa96ae28aUL,
+		0x7da08661UL, 0x8fcb0562UL, 0x9c9bf696UL, 0x6ef07595UL, 0x417b1dbcUL, 0xb3109ebfUL,
+		0xa0406d4bUL, 0x522bee48UL, 0x86e18aa3UL, 0x748a09a0UL, 0x67dafa54UL, 0x95b17957UL,
+		0xcba24573UL, 0x39c9c670UL, 0x2a993584UL, 0xd8f2b687UL, 0x0c38d26cUL, 0xfe53516fUL,
+		0xed03a29bUL, 0x1f682198UL, 0x5125dad3UL, 0xa34e59d0UL, 0xb01eaa24UL, 0x42752927UL,
+		0x96bf4dccUL, 0x64d4cecfUL, 0x77843d3bUL, 0x85efbe38UL, 0xdbfc821cUL, 0x2997011fUL,
+		0x3ac7f2ebUL, 0xc8ac71e8UL, 0x1c661503UL, 0xee0d9600UL, 0xfd5d65f4UL, 0x0f36e6f7UL,
+		0x61c69362UL, 0x93ad1061UL, 0x80fde395UL, 0x72966096UL, 0xa65c047dUL, 0x5437877eUL,
+		0x4767748aUL, 0xb50cf789UL, 0xeb1fcbadUL, 0x197448aeUL, 0x0a24bb5aUL, 0xf84f3859UL,
+		0x2c855cb2UL, 0xdeeedfb1UL, 0xcdbe2c45UL, 0x3fd5af46UL, 0x7198540dUL, 0x83f3d70eUL,
+		0x90a324faUL, 0x62c8a7f9UL, 0xb602c312UL, 0x44694011UL, 0x5739b3e5UL, 0xa55230e6UL,
+		0xfb410cc2UL, 0x092a8fc1UL, 0x1a7a7c35UL, 0xe811ff36UL, 0x3cdb9bddUL, 0xceb018deUL,
+		0xdde0eb2aUL, 0x2f8b6829UL, 0x82f63b78UL, 0x709db87bUL, 0x63cd4b8fUL, 0x91a6c88cUL,
+		0x456cac67UL, 0xb7072f64UL, 0xa457dc90UL, 0x563c5f93UL, 0x082f63b7UL, 0xfa44e0b4UL,
+		0xe9141340UL, 0x1b7f9043UL, 0xcfb5f4a8UL, 0x3dde77abUL, 0x2e8e845fUL, 0xdce5075cUL,
+		0x92a8fc17UL, 0x60c37f14UL, 0x73938ce0UL, 0x81f80fe3UL, 0x55326b08UL, 0xa759e80bUL,
+		0xb4091bffUL, 0x466298fcUL, 0x1871a4d8UL, 0xea1a27dbUL, 0xf94ad42fUL, 0x0b21572cUL,
+		0xdfeb33c7UL, 0x2d80b0c4UL, 0x3ed04330UL, 0xccbbc033UL, 0xa24bb5a6UL, 0x502036a5UL,
+		0x4370c551UL, 0xb11b4652UL, 0x65d122b9UL, 0x97baa1baUL, 0x84ea524eUL, 0x7681d14dUL,
+		0x2892ed69UL, 0xdaf96e6aUL, 0xc9a99d9eUL, 0x3bc21e9dUL, 0xef087a76UL, 0x1d63f975UL,
+		0x0e330a81UL, 0xfc588982UL, 0xb21572c9UL, 0x407ef1caUL, 0x532e023eUL, 0xa145813dUL,
+		0x758fe5d6UL, 0x87e466d5UL, 0x94b49521UL, 0x66df1622UL, 0x38cc2a06UL, 0xcaa7a905UL,
+		0xd9f75af1UL, 0x2b9cd9f2UL, 0xff56bd19UL, 0x0d3d3e1aUL, 0x1e6dcdeeUL, 0xec064eedUL,
+		0xc38d26c4UL, 0x31e6a5c7UL, 0x22b65633UL, 0xd0ddd530UL, 0x0417b1dbUL, 0xf67c32d8UL,
+		0xe52cc12cUL, 0x1747422fUL, 0x49547e0bUL, 0xbb3ffd08UL, 0xa86f0efcUL, 0x5a048dffUL,
+		0x8ecee914UL, 0x7ca56a17UL, 0x6ff599e3UL, 0x9d9e1ae0UL, 0xd3d3e1abUL, 0x21b862a8UL,
+		0x32e8915cUL, 0xc083125fUL, 0x144976b4UL, 0xe622f5b7UL, 0xf5720643UL, 0x07198540UL,
+		0x590ab964UL, 0xab613a67UL, 0xb831c993UL, 0x4a5a4a90UL, 0x9e902e7bUL, 0x6cfbad78UL,
+		0x7fab5e8cUL, 0x8dc0dd8fUL, 0xe330a81aUL, 0x115b2b19UL, 0x020bd8edUL, 0xf0605beeUL,
+		0x24aa3f05UL, 0xd6c1bc06UL, 0xc5914ff2UL, 0x37faccf1UL, 0x69e9f0d5UL, 0x9b8273d6UL,
+		0x88d28022UL, 0x7ab90321UL, 0xae7367caUL, 0x5c18e4c9UL, 0x4f48173dUL, 0xbd23943eUL,
+		0xf36e6f75UL, 0x0105ec76UL, 0x12551f82UL, 0xe03e9c81UL, 0x34f4f86aUL, 0xc69f7b69UL,
+		0xd5cf889dUL, 0x27a40b9eUL, 0x79b737baUL, 0x8bdcb4b9UL, 0x988c474dUL, 0x6ae7c44eUL,
+		0xbe2da0a5UL, 0x4c4623a6UL, 0x5f16d052UL, 0xad7d5351UL
+	},
+	{
+		0x00000000UL, 0x13a29877UL, 0x274530eeUL, 0x34e7a899UL, 0x4e8a61dcUL, 0x5d28f9abUL,
+		0x69cf5132UL, 0x7a6dc945UL, 0x9d14c3b8UL, 0x8eb65bcfUL, 0xba51f356UL, 0xa9f36b21UL,
+		0xd39ea264UL, 0xc03c3a13UL, 0xf4db928aUL, 0xe7790afdUL, 0x3fc5f181UL, 0x2c6769f6UL,
+		0x1880c16fUL, 0x0b225918UL, 0x714f905dUL, 0x62ed082aUL, 0x560aa0b3UL, 0x45a838c4UL,
+		0xa2d13239UL, 0xb173aa4eUL, 0x859402d7UL, 0x96369aa0UL, 0xec5b53e5UL, 0xfff9cb92UL,
+		0xcb1e630bUL, 0xd8bcfb7cUL, 0x7f8be302UL, 0x6c297b75UL, 0x58ced3ecUL, 0x4b6c4b9bUL,
+		0x310182deUL, 0x22a31aa9UL, 0x1644b230UL, 0x05e62a47UL, 0xe29f20baUL, 0xf13db8cdUL,
+		0xc5da1054UL, 0xd6788823UL, 0xac154166UL, 0xbfb7d911UL, 0x8b507188UL, 0x98f2e9ffUL,
+		0x404e1283UL, 0x53ec8af4UL, 0x670b226dUL, 0x74a9ba1aUL, 0x0ec4735fUL, 0x1d66eb28UL,
+		0x298143b1UL, 0x3a23dbc6UL, 0xdd5ad13bUL, 0xcef8494cUL, 0xfa1fe1d5UL, 0xe9bd79a2UL,
+		0x93d0b0e7UL, 0x80722890UL, 0xb4958009UL, 0xa737187eUL, 0xff17c604UL, 0xecb55e73UL,
+		0xd852f6eaUL, 0xcbf06e9dUL, 0xb19da7d8UL, 0xa23f3fafUL, 0x96d89736UL, 0x857a0f41UL,
+		0x620305bcUL, 0x71a19dcbUL, 0x45463552UL, 0x56e4ad25UL, 0x2c896460UL, 0x3f2bfc17UL,
+		0x0bcc548eUL, 0x186eccf9UL, 0xc0d23785UL, 0xd370aff2UL, 0xe797076bUL, 0xf4359f1cUL,
+		0x8e585659UL, 0x9dface2eUL, 0xa91d66b7UL, 0xbabffec0UL, 0x5dc6f43dUL, 0x4e646c4aUL,
+		0x7a83c4d3UL, 0x69215ca4UL, 0x134c95e1UL, 0x00ee0d96UL, 0x3409a50fUL, 0x27ab3d78UL,
+		0x809c2506UL, 0x933ebd71UL, 0xa7d915e8UL, 0xb47b8d9fUL, 0xce1644daUL, 0xddb4dcadUL,
+		0xe9537434UL, 0xfaf1ec43UL, 0x1d88e6beUL, 0x0e2a7ec9UL, 0x3acdd650UL, 0x296f4e27UL,
+		0x53028762UL, 0x40a01f15UL, 0x7447b78cUL, 0x67e52ffbUL, 0xbf59d487UL, 0xacfb4cf0UL,
+		0x981ce469UL, 0x8bbe7c1eUL, 0xf1d3b55bUL, 0xe2712d2cUL, 0xd69685b5UL, 0xc5341dc2UL,
+		0x224d173fUL, 0x31ef8f48UL, 0x050827d1UL, 0x16aabfa6UL, 0x6cc776e3UL, 0x7f65ee94UL,
+		0x4b82460dUL, 0x5820de7aUL, 0xfbc3faf9UL, 0xe861628eUL, 0xdc86ca17UL, 0xcf245260UL,
+		0xb5499b25UL, 0xa6eb0352UL, 0x920cabcbUL, 0x81ae33bcUL, 0x66d73941UL, 0x7575a136UL,
+		0x419209afUL, 0x523091d8UL, 0x285d589dUL, 0x3bffc0eaUL, 0x0f186873UL, 0x1cbaf004UL,
+		0xc4060b78UL, 0xd7a4930fUL, 0xe3433b96UL, 0xf0e1a3e1UL, 0x8a8c6aa4UL, 0x992ef2d3UL,
+		0xadc95a4aUL, 0xbe6bc23dUL, 0x5912c8c0UL, 0x4ab050b7UL, 0x7e57f82eUL, 0x6df56059UL,
+		0x1798a91cUL, 0x043a316bUL, 0x30dd99f2UL, 0x237f0185UL, 0x844819fbUL, 0x97ea818cUL,
+		0xa30d2915UL, 0xb0afb162UL, 0xcac27827UL, 0xd960e050UL, 0xed8748c9UL, 0xfe25d0beUL,
+		0x195cda43UL, 0x0afe4234UL, 0x3e19eaadUL, 0x2dbb72daUL, 0x57d6bb9fUL, 0x447423e8UL,
+		0x70938b71UL, 0x63311306UL, 0xbb8de87aUL, 0xa82f700dUL, 0x9cc8d894UL, 0x8f6a40e3UL,
+		0xf50789a6UL, 0xe6a511d1UL, 0xd242b948UL, 0xc1e0213fUL, 0x26992bc2UL, 0x353bb3b5UL,
+		0x01dc1b2cUL, 0x127e835bUL, 0x68134a1eUL, 0x7bb1d269UL, 0x4f567af0UL, 0x5cf4e287UL,
+		0x04d43cfdUL, 0x1776a48aUL, 0x23910c13UL, 0x30339464UL, 0x4a5e5d21UL, 0x59fcc556UL,
+		0x6d1b6dcfUL, 0x7eb9f5b8UL, 0x99c0ff45UL, 0x8a626732UL, 0xbe85cfabUL, 0xad2757dcUL,
+		0xd74a9e99UL, 0xc4e806eeUL, 0xf00fae77UL, 0xe3ad3600UL, 0x3b11cd7cUL, 0x28b3550bUL,
+		0x1c54fd92UL, 0x0ff665e5UL, 0x759baca0UL, 0x663934d7UL, 0x52de9c4eUL, 0x417c0439UL,
+		0xa6050ec4UL, 0xb5a796b3UL, 0x81403e2aUL, 0x92e2a65dUL, 0xe88f6f18UL, 0xfb2df76fUL,
+		0xcfca5ff6UL, 0xdc68c781UL, 0x7b5fdfffUL, 0x68fd4788UL, 0x5c1aef11UL, 0x4fb87766UL,
+		0x35d5be23UL, 0x26772654UL, 0x12908ecdUL, 0x013216baUL, 0xe64b1c47UL, 0xf5e98430UL,
+		0xc10e2ca9UL, 0xd2acb4deUL, 0xa8c17d9bUL, 0xbb63e5ecUL, 0x8f844d75UL, 0x9c26d502UL,
+		0x449a2e7eUL, 0x5738b609UL, 0x63df1e90UL, 0x707d86e7UL, 0x0a104fa2UL, 0x19b2d7d5UL,
+		0x2d557f4cUL, 0x3ef7e73bUL, 0xd98eedc6UL, 0xca2c75b1UL, 0xfecbdd28UL, 0xed69455fUL,
+		0x97048c1aUL, 0x84a6146dUL, 0xb041bcf4UL, 0xa3e32483UL
+	},
+	{
+		0x00000000UL, 0xa541927eUL, 0x4f6f520dUL, 0xea2ec073UL, 0x9edea41aUL, 0x3b9f3664UL,
+		0xd1b1f617UL, 0x74f06469UL, 0x38513ec5UL, 0x9d10acbbUL, 0x773e6cc8UL, 0xd27ffeb6UL,
+		0xa68f9adfUL, 0x03ce08a1UL, 0xe9e0c8d2UL, 0x4ca15aacUL, 0x70a27d8aUL, 0xd5e3eff4UL,
+		0x3fcd2f87UL, 0x9a8cbdf9UL, 0xee7cd990UL, 0x4b3d4beeUL, 0xa1138b9dUL, 0x045219e3UL,
+		0x48f3434fUL, 0xedb2d131UL, 0x079c1142UL, 0xa2dd833cUL, 0xd62de755UL, 0x736c752bUL,
+		0x9942b558UL, 0x3c032726UL, 0xe144fb14UL, 0x4405696aUL, 0xae2ba919UL, 0x0b6a3b67UL,
+		0x7f9a5f0eUL, 0xdadbcd70UL, 0x30f50d03UL, 0x95b49f7dUL, 0xd915c5d1UL, 0x7c5457afUL,
+		0x967a97dcUL, 0x333b05a2UL, 0x47cb61cbUL, 0xe28af3b5UL, 0x08a433c6UL, 0xade5a1b8UL,
+		0x91e6869eUL, 0x34a714e0UL, 0xde89d493UL, 0x7bc846edUL, 0x0f382284UL, 0xaa79b0faUL,
+		0x40577089UL, 0xe516e2f7UL, 0xa9b7b85bUL, 0x0cf62a25UL, 0xe6d8ea56UL, 0x43997828UL,
+		0x37691c41UL, 0x92288e3fUL, 0x78064e4cUL, 0xdd47dc32UL, 0xc76580d9UL, 0x622412a7UL,
+		0x880ad2d4UL, 0x2d4b40aaUL, 0x59bb24c3UL, 0xfcfab6bdUL, 0x16d476ceUL, 0xb395e4b0UL,
+		0xff34be1cUL, 0x5a752c62UL, 0xb05bec11UL, 0x151a7e6fUL, 0x61ea1a06UL, 0xc4ab8878UL,
+		0x2e85480bUL, 0x8bc4da75UL, 0xb7c7fd53UL, 0x12866f2dUL, 0xf8a8af5eUL, 0x5de93d20UL,
+		0x29195949UL, 0x8c58cb37UL, 0x66760b44UL, 0xc337993aUL, 0x8f96c396UL, 0x2ad751e8UL,
+		0xc0f9919bUL, 0x65b803e5UL, 0x1148678cUL, 0xb409f5f2UL, 0x5e273581UL, 0xfb66a7ffUL,
+		0x26217bcdUL, 0x8360e9b3UL, 0x694e29c0UL, 0xcc0fbbbeUL, 0xb8ffdfd7UL, 0x1dbe4da9UL,
+		0xf7908ddaUL, 0x52d11fa4UL, 0x1e704508UL, 0xbb31d776UL, 0x511f1705UL, 0xf45e857bUL,
+		0x80aee112UL, 0x25ef736cUL, 0xcfc1b31fUL, 0x6a802161UL, 0x56830647UL, 0xf3c29439UL,
+		0x19ec544aUL, 0xbcadc634UL, 0xc85da25dUL, 0x6d1c3023UL, 0x8732f050UL, 0x2273622eUL,
+		0x6ed23882UL, 0xcb93aafcUL, 0x21bd6a8fUL, 0x84fcf8f1UL, 0xf00c9c98UL, 0x554d0ee6UL,
+		0xbf63ce95UL, 0x1a225cebUL, 0x8b277743UL, 0x2e66e53dUL, 0xc448254eUL, 0x6109b730UL,
+		0x15f9d359UL, 0xb0b84127UL, 0x5a968154UL, 0xffd7132aUL, 0xb3764986UL, 0x1637dbf8UL,
+		0xfc191b8bUL, 0x595889f5UL, 0x2da8ed9cUL, 0x88e97fe2UL, 0x62c7bf91UL, 0xc7862defUL,
+		0xfb850ac9UL, 0x5ec498b7UL, 0xb4ea58c4UL, 0x11abcabaUL, 0x655baed3UL, 0xc01a3cadUL,
+		0x2a34fcdeUL, 0x8f756ea0UL, 0xc3d4340cUL, 0x6695a672UL, 0x8cbb6601UL, 0x29faf47fUL,
+		0x5d0a9016UL, 0xf84b0268UL, 0x1265c21bUL, 0xb7245065UL, 0x6a638c57UL, 0xcf221e29UL,
+		0x250cde5aUL, 0x804d4c24UL, 0xf4bd284dUL, 0x51fcba33UL, 0xbbd27a40UL, 0x1e93e83eUL,
+		0x5232b292UL, 0xf77320ecUL, 0x1d5de09fUL, 0xb81c72e1UL, 0xccec1688UL, 0x69ad84f6UL,
+		0x83834485UL, 0x26c2d6fbUL, 0x1ac1f1ddUL, 0xbf8063a3UL, 0x55aea3d0UL, 0xf0ef31aeUL,
+		0x841f55c7UL, 0x215ec7b9UL, 0xcb7007caUL, 0x6e3195b4UL, 0x2290cf18UL, 0x87d15d66UL,
+		0x6dff9d15UL, 0xc8be0f6bUL, 0xbc4e6b02UL, 0x190ff97cUL, 0xf321390fUL, 0x5660ab71UL,
+		0x4c42f79aUL, 0xe90365e4UL, 0x032da597UL, 0xa66c37e9UL, 0xd29c5380UL, 0x77ddc1feUL,
+		0x9df3018dUL, 0x38b293f3UL, 0x7413c95fUL, 0xd1525b21UL, 0x3b7c9b52UL, 0x9e3d092cUL,
+		0xeacd6d45UL, 0x4f8cff3bUL, 0xa5a23f48UL, 0x00e3ad36UL, 0x3ce08a10UL, 0x99a1186eUL,
+		0x738fd81dUL, 0xd6ce4a63UL, 0xa23e2e0aUL, 0x077fbc74UL, 0xed517c07UL, 0x4810ee79UL,
+		0x04b1b4d5UL, 0xa1f026abUL, 0x4bdee6d8UL, 0xee9f74a6UL, 0x9a6f10cfUL, 0x3f2e82b1UL,
+		0xd50042c2UL, 0x7041d0bcUL, 0xad060c8eUL, 0x08479ef0UL, 0xe2695e83UL, 0x4728ccfdUL,
+		0x33d8a894UL, 0x96993aeaUL, 0x7cb7fa99UL, 0xd9f668e7UL, 0x9557324bUL, 0x3016a035UL,
+		0xda386046UL, 0x7f79f238UL, 0x0b899651UL, 0xaec8042fUL, 0x44e6c45cUL, 0xe1a75622UL,
+		0xdda47104UL, 0x78e5e37aUL, 0x92cb2309UL, 0x378ab177UL, 0x437ad51eUL, 0xe63b4760UL,
+		0x0c158713UL, 0xa954156dUL, 0xe5f54fc1UL, 0x40b4ddbfUL, 0xaa9a1dccUL, 0x0fdb8fb2UL,
+		0x7b2bebdbUL, 0xde6a79a5UL, 0x3444b9d6UL, 0x91052ba8UL
+	},
+	{
+		0x00000000UL, 0xdd45aab8UL, 0xbf672381UL, 0x62228939UL, 0x7b2231f3UL, 0xa6679b4bUL,
+		0xc4451272UL, 0x1900b8caUL, 0xf64463e6UL, 0x2b01c95eUL, 0x49234067UL, 0x9466eadfUL,
+		0x8d665215UL, 0x5023f8adUL, 0x32017194UL, 0xef44db2cUL, 0xe964b13dUL, 0x34211b85UL,
+		0x560392bcUL, 0x8b463804UL, 0x924680ceUL, 0x4f032a76UL, 0x2d21a34fUL, 0xf06409f7UL,
+		0x1f20d2dbUL, 0xc2657863UL, 0xa047f15aUL, 0x7d025be2UL, 0x6402e328UL, 0xb9474990UL,
+		0xdb65c0a9UL, 0x06206a11UL, 0xd725148bUL, 0x0a60be33UL, 0x6842370aUL, 0xb5079db2UL,
+		0xac072578UL, 0x71428fc0UL, 0x136006f9UL, 0xce25ac41UL, 0x2161776dUL, 0xfc24ddd5UL,
+		0x9e0654ecUL, 0x4343fe54UL, 0x5a43469eUL, 0x8706ec26UL, 0xe524651fUL, 0x3861cfa7UL,
+		0x3e41a5b6UL, 0xe3040f0eUL, 0x81268637UL, 0x5c632c8fUL, 0x45639445UL, 0x98263efdUL,
+		0xfa04b7c4UL, 0x27411d7cUL, 0xc805c650UL, 0x15406ce8UL, 0x7762e5d1UL, 0xaa274f69UL,
+		0xb327f7a3UL, 0x6e625d1bUL, 0x0c40d422UL, 0xd1057e9aUL, 0xaba65fe7UL, 0x76e3f55fUL,
+		0x14c17c66UL, 0xc984d6deUL, 0xd0846e14UL, 0x0dc1c4acUL, 0x6fe34d95UL, 0xb2a6e72dUL,
+		0x5de23c01UL, 0x80a796b9UL, 0xe2851f80UL, 0x3fc0b538UL, 0x26c00df2UL, 0xfb85a74aUL,
+		0x99a72e73UL, 0x44e284cbUL, 0x42c2eedaUL, 0x9f874462UL, 0xfda5cd5bUL, 0x20e067e3UL,
+		0x39e0df29UL, 0xe4a57591UL, 0x8687fca8UL, 0x5bc25610UL, 0xb4868d3cUL, 0x69c32784UL,
+		0x0be1aebdUL, 0xd6a40405UL, 0xcfa4bccfUL, 0x12e11677UL, 0x70c39f4eUL, 0xad8635f6UL,
+		0x7c834b6cUL, 0xa1c6e1d4UL, 0xc3e468edUL, 0x1ea1c255UL, 0x07a17a9fUL, 0xdae4d027UL,
+		0xb8c6591eUL, 0x6583f3a6UL, 0x8ac7288aUL, 0x57828232UL, 0x35a00b0bUL, 0xe8e5a1b3UL,
+		0xf1e51979UL, 0x2ca0b3c1UL, 0x4e823af8UL, 0x93c79040UL, 0x95e7fa51UL, 0x48a250e9UL,
+		0x2a80d9d0UL, 0xf7c57368UL, 0xeec5cba2UL, 0x3380611aUL, 0x51a2e823UL, 0x8ce7429bUL,
+		0x63a399b7UL, 0xbee6330fUL, 0xdcc4ba36UL, 0x0181108eUL, 0x1881a844UL, 0xc5c402fcUL,
+		0xa7e68bc5UL, 0x7aa3217dUL, 0x52a0c93fUL, 0x8fe56387UL, 0xedc7eabeUL, 0x30824006UL,
+		0x2982f8ccUL, 0xf4c75274UL, 0x96e5db4dUL, 0x4ba071f5UL, 0xa4e4aad9UL, 0x79a10061UL,
+		0x1b838958UL, 0xc6c623e0UL, 0xdfc69b2aUL, 0x02833192UL, 0x60a1b8abUL, 0xbde41213UL,
+		0xbbc47802UL, 0x6681d2baUL, 0x04a35b83UL, 0xd9e6f13bUL, 0xc0e649f1UL, 0x1da3e349UL,
+		0x7f816a70UL, 0xa2c4c0c8UL, 0x4d801be4UL, 0x90c5b15cUL, 0xf2e73865UL, 0x2fa292ddUL,
+		0x36a22a17UL, 0xebe780afUL, 0x89c50996UL, 0x5480a32eUL, 0x8585ddb4UL, 0x58c0770cUL,
+		0x3ae2fe35UL, 0xe7a7548dUL, 0xfea7ec47UL, 0x23e246ffUL, 0x41c0cfc6UL, 0x9c85657eUL,
+		0x73c1be52UL, 0xae8414eaUL, 0xcca69dd3UL, 0x11e3376bUL, 0x08e38fa1UL, 0xd5a62519UL,
+		0xb784ac20UL, 0x6ac10698UL, 0x6ce16c89UL, 0xb1a4c631UL, 0xd3864f08UL, 0x0ec3e5b0UL,
+		0x17c35d7aUL, 0xca86f7c2UL, 0xa8a47efbUL, 0x75e1d443UL, 0x9aa50f6fUL, 0x47e0a5d7UL,
+		0x25c22ceeUL, 0xf8878656UL, 0xe1873e9cUL, 0x3cc29424UL, 0x5ee01d1dUL, 0x83a5b7a5UL,
+		0xf90696d8UL, 0x24433c60UL, 0x4661b559UL, 0x9b241fe1UL, 0x8224a72bUL, 0x5f610d93UL,
+		0x3d4384aaUL, 0xe0062e12UL, 0x0f42f53eUL, 0xd2075f86UL, 0xb025d6bfUL, 0x6d607c07UL,
+		0x7460c4cdUL, 0xa9256e75UL, 0xcb07e74cUL, 0x16424df4UL, 0x106227e5UL, 0xcd278d5dUL,
+		0xaf050464UL, 0x7240aedcUL, 0x6b401616UL, 0xb605bcaeUL, 0xd4273597UL, 0x09629f2fUL,
+		0xe6264403UL, 0x3b63eebbUL, 0x59416782UL, 0x8404cd3aUL, 0x9d0475f0UL, 0x4041df48UL,
+		0x22635671UL, 0xff26fcc9UL, 0x2e238253UL, 0xf36628ebUL, 0x9144a1d2UL, 0x4c010b6aUL,
+		0x5501b3a0UL, 0x88441918UL, 0xea669021UL, 0x37233a99UL, 0xd867e1b5UL, 0x05224b0dUL,
+		0x6700c234UL, 0xba45688cUL, 0xa345d046UL, 0x7e007afeUL, 0x1c22f3c7UL, 0xc167597fUL,
+		0xc747336eUL, 0x1a0299d6UL, 0x782010efUL, 0xa565ba57UL, 0xbc65029dUL, 0x6120a825UL,
+		0x0302211cUL, 0xde478ba4UL, 0x31035088UL, 0xec46fa30UL, 0x8e647309UL, 0x5321d9b1UL,
+		0x4a21617bUL, 0x9764cbc3UL, 0xf54642faUL, 0x2803e842UL
+	},
+	{
+		0x00000000UL, 0x38116facUL, 0x7022df58UL, 0x4833b0f4UL, 0xe045beb0UL, 0xd854d11cUL,
+		0x906761e8UL, 0xa8760e44UL, 0xc5670b91UL, 0xfd76643dUL, 0xb545d4c9UL, 0x8d54bb65UL,
+		0x2522b521UL, 0x1d33da8dUL, 0x55006a79UL, 0x6d1105d5UL, 0x8f2261d3UL, 0xb7330e7fUL,
+		0xff00be8bUL, 0xc711d127UL, 0x6f67df63UL, 0x5776b0cfUL, 0x1f45003bUL, 0x27546f97UL,
+		0x4a456a42UL, 0x725405eeUL, 0x3a67b51aUL, 0x0276dab6UL, 0xaa00d4f2UL, 0x9211bb5eUL,
+		0xda220baaUL, 0xe2336406UL, 0x1ba8b557UL, 0x23b9dafbUL, 0x6b8a6a0fUL, 0x539b05a3UL,
+		0xfbed0be7UL, 0xc3fc644bUL, 0x8bcfd4bfUL, 0xb3debb13UL, 0xdecfbec6UL, 0xe6ded16aUL,
+		0xaeed619eUL, 0x96fc0e32UL, 0x3e8a0076UL, 0x069b6fdaUL, 0x4ea8df2eUL, 0x76b9b082UL,
+		0x948ad484UL, 0xac9bbb28UL, 0xe4a80bdcUL, 0xdcb96470UL, 0x74cf6a34UL, 0x4cde0598UL,
+		0x04edb56cUL, 0x3cfcdac0UL, 0x51eddf15UL, 0x69fcb0b9UL, 0x21cf004dUL, 0x19de6fe1UL,
+		0xb1a861a5UL, 0x89b90e09UL, 0xc18abefdUL, 0xf99bd151UL, 0x37516aaeUL, 0x0f400502UL,
+		0x4773b5f6UL, 0x7f62da5aUL, 0xd714d41eUL, 0xef05bbb2UL, 0xa7360b46UL, 0x9f2764eaUL,
+		0xf236613fUL, 0xca270e93UL, 0x8214be67UL, 0xba05d1cbUL, 0x1273df8fUL, 0x2a62b023UL,
+		0x625100d7UL, 0x5a406f7bUL, 0xb8730b7dUL, 0x806264d1UL, 0xc851d425UL, 0xf040bb89UL,
+		0x5836b5cdUL, 0x6027da61UL, 0x28146a95UL, 0x10050539UL, 0x7d1400ecUL, 0x45056f40UL,
+		0x0d36dfb4UL, 0x3527b018UL, 0x9d51be5cUL, 0xa540d1f0UL, 0xed736104UL, 0xd5620ea8UL,
+		0x2cf9dff9UL, 0x14e8b055UL, 0x5cdb00a1UL, 0x64ca6f0dUL, 0xccbc6149UL, 0xf4ad0ee5UL,
+		0xbc9ebe11UL, 0x848fd1bdUL, 0xe99ed468UL, 0xd18fbbc4UL, 0x99bc0b30UL, 0xa1ad649cUL,
+		0x09db6ad8UL, 0x31ca0574UL, 0x79f9b580UL, 0x41e8da2cUL, 0xa3dbbe2aUL, 0x9bcad186UL,
+		0xd3f96172UL, 0xebe80edeUL, 0x439e009aUL, 0x7b8f6f36UL, 0x33bcdfc2UL, 0x0badb06eUL,
+		0x66bcb5bbUL, 0x5eadda17UL, 0x169e6ae3UL, 0x2e8f054fUL, 0x86f90b0bUL, 0xbee864a7UL,
+		0xf6dbd453UL, 0xcecabbffUL, 0x6ea2d55cUL, 0x56b3baf0UL, 0x1e800a04UL, 0x269165a8UL,
+		0x8ee76becUL, 0xb6f60440UL, 0xfec5b4b4UL, 0xc6d4db18UL, 0xabc5decdUL, 0x93d4b161UL,
+		0xdbe70195UL, 0xe3f66e39UL, 0x4b80607dUL, 0x73910fd1UL, 0x3ba2bf25UL, 0x03b3d089UL,
+		0xe180b48fUL, 0xd991db23UL, 0x91a26bd7UL, 0xa9b3047bUL, 0x01c50a3fUL, 0x39d46593UL,
+		0x71e7d567UL, 0x49f6bacbUL, 0x24e7bf1eUL, 0x1cf6d0b2UL, 0x54c56046UL, 0x6cd40feaUL,
+		0xc4a201aeUL, 0xfcb36e02UL, 0xb480def6UL, 0x8c91b15aUL, 0x750a600bUL, 0x4d1b0fa7UL,
+		0x0528bf53UL, 0x3d39d0ffUL, 0x954fdebbUL, 0xad5eb117UL, 0xe56d01e3UL, 0xdd7c6e4fUL,
+		0xb06d6b9aUL, 0x887c0436UL, 0xc04fb4c2UL, 0xf85edb6eUL, 0x5028d52aUL, 0x6839ba86UL,
+		0x200a0a72UL, 0x181b65deUL, 0xfa2801d8UL, 0xc2396e74UL, 0x8a0ade80UL, 0xb21bb12cUL,
+		0x1a6dbf68UL, 0x227cd0c4UL, 0x6a4f6030UL, 0x525e0f9cUL, 0x3f4f0a49UL, 0x075e65e5UL,
+		0x4f6dd511UL, 0x777cbabdUL, 0xdf0ab4f9UL, 0xe71bdb55UL, 0xaf286ba1UL, 0x9739040dUL,
+		0x59f3bff2UL, 0x61e2d05eUL, 0x29d160aaUL, 0x11c00f06UL, 0xb9b60142UL, 0x81a76eeeUL,
+		0xc994de1aUL, 0xf185b1b6UL, 0x9c94b463UL, 0xa485dbcfUL, 0xecb66b3bUL, 0xd4a70497UL,
+		0x7cd10ad3UL, 0x44c0657fUL, 0x0cf3d58bUL, 0x34e2ba27UL, 0xd6d1de21UL, 0xeec0b18dUL,
+		0xa6f30179UL, 0x9ee26ed5UL, 0x36946091UL, 0x0e850f3dUL, 0x46b6bfc9UL, 0x7ea7d065UL,
+		0x13b6d5b0UL, 0x2ba7ba1cUL, 0x63940ae8UL, 0x5b856544UL, 0xf3f36b00UL, 0xcbe204acUL,
+		0x83d1b458UL, 0xbbc0dbf4UL, 0x425b0aa5UL, 0x7a4a6509UL, 0x3279d5fdUL, 0x0a68ba51UL,
+		0xa21eb415UL, 0x9a0fdbb9UL, 0xd23c6b4dUL, 0xea2d04e1UL, 0x873c0134UL, 0xbf2d6e98UL,
+		0xf71ede6cUL, 0xcf0fb1c0UL, 0x6779bf84UL, 0x5f68d028UL, 0x175b60dcUL, 0x2f4a0f70UL,
+		0xcd796b76UL, 0xf56804daUL, 0xbd5bb42eUL, 0x854adb82UL, 0x2d3cd5c6UL, 0x152dba6aUL,
+		0x5d1e0a9eUL, 0x650f6532UL, 0x081e60e7UL, 0x300f0f4bUL, 0x783cbfbfUL, 0x402dd013UL,
+		0xe85bde57UL, 0xd04ab1fbUL, 0x9879010fUL, 0xa0686ea3UL
+	},
+	{
+		0x00000000UL, 0xef306b19UL, 0xdb8ca0c3UL, 0x34bccbdaUL, 0xb2f53777UL, 0x5dc55c6eUL,
+		0x697997b4UL, 0x8649fcadUL, 0x6006181fUL, 0x8f367306UL, 0xbb8ab8dcUL, 0x54bad3c5UL,
+		0xd2f32f68UL, 0x3dc34471UL, 0x097f8fabUL, 0xe64fe4b2UL, 0xc00c303eUL, 0x2f3c5b27UL,
+		0x1b8090fdUL, 0xf4b0fbe4UL, 0x72f90749UL, 0x9dc96c50UL, 0xa975a78aUL, 0x4645cc93UL,
+		0xa00a2821UL, 0x4f3a4338UL, 0x7b8688e2UL, 0x94b6e3fbUL, 0x12ff1f56UL, 0xfdcf744fUL,
+		0xc973bf95UL, 0x2643d48cUL, 0x85f4168dUL, 0x6ac47d94UL, 0x5e78b64eUL, 0xb148dd57UL,
+		0x370121faUL, 0xd8314ae3UL, 0xec8d8139UL, 0x03bdea20UL, 0xe5f20e92UL, 0x0ac2658bUL,
+		0x3e7eae51UL, 0xd14ec548UL, 0x570739e5UL, 0xb83752fcUL, 0x8c8b9926UL, 0x63bbf23fUL,
+		0x45f826b3UL, 0xaac84daaUL, 0x9e748670UL, 0x7144ed69UL, 0xf70d11c4UL, 0x183d7addUL,
+		0x2c81b107UL, 0xc3b1da1eUL, 0x25fe3eacUL, 0xcace55b5UL, 0xfe729e6fUL, 0x1142f576UL,
+		0x970b09dbUL, 0x783b62c2UL, 0x4c87a918UL, 0xa3b7c201UL, 0x0e045bebUL, 0xe13430f2UL,
+		0xd588fb28UL, 0x3ab89031UL, 0xbcf16c9cUL, 0x53c10785UL, 0x677dcc5fUL, 0x884da746UL,
+		0x6e0243f4UL, 0x813228edUL, 0xb58ee337UL, 0x5abe882eUL, 0xdcf77483UL, 0x33c71f9aUL,
+		0x077bd440UL, 0xe84bbf59UL, 0xce086bd5UL, 0x213800ccUL, 0x1584cb16UL, 0xfab4a00fUL,
+		0x7cfd5ca2UL, 0x93cd37bbUL, 0xa771fc61UL, 0x48419778UL, 0xae0e73caUL, 0x413e18d3UL,
+		0x7582d309UL, 0x9ab2b810UL, 0x1cfb44bdUL, 0xf3cb2fa4UL, 0xc777e47eUL, 0x28478f67UL,
+		0x8bf04d66UL, 0x64c0267fUL, 0x507ceda5UL, 0xbf4c86bcUL, 0x39057a11UL, 0xd6351108UL,
+		0xe289dad2UL, 0x0db9b1cbUL, 0xebf65579UL, 0x04c63e60UL, 0x307af5baUL, 0xdf4a9ea3UL,
+		0x5903620eUL, 0xb6330917UL, 0x828fc2cdUL, 0x6dbfa9d4UL, 0x4bfc7d58UL, 0xa4cc1641UL,
+		0x9070dd9bUL, 0x7f40b682UL, 0xf9094a2fUL, 0x16392136UL, 0x2285eaecUL, 0xcdb581f5UL,
+		0x2bfa6547UL, 0xc4ca0e5eUL, 0xf076c584UL, 0x1f46ae9dUL, 0x990f5230UL, 0x763f3929UL,
+		0x4283f2f3UL, 0xadb399eaUL, 0x1c08b7d6UL, 0xf338dccfUL, 0xc7841715UL, 0x28b47c0cUL,
+		0xaefd80a1UL, 0x41cdebb8UL, 0x75712062UL, 0x9a414b7bUL, 0x7c0eafc9UL, 0x933ec4d0UL,
+		0xa7820f0aUL, 0x48b26413UL, 0xcefb98beUL, 0x21cbf3a7UL, 0x1577387dUL, 0xfa475364UL,
+		0xdc0487e8UL, 0x3334ecf1UL, 0x0788272bUL, 0xe8b84c32UL, 0x6ef1b09fUL, 0x81c1db86UL,
+		0xb57d105cUL, 0x5a4d7b45UL, 0xbc029ff7UL, 0x5332f4eeUL, 0x678e3f34UL, 0x88be542dUL,
+		0x0ef7a880UL, 0xe1c7c399UL, 0xd57b0843UL, 0x3a4b635aUL, 0x99fca15bUL, 0x76ccca42UL,
+		0x42700198UL, 0xad406a81UL, 0x2b09962cUL, 0xc439fd35UL, 0xf08536efUL, 0x1fb55df6UL,
+		0xf9fab944UL, 0x16cad25dUL, 0x22761987UL, 0xcd46729eUL, 0x4b0f8e33UL, 0xa43fe52aUL,
+		0x90832ef0UL, 0x7fb345e9UL, 0x59f09165UL, 0xb6c0fa7cUL, 0x827c31a6UL, 0x6d4c5abfUL,
+		0xeb05a612UL, 0x0435cd0bUL, 0x308906d1UL, 0xdfb96dc8UL, 0x39f6897aUL, 0xd6c6e263UL,
+		0xe27a29b9UL, 0x0d4a42a0UL, 0x8b03be0dUL, 0x6433d514UL, 0x508f1eceUL, 0xbfbf75d7UL,
+		0x120cec3dUL, 0xfd3c8724UL, 0xc9804cfeUL, 0x26b027e7UL, 0xa0f9db4aUL, 0x4fc9b053UL,
+		0x7b757b89UL, 0x94451090UL, 0x720af422UL, 0x9d3a9f3bUL, 0xa98654e1UL, 0x46b63ff8UL,
+		0xc0ffc355UL, 0x2fcfa84cUL, 0x1b736396UL, 0xf443088fUL, 0xd200dc03UL, 0x3d30b71aUL,
+		0x098c7cc0UL, 0xe6bc17d9UL, 0x60f5eb74UL, 0x8fc5806dUL, 0xbb794bb7UL, 0x544920aeUL,
+		0xb206c41cUL, 0x5d36af05UL, 0x698a64dfUL, 0x86ba0fc6UL, 0x00f3f36bUL, 0xefc39872UL,
+		0xdb7f53a8UL, 0x344f38b1UL, 0x97f8fab0UL, 0x78c891a9UL, 0x4c745a73UL, 0xa344316aUL,
+		0x250dcdc7UL, 0xca3da6deUL, 0xfe816d04UL, 0x11b1061dUL, 0xf7fee2afUL, 0x18ce89b6UL,
+		0x2c72426cUL, 0xc3422975UL, 0x450bd5d8UL, 0xaa3bbec1UL, 0x9e87751bUL, 0x71b71e02UL,
+		0x57f4ca8eUL, 0xb8c4a197UL, 0x8c786a4dUL, 0x63480154UL, 0xe501fdf9UL, 0x0a3196e0UL,
+		0x3e8d5d3aUL, 0xd1bd3623UL, 0x37f2d291UL, 0xd8c2b988UL, 0xec7e7252UL, 0x034e194bUL,
+		0x8507e5e6UL, 0x6a378effUL, 0x5e8b4525UL, 0xb1bb2e3cUL
+	},
+	{
+		0x00000000UL, 0x68032cc8UL, 0xd0065990UL, 0xb8057558UL, 0xa5e0c5d1UL, 0xcde3e919UL,
+		0x75e69c41UL, 0x1de5b089UL, 0x4e2dfd53UL, 0x262ed19bUL, 0x9e2ba4c3UL, 0xf628880bUL,
+		0xebcd3882UL, 0x83ce144aUL, 0x3bcb6112UL, 0x53c84ddaUL, 0x9c5bfaa6UL, 0xf458d66eUL,
+		0x4c5da336UL, 0x245e8ffeUL, 0x39bb3f77UL, 0x51b813bfUL, 0xe9bd66e7UL, 0x81be4a2fUL,
+		0xd27607f5UL, 0xba752b3dUL, 0x02705e65UL, 0x6a7372adUL, 0x7796c224UL, 0x1f95eeecUL,
+		0xa7909bb4UL, 0xcf93b77cUL, 0x3d5b83bdUL, 0x5558af75UL, 0xed5dda2dUL, 0x855ef6e5UL,
+		0x98bb466cUL, 0xf0b86aa4UL, 0x48bd1ffcUL, 0x20be3334UL, 0x73767eeeUL, 0x1b755226UL,
+		0xa370277eUL, 0xcb730bb6UL, 0xd696bb3fUL, 0xbe9597f7UL, 0x0690e2afUL, 0x6e93ce67UL,
+		0xa100791bUL, 0xc90355d3UL, 0x7106208bUL, 0x19050c43UL, 0x04e0bccaUL, 0x6ce39002UL,
+		0xd4e6e55aUL, 0xbce5c992UL, 0xef2d8448UL, 0x872ea880UL, 0x3f2bddd8UL, 0x5728f110UL,
+		0x4acd4199UL, 0x22ce6d51UL, 0x9acb1809UL, 0xf2c834c1UL, 0x7ab7077aUL, 0x12b42bb2UL,
+		0xaab15eeaUL, 0xc2b27222UL, 0xdf57c2abUL, 0xb754ee63UL, 0x0f519b3bUL, 0x6752b7f3UL,
+		0x349afa29UL, 0x5c99d6e1UL, 0xe49ca3b9UL, 0x8c9f8f71UL, 0x917a3ff8UL, 0xf9791330UL,
+		0x417c6668UL, 0x297f4aa0UL, 0xe6ecfddcUL, 0x8eefd114UL, 0x36eaa44cUL, 0x5ee98884UL,
+		0x430c380dUL, 0x2b0f14c5UL, 0x930a619dUL, 0xfb094d55UL, 0xa8c1008fUL, 0xc0c22c47UL,
+		0x78c7591fUL, 0x10c475d7UL, 0x0d21c55eUL, 0x6522e996UL, 0xdd279cceUL, 0xb524b006UL,
+		0x47ec84c7UL, 0x2fefa80fUL, 0x97eadd57UL, 0xffe9f19fUL, 0xe20c4116UL, 0x8a0f6ddeUL,
+		0x320a1886UL, 0x5a09344eUL, 0x09c17994UL, 0x61c2555cUL, 0xd9c72004UL, 0xb1c40cccUL,
+		0xac21bc45UL, 0xc422908dUL, 0x7c27e5d5UL, 0x1424c91dUL, 0xdbb77e61UL, 0xb3b452a9UL,
+		0x0bb127f1UL, 0x63b20b39UL, 0x7e57bbb0UL, 0x16549778UL, 0xae51e220UL, 0xc652cee8UL,
+		0x959a8332UL, 0xfd99affaUL, 0x459cdaa2UL, 0x2d9ff66aUL, 0x307a46e3UL, 0x58796a2bUL,
+		0xe07c1f73UL, 0x887f33bbUL, 0xf56e0ef4UL, 0x9d6d223cUL, 0x25685764UL, 0x4d6b7bacUL,
+		0x508ecb25UL, 0x388de7edUL, 0x808892b5UL, 0xe88bbe7dUL, 0xbb43f3a7UL, 0xd340df6fUL,
+		0x6b45aa37UL, 0x034686ffUL, 0x1ea33676UL, 0x76a01abeUL, 0xcea56fe6UL, 0xa6a6432eUL,
+		0x6935f452UL, 0x0136d89aUL, 0xb933adc2UL, 0xd130810aUL, 0xccd53183UL, 0xa4d61d4bUL,
+		0x1cd36813UL, 0x74d044dbUL, 0x27180901UL, 0x4f1b25c9UL, 0xf71e5091UL, 0x9f1d7c59UL,
+		0x82f8ccd0UL, 0xeafbe018UL, 0x52fe9540UL, 0x3afdb988UL, 0xc8358d49UL, 0xa036a181UL,
+		0x1833d4d9UL, 0x7030f811UL, 0x6dd54898UL, 0x05d66450UL, 0xbdd31108UL, 0xd5d03dc0UL,
+		0x8618701aUL, 0xee1b5cd2UL, 0x561e298aUL, 0x3e1d0542UL, 0x23f8b5cbUL, 0x4bfb9903UL,
+		0xf3feec5bUL, 0x9bfdc093UL, 0x546e77efUL, 0x3c6d5b27UL, 0x84682e7fUL, 0xec6b02b7UL,
+		0xf18eb23eUL, 0x998d9ef6UL, 0x2188ebaeUL, 0x498bc766UL, 0x1a438abcUL, 0x7240a674UL,
+		0xca45d32cUL, 0xa246ffe4UL, 0xbfa34f6dUL, 0xd7a063a5UL, 0x6fa516fdUL, 0x07a63a35UL,
+		0x8fd9098eUL, 0xe7da2546UL, 0x5fdf501eUL, 0x37dc7cd6UL, 0x2a39cc5fUL, 0x423ae097UL,
+		0xfa3f95cfUL, 0x923cb907UL, 0xc1f4f4ddUL, 0xa9f7d815UL, 0x11f2ad4dUL, 0x79f18185UL,
+		0x6414310cUL, 0x0c171dc4UL, 0xb412689cUL, 0xdc114454UL, 0x1382f328UL, 0x7b81dfe0UL,
+		0xc384aab8UL, 0xab878670UL, 0xb66236f9UL, 0xde611a31UL, 0x66646f69UL, 0x0e6743a1UL,
+		0x5daf0e7bUL, 0x35ac22b3UL, 0x8da957ebUL, 0xe5aa7b23UL, 0xf84fcbaaUL, 0x904ce762UL,
+		0x2849923aUL, 0x404abef2UL, 0xb2828a33UL, 0xda81a6fbUL, 0x6284d3a3UL, 0x0a87ff6bUL,
+		0x17624fe2UL, 0x7f61632aUL, 0xc7641672UL, 0xaf673abaUL, 0xfcaf7760UL, 0x94ac5ba8UL,
+		0x2ca92ef0UL, 0x44aa0238UL, 0x594fb2b1UL, 0x314c9e79UL, 0x8949eb21UL, 0xe14ac7e9UL,
+		0x2ed97095UL, 0x46da5c5dUL, 0xfedf2905UL, 0x96dc05cdUL, 0x8b39b544UL, 0xe33a998cUL,
+		0x5b3fecd4UL, 0x333cc01cUL, 0x60f48dc6UL, 0x08f7a10eUL, 0xb0f2d456UL, 0xd8f1f89eUL,
+		0xc5144817UL, 0xad1764dfUL, 0x15121187UL, 0x7d113d4fUL
+	},
+	{
+		0x00000000UL, 0x493c7d27UL, 0x9278fa4eUL, 0xdb448769UL, 0x211d826dUL, 0x6821ff4aUL,
+		0xb3657823UL, 0xfa590504UL, 0x423b04daUL, 0x0b0779fdUL, 0xd043fe94UL, 0x997f83b3UL,
+		0x632686b7UL, 0x2a1afb90UL, 0xf15e7cf9UL, 0xb86201deUL, 0x847609b4UL, 0xcd4a7493UL,
+		0x160ef3faUL, 0x5f328eddUL, 0xa56b8bd9UL, 0xec57f6feUL, 0x37137197UL, 0x7e2f0cb0UL,
+		0xc64d0d6eUL, 0x8f717049UL, 0x5435f720UL, 0x1d098a07UL, 0xe7508f03UL, 0xae6cf224UL,
+		0x7528754dUL, 0x3c14086aUL, 0x0d006599UL, 0x443c18beUL, 0x9f789fd7UL, 0xd644e2f0UL,
+		0x2c1de7f4UL, 0x65219ad3UL, 0xbe651dbaUL, 0xf759609dUL, 0x4f3b6143UL, 0x06071c64UL,
+		0xdd439b0dUL, 0x947fe62aUL, 0x6e26e32eUL, 0x271a9e09UL, 0xfc5e1960UL, 0xb5626447UL,
+		0x89766c2dUL, 0xc04a110aUL, 0x1b0e9663UL, 0x5232eb44UL, 0xa86bee40UL, 0xe1579367UL,
+		0x3a13140eUL, 0x732f6929UL, 0xcb4d68f7UL, 0x827115d0UL, 0x593592b9UL, 0x1009ef9eUL,
+		0xea50ea9aUL, 0xa36c97bdUL, 0x782810d4UL, 0x31146df3UL, 0x1a00cb32UL, 0x533cb615UL,
+		0x8878317cUL, 0xc1444c5bUL, 0x3b1d495fUL, 0x72213478UL, 0xa965b311UL, 0xe059ce36UL,
+		0x583bcfe8UL, 0x1107b2cfUL, 0xca4335a6UL, 0x837f4881UL, 0x79264d85UL, 0x301a30a2UL,
+		0xeb5eb7cbUL, 0xa262caecUL, 0x9e76c286UL, 0xd74abfa1UL, 0x0c0e38c8UL, 0x453245efUL,
+		0xbf6b40ebUL, 0xf6573dccUL, 0x2d13baa5UL, 0x642fc782UL, 0xdc4dc65cUL, 0x9571bb7bUL,
+		0x4e353c12UL, 0x07094135UL, 0xfd504431UL, 0xb46c3916UL, 0x6f28be7fUL, 0x2614c358UL,
+		0x1700aeabUL, 0x5e3cd38cUL, 0x857854e5UL, 0xcc4429c2UL, 0x361d2cc6UL, 0x7f2151e1UL,
+		0xa465d688UL, 0xed59abafUL, 0x553baa71UL, 0x1c07d756UL, 0xc743503fUL, 0x8e7f2d18UL,
+		0x7426281cUL, 0x3d1a553bUL, 0xe65ed252UL, 0xaf62af75UL, 0x9376a71fUL, 0xda4ada38UL,
+		0x010e5d51UL, 0x48322076UL, 0xb26b2572UL, 0xfb575855UL, 0x2013df3cUL, 0x692fa21bUL,
+		0xd14da3c5UL, 0x9871dee2UL, 0x4335598bUL, 0x0a0924acUL, 0xf05021a8UL, 0xb96c5c8fUL,
+		0x6228dbe6UL, 0x2b14a6c1UL, 0x34019664UL, 0x7d3deb43UL, 0xa6796c2aUL, 0xef45110dUL,
+		0x151c1409UL, 0x5c20692eUL, 0x8764ee47UL, 0xce589360UL, 0x763a92beUL, 0x3f06ef99UL,
+		0xe44268f0UL, 0xad7e15d7UL, 0x572710d3UL, 0x1e1b6df4UL, 0xc55fea9dUL, 0x8c6397baUL,
+		0xb0779fd0UL, 0xf94be2f7UL, 0x220f659eUL, 0x6b3318b9UL, 0x916a1dbdUL, 0xd856609aUL,
+		0x0312e7f3UL, 0x4a2e9ad4UL, 0xf24c9b0aUL, 0xbb70e62dUL, 0x60346144UL, 0x29081c63UL,
+		0xd3511967UL, 0x9a6d6440UL, 0x4129e329UL, 0x08159e0eUL, 0x3901f3fdUL, 0x703d8edaUL,
+		0xab7909b3UL, 0xe2457494UL, 0x181c7190UL, 0x51200cb7UL, 0x8a648bdeUL, 0xc358f6f9UL,
+		0x7b3af727UL, 0x32068a00UL, 0xe9420d69UL, 0xa07e704eUL, 0x5a27754aUL, 0x131b086dUL,
+		0xc85f8f04UL, 0x8163f223UL, 0xbd77fa49UL, 0xf44b876eUL, 0x2f0f0007UL, 0x66337d20UL,
+		0x9c6a7824UL, 0xd5560503UL, 0x0e12826aUL, 0x472eff4dUL, 0xff4cfe93UL, 0xb67083b4UL,
+		0x6d3404ddUL, 0x240879faUL, 0xde517cfeUL, 0x976d01d9UL, 0x4c2986b0UL, 0x0515fb97UL,
+		0x2e015d56UL, 0x673d2071UL, 0xbc79a718UL, 0xf545da3fUL, 0x0f1cdf3bUL, 0x4620a21cUL,
+		0x9d642575UL, 0xd4585852UL, 0x6c3a598cUL, 0x250624abUL, 0xfe42a3c2UL, 0xb77edee5UL,
+		0x4d27dbe1UL, 0x041ba6c6UL, 0xdf5f21afUL, 0x96635c88UL, 0xaa7754e2UL, 0xe34b29c5UL,
+		0x380faeacUL, 0x7133d38bUL, 0x8b6ad68fUL, 0xc256aba8UL, 0x19122cc1UL, 0x502e51e6UL,
+		0xe84c5038UL, 0xa1702d1fUL, 0x7a34aa76UL, 0x3308d751UL, 0xc951d255UL, 0x806daf72UL,
+		0x5b29281bUL, 0x1215553cUL, 0x230138cfUL, 0x6a3d45e8UL, 0xb179c281UL, 0xf845bfa6UL,
+		0x021cbaa2UL, 0x4b20c785UL, 0x906440ecUL, 0xd9583dcbUL, 0x613a3c15UL, 0x28064132UL,
+		0xf342c65bUL, 0xba7ebb7cUL, 0x4027be78UL, 0x091bc35fUL, 0xd25f4436UL, 0x9b633911UL,
+		0xa777317bUL, 0xee4b4c5cUL, 0x350fcb35UL, 0x7c33b612UL, 0x866ab316UL, 0xcf56ce31UL,
+		0x14124958UL, 0x5d2e347fUL, 0xe54c35a1UL, 0xac704886UL, 0x7734cfefUL, 0x3e08b2c8UL,
+		0xc451b7ccUL, 0x8d6dcaebUL, 0x56294d82UL, 0x1f1530a5UL
+	}
+};
+
+/* Calculates the CRC-32C of a buffer using the slicing-by-8 table
+ * Returns the updated checksum
+ */
+uint32_t libfsxfs_checksum_calculate_crc32c_table(
+          uint32_t checksum,
+          const uint8_t *buffer,
+          size_t size )
+{
+	uint32_t lower_32bit = 0;
+	uint32_t upper_32bit = 0;
+
+	while( size >= 8 )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 buffer,
+		 lower_32bit );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 &( buffer[ 4 ] ),
+		 upper_32bit );
+
+		lower_32bit ^= checksum;
+
+		checksum = libfsxfs_checksum_crc32c_table[ 7 ][ lower_32bit & 0xff ]
+		         ^ libfsxfs_checksum_crc32c_table[ 6 ][ ( lower_32bit >> 8 ) & 0xff ]
+		         ^ libfsxfs_checksum_crc32c_table[ 5 ][ ( lower_32bit >> 16 ) & 0xff ]
+		         ^ libfsxfs_checksum_crc32c_table[ 4 ][ lower_32bit >> 24 ]
+		         ^ libfsxfs_checksum_crc32c_table[ 3 ][ upper_32bit & 0xff ]
+		         ^ libfsxfs_checksum_crc32c_table[ 2 ][ ( upper_32bit >> 8 ) & 0xff ]
+		         ^ libfsxfs_checksum_crc32c_table[ 1 ][ ( upper_32bit >> 16 ) & 0xff ]
+		         ^ libfsxfs_checksum_crc32c_table[ 0 ][ upper_32bit >> 24 ];
+
+		buffer += 8;
+		size   -= 8;
+	}
+	while( size > 0 )
+	{
+		checksum = libfsxfs_checksum_crc32c_table[ 0 ][ ( checksum ^ *buffer ) & 0xff ] ^ ( checksum >> 8 );
+
+		buffer += 1;
+		size   -= 1;
+	}
+	return( checksum );
+}
+
+#if defined( HAVE_LIBFSXFS_CRC32C_SSE42_SUPPORT )
+
+/* Calculates the CRC-32C of a buffer using the SSE4.2 CRC32 instruction
+ * Returns the updated checksum
+ */
+__attribute__((target("sse4.2")))
+uint32_t libfsxfs_checksum_calculate_crc32c_sse42(
+          uint32_t checksum,
+          const uint8_t *buffer,
+          size_t size )
+{
+#if defined( __x86_64__ )
+	uint64_t value_64bit = 0;
+#endif
+	uint32_t value_32bit = 0;
+
+#if defined( __x86_64__ )
+	while( size >= 8 )
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 buffer,
+		 value_64bit );
+
+		checksum = (uint32_t) _mm_crc32_u64(
+		                       (uint64_t) checksum,
+		                       value_64bit );
+
+		buffer += 8;
+		size   -= 8;
+	}
+#endif
+	while( size >= 4 )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 buffer,
+		 value_32bit );
+
+		checksum = _mm_crc32_u32(
+		            checksum,
+		            value_32bit );
+
+		buffer += 4;
+		size   -= 4;
+	}
+	while( size > 0 )
+	{
+		checksum = _mm_crc32_u8(
+		            checksum,
+		            *buffer );
+
+		buffer += 1;
+		size   -= 1;
+	}
+	return( checksum );
+}
+
+#endif /* defined( HAVE_LIBFSXFS_CRC32C_SSE42_SUPPORT ) */
+
+#if defined( HAVE_LIBFSXFS_CRC32C_ARMV8_SUPPORT )
+
+/* Calculates the CRC-32C of a buffer using the ARMv8 CRC32C instructions
+ * Returns the updated checksum
+ */
+uint32_t libfsxfs_checksum_calculate_crc32c_armv8(
+          uint32_t checksum,
+          const uint8_t *buffer,
+          size_t size )
+{
+	uint64_t value_64bit = 0;
+
+	while( size >= 8 )
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 buffer,
+		 value_64bit );
+
+		checksum = __crc32cd(
+		            checksum,
+		            value_64bit );
+
+		buffer += 8;
+		size   -= 8;
+	}
+	while( size > 0 )
+	{
+		checksum = __crc32cb(
+		            checksum,
+		            *buffer );
+
+		buffer += 1;
+		size   -= 1;
+	}
+	return( checksum );
+}
+
+#endif /* defined( HAVE_LIBFSXFS_CRC32C_ARMV8_SUPPORT ) */
+
+/* Calculates the CRC-32C (Castagnoli) of a buffer
+ * The checksum is not inverted before or after the calculation
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_checksum_calculate_crc32c(
+     uint32_t *checksum,
+     const uint8_t *buffer,
+     size_t size,
+     uint32_t initial_value,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_checksum_calculate_crc32c";
+
+	if( checksum == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checksum.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_CRC32C_SSE42_SUPPORT )
+	if( __builtin_cpu_supports( "sse4.2" ) )
+	{
+		*checksum = libfsxfs_checksum_calculate_crc32c_sse42(
+		             initial_value,
+		             buffer,
+		             size );
+
+		return( 1 );
+	}
+#elif defined( HAVE_LIBFSXFS_CRC32C_ARMV8_SUPPORT )
+	*checksum = libfsxfs_checksum_calculate_crc32c_armv8(
+	             initial_value,
+	             buffer,
+	             size );
+
+	return( 1 );
+#endif
+	*checksum = libfsxfs_checksum_calculate_crc32c_table(
+	             initial_value,
+	             buffer,
+	             size );
+
+	return( 1 );
+}
+
+/* Verifies the CRC-32C checksum of version 5 metadata
+ * The checksum is calculated over the data with the 4 bytes of the stored checksum set to 0
+ * Returns 1 if successful or -1 on error or if the checksum does not match
+ */
+int libfsxfs_checksum_verify_metadata_checksum(
+     const uint8_t *data,
+     size_t data_size,
+     size_t checksum_offset,
+     libcerror_error_t **error )
+{
+	uint8_t empty_checksum[ 4 ]  = { 0, 0, 0, 0 };
+
+	static char *function        = "libfsxfs_checksum_verify_metadata_checksum";
+	uint32_t calculated_checksum = 0;
+	uint32_t stored_checksum     = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < 4 )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( checksum_offset > ( data_size - 4 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid checksum offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 &( data[ checksum_offset ] ),
+	 stored_checksum );
+
+	if( libfsxfs_checksum_calculate_crc32c(
+	     &calculated_checksum,
+	     data,
+	     checksum_offset,
+	     0xffffffffUL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to calculate CRC-32C.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsxfs_checksum_calculate_crc32c(
+	     &calculated_checksum,
+	     empty_checksum,
+	     4,
+	     calculated_checksum,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to calculate CRC-32C.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsxfs_checksum_calculate_crc32c(
+	     &calculated_checksum,
+	     &( data[ checksum_offset + 4 ] ),
+	     data_size - ( checksum_offset + 4 ),
+	     calculated_checksum,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to calculate CRC-32C.",
+		 function );
+
+		return( -1 );
+	}
+	calculated_checksum ^= 0xffffffffUL;
+
+	if( stored_checksum != calculated_checksum )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_CHECKSUM_MISMATCH,
+		 "%s: mismatch in checksum ( stored: 0x%08" PRIx32 ", calculated: 0x%08" PRIx32 " ).",
+		 function,
+		 stored_checksum,
+		 calculated_checksum );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,85 @@
+/*
+ * Checksum functions
+ *
+ * Copyright (C) 2020-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSXFS_CHECKSUM_H )
+#define _LIBFSXFS_CHECKSUM_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsxfs_libcerror.h"
+
+/* HAVE_LIBFSXFS_CRC32C_SSE42_SUPPORT and HAVE_LIBFSXFS_CRC32C_ARMV8_SUPPORT are defined by configure
+ */
+#if defined( HAVE_LIBFSXFS_CRC32C_SSE42_SUPPORT )
+#include <nmmintrin.h>
+
+#elif defined( HAVE_LIBFSXFS_CRC32C_ARMV8_SUPPORT )
+#include <arm_acle.h>
+
+#endif
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+uint32_t libfsxfs_checksum_calculate_crc32c_table(
+          uint32_t checksum,
+          const uint8_t *buffer,
+          size_t size );
+
+#if defined( HAVE_LIBFSXFS_CRC32C_SSE42_SUPPORT )
+
+uint32_t libfsxfs_checksum_calculate_crc32c_sse42(
+          uint32_t checksum,
+          const uint8_t *buffer,
+          size_t size );
+
+#endif /* defined( HAVE_LIBFSXFS_CRC32C_SSE42_SUPPORT ) */
+
+#if defined( HAVE_LIBFSXFS_CRC32C_ARMV8_SUPPORT )
+
+uint32_t libfsxfs_checksum_calculate_crc32c_armv8(
+          uint32_t checksum,
+          const uint8_t *buffer,
+          size_t size );
+
+#endif /* defined( HAVE_LIBFSXFS_CRC32C_ARMV8_SUPPORT ) */
+
+int libfsxfs_checksum_calculate_crc32c(
+     uint32_t *checksum,
+     const uint8_t *buffer,
+     size_t size,
+     uint32_t initial_value,
+     libcerror_error_t **error );
+
+int libfsxfs_checksum_verify_metadata_checksum(
+     const uint8_t *data,
+     size_t data_size,
+     size_t checksum_offset,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSXFS_CHECKSUM_H ) */
+
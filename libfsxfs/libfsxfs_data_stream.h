@@ -25,8 +25,6 @@
 #include <common.h>
 #include <types.h>
 
-#include "libfsxfs_inode.h"
-#include "libfsxfs_io_handle.h"
 #include "libfsxfs_libbfio.h"
 #include "libfsxfs_libcerror.h"
 #include "libfsxfs_libfdata.h"
@@ -41,20 +39,6 @@ int libfsxfs_data_stream_initialize_from_data(
      size64_t data_size,
      libcerror_error_t **error );
 
-int libfsxfs_data_stream_initialize_from_extents(
-     libfdata_stream_t **data_stream,
-     libfsxfs_io_handle_t *io_handle,
-     libfsxfs_inode_t *inode,
-     size64_t data_size,
-     libcerror_error_t **error );
-
-int libfsxfs_data_stream_initialize(
-     libfdata_stream_t **data_stream,
-     libfsxfs_io_handle_t *io_handle,
-     libfsxfs_inode_t *inode,
-     size64_t data_size,
-     libcerror_error_t **error );
-
 #if defined( __cplusplus )
 }
 #endif
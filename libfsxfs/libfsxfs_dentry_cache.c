@@ -0,0 +1,890 @@
+/*
+ * Directory entry (dentry) cache functions
+ *
+ * Copyright (C) 2020-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfsxfs_definitions.h"
+#include "libfsxfs_dentry_cache.h"
+#include "libfsxfs_directory_entry.h"
+#include "libfsxfs_directory_hash.h"
+#include "libfsxfs_libcerror.h"
+#include "libfsxfs_libcthreads.h"
+
+/* Creates a dentry cache
+ * Make sure the value dentry_cache is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_dentry_cache_initialize(
+     libfsxfs_dentry_cache_t **dentry_cache,
+     int maximum_number_of_values,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_dentry_cache_initialize";
+
+	if( dentry_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid dentry cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *dentry_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid dentry cache value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_values < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid maximum number of values value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	*dentry_cache = memory_allocate_structure(
+	                 libfsxfs_dentry_cache_t );
+
+	if( *dentry_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create dentry cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *dentry_cache,
+	     0,
+	     sizeof( libfsxfs_dentry_cache_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear dentry cache.",
+		 function );
+
+		memory_free(
+		 *dentry_cache );
+
+		*dentry_cache = NULL;
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( ( *dentry_cache )->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	( *dentry_cache )->maximum_number_of_values = maximum_number_of_values;
+
+	return( 1 );
+
+on_error:
+	if( *dentry_cache != NULL )
+	{
+		memory_free(
+		 *dentry_cache );
+
+		*dentry_cache = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a dentry cache
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_dentry_cache_free(
+     libfsxfs_dentry_cache_t **dentry_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_dentry_cache_free";
+	int result            = 1;
+
+	if( dentry_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid dentry cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *dentry_cache != NULL )
+	{
+		while( ( *dentry_cache )->last_value != NULL )
+		{
+			if( libfsxfs_dentry_cache_remove_last_value(
+			     *dentry_cache,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+				 "%s: unable to remove last value.",
+				 function );
+
+				result = -1;
+
+				break;
+			}
+		}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( ( *dentry_cache )->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		memory_free(
+		 *dentry_cache );
+
+		*dentry_cache = NULL;
+	}
+	return( result );
+}
+
+/* Removes the least recently used value
+ * The caller is expected to hold the lock for writing
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_dentry_cache_remove_last_value(
+     libfsxfs_dentry_cache_t *dentry_cache,
+     libcerror_error_t **error )
+{
+	libfsxfs_dentry_cache_value_t *bucket_value = NULL;
+	libfsxfs_dentry_cache_value_t *value        = NULL;
+	static char *function                       = "libfsxfs_dentry_cache_remove_last_value";
+	int bucket_index                            = 0;
+	int result                                  = 1;
+
+	if( dentry_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid dentry cache.",
+		 function );
+
+		return( -1 );
+	}
+	value = dentry_cache->last_value;
+
+	if( value == NULL )
+	{
+		return( 1 );
+	}
+	bucket_index = (int) ( ( value->name_hash ^ (uint32_t) value->parent_inode_number ) % LIBFSXFS_DENTRY_CACHE_NUMBER_OF_BUCKETS );
+
+	if( dentry_cache->buckets[ bucket_index ] == value )
+	{
+		dentry_cache->buckets[ bucket_index ] = value->next_bucket_value;
+	}
+	else
+	{
+		bucket_value = dentry_cache->buckets[ bucket_index ];
+
+		while( bucket_value != NULL )
+		{
+			if( bucket_value->next_bucket_value == value )
+			{
+				bucket_value->next_bucket_value = value->next_bucket_value;
+
+				break;
+			}
+			bucket_value = bucket_value->next_bucket_value;
+		}
+	}
+	dentry_cache->last_value = value->previous_value;
+
+	if( dentry_cache->last_value != NULL )
+	{
+		dentry_cache->last_value->next_value = NULL;
+	}
+	else
+	{
+		dentry_cache->first_value = NULL;
+	}
+	dentry_cache->number_of_values -= 1;
+
+	if( value->directory_entry != NULL )
+	{
+		if( libfsxfs_directory_entry_free(
+		     &( value->directory_entry ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free directory entry.",
+			 function );
+
+			result = -1;
+		}
+	}
+	memory_free(
+	 value );
+
+	return( result );
+}
+
+/* Retrieves the maximum number of cached values
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_dentry_cache_get_maximum_number_of_values(
+     libfsxfs_dentry_cache_t *dentry_cache,
+     int *maximum_number_of_values,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_dentry_cache_get_maximum_number_of_values";
+
+	if( dentry_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid dentry cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid maximum number of values.",
+		 function );
+
+		return( -1 );
+	}
+	*maximum_number_of_values = dentry_cache->maximum_number_of_values;
+
+	return( 1 );
+}
+
+/* Sets the maximum number of cached values
+ * Values are evicted when the cache exceeds the new maximum
+ * A maximum of 0 disables the cache
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_dentry_cache_set_maximum_number_of_values(
+     libfsxfs_dentry_cache_t *dentry_cache,
+     int maximum_number_of_values,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_dentry_cache_set_maximum_number_of_values";
+	int result            = 1;
+
+	if( dentry_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid dentry cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_values < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid maximum number of values value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     dentry_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	dentry_cache->maximum_number_of_values = maximum_number_of_values;
+
+	while( dentry_cache->number_of_values > maximum_number_of_values )
+	{
+		if( libfsxfs_dentry_cache_remove_last_value(
+		     dentry_cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to remove last value.",
+			 function );
+
+			result = -1;
+
+			break;
+		}
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     dentry_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the number of cached values
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_dentry_cache_get_number_of_values(
+     libfsxfs_dentry_cache_t *dentry_cache,
+     int *number_of_values,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_dentry_cache_get_number_of_values";
+
+	if( dentry_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid dentry cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of values.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_values = dentry_cache->number_of_values;
+
+	return( 1 );
+}
+
+/* Retrieves the directory entry of a specific parent inode number and UTF-8 encoded name
+ * On success a copy of the directory entry is returned, which must be freed
+ * with libfsxfs_directory_entry_free. For a negative (not found) entry
+ * the directory entry is set to NULL
+ * Returns 1 if successful, 0 if not cached or -1 on error
+ */
+int libfsxfs_dentry_cache_get_directory_entry(
+     libfsxfs_dentry_cache_t *dentry_cache,
+     uint64_t parent_inode_number,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libfsxfs_directory_entry_t **directory_entry,
+     libcerror_error_t **error )
+{
+	libfsxfs_dentry_cache_value_t *value = NULL;
+	static char *function                = "libfsxfs_dentry_cache_get_directory_entry";
+	uint32_t name_hash                   = 0;
+	int bucket_index                     = 0;
+	int result                           = 0;
+
+	if( dentry_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid dentry cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *directory_entry != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid directory entry value already set.",
+		 function );
+
+		return( -1 );
+	}
+	/* Names that do not fit in a directory entry are never cached
+	 */
+	if( ( utf8_string_length == 0 )
+	 || ( utf8_string_length > 255 ) )
+	{
+		return( 0 );
+	}
+	if( libfsxfs_directory_hash_calculate(
+	     &name_hash,
+	     utf8_string,
+	     utf8_string_length,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate name hash.",
+		 function );
+
+		return( -1 );
+	}
+	bucket_index = (int) ( ( name_hash ^ (uint32_t) parent_inode_number ) % LIBFSXFS_DENTRY_CACHE_NUMBER_OF_BUCKETS );
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     dentry_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	value = dentry_cache->buckets[ bucket_index ];
+
+	while( value != NULL )
+	{
+		if( ( value->parent_inode_number == parent_inode_number )
+		 && ( value->name_hash == name_hash )
+		 && ( (size_t) value->name_length == utf8_string_length )
+		 && ( memory_compare(
+		       value->name,
+		       utf8_string,
+		       utf8_string_length ) == 0 ) )
+		{
+			break;
+		}
+		value = value->next_bucket_value;
+	}
+	if( value != NULL )
+	{
+		if( libfsxfs_directory_entry_clone(
+		     directory_entry,
+		     value->directory_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create directory entry.",
+			 function );
+
+			goto on_error;
+		}
+		/* Move the value to the front of the LRU list
+		 */
+		if( value != dentry_cache->first_value )
+		{
+			value->previous_value->next_value = value->next_value;
+
+			if( value->next_value != NULL )
+			{
+				value->next_value->previous_value = value->previous_value;
+			}
+			else
+			{
+				dentry_cache->last_value = value->previous_value;
+			}
+			value->previous_value = NULL;
+			value->next_value     = dentry_cache->first_value;
+
+			dentry_cache->first_value->previous_value = value;
+			dentry_cache->first_value                 = value;
+		}
+		result = 1;
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     dentry_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		if( *directory_entry != NULL )
+		{
+			libfsxfs_directory_entry_free(
+			 directory_entry,
+			 NULL );
+		}
+		return( -1 );
+	}
+#endif
+	return( result );
+
+on_error:
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_write(
+	 dentry_cache->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Inserts the directory entry of a specific parent inode number and UTF-8 encoded name
+ * The cache stores its own copy of the directory entry. A directory entry
+ * of NULL inserts a negative (not found) entry
+ * Least recently used values are evicted when the cache exceeds its maximum
+ * Returns 1 if successful, 0 if not inserted or -1 on error
+ */
+int libfsxfs_dentry_cache_insert_directory_entry(
+     libfsxfs_dentry_cache_t *dentry_cache,
+     uint64_t parent_inode_number,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libfsxfs_directory_entry_t *directory_entry,
+     libcerror_error_t **error )
+{
+	libfsxfs_dentry_cache_value_t *value = NULL;
+	static char *function                = "libfsxfs_dentry_cache_insert_directory_entry";
+	uint32_t name_hash                   = 0;
+	int bucket_index                     = 0;
+	int result                           = 0;
+
+	if( dentry_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid dentry cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf8_string_length == 0 )
+	 || ( utf8_string_length > 255 )
+	 || ( dentry_cache->maximum_number_of_values == 0 ) )
+	{
+		return( 0 );
+	}
+	if( libfsxfs_directory_hash_calculate(
+	     &name_hash,
+	     utf8_string,
+	     utf8_string_length,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate name hash.",
+		 function );
+
+		return( -1 );
+	}
+	bucket_index = (int) ( ( name_hash ^ (uint32_t) parent_inode_number ) % LIBFSXFS_DENTRY_CACHE_NUMBER_OF_BUCKETS );
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     dentry_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	value = dentry_cache->buckets[ bucket_index ];
+
+	while( value != NULL )
+	{
+		if( ( value->parent_inode_number == parent_inode_number )
+		 && ( value->name_hash == name_hash )
+		 && ( (size_t) value->name_length == utf8_string_length )
+		 && ( memory_compare(
+		       value->name,
+		       utf8_string,
+		       utf8_string_length ) == 0 ) )
+		{
+			break;
+		}
+		value = value->next_bucket_value;
+	}
+	/* Another thread might have inserted the same name
+	 */
+	if( value == NULL )
+	{
+		value = memory_allocate_structure(
+		         libfsxfs_dentry_cache_value_t );
+
+		if( value == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create value.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     value,
+		     0,
+		     sizeof( libfsxfs_dentry_cache_value_t ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear value.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     value->name,
+		     utf8_string,
+		     utf8_string_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy name.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfsxfs_directory_entry_clone(
+		     &( value->directory_entry ),
+		     directory_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create directory entry.",
+			 function );
+
+			goto on_error;
+		}
+		value->parent_inode_number = parent_inode_number;
+		value->name_hash           = name_hash;
+		value->name_length         = (uint8_t) utf8_string_length;
+		value->next_bucket_value   = dentry_cache->buckets[ bucket_index ];
+		value->next_value          = dentry_cache->first_value;
+
+		dentry_cache->buckets[ bucket_index ] = value;
+
+		if( dentry_cache->first_value != NULL )
+		{
+			dentry_cache->first_value->previous_value = value;
+		}
+		else
+		{
+			dentry_cache->last_value = value;
+		}
+		dentry_cache->first_value       = value;
+		dentry_cache->number_of_values += 1;
+
+		value = NULL;
+
+		while( dentry_cache->number_of_values > dentry_cache->maximum_number_of_values )
+		{
+			if( libfsxfs_dentry_cache_remove_last_value(
+			     dentry_cache,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+				 "%s: unable to remove last value.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		result = 1;
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     dentry_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+
+on_error:
+	if( value != NULL )
+	{
+		memory_free(
+		 value );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_write(
+	 dentry_cache->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
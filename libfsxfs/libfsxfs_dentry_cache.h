@@ -0,0 +1,154 @@
+/*
+ * Directory entry (dentry) cache functions
+ *
+ * Copyright (C) 2020-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSXFS_DENTRY_CACHE_H )
+#define _LIBFSXFS_DENTRY_CACHE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsxfs_definitions.h"
+#include "libfsxfs_directory_entry.h"
+#include "libfsxfs_libcerror.h"
+#include "libfsxfs_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfsxfs_dentry_cache_value libfsxfs_dentry_cache_value_t;
+
+struct libfsxfs_dentry_cache_value
+{
+	/* The parent (directory) inode number
+	 */
+	uint64_t parent_inode_number;
+
+	/* The name hash
+	 */
+	uint32_t name_hash;
+
+	/* The UTF-8 encoded name, as used in the lookup
+	 */
+	uint8_t name[ 255 ];
+
+	/* The name length
+	 */
+	uint8_t name_length;
+
+	/* The directory entry or NULL for a negative (not found) entry
+	 */
+	libfsxfs_directory_entry_t *directory_entry;
+
+	/* The previous (more recently used) value
+	 */
+	libfsxfs_dentry_cache_value_t *previous_value;
+
+	/* The next (less recently used) value
+	 */
+	libfsxfs_dentry_cache_value_t *next_value;
+
+	/* The next value in the same hash bucket
+	 */
+	libfsxfs_dentry_cache_value_t *next_bucket_value;
+};
+
+typedef struct libfsxfs_dentry_cache libfsxfs_dentry_cache_t;
+
+struct libfsxfs_dentry_cache
+{
+	/* The hash buckets
+	 */
+	libfsxfs_dentry_cache_value_t *buckets[ LIBFSXFS_DENTRY_CACHE_NUMBER_OF_BUCKETS ];
+
+	/* The most recently used value
+	 */
+	libfsxfs_dentry_cache_value_t *first_value;
+
+	/* The least recently used value
+	 */
+	libfsxfs_dentry_cache_value_t *last_value;
+
+	/* The number of values
+	 */
+	int number_of_values;
+
+	/* The maximum number of values
+	 */
+	int maximum_number_of_values;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
+};
+
+int libfsxfs_dentry_cache_initialize(
+     libfsxfs_dentry_cache_t **dentry_cache,
+     int maximum_number_of_values,
+     libcerror_error_t **error );
+
+int libfsxfs_dentry_cache_free(
+     libfsxfs_dentry_cache_t **dentry_cache,
+     libcerror_error_t **error );
+
+int libfsxfs_dentry_cache_remove_last_value(
+     libfsxfs_dentry_cache_t *dentry_cache,
+     libcerror_error_t **error );
+
+int libfsxfs_dentry_cache_get_maximum_number_of_values(
+     libfsxfs_dentry_cache_t *dentry_cache,
+     int *maximum_number_of_values,
+     libcerror_error_t **error );
+
+int libfsxfs_dentry_cache_set_maximum_number_of_values(
+     libfsxfs_dentry_cache_t *dentry_cache,
+     int maximum_number_of_values,
+     libcerror_error_t **error );
+
+int libfsxfs_dentry_cache_get_number_of_values(
+     libfsxfs_dentry_cache_t *dentry_cache,
+     int *number_of_values,
+     libcerror_error_t **error );
+
+int libfsxfs_dentry_cache_get_directory_entry(
+     libfsxfs_dentry_cache_t *dentry_cache,
+     uint64_t parent_inode_number,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libfsxfs_directory_entry_t **directory_entry,
+     libcerror_error_t **error );
+
+int libfsxfs_dentry_cache_insert_directory_entry(
+     libfsxfs_dentry_cache_t *dentry_cache,
+     uint64_t parent_inode_number,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libfsxfs_directory_entry_t *directory_entry,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSXFS_DENTRY_CACHE_H ) */
+
@@ -20,13 +20,16 @@
  */
 
 #include <common.h>
+#include <byte_stream.h>
 #include <memory.h>
 #include <types.h>
 
 #include "libfsxfs_block_directory.h"
 #include "libfsxfs_definitions.h"
 #include "libfsxfs_directory.h"
+#include "libfsxfs_directory_arena.h"
 #include "libfsxfs_directory_entry.h"
+#include "libfsxfs_directory_hash.h"
 #include "libfsxfs_directory_table.h"
 #include "libfsxfs_extent.h"
 #include "libfsxfs_inode.h"
@@ -37,6 +40,8 @@
 #include "libfsxfs_libcnotify.h"
 #include "libfsxfs_libuna.h"
 
+#include "fsxfs_directory_leaf.h"
+
 /* Creates a directory
  * Make sure the value directory is referencing, is set to NULL
  * Returns 1 if successful or -1 on error
@@ -116,11 +121,31 @@ int libfsxfs_directory_initialize(
 
 		goto on_error;
 	}
+	if( libfsxfs_directory_arena_initialize(
+	     &( ( *directory )->directory_arena ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create directory arena.",
+		 function );
+
+		goto on_error;
+	}
 	return( 1 );
 
 on_error:
 	if( *directory != NULL )
 	{
+		if( ( *directory )->entries_array != NULL )
+		{
+			libcdata_array_free(
+			 &( ( *directory )->entries_array ),
+			 NULL,
+			 NULL );
+		}
 		memory_free(
 		 *directory );
 
@@ -166,6 +191,21 @@ int libfsxfs_directory_free(
 
 			result = -1;
 		}
+		/* Directory entries that were cloned keep the directory arena alive
+		 */
+		if( libfsxfs_directory_arena_free(
+		     &( ( *directory )->directory_arena ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free directory arena.",
+			 function );
+
+			result = -1;
+		}
 		memory_free(
 		 *directory );
 
@@ -194,6 +234,7 @@ int libfsxfs_directory_read_file_io_handle(
 	uint64_t relative_block_number              = 0;
 	int allocation_group_index                  = 0;
 	int extent_index                            = 0;
+	int number_of_entries                       = 0;
 	int number_of_extents                       = 0;
 
 	if( directory == NULL )
@@ -287,6 +328,7 @@ int libfsxfs_directory_read_file_io_handle(
 			     inode->inline_data,
 			     (size_t) inode->size,
 			     directory->entries_array,
+			     directory->directory_arena,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
@@ -412,6 +454,20 @@ int libfsxfs_directory_read_file_io_handle(
 
 				while( extent_size > 0 )
 				{
+					if( libcdata_array_get_number_of_entries(
+					     directory->entries_array,
+					     &number_of_entries,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+						 "%s: unable to retrieve number of entries.",
+						 function );
+
+						goto on_error;
+					}
 					if( libfsxfs_block_directory_initialize(
 					     &block_directory,
 					     io_handle->block_size,
@@ -432,6 +488,7 @@ int libfsxfs_directory_read_file_io_handle(
 					     file_io_handle,
 					     block_directory_offset,
 					     directory->entries_array,
+					     directory->directory_arena,
 					     error ) != 1 )
 					{
 						libcerror_error_set(
@@ -443,7 +500,23 @@ int libfsxfs_directory_read_file_io_handle(
 
 						goto on_error;
 					}
+					if( libfsxfs_directory_add_offset_to_entries(
+					     directory->entries_array,
+					     number_of_entries,
+					     (uint64_t) logical_offset,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+						 "%s: unable to set offset of directory entries.",
+						 function );
+
+						goto on_error;
+					}
 					block_directory_offset += io_handle->directory_block_size;
+					logical_offset         += io_handle->directory_block_size;
 					extent_size            -= io_handle->directory_block_size;
 
 					if( libfsxfs_block_directory_free(
@@ -486,6 +559,73 @@ on_error:
 	return( -1 );
 }
 
+/* Adds an offset to the offset of the directory entries
+ * This is used to make the offset of entries read from a directory block
+ * relative to the start of the directory data
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_directory_add_offset_to_entries(
+     libcdata_array_t *entries_array,
+     int first_entry_index,
+     uint64_t offset,
+     libcerror_error_t **error )
+{
+	libfsxfs_directory_entry_t *directory_entry = NULL;
+	static char *function                       = "libfsxfs_directory_add_offset_to_entries";
+	int entry_index                             = 0;
+	int number_of_entries                       = 0;
+
+	if( libcdata_array_get_number_of_entries(
+	     entries_array,
+	     &number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	for( entry_index = first_entry_index;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     entries_array,
+		     entry_index,
+		     (intptr_t **) &directory_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve entry: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		if( directory_entry == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing entry: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		directory_entry->offset += offset;
+	}
+	return( 1 );
+}
+
 /* Retrieves the number of entries
  * Returns 1 if successful or -1 on error
  */
@@ -747,3 +887,1717 @@ int libfsxfs_directory_get_entry_by_utf16_name(
 	return( 0 );
 }
 
+/* Retrieves the file offset of a specific directory block
+ * Returns 1 if successful, 0 if the block is not allocated or -1 on error
+ */
+int libfsxfs_directory_get_block_file_offset(
+     libfsxfs_io_handle_t *io_handle,
+     libfsxfs_inode_t *inode,
+     uint64_t logical_block_number,
+     off64_t *file_offset,
+     libcerror_error_t **error )
+{
+	libfsxfs_extent_t *extent      = NULL;
+	static char *function          = "libfsxfs_directory_get_block_file_offset";
+	uint64_t physical_block_number = 0;
+	uint64_t relative_block_number = 0;
+	int allocation_group_index     = 0;
+	int extent_index               = 0;
+	int number_of_extents          = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsxfs_inode_get_number_of_data_extents(
+	     inode,
+	     &number_of_extents,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of data extents.",
+		 function );
+
+		return( -1 );
+	}
+	for( extent_index = 0;
+	     extent_index < number_of_extents;
+	     extent_index++ )
+	{
+		if( libfsxfs_inode_get_data_extent_by_index(
+		     inode,
+		     extent_index,
+		     &extent,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve data extent: %d.",
+			 function,
+			 extent_index );
+
+			return( -1 );
+		}
+		if( extent == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing extent: %d.",
+			 function,
+			 extent_index );
+
+			return( -1 );
+		}
+		if( ( logical_block_number >= extent->logical_block_number )
+		 && ( ( logical_block_number - extent->logical_block_number ) < (uint64_t) extent->number_of_blocks ) )
+		{
+			if( ( extent->range_flags & LIBFSXFS_EXTENT_FLAG_IS_SPARSE ) != 0 )
+			{
+				break;
+			}
+			physical_block_number  = extent->physical_block_number + ( logical_block_number - extent->logical_block_number );
+			allocation_group_index = (int) ( physical_block_number >> io_handle->number_of_relative_block_number_bits );
+			relative_block_number  = physical_block_number & ( ( 1 << io_handle->number_of_relative_block_number_bits ) - 1 );
+
+			*file_offset = ( ( (off64_t) allocation_group_index * io_handle->allocation_group_size ) + relative_block_number ) * io_handle->block_size;
+
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
+/* Reads the data of a directory block
+ * The directory block is read per file system block since it can be stored non-contiguous
+ * Returns 1 if successful, 0 if the block is not allocated or -1 on error
+ */
+int libfsxfs_directory_read_block_data(
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfsxfs_inode_t *inode,
+     uint64_t logical_block_number,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_directory_read_block_data";
+	size_t data_offset    = 0;
+	ssize_t read_count    = 0;
+	off64_t file_offset   = 0;
+	int result            = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->block_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid IO handle - block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size == 0 )
+	 || ( data_size > (size_t) SSIZE_MAX )
+	 || ( ( data_size % io_handle->block_size ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	while( data_offset < data_size )
+	{
+		result = libfsxfs_directory_get_block_file_offset(
+		          io_handle,
+		          inode,
+		          logical_block_number,
+		          &file_offset,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file offset of block: %" PRIu64 ".",
+			 function,
+			 logical_block_number );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			return( 0 );
+		}
+		read_count = libfsxfs_io_handle_read_buffer_at_offset(
+		              io_handle,
+		              file_io_handle,
+		              &( data[ data_offset ] ),
+		              (size_t) io_handle->block_size,
+		              file_offset,
+		              error );
+
+		if( read_count != (ssize_t) io_handle->block_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read block: %" PRIu64 " at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 logical_block_number,
+			 file_offset,
+			 file_offset );
+
+			return( -1 );
+		}
+		data_offset          += io_handle->block_size;
+		logical_block_number += 1;
+	}
+	return( 1 );
+}
+
+/* Retrieves the directory entry for a name hash using the leaf and node (hash) blocks
+ * Only the data blocks that contain an entry with a matching name hash are read,
+ * their entries are stored in the entries array of the directory
+ * Either the UTF-8 or UTF-16 encoded name is used to compare the name
+ * Returns 1 if successful, 0 if not found or -1 on error
+ */
+int libfsxfs_directory_get_entry_by_name_hash(
+     libfsxfs_directory_t *directory,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfsxfs_inode_t *inode,
+     uint32_t name_hash,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     libfsxfs_directory_entry_t **directory_entry,
+     libcerror_error_t **error )
+{
+	libfsxfs_block_directory_t *block_directory      = NULL;
+	libfsxfs_directory_entry_t *safe_directory_entry = NULL;
+	uint8_t *data_block_data                         = NULL;
+	uint8_t *hash_block_data                         = NULL;
+	static char *function                            = "libfsxfs_directory_get_entry_by_name_hash";
+	size_t header_size                               = 0;
+	uint64_t block_number                            = 0;
+	uint64_t data_block_number                       = 0;
+	uint64_t data_offset                             = 0;
+	uint64_t last_data_block_number                  = 0;
+	uint32_t address                                 = 0;
+	uint32_t entry_name_hash                         = 0;
+	uint32_t next_block_number                       = 0;
+	uint32_t sub_block_number                        = 0;
+	uint16_t number_of_entries                       = 0;
+	uint16_t signature                               = 0;
+	int block_index                                  = 0;
+	int entry_index                                  = 0;
+	int hash_entry_index                             = 0;
+	int is_leaf_block                                = 0;
+	int lower_entry_index                            = 0;
+	int number_of_directory_entries                  = 0;
+	int result                                       = 0;
+	int upper_entry_index                            = 0;
+
+	if( directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( io_handle->block_size == 0 )
+	 || ( io_handle->directory_block_size < io_handle->block_size )
+	 || ( io_handle->directory_block_size > (uint32_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	 || ( ( io_handle->directory_block_size % io_handle->block_size ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid IO handle - directory block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf8_string == NULL )
+	 && ( utf16_string == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory entry.",
+		 function );
+
+		return( -1 );
+	}
+	hash_block_data = (uint8_t *) memory_allocate(
+	                               sizeof( uint8_t ) * io_handle->directory_block_size );
+
+	if( hash_block_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create hash block data.",
+		 function );
+
+		goto on_error;
+	}
+	data_block_data = (uint8_t *) memory_allocate(
+	                               sizeof( uint8_t ) * io_handle->directory_block_size );
+
+	if( data_block_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data block data.",
+		 function );
+
+		goto on_error;
+	}
+	last_data_block_number = (uint64_t) -1;
+
+	/* The first leaf or node block is stored at the start of the leaf offset
+	 */
+	block_number = LIBFSXFS_DIRECTORY_LEAF_OFFSET / io_handle->block_size;
+
+	/* The number of blocks read is bound by the depth of the node blocks and
+	 * the number of leaf blocks that contain entries with the same name hash
+	 */
+	for( block_index = 0;
+	     block_index < LIBFSXFS_MAXIMUM_RECURSION_DEPTH;
+	     block_index++ )
+	{
+		result = libfsxfs_directory_read_block_data(
+		          io_handle,
+		          file_io_handle,
+		          inode,
+		          block_number,
+		          hash_block_data,
+		          (size_t) io_handle->directory_block_size,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read hash block: %" PRIu64 ".",
+			 function,
+			 block_number );
+
+			goto on_error;
+		}
+		byte_stream_copy_to_uint32_big_endian(
+		 ( (fsxfs_directory_leaf_header_v2_t *) hash_block_data )->next_block_number,
+		 next_block_number );
+
+		byte_stream_copy_to_uint16_big_endian(
+		 ( (fsxfs_directory_leaf_header_v2_t *) hash_block_data )->signature,
+		 signature );
+
+		switch( signature )
+		{
+			case 0xd2f1:
+			case 0xd2ff:
+				byte_stream_copy_to_uint16_big_endian(
+				 ( (fsxfs_directory_leaf_header_v2_t *) hash_block_data )->number_of_entries,
+				 number_of_entries );
+
+				header_size   = sizeof( fsxfs_directory_leaf_header_v2_t );
+				is_leaf_block = 1;
+
+				break;
+
+			case 0x3df1:
+			case 0x3dff:
+				byte_stream_copy_to_uint16_big_endian(
+				 ( (fsxfs_directory_leaf_header_v3_t *) hash_block_data )->number_of_entries,
+				 number_of_entries );
+
+				header_size   = sizeof( fsxfs_directory_leaf_header_v3_t );
+				is_leaf_block = 1;
+
+				break;
+
+			case 0xfebe:
+				byte_stream_copy_to_uint16_big_endian(
+				 ( (fsxfs_directory_node_header_v2_t *) hash_block_data )->number_of_entries,
+				 number_of_entries );
+
+				header_size   = sizeof( fsxfs_directory_node_header_v2_t );
+				is_leaf_block = 0;
+
+				break;
+
+			case 0x3ebe:
+				byte_stream_copy_to_uint16_big_endian(
+				 ( (fsxfs_directory_node_header_v3_t *) hash_block_data )->number_of_entries,
+				 number_of_entries );
+
+				header_size   = sizeof( fsxfs_directory_node_header_v3_t );
+				is_leaf_block = 0;
+
+				break;
+
+			default:
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unsupported hash block: %" PRIu64 " signature: 0x%04" PRIx16 ".",
+				 function,
+				 block_number,
+				 signature );
+
+				goto on_error;
+		}
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: hash block: %" PRIu64 " signature\t\t: 0x%04" PRIx16 "\n",
+			 function,
+			 block_number,
+			 signature );
+
+			libcnotify_printf(
+			 "%s: hash block: %" PRIu64 " number of entries\t: %" PRIu16 "\n",
+			 function,
+			 block_number,
+			 number_of_entries );
+
+			libcnotify_printf(
+			 "\n" );
+		}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+		if( (size_t) number_of_entries > ( ( io_handle->directory_block_size - header_size ) / 8 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid hash block: %" PRIu64 " - number of entries value out of bounds.",
+			 function,
+			 block_number );
+
+			goto on_error;
+		}
+		/* Determine the first entry with a name hash equal or greater than the name hash
+		 * the entries in both leaf and node blocks are stored in ascending name hash order
+		 */
+		lower_entry_index = 0;
+		upper_entry_index = (int) number_of_entries;
+
+		while( lower_entry_index < upper_entry_index )
+		{
+			hash_entry_index = lower_entry_index + ( ( upper_entry_index - lower_entry_index ) / 2 );
+
+			byte_stream_copy_to_uint32_big_endian(
+			 &( hash_block_data[ header_size + ( (size_t) hash_entry_index * 8 ) ] ),
+			 entry_name_hash );
+
+			if( entry_name_hash < name_hash )
+			{
+				lower_entry_index = hash_entry_index + 1;
+			}
+			else
+			{
+				upper_entry_index = hash_entry_index;
+			}
+		}
+		if( is_leaf_block == 0 )
+		{
+			if( lower_entry_index >= (int) number_of_entries )
+			{
+				break;
+			}
+			byte_stream_copy_to_uint32_big_endian(
+			 ( (fsxfs_directory_node_entry_t *) &( hash_block_data[ header_size + ( (size_t) lower_entry_index * 8 ) ] ) )->sub_block_number,
+			 sub_block_number );
+
+			block_number = sub_block_number;
+
+			continue;
+		}
+		for( hash_entry_index = lower_entry_index;
+		     hash_entry_index < (int) number_of_entries;
+		     hash_entry_index++ )
+		{
+			byte_stream_copy_to_uint32_big_endian(
+			 &( hash_block_data[ header_size + ( (size_t) hash_entry_index * 8 ) ] ),
+			 entry_name_hash );
+
+			if( entry_name_hash != name_hash )
+			{
+				break;
+			}
+			byte_stream_copy_to_uint32_big_endian(
+			 &( hash_block_data[ header_size + ( (size_t) hash_entry_index * 8 ) + 4 ] ),
+			 address );
+
+			/* An address of 0 indicates a stale entry
+			 */
+			if( address == 0 )
+			{
+				continue;
+			}
+			/* The address contains the offset of the entry in the directory in units of 8 bytes
+			 */
+			data_offset       = (uint64_t) address * 8;
+			data_block_number = ( data_offset - ( data_offset % io_handle->directory_block_size ) ) / io_handle->block_size;
+
+			if( data_block_number == last_data_block_number )
+			{
+				continue;
+			}
+			last_data_block_number = data_block_number;
+
+			if( libcdata_array_empty(
+			     directory->entries_array,
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libfsxfs_directory_entry_free,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+				 "%s: unable to empty entries array.",
+				 function );
+
+				goto on_error;
+			}
+			result = libfsxfs_directory_read_block_data(
+			          io_handle,
+			          file_io_handle,
+			          inode,
+			          data_block_number,
+			          data_block_data,
+			          (size_t) io_handle->directory_block_size,
+			          error );
+
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read data block: %" PRIu64 ".",
+				 function,
+				 data_block_number );
+
+				goto on_error;
+			}
+			if( libfsxfs_block_directory_initialize(
+			     &block_directory,
+			     io_handle->directory_block_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to initialize block directory.",
+				 function );
+
+				goto on_error;
+			}
+			if( libfsxfs_block_directory_read_data(
+			     block_directory,
+			     io_handle,
+			     data_block_data,
+			     (size_t) io_handle->directory_block_size,
+			     directory->entries_array,
+			     directory->directory_arena,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read block directory.",
+				 function );
+
+				goto on_error;
+			}
+			if( libfsxfs_block_directory_free(
+			     &block_directory,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free block directory.",
+				 function );
+
+				goto on_error;
+			}
+			if( libcdata_array_get_number_of_entries(
+			     directory->entries_array,
+			     &number_of_directory_entries,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve number of entries.",
+				 function );
+
+				goto on_error;
+			}
+			for( entry_index = 0;
+			     entry_index < number_of_directory_entries;
+			     entry_index++ )
+			{
+				if( libcdata_array_get_entry_by_index(
+				     directory->entries_array,
+				     entry_index,
+				     (intptr_t **) &safe_directory_entry,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve entry: %d.",
+					 function,
+					 entry_index );
+
+					goto on_error;
+				}
+				if( utf8_string != NULL )
+				{
+					result = libfsxfs_directory_entry_compare_with_utf8_string(
+					          safe_directory_entry,
+					          utf8_string,
+					          utf8_string_length,
+					          error );
+				}
+				else
+				{
+					result = libfsxfs_directory_entry_compare_with_utf16_string(
+					          safe_directory_entry,
+					          utf16_string,
+					          utf16_string_length,
+					          error );
+				}
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GENERIC,
+					 "%s: unable to compare name with directory entry: %d.",
+					 function,
+					 entry_index );
+
+					goto on_error;
+				}
+				else if( result == LIBUNA_COMPARE_EQUAL )
+				{
+					memory_free(
+					 data_block_data );
+					memory_free(
+					 hash_block_data );
+
+					*directory_entry = safe_directory_entry;
+
+					return( 1 );
+				}
+			}
+		}
+		/* Entries with the same name hash can continue in the next leaf block
+		 */
+		if( ( hash_entry_index < (int) number_of_entries )
+		 || ( next_block_number == 0 ) )
+		{
+			break;
+		}
+		block_number = next_block_number;
+	}
+	memory_free(
+	 data_block_data );
+	memory_free(
+	 hash_block_data );
+
+	*directory_entry = NULL;
+
+	return( 0 );
+
+on_error:
+	if( block_directory != NULL )
+	{
+		libfsxfs_block_directory_free(
+		 &block_directory,
+		 NULL );
+	}
+	if( data_block_data != NULL )
+	{
+		memory_free(
+		 data_block_data );
+	}
+	if( hash_block_data != NULL )
+	{
+		memory_free(
+		 hash_block_data );
+	}
+	libcdata_array_empty(
+	 directory->entries_array,
+	 (int (*)(intptr_t **, libcerror_error_t **)) &libfsxfs_directory_entry_free,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Reads the directory entry for an UTF-8 encoded name
+ * Leaf and node directories are looked up using their name hash index, which only reads
+ * the hash blocks and the data block that contains the entry. Other directories are read entirely.
+ * The entries array of the directory only contains the entries that were read
+ * Returns 1 if successful, 0 if not found or -1 on error
+ */
+int libfsxfs_directory_read_entry_by_utf8_name(
+     libfsxfs_directory_t *directory,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfsxfs_inode_t *inode,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libfsxfs_directory_entry_t **directory_entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_directory_read_entry_by_utf8_name";
+	off64_t file_offset   = 0;
+	uint32_t name_hash    = 0;
+	int result            = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->block_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid IO handle - block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( inode == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ( inode->file_mode & 0xf000 ) == LIBFSXFS_FILE_TYPE_DIRECTORY )
+	 && ( ( inode->fork_type == LIBFSXFS_FORK_TYPE_EXTENTS )
+	  ||  ( inode->fork_type == LIBFSXFS_FORK_TYPE_BTREE ) ) )
+	{
+		/* Only leaf and node directories have a block at the leaf offset
+		 */
+		result = libfsxfs_directory_get_block_file_offset(
+		          io_handle,
+		          inode,
+		          LIBFSXFS_DIRECTORY_LEAF_OFFSET / io_handle->block_size,
+		          &file_offset,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file offset of leaf block.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( result != 0 )
+	{
+		if( libfsxfs_directory_hash_calculate(
+		     &name_hash,
+		     utf8_string,
+		     utf8_string_length,
+		     (uint8_t) ( ( io_handle->feature_flags & LIBFSXFS_FEATURE_FLAG_ASCII_CASE_INSENSITIVE ) != 0 ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to calculate name hash.",
+			 function );
+
+			return( -1 );
+		}
+		result = libfsxfs_directory_get_entry_by_name_hash(
+		          directory,
+		          io_handle,
+		          file_io_handle,
+		          inode,
+		          name_hash,
+		          utf8_string,
+		          utf8_string_length,
+		          NULL,
+		          0,
+		          directory_entry,
+		          error );
+	}
+	else
+	{
+		if( libfsxfs_directory_read_file_io_handle(
+		     directory,
+		     io_handle,
+		     file_io_handle,
+		     inode,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read directory.",
+			 function );
+
+			return( -1 );
+		}
+		result = libfsxfs_directory_get_entry_by_utf8_name(
+		          directory,
+		          utf8_string,
+		          utf8_string_length,
+		          directory_entry,
+		          error );
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve directory entry by UTF-8 name.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Reads the directory entry for an UTF-16 encoded name
+ * Leaf and node directories are looked up using their name hash index, which only reads
+ * the hash blocks and the data block that contains the entry. Other directories are read entirely.
+ * The entries array of the directory only contains the entries that were read
+ * Returns 1 if successful, 0 if not found or -1 on error
+ */
+int libfsxfs_directory_read_entry_by_utf16_name(
+     libfsxfs_directory_t *directory,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfsxfs_inode_t *inode,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     libfsxfs_directory_entry_t **directory_entry,
+     libcerror_error_t **error )
+{
+	uint8_t *utf8_string    = NULL;
+	static char *function   = "libfsxfs_directory_read_entry_by_utf16_name";
+	size_t utf8_string_size = 0;
+	off64_t file_offset     = 0;
+	uint32_t name_hash      = 0;
+	int result              = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->block_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid IO handle - block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( inode == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ( inode->file_mode & 0xf000 ) == LIBFSXFS_FILE_TYPE_DIRECTORY )
+	 && ( ( inode->fork_type == LIBFSXFS_FORK_TYPE_EXTENTS )
+	  ||  ( inode->fork_type == LIBFSXFS_FORK_TYPE_BTREE ) ) )
+	{
+		/* Only leaf and node directories have a block at the leaf offset
+		 */
+		result = libfsxfs_directory_get_block_file_offset(
+		          io_handle,
+		          inode,
+		          LIBFSXFS_DIRECTORY_LEAF_OFFSET / io_handle->block_size,
+		          &file_offset,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file offset of leaf block.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( result != 0 )
+	{
+		/* The name hash is calculated over the UTF-8 encoded name as stored on disk
+		 */
+		if( libuna_utf8_string_size_from_utf16(
+		     utf16_string,
+		     utf16_string_length,
+		     &utf8_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve UTF-8 string size.",
+			 function );
+
+			goto on_error;
+		}
+		if( ( utf8_string_size == 0 )
+		 || ( utf8_string_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid UTF-8 string size value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		utf8_string = (uint8_t *) memory_allocate(
+		                           sizeof( uint8_t ) * utf8_string_size );
+
+		if( utf8_string == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create UTF-8 string.",
+			 function );
+
+			goto on_error;
+		}
+		if( libuna_utf8_string_copy_from_utf16(
+		     utf8_string,
+		     utf8_string_size,
+		     utf16_string,
+		     utf16_string_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy UTF-8 string.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfsxfs_directory_hash_calculate(
+		     &name_hash,
+		     utf8_string,
+		     utf8_string_size - 1,
+		     (uint8_t) ( ( io_handle->feature_flags & LIBFSXFS_FEATURE_FLAG_ASCII_CASE_INSENSITIVE ) != 0 ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to calculate name hash.",
+			 function );
+
+			goto on_error;
+		}
+		memory_free(
+		 utf8_string );
+
+		utf8_string = NULL;
+
+		result = libfsxfs_directory_get_entry_by_name_hash(
+		          directory,
+		          io_handle,
+		          file_io_handle,
+		          inode,
+		          name_hash,
+		          NULL,
+		          0,
+		          utf16_string,
+		          utf16_string_length,
+		          directory_entry,
+		          error );
+	}
+	else
+	{
+		if( libfsxfs_directory_read_file_io_handle(
+		     directory,
+		     io_handle,
+		     file_io_handle,
+		     inode,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read directory.",
+			 function );
+
+			goto on_error;
+		}
+		result = libfsxfs_directory_get_entry_by_utf16_name(
+		          directory,
+		          utf16_string,
+		          utf16_string_length,
+		          directory_entry,
+		          error );
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve directory entry by UTF-16 name.",
+		 function );
+
+		goto on_error;
+	}
+	return( result );
+
+on_error:
+	if( utf8_string != NULL )
+	{
+		memory_free(
+		 utf8_string );
+	}
+	return( -1 );
+}
+
+/* Reads the directory block that contains the offset or the next allocated directory block
+ * The offset is relative to the start of the directory data
+ * The entries array of the directory only contains the entries of the directory block
+ * Returns 1 if successful, 0 if there are no more directory blocks or -1 on error
+ */
+int libfsxfs_directory_read_block_at_offset(
+     libfsxfs_directory_t *directory,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfsxfs_inode_t *inode,
+     uint64_t offset,
+     libcerror_error_t **error )
+{
+	libfsxfs_block_directory_t *block_directory = NULL;
+	libfsxfs_directory_table_t *directory_table = NULL;
+	libfsxfs_extent_t *extent                   = NULL;
+	static char *function                       = "libfsxfs_directory_read_block_at_offset";
+	uint64_t block_offset                       = 0;
+	uint64_t extent_end_offset                  = 0;
+	uint64_t extent_offset                      = 0;
+	uint64_t safe_block_offset                  = 0;
+	int extent_index                            = 0;
+	int number_of_extents                       = 0;
+	int result                                  = 0;
+
+	if( directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( io_handle->block_size == 0 )
+	 || ( io_handle->directory_block_size < io_handle->block_size )
+	 || ( io_handle->directory_block_size > (uint32_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	 || ( ( io_handle->directory_block_size % io_handle->block_size ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid IO handle - directory block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( inode == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( inode->fork_type != LIBFSXFS_FORK_TYPE_INLINE_DATA )
+	 && ( inode->fork_type != LIBFSXFS_FORK_TYPE_EXTENTS )
+	 && ( inode->fork_type != LIBFSXFS_FORK_TYPE_BTREE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported directory data fork type.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_empty(
+	     directory->entries_array,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libfsxfs_directory_entry_free,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to empty entries array.",
+		 function );
+
+		goto on_error;
+	}
+	/* Reuse the directory arena unless entries of a previous block are still referenced
+	 */
+	result = libfsxfs_directory_arena_empty(
+	          directory->directory_arena,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to empty directory arena.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		if( libfsxfs_directory_arena_free(
+		     &( directory->directory_arena ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free directory arena.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfsxfs_directory_arena_initialize(
+		     &( directory->directory_arena ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create directory arena.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	directory->has_block        = 0;
+	directory->block_offset     = 0;
+	directory->block_end_offset = 0;
+
+	if( offset >= LIBFSXFS_DIRECTORY_LEAF_OFFSET )
+	{
+		return( 0 );
+	}
+	if( inode->fork_type == LIBFSXFS_FORK_TYPE_INLINE_DATA )
+	{
+		/* The entries of a short-form directory are stored with their offset in block form
+		 */
+		if( libfsxfs_directory_table_initialize(
+		     &directory_table,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize directory table.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfsxfs_directory_table_read_data(
+		     directory_table,
+		     io_handle,
+		     inode->inline_data,
+		     (size_t) inode->size,
+		     directory->entries_array,
+		     directory->directory_arena,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read directory table.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfsxfs_directory_table_free(
+		     &directory_table,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free directory table.",
+			 function );
+
+			goto on_error;
+		}
+		directory->has_block        = 1;
+		directory->block_offset     = 0;
+		directory->block_end_offset = LIBFSXFS_DIRECTORY_LEAF_OFFSET;
+
+		return( 1 );
+	}
+	if( libfsxfs_inode_get_number_of_data_extents(
+	     inode,
+	     &number_of_extents,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of data extents.",
+		 function );
+
+		goto on_error;
+	}
+	offset -= offset % io_handle->directory_block_size;
+
+	/* Determine the first allocated directory block at or after the offset
+	 */
+	block_offset = LIBFSXFS_DIRECTORY_LEAF_OFFSET;
+
+	for( extent_index = 0;
+	     extent_index < number_of_extents;
+	     extent_index++ )
+	{
+		if( libfsxfs_inode_get_data_extent_by_index(
+		     inode,
+		     extent_index,
+		     &extent,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve data extent: %d.",
+			 function,
+			 extent_index );
+
+			goto on_error;
+		}
+		if( extent == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing extent: %d.",
+			 function,
+			 extent_index );
+
+			goto on_error;
+		}
+		if( ( extent->range_flags & LIBFSXFS_EXTENT_FLAG_IS_SPARSE ) != 0 )
+		{
+			continue;
+		}
+		if( extent->logical_block_number >= ( LIBFSXFS_DIRECTORY_LEAF_OFFSET / io_handle->block_size ) )
+		{
+			continue;
+		}
+		extent_offset     = extent->logical_block_number * io_handle->block_size;
+		extent_end_offset = extent_offset + ( (uint64_t) extent->number_of_blocks * io_handle->block_size );
+
+		if( extent_offset < offset )
+		{
+			safe_block_offset = offset;
+		}
+		else
+		{
+			safe_block_offset = extent_offset;
+
+			if( ( safe_block_offset % io_handle->directory_block_size ) != 0 )
+			{
+				safe_block_offset += io_handle->directory_block_size - ( safe_block_offset % io_handle->directory_block_size );
+			}
+		}
+		if( ( safe_block_offset < extent_end_offset )
+		 && ( safe_block_offset < block_offset ) )
+		{
+			block_offset = safe_block_offset;
+		}
+	}
+	if( block_offset >= LIBFSXFS_DIRECTORY_LEAF_OFFSET )
+	{
+		return( 0 );
+	}
+	if( libfsxfs_block_directory_initialize(
+	     &block_directory,
+	     io_handle->directory_block_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize block directory.",
+		 function );
+
+		goto on_error;
+	}
+	result = libfsxfs_directory_read_block_data(
+	          io_handle,
+	          file_io_handle,
+	          inode,
+	          block_offset / io_handle->block_size,
+	          block_directory->data,
+	          block_directory->data_size,
+	          error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read directory block at offset: %" PRIu64 ".",
+		 function,
+		 block_offset );
+
+		goto on_error;
+	}
+	if( libfsxfs_block_directory_read_data(
+	     block_directory,
+	     io_handle,
+	     block_directory->data,
+	     block_directory->data_size,
+	     directory->entries_array,
+	     directory->directory_arena,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read block directory.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsxfs_block_directory_free(
+	     &block_directory,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free block directory.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsxfs_directory_add_offset_to_entries(
+	     directory->entries_array,
+	     0,
+	     block_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set offset of directory entries.",
+		 function );
+
+		goto on_error;
+	}
+	directory->has_block        = 1;
+	directory->block_offset     = block_offset;
+	directory->block_end_offset = block_offset + io_handle->directory_block_size;
+
+	return( 1 );
+
+on_error:
+	if( block_directory != NULL )
+	{
+		libfsxfs_block_directory_free(
+		 &block_directory,
+		 NULL );
+	}
+	if( directory_table != NULL )
+	{
+		libfsxfs_directory_table_free(
+		 &directory_table,
+		 NULL );
+	}
+	libcdata_array_empty(
+	 directory->entries_array,
+	 (int (*)(intptr_t **, libcerror_error_t **)) &libfsxfs_directory_entry_free,
+	 NULL );
+
+	directory->has_block = 0;
+
+	return( -1 );
+}
+
+/* Retrieves the next directory entry
+ * The directory is read one directory block at a time, starting at the block that contains the cookie.
+ * The cookie is an opaque value that allows to resume iterating the directory, where 0 represents
+ * the start of the directory, it is updated to refer to the entry after the directory entry.
+ * The directory entry is managed by the directory and only valid until the next call
+ * Returns 1 if successful, 0 if there are no more entries or -1 on error
+ */
+int libfsxfs_directory_get_next_entry(
+     libfsxfs_directory_t *directory,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfsxfs_inode_t *inode,
+     uint64_t *cookie,
+     libfsxfs_directory_entry_t **directory_entry,
+     libcerror_error_t **error )
+{
+	libfsxfs_directory_entry_t *safe_directory_entry = NULL;
+	static char *function                            = "libfsxfs_directory_get_next_entry";
+	uint64_t safe_cookie                             = 0;
+	int entry_index                                  = 0;
+	int lower_entry_index                            = 0;
+	int number_of_entries                            = 0;
+	int result                                       = 0;
+	int upper_entry_index                            = 0;
+
+	if( directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( cookie == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cookie.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory entry.",
+		 function );
+
+		return( -1 );
+	}
+	safe_cookie = *cookie;
+
+	while( safe_cookie < LIBFSXFS_DIRECTORY_LEAF_OFFSET )
+	{
+		if( ( directory->has_block == 0 )
+		 || ( safe_cookie < directory->block_offset )
+		 || ( safe_cookie >= directory->block_end_offset ) )
+		{
+			result = libfsxfs_directory_read_block_at_offset(
+			          directory,
+			          io_handle,
+			          file_io_handle,
+			          inode,
+			          safe_cookie,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read directory block at offset: %" PRIu64 ".",
+				 function,
+				 safe_cookie );
+
+				return( -1 );
+			}
+			else if( result == 0 )
+			{
+				break;
+			}
+			if( safe_cookie < directory->block_offset )
+			{
+				safe_cookie = directory->block_offset;
+			}
+		}
+		if( libcdata_array_get_number_of_entries(
+		     directory->entries_array,
+		     &number_of_entries,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of entries.",
+			 function );
+
+			return( -1 );
+		}
+		/* The entries of a directory block are stored in ascending offset order
+		 * hence determine the first entry with an offset equal to or greater than the cookie
+		 */
+		lower_entry_index = 0;
+		upper_entry_index = number_of_entries;
+
+		while( lower_entry_index < upper_entry_index )
+		{
+			entry_index = lower_entry_index + ( ( upper_entry_index - lower_entry_index ) / 2 );
+
+			if( libcdata_array_get_entry_by_index(
+			     directory->entries_array,
+			     entry_index,
+			     (intptr_t **) &safe_directory_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve entry: %d.",
+				 function,
+				 entry_index );
+
+				return( -1 );
+			}
+			if( safe_directory_entry == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing entry: %d.",
+				 function,
+				 entry_index );
+
+				return( -1 );
+			}
+			if( safe_directory_entry->offset < safe_cookie )
+			{
+				lower_entry_index = entry_index + 1;
+			}
+			else
+			{
+				upper_entry_index = entry_index;
+			}
+		}
+		if( lower_entry_index < number_of_entries )
+		{
+			if( libcdata_array_get_entry_by_index(
+			     directory->entries_array,
+			     lower_entry_index,
+			     (intptr_t **) &safe_directory_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve entry: %d.",
+				 function,
+				 lower_entry_index );
+
+				return( -1 );
+			}
+			*cookie          = safe_directory_entry->offset + 1;
+			*directory_entry = safe_directory_entry;
+
+			return( 1 );
+		}
+		safe_cookie = directory->block_end_offset;
+	}
+	*cookie          = LIBFSXFS_DIRECTORY_LEAF_OFFSET;
+	*directory_entry = NULL;
+
+	return( 0 );
+}
+
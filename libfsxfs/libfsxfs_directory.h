@@ -25,6 +25,7 @@
 #include <common.h>
 #include <types.h>
 
+#include "libfsxfs_directory_arena.h"
 #include "libfsxfs_directory_entry.h"
 #include "libfsxfs_inode.h"
 #include "libfsxfs_io_handle.h"
@@ -43,6 +44,22 @@ struct libfsxfs_directory
 	/* Entries array
 	 */
 	libcdata_array_t *entries_array;
+
+	/* The directory arena that contains the entries
+	 */
+	libfsxfs_directory_arena_t *directory_arena;
+
+	/* Value to indicate the entries array contains a single directory block
+	 */
+	uint8_t has_block;
+
+	/* The (logical) offset of the directory block
+	 */
+	uint64_t block_offset;
+
+	/* The (logical) end offset of the directory block
+	 */
+	uint64_t block_end_offset;
 };
 
 int libfsxfs_directory_initialize(
@@ -60,6 +77,12 @@ int libfsxfs_directory_read_file_io_handle(
      libfsxfs_inode_t *inode,
      libcerror_error_t **error );
 
+int libfsxfs_directory_add_offset_to_entries(
+     libcdata_array_t *entries_array,
+     int first_entry_index,
+     uint64_t offset,
+     libcerror_error_t **error );
+
 int libfsxfs_directory_get_number_of_entries(
      libfsxfs_directory_t *directory,
      int *number_of_entries,
@@ -85,6 +108,72 @@ int libfsxfs_directory_get_entry_by_utf16_name(
      libfsxfs_directory_entry_t **directory_entry,
      libcerror_error_t **error );
 
+int libfsxfs_directory_get_block_file_offset(
+     libfsxfs_io_handle_t *io_handle,
+     libfsxfs_inode_t *inode,
+     uint64_t logical_block_number,
+     off64_t *file_offset,
+     libcerror_error_t **error );
+
+int libfsxfs_directory_read_block_data(
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfsxfs_inode_t *inode,
+     uint64_t logical_block_number,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libfsxfs_directory_get_entry_by_name_hash(
+     libfsxfs_directory_t *directory,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfsxfs_inode_t *inode,
+     uint32_t name_hash,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     libfsxfs_directory_entry_t **directory_entry,
+     libcerror_error_t **error );
+
+int libfsxfs_directory_read_entry_by_utf8_name(
+     libfsxfs_directory_t *directory,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfsxfs_inode_t *inode,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libfsxfs_directory_entry_t **directory_entry,
+     libcerror_error_t **error );
+
+int libfsxfs_directory_read_entry_by_utf16_name(
+     libfsxfs_directory_t *directory,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfsxfs_inode_t *inode,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     libfsxfs_directory_entry_t **directory_entry,
+     libcerror_error_t **error );
+
+int libfsxfs_directory_read_block_at_offset(
+     libfsxfs_directory_t *directory,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfsxfs_inode_t *inode,
+     uint64_t offset,
+     libcerror_error_t **error );
+
+int libfsxfs_directory_get_next_entry(
+     libfsxfs_directory_t *directory,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfsxfs_inode_t *inode,
+     uint64_t *cookie,
+     libfsxfs_directory_entry_t **directory_entry,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -0,0 +1,522 @@
+/*
+ * Directory entry arena functions
+ *
+ * Copyright (C) 2020-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfsxfs_definitions.h"
+#include "libfsxfs_directory_arena.h"
+#include "libfsxfs_libcerror.h"
+#include "libfsxfs_libcthreads.h"
+
+/* Creates a directory arena
+ * Make sure the value directory_arena is referencing, is set to NULL
+ * The directory arena is created with a single reference
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_directory_arena_initialize(
+     libfsxfs_directory_arena_t **directory_arena,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_directory_arena_initialize";
+
+	if( directory_arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( *directory_arena != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid directory arena value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*directory_arena = memory_allocate_structure(
+	                    libfsxfs_directory_arena_t );
+
+	if( *directory_arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create directory arena.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *directory_arena,
+	     0,
+	     sizeof( libfsxfs_directory_arena_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear directory arena.",
+		 function );
+
+		memory_free(
+		 *directory_arena );
+
+		*directory_arena = NULL;
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( ( *directory_arena )->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	( *directory_arena )->number_of_references = 1;
+
+	return( 1 );
+
+on_error:
+	if( *directory_arena != NULL )
+	{
+		memory_free(
+		 *directory_arena );
+
+		*directory_arena = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a directory arena
+ * This releases a reference, the arena and its blocks are freed when the last reference is released
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_directory_arena_free(
+     libfsxfs_directory_arena_t **directory_arena,
+     libcerror_error_t **error )
+{
+	static char *function    = "libfsxfs_directory_arena_free";
+	int number_of_references = 0;
+	int result               = 1;
+
+	if( directory_arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( *directory_arena != NULL )
+	{
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_grab_for_write(
+		     ( *directory_arena )->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab read/write lock for writing.",
+			 function );
+
+			return( -1 );
+		}
+#endif
+		( *directory_arena )->number_of_references -= 1;
+
+		number_of_references = ( *directory_arena )->number_of_references;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_release_for_write(
+		     ( *directory_arena )->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read/write lock for writing.",
+			 function );
+
+			return( -1 );
+		}
+#endif
+		if( number_of_references <= 0 )
+		{
+			if( libfsxfs_directory_arena_free_blocks(
+			     *directory_arena,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free blocks.",
+				 function );
+
+				result = -1;
+			}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+			if( libcthreads_read_write_lock_free(
+			     &( ( *directory_arena )->read_write_lock ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free read/write lock.",
+				 function );
+
+				result = -1;
+			}
+#endif
+			memory_free(
+			 *directory_arena );
+		}
+		*directory_arena = NULL;
+	}
+	return( result );
+}
+
+/* Frees the blocks of a directory arena
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_directory_arena_free_blocks(
+     libfsxfs_directory_arena_t *directory_arena,
+     libcerror_error_t **error )
+{
+	libfsxfs_directory_arena_block_t *block = NULL;
+	static char *function                   = "libfsxfs_directory_arena_free_blocks";
+
+	if( directory_arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory arena.",
+		 function );
+
+		return( -1 );
+	}
+	while( directory_arena->first_block != NULL )
+	{
+		block = directory_arena->first_block;
+
+		directory_arena->first_block = block->next_block;
+
+		if( block->data != NULL )
+		{
+			memory_free(
+			 block->data );
+		}
+		memory_free(
+		 block );
+	}
+	return( 1 );
+}
+
+/* Adds a reference to a directory arena
+ * Every reference must be released with libfsxfs_directory_arena_free
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_directory_arena_add_reference(
+     libfsxfs_directory_arena_t *directory_arena,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_directory_arena_add_reference";
+
+	if( directory_arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory arena.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     directory_arena->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	directory_arena->number_of_references += 1;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     directory_arena->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Empties a directory arena so that its blocks can be reused
+ * This is only possible if the caller holds the only reference
+ * Returns 1 if successful, 0 if the arena is still referenced or -1 on error
+ */
+int libfsxfs_directory_arena_empty(
+     libfsxfs_directory_arena_t *directory_arena,
+     libcerror_error_t **error )
+{
+	libfsxfs_directory_arena_block_t *block = NULL;
+	static char *function                   = "libfsxfs_directory_arena_empty";
+	int result                              = 0;
+
+	if( directory_arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory arena.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     directory_arena->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( directory_arena->number_of_references == 1 )
+	{
+		/* Keep the most recently allocated, and largest, block
+		 */
+		block = directory_arena->first_block;
+
+		if( block != NULL )
+		{
+			directory_arena->first_block = block->next_block;
+
+			block->data_offset = 0;
+			block->next_block  = NULL;
+		}
+		result = libfsxfs_directory_arena_free_blocks(
+		          directory_arena,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free blocks.",
+			 function );
+
+			result = -1;
+		}
+		directory_arena->first_block = block;
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     directory_arena->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Allocates data from a directory arena
+ * The data is 8-byte aligned and remains valid until the last reference to the arena is released
+ * Only the owner of the arena is expected to allocate data
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_directory_arena_allocate(
+     libfsxfs_directory_arena_t *directory_arena,
+     size_t size,
+     uint8_t **data,
+     libcerror_error_t **error )
+{
+	libfsxfs_directory_arena_block_t *block = NULL;
+	static char *function                   = "libfsxfs_directory_arena_allocate";
+	size_t block_size                       = 0;
+
+	if( directory_arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( size == 0 )
+	 || ( size > (size_t) LIBFSXFS_DIRECTORY_ARENA_MAXIMUM_BLOCK_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( size % 8 ) != 0 )
+	{
+		size += 8 - ( size % 8 );
+	}
+	block = directory_arena->first_block;
+
+	if( ( block == NULL )
+	 || ( size > ( block->data_size - block->data_offset ) ) )
+	{
+		if( block == NULL )
+		{
+			block_size = LIBFSXFS_DIRECTORY_ARENA_MINIMUM_BLOCK_SIZE;
+		}
+		else if( block->data_size < LIBFSXFS_DIRECTORY_ARENA_MAXIMUM_BLOCK_SIZE )
+		{
+			block_size = block->data_size * 2;
+		}
+		else
+		{
+			block_size = LIBFSXFS_DIRECTORY_ARENA_MAXIMUM_BLOCK_SIZE;
+		}
+		block = memory_allocate_structure(
+		         libfsxfs_directory_arena_block_t );
+
+		if( block == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create block.",
+			 function );
+
+			goto on_error;
+		}
+		block->data = (uint8_t *) memory_allocate(
+		                           sizeof( uint8_t ) * block_size );
+
+		if( block->data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create block data.",
+			 function );
+
+			goto on_error;
+		}
+		block->data_size   = block_size;
+		block->data_offset = 0;
+		block->next_block  = directory_arena->first_block;
+
+		directory_arena->first_block = block;
+	}
+	*data = &( block->data[ block->data_offset ] );
+
+	block->data_offset += size;
+
+	return( 1 );
+
+on_error:
+	if( block != NULL )
+	{
+		memory_free(
+		 block );
+	}
+	return( -1 );
+}
+
@@ -0,0 +1,107 @@
+/*
+ * Directory entry arena functions
+ *
+ * Copyright (C) 2020-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSXFS_DIRECTORY_ARENA_H )
+#define _LIBFSXFS_DIRECTORY_ARENA_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsxfs_definitions.h"
+#include "libfsxfs_libcerror.h"
+#include "libfsxfs_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfsxfs_directory_arena_block libfsxfs_directory_arena_block_t;
+
+struct libfsxfs_directory_arena_block
+{
+	/* The data
+	 */
+	uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* The offset of the unused data
+	 */
+	size_t data_offset;
+
+	/* The next (previously allocated) block
+	 */
+	libfsxfs_directory_arena_block_t *next_block;
+};
+
+typedef struct libfsxfs_directory_arena libfsxfs_directory_arena_t;
+
+struct libfsxfs_directory_arena
+{
+	/* The most recently allocated block
+	 */
+	libfsxfs_directory_arena_block_t *first_block;
+
+	/* The number of references
+	 */
+	int number_of_references;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
+};
+
+int libfsxfs_directory_arena_initialize(
+     libfsxfs_directory_arena_t **directory_arena,
+     libcerror_error_t **error );
+
+int libfsxfs_directory_arena_free(
+     libfsxfs_directory_arena_t **directory_arena,
+     libcerror_error_t **error );
+
+int libfsxfs_directory_arena_free_blocks(
+     libfsxfs_directory_arena_t *directory_arena,
+     libcerror_error_t **error );
+
+int libfsxfs_directory_arena_add_reference(
+     libfsxfs_directory_arena_t *directory_arena,
+     libcerror_error_t **error );
+
+int libfsxfs_directory_arena_empty(
+     libfsxfs_directory_arena_t *directory_arena,
+     libcerror_error_t **error );
+
+int libfsxfs_directory_arena_allocate(
+     libfsxfs_directory_arena_t *directory_arena,
+     size_t size,
+     uint8_t **data,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSXFS_DIRECTORY_ARENA_H ) */
+
@@ -23,12 +23,15 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libfsxfs_definitions.h"
+#include "libfsxfs_directory_arena.h"
 #include "libfsxfs_directory_entry.h"
 #include "libfsxfs_libcerror.h"
 #include "libfsxfs_libuna.h"
 
 /* Creates directory entry
  * Make sure the value directory_entry is referencing, is set to NULL
+ * The directory entry is allocated separately with room for a name of maximum size
  * Returns 1 if successful or -1 on error
  */
 int libfsxfs_directory_entry_initialize(
@@ -59,8 +62,8 @@ int libfsxfs_directory_entry_initialize(
 
 		return( -1 );
 	}
-	*directory_entry = memory_allocate_structure(
-	                    libfsxfs_directory_entry_t );
+	*directory_entry = (libfsxfs_directory_entry_t *) memory_allocate(
+	                                                   sizeof( libfsxfs_directory_entry_t ) + 255 );
 
 	if( *directory_entry == NULL )
 	{
@@ -76,7 +79,7 @@ int libfsxfs_directory_entry_initialize(
 	if( memory_set(
 	     *directory_entry,
 	     0,
-	     sizeof( libfsxfs_directory_entry_t ) ) == NULL )
+	     sizeof( libfsxfs_directory_entry_t ) + 255 ) == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -87,6 +90,8 @@ int libfsxfs_directory_entry_initialize(
 
 		goto on_error;
 	}
+	( *directory_entry )->name = (uint8_t *) &( ( *directory_entry )[ 1 ] );
+
 	return( 1 );
 
 on_error:
@@ -100,6 +105,84 @@ on_error:
 	return( -1 );
 }
 
+/* Creates directory entry in a directory arena
+ * Make sure the value directory_entry is referencing, is set to NULL
+ * The directory entry and its name are stored in the arena, which avoids
+ * an allocation per directory entry. The directory entry holds a reference
+ * to the arena that is released when the directory entry is freed.
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_directory_entry_initialize_from_arena(
+     libfsxfs_directory_entry_t **directory_entry,
+     libfsxfs_directory_arena_t *directory_arena,
+     uint8_t name_size,
+     libcerror_error_t **error )
+{
+	uint8_t *data         = NULL;
+	static char *function = "libfsxfs_directory_entry_initialize_from_arena";
+
+	if( directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *directory_entry != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid directory entry value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsxfs_directory_arena_allocate(
+	     directory_arena,
+	     sizeof( libfsxfs_directory_entry_t ) + (size_t) name_size,
+	     &data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to allocate directory entry from arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsxfs_directory_arena_add_reference(
+	     directory_arena,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to add reference to arena.",
+		 function );
+
+		return( -1 );
+	}
+	*directory_entry = (libfsxfs_directory_entry_t *) data;
+
+	( *directory_entry )->inode_number    = 0;
+	( *directory_entry )->offset          = 0;
+	( *directory_entry )->name            = &( data[ sizeof( libfsxfs_directory_entry_t ) ] );
+	( *directory_entry )->name_size       = 0;
+	( *directory_entry )->file_type       = 0;
+	( *directory_entry )->directory_arena = directory_arena;
+
+	return( 1 );
+}
+
 /* Frees directory entry
  * Returns 1 if successful or -1 on error
  */
@@ -107,7 +190,8 @@ int libfsxfs_directory_entry_free(
      libfsxfs_directory_entry_t **directory_entry,
      libcerror_error_t **error )
 {
-	static char *function = "libfsxfs_directory_entry_free";
+	libfsxfs_directory_arena_t *directory_arena = NULL;
+	static char *function                       = "libfsxfs_directory_entry_free";
 
 	if( directory_entry == NULL )
 	{
@@ -122,15 +206,40 @@ int libfsxfs_directory_entry_free(
 	}
 	if( *directory_entry != NULL )
 	{
-		memory_free(
-		 *directory_entry );
+		directory_arena = ( *directory_entry )->directory_arena;
 
+		if( directory_arena == NULL )
+		{
+			memory_free(
+			 *directory_entry );
+		}
 		*directory_entry = NULL;
+
+		/* The directory entry is stored in the arena hence only the reference is released
+		 */
+		if( directory_arena != NULL )
+		{
+			if( libfsxfs_directory_arena_free(
+			     &directory_arena,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to release directory arena.",
+				 function );
+
+				return( -1 );
+			}
+		}
 	}
 	return( 1 );
 }
 
 /* Clones the directory entry value
+ * A directory entry stored in a directory arena is shared, in which case cloning
+ * only adds a reference to the arena
  * Returns 1 if successful or -1 on error
  */
 int libfsxfs_directory_entry_clone(
@@ -168,43 +277,65 @@ int libfsxfs_directory_entry_clone(
 
 		return( 1 );
 	}
-	*destination_directory_entry = memory_allocate_structure(
-	                                libfsxfs_directory_entry_t );
+	if( source_directory_entry->directory_arena != NULL )
+	{
+		if( libfsxfs_directory_arena_add_reference(
+		     source_directory_entry->directory_arena,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to add reference to directory arena.",
+			 function );
+
+			return( -1 );
+		}
+		*destination_directory_entry = source_directory_entry;
 
-	if( *destination_directory_entry == NULL )
+		return( 1 );
+	}
+	if( libfsxfs_directory_entry_initialize(
+	     destination_directory_entry,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
 		 "%s: unable to create destination directory entry.",
 		 function );
 
 		goto on_error;
 	}
 	if( memory_copy(
-	     *destination_directory_entry,
-	     source_directory_entry,
-	     sizeof( libfsxfs_directory_entry_t ) ) == NULL )
+	     ( *destination_directory_entry )->name,
+	     source_directory_entry->name,
+	     (size_t) source_directory_entry->name_size ) == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_MEMORY,
 		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-		 "%s: unable to copy source to destination directory entry.",
+		 "%s: unable to copy name.",
 		 function );
 
 		goto on_error;
 	}
+	( *destination_directory_entry )->inode_number = source_directory_entry->inode_number;
+	( *destination_directory_entry )->offset       = source_directory_entry->offset;
+	( *destination_directory_entry )->name_size    = source_directory_entry->name_size;
+	( *destination_directory_entry )->file_type    = source_directory_entry->file_type;
+
 	return( 1 );
 
 on_error:
 	if( *destination_directory_entry != NULL )
 	{
-		memory_free(
-		 *destination_directory_entry );
-
-		*destination_directory_entry = NULL;
+		libfsxfs_directory_entry_free(
+		 destination_directory_entry,
+		 NULL );
 	}
 	return( -1 );
 }
@@ -246,6 +377,78 @@ int libfsxfs_directory_entry_get_inode_number(
 	return( 1 );
 }
 
+/* Retrieves the file type
+ * The file type is stored in the directory entry by file systems with the file type feature
+ * and is returned as a file mode file type, such as LIBFSXFS_FILE_TYPE_DIRECTORY
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfsxfs_directory_entry_get_file_type(
+     libfsxfs_directory_entry_t *directory_entry,
+     uint16_t *file_type,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_directory_entry_get_file_type";
+
+	if( directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file type.",
+		 function );
+
+		return( -1 );
+	}
+	switch( directory_entry->file_type )
+	{
+		case LIBFSXFS_DIRECTORY_ENTRY_FILE_TYPE_REGULAR_FILE:
+			*file_type = LIBFSXFS_FILE_TYPE_REGULAR_FILE;
+			break;
+
+		case LIBFSXFS_DIRECTORY_ENTRY_FILE_TYPE_DIRECTORY:
+			*file_type = LIBFSXFS_FILE_TYPE_DIRECTORY;
+			break;
+
+		case LIBFSXFS_DIRECTORY_ENTRY_FILE_TYPE_CHARACTER_DEVICE:
+			*file_type = LIBFSXFS_FILE_TYPE_CHARACTER_DEVICE;
+			break;
+
+		case LIBFSXFS_DIRECTORY_ENTRY_FILE_TYPE_BLOCK_DEVICE:
+			*file_type = LIBFSXFS_FILE_TYPE_BLOCK_DEVICE;
+			break;
+
+		case LIBFSXFS_DIRECTORY_ENTRY_FILE_TYPE_FIFO:
+			*file_type = LIBFSXFS_FILE_TYPE_FIFO;
+			break;
+
+		case LIBFSXFS_DIRECTORY_ENTRY_FILE_TYPE_SOCKET:
+			*file_type = LIBFSXFS_FILE_TYPE_SOCKET;
+			break;
+
+		case LIBFSXFS_DIRECTORY_ENTRY_FILE_TYPE_SYMBOLIC_LINK:
+			*file_type = LIBFSXFS_FILE_TYPE_SYMBOLIC_LINK;
+			break;
+
+		default:
+			*file_type = 0;
+
+			return( 0 );
+	}
+	return( 1 );
+}
+
 /* Retrieves the size of the UTF-8 encoded name
  * The returned size includes the end of string character
  * Returns 1 if successful or -1 on error
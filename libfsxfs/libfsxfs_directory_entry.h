@@ -25,6 +25,7 @@
 #include <common.h>
 #include <types.h>
 
+#include "libfsxfs_directory_arena.h"
 #include "libfsxfs_libcerror.h"
 
 #if defined( __cplusplus )
@@ -39,19 +40,38 @@ struct libfsxfs_directory_entry
 	 */
 	uint64_t inode_number;
 
-	/* Name
+	/* The offset of the entry in the directory data
+	 * This offset is used to resume iterating a directory
 	 */
-	uint8_t name[ 255 ];
+	uint64_t offset;
+
+	/* Name, stored directly after the directory entry
+	 */
+	uint8_t *name;
 
 	/* Name size
 	 */
 	uint8_t name_size;
+
+	/* The (directory entry) file type or 0 if not stored
+	 */
+	uint8_t file_type;
+
+	/* The directory arena that contains the directory entry or NULL if allocated separately
+	 */
+	libfsxfs_directory_arena_t *directory_arena;
 };
 
 int libfsxfs_directory_entry_initialize(
      libfsxfs_directory_entry_t **directory_entry,
      libcerror_error_t **error );
 
+int libfsxfs_directory_entry_initialize_from_arena(
+     libfsxfs_directory_entry_t **directory_entry,
+     libfsxfs_directory_arena_t *directory_arena,
+     uint8_t name_size,
+     libcerror_error_t **error );
+
 int libfsxfs_directory_entry_free(
      libfsxfs_directory_entry_t **directory_entry,
      libcerror_error_t **error );
@@ -66,6 +86,11 @@ int libfsxfs_directory_entry_get_inode_number(
      uint64_t *inode_number,
      libcerror_error_t **error );
 
+int libfsxfs_directory_entry_get_file_type(
+     libfsxfs_directory_entry_t *directory_entry,
+     uint16_t *file_type,
+     libcerror_error_t **error );
+
 int libfsxfs_directory_entry_get_utf8_name_size(
      libfsxfs_directory_entry_t *directory_entry,
      size_t *utf8_string_size,
@@ -0,0 +1,101 @@
+/*
+ * Directory name hash functions
+ *
+ * Copyright (C) 2020-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsxfs_directory_hash.h"
+#include "libfsxfs_libcerror.h"
+
+/* Calculates the hash of a directory entry name
+ * The hash is used to index the directory entries in leaf and node directories
+ * If use case folding is set, ASCII upper case characters are hashed as lower case,
+ * as used by file systems with the ASCII case-insensitive feature
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_directory_hash_calculate(
+     uint32_t *name_hash,
+     const uint8_t *name,
+     size_t name_size,
+     uint8_t use_case_folding,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_directory_hash_calculate";
+	size_t name_index     = 0;
+	uint32_t safe_hash    = 0;
+	uint8_t byte_value    = 0;
+
+	if( name_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid name size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	/* The name is hashed in groups of 4 bytes, where the previous hash
+	 * is rotated left by 7 bits for every byte in the group
+	 */
+	for( name_index = 0;
+	     name_index < name_size;
+	     name_index++ )
+	{
+		byte_value = name[ name_index ];
+
+		if( ( use_case_folding != 0 )
+		 && ( byte_value >= (uint8_t) 'A' )
+		 && ( byte_value <= (uint8_t) 'Z' ) )
+		{
+			byte_value += (uint8_t) ( 'a' - 'A' );
+		}
+		safe_hash = ( safe_hash << 7 ) | ( safe_hash >> 25 );
+		safe_hash ^= byte_value;
+	}
+	*name_hash = safe_hash;
+
+	return( 1 );
+}
+
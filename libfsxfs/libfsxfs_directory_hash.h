@@ -0,0 +1,46 @@
+/*
+ * Directory name hash functions
+ *
+ * Copyright (C) 2020-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSXFS_DIRECTORY_HASH_H )
+#define _LIBFSXFS_DIRECTORY_HASH_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsxfs_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+int libfsxfs_directory_hash_calculate(
+     uint32_t *name_hash,
+     const uint8_t *name,
+     size_t name_size,
+     uint8_t use_case_folding,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSXFS_DIRECTORY_HASH_H ) */
+
@@ -156,6 +156,7 @@ int libfsxfs_directory_table_free(
 }
 
 /* Reads the directory table
+ * The directory entries are stored in the directory arena if provided
  * Returns 1 if successful or -1 on error
  */
 int libfsxfs_directory_table_read_data(
@@ -164,6 +165,7 @@ int libfsxfs_directory_table_read_data(
      const uint8_t *data,
      size_t data_size,
      libcdata_array_t *entries_array,
+     libfsxfs_directory_arena_t *directory_arena,
      libcerror_error_t **error )
 {
 	libfsxfs_directory_entry_t *directory_entry = NULL;
@@ -171,12 +173,10 @@ int libfsxfs_directory_table_read_data(
 	size_t data_offset                          = 0;
 	size_t entry_data_size                      = 0;
 	uint32_t directory_entry_index              = 0;
+	uint16_t tag_offset                         = 0;
 	uint8_t name_size                           = 0;
 	int entry_index                             = 0;
-
-#if defined( HAVE_DEBUG_OUTPUT )
-	uint16_t value_16bit                        = 0;
-#endif
+	int result                                  = 0;
 
 	if( directory_table == NULL )
 	{
@@ -325,6 +325,10 @@ int libfsxfs_directory_table_read_data(
 
 		data_offset++;
 
+		byte_stream_copy_to_uint16_big_endian(
+		 &( data[ data_offset ] ),
+		 tag_offset );
+
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libcnotify_verbose != 0 )
 		{
@@ -333,13 +337,10 @@ int libfsxfs_directory_table_read_data(
 			 function,
 			 name_size );
 
-			byte_stream_copy_to_uint16_big_endian(
-			 &( data[ data_offset ] ),
-			 value_16bit );
 			libcnotify_printf(
 			 "%s: tag offset\t\t\t\t: %" PRIu16 "\n",
 			 function,
-			 value_16bit );
+			 tag_offset );
 		}
 #endif /* defined( HAVE_DEBUG_OUTPUT ) */
 
@@ -367,9 +368,21 @@ int libfsxfs_directory_table_read_data(
 		}
 #endif /* defined( HAVE_DEBUG_OUTPUT ) */
 
-		if( libfsxfs_directory_entry_initialize(
-		     &directory_entry,
-		     error ) != 1 )
+		if( directory_arena != NULL )
+		{
+			result = libfsxfs_directory_entry_initialize_from_arena(
+			          &directory_entry,
+			          directory_arena,
+			          name_size,
+			          error );
+		}
+		else
+		{
+			result = libfsxfs_directory_entry_initialize(
+			          &directory_entry,
+			          error );
+		}
+		if( result != 1 )
 		{
 			libcerror_error_set(
 			 error,
@@ -395,6 +408,7 @@ int libfsxfs_directory_table_read_data(
 			goto on_error;
 		}
 		directory_entry->name_size = name_size;
+		directory_entry->offset    = (uint64_t) tag_offset;
 
 		data_offset += name_size;
 
@@ -411,6 +425,8 @@ int libfsxfs_directory_table_read_data(
 			}
 #endif /* defined( HAVE_DEBUG_OUTPUT ) */
 
+			directory_entry->file_type = data[ data_offset ];
+
 			data_offset++;
 		}
 		if( directory_table->header->inode_number_data_size == 4 )
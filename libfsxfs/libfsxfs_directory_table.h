@@ -25,6 +25,7 @@
 #include <common.h>
 #include <types.h>
 
+#include "libfsxfs_directory_arena.h"
 #include "libfsxfs_directory_table_header.h"
 #include "libfsxfs_io_handle.h"
 #include "libfsxfs_libcdata.h"
@@ -57,6 +58,7 @@ int libfsxfs_directory_table_read_data(
      const uint8_t *data,
      size_t data_size,
      libcdata_array_t *entries_array,
+     libfsxfs_directory_arena_t *directory_arena,
      libcerror_error_t **error );
 
 #if defined( __cplusplus )
@@ -218,7 +218,7 @@ int libfsxfs_extent_read_data(
 	}
 	else
 	{
-		extent->range_flags = LIBFSXFS_EXTENT_FLAG_IS_SPARSE;
+		extent->range_flags = LIBFSXFS_EXTENT_FLAG_IS_SPARSE | LIBFSXFS_EXTENT_FLAG_IS_UNWRITTEN;
 	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
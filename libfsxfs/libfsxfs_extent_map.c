@@ -0,0 +1,655 @@
+/*
+ * Extent map functions
+ *
+ * Copyright (C) 2020-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfsxfs_definitions.h"
+#include "libfsxfs_extent.h"
+#include "libfsxfs_extent_map.h"
+#include "libfsxfs_inode.h"
+#include "libfsxfs_io_handle.h"
+#include "libfsxfs_libcerror.h"
+
+/* Creates an extent map
+ * Make sure the value extent_map is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_extent_map_initialize(
+     libfsxfs_extent_map_t **extent_map,
+     int number_of_allocated_entries,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_extent_map_initialize";
+
+	if( extent_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent map.",
+		 function );
+
+		return( -1 );
+	}
+	if( *extent_map != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid extent map value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_allocated_entries < 0 )
+	 || ( (size_t) number_of_allocated_entries > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libfsxfs_extent_map_entry_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of allocated entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*extent_map = memory_allocate_structure(
+	               libfsxfs_extent_map_t );
+
+	if( *extent_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create extent map.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *extent_map,
+	     0,
+	     sizeof( libfsxfs_extent_map_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear extent map.",
+		 function );
+
+		memory_free(
+		 *extent_map );
+
+		*extent_map = NULL;
+
+		return( -1 );
+	}
+	if( number_of_allocated_entries > 0 )
+	{
+		( *extent_map )->entries = (libfsxfs_extent_map_entry_t *) memory_allocate(
+		                                                            sizeof( libfsxfs_extent_map_entry_t ) * number_of_allocated_entries );
+
+		if( ( *extent_map )->entries == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create entries.",
+			 function );
+
+			goto on_error;
+		}
+		( *extent_map )->number_of_allocated_entries = number_of_allocated_entries;
+	}
+	return( 1 );
+
+on_error:
+	if( *extent_map != NULL )
+	{
+		memory_free(
+		 *extent_map );
+
+		*extent_map = NULL;
+	}
+	return( -1 );
+}
+
+/* Creates an extent map from the data extents of an inode
+ * Make sure the value extent_map is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_extent_map_initialize_from_inode(
+     libfsxfs_extent_map_t **extent_map,
+     libfsxfs_io_handle_t *io_handle,
+     libfsxfs_inode_t *inode,
+     libcerror_error_t **error )
+{
+	libfsxfs_extent_map_t *safe_extent_map = NULL;
+	libfsxfs_extent_t *extent              = NULL;
+	static char *function                  = "libfsxfs_extent_map_initialize_from_inode";
+	off64_t logical_offset                 = 0;
+	off64_t physical_offset                = 0;
+	uint64_t relative_block_number         = 0;
+	int allocation_group_index             = 0;
+	int extent_index                       = 0;
+	int number_of_extents                  = 0;
+
+	if( extent_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent map.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->allocation_group_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid IO handle - allocation group size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->block_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid IO handle - block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsxfs_inode_get_number_of_data_extents(
+	     inode,
+	     &number_of_extents,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of data extents.",
+		 function );
+
+		goto on_error;
+	}
+	/* The entries are allocated at once to prevent an allocation per extent
+	 */
+	if( libfsxfs_extent_map_initialize(
+	     &safe_extent_map,
+	     number_of_extents,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create extent map.",
+		 function );
+
+		goto on_error;
+	}
+	for( extent_index = 0;
+	     extent_index < number_of_extents;
+	     extent_index++ )
+	{
+		if( libfsxfs_inode_get_data_extent_by_index(
+		     inode,
+		     extent_index,
+		     &extent,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve data extent: %d.",
+			 function,
+			 extent_index );
+
+			goto on_error;
+		}
+		if( extent == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing extent: %d.",
+			 function,
+			 extent_index );
+
+			goto on_error;
+		}
+		allocation_group_index = (int) ( extent->physical_block_number >> io_handle->number_of_relative_block_number_bits );
+		relative_block_number  = extent->physical_block_number & ( ( 1 << io_handle->number_of_relative_block_number_bits ) - 1 );
+
+		logical_offset  = (off64_t) extent->logical_block_number * io_handle->block_size;
+		physical_offset = ( ( (off64_t) allocation_group_index * io_handle->allocation_group_size ) + relative_block_number ) * io_handle->block_size;
+
+		if( libfsxfs_extent_map_append_entry(
+		     safe_extent_map,
+		     logical_offset,
+		     physical_offset,
+		     (size64_t) extent->number_of_blocks * io_handle->block_size,
+		     extent->range_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append extent: %d to map.",
+			 function,
+			 extent_index );
+
+			goto on_error;
+		}
+	}
+	*extent_map = safe_extent_map;
+
+	return( 1 );
+
+on_error:
+	if( safe_extent_map != NULL )
+	{
+		libfsxfs_extent_map_free(
+		 &safe_extent_map,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees an extent map
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_extent_map_free(
+     libfsxfs_extent_map_t **extent_map,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_extent_map_free";
+
+	if( extent_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent map.",
+		 function );
+
+		return( -1 );
+	}
+	if( *extent_map != NULL )
+	{
+		if( ( *extent_map )->entries != NULL )
+		{
+			memory_free(
+			 ( *extent_map )->entries );
+		}
+		memory_free(
+		 *extent_map );
+
+		*extent_map = NULL;
+	}
+	return( 1 );
+}
+
+/* Appends an entry
+ * The entries must be appended in logical order and must not overlap
+ * An entry that continues the last entry, both logically and physically and with
+ * the same range flags, is merged into the last entry so that a read can span both
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_extent_map_append_entry(
+     libfsxfs_extent_map_t *extent_map,
+     off64_t logical_offset,
+     off64_t physical_offset,
+     size64_t size,
+     uint32_t range_flags,
+     libcerror_error_t **error )
+{
+	libfsxfs_extent_map_entry_t *entries    = NULL;
+	libfsxfs_extent_map_entry_t *last_entry = NULL;
+	static char *function                   = "libfsxfs_extent_map_append_entry";
+	int number_of_allocated_entries         = 0;
+
+	if( extent_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent map.",
+		 function );
+
+		return( -1 );
+	}
+	if( logical_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid logical offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( physical_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid physical offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size64_t) ( INT64_MAX - logical_offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( extent_map->number_of_entries > 0 )
+	{
+		last_entry = &( extent_map->entries[ extent_map->number_of_entries - 1 ] );
+
+		if( logical_offset < (off64_t) ( last_entry->logical_offset + last_entry->size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid logical offset value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		/* The physical offset of sparse entries is not used
+		 */
+		if( ( last_entry->range_flags == range_flags )
+		 && ( logical_offset == (off64_t) ( last_entry->logical_offset + last_entry->size ) )
+		 && ( ( ( range_flags & LIBFSXFS_EXTENT_FLAG_IS_SPARSE ) != 0 )
+		  || ( physical_offset == (off64_t) ( last_entry->physical_offset + last_entry->size ) ) ) )
+		{
+			last_entry->size += size;
+
+			return( 1 );
+		}
+	}
+	if( extent_map->number_of_entries >= extent_map->number_of_allocated_entries )
+	{
+		if( extent_map->number_of_allocated_entries == 0 )
+		{
+			number_of_allocated_entries = 16;
+		}
+		else if( extent_map->number_of_allocated_entries < ( INT_MAX / 2 ) )
+		{
+			number_of_allocated_entries = extent_map->number_of_allocated_entries * 2;
+		}
+		else
+		{
+			number_of_allocated_entries = INT_MAX;
+		}
+		if( ( number_of_allocated_entries <= extent_map->number_of_entries )
+		 || ( (size_t) number_of_allocated_entries > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libfsxfs_extent_map_entry_t ) ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid number of allocated entries value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		entries = (libfsxfs_extent_map_entry_t *) memory_reallocate(
+		                                           extent_map->entries,
+		                                           sizeof( libfsxfs_extent_map_entry_t ) * number_of_allocated_entries );
+
+		if( entries == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize entries.",
+			 function );
+
+			return( -1 );
+		}
+		extent_map->entries                     = entries;
+		extent_map->number_of_allocated_entries = number_of_allocated_entries;
+	}
+	extent_map->entries[ extent_map->number_of_entries ].logical_offset  = logical_offset;
+	extent_map->entries[ extent_map->number_of_entries ].physical_offset = physical_offset;
+	extent_map->entries[ extent_map->number_of_entries ].size            = size;
+	extent_map->entries[ extent_map->number_of_entries ].range_flags     = range_flags;
+
+	extent_map->number_of_entries += 1;
+
+	return( 1 );
+}
+
+/* Retrieves the number of entries
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_extent_map_get_number_of_entries(
+     libfsxfs_extent_map_t *extent_map,
+     int *number_of_entries,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_extent_map_get_number_of_entries";
+
+	if( extent_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent map.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_entries = extent_map->number_of_entries;
+
+	return( 1 );
+}
+
+/* Retrieves a specific entry
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_extent_map_get_entry_by_index(
+     libfsxfs_extent_map_t *extent_map,
+     int entry_index,
+     libfsxfs_extent_map_entry_t **entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_extent_map_get_entry_by_index";
+
+	if( extent_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent map.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( entry_index < 0 )
+	 || ( entry_index >= extent_map->number_of_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry.",
+		 function );
+
+		return( -1 );
+	}
+	*entry = &( extent_map->entries[ entry_index ] );
+
+	return( 1 );
+}
+
+/* Retrieves the index of the entry that contains a specific logical offset
+ * If no entry contains the offset, the index of the first entry after the offset
+ * is returned, which is the number of entries if there is no such entry
+ * Returns 1 if successful, 0 if no entry contains the offset or -1 on error
+ */
+int libfsxfs_extent_map_get_entry_index_at_offset(
+     libfsxfs_extent_map_t *extent_map,
+     off64_t offset,
+     int *entry_index,
+     libcerror_error_t **error )
+{
+	libfsxfs_extent_map_entry_t *entry = NULL;
+	static char *function              = "libfsxfs_extent_map_get_entry_index_at_offset";
+	int lower_entry_index              = 0;
+	int middle_entry_index             = 0;
+	int upper_entry_index              = 0;
+
+	if( extent_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent map.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry index.",
+		 function );
+
+		return( -1 );
+	}
+	/* Determine the number of entries that start at or before the offset
+	 */
+	upper_entry_index = extent_map->number_of_entries;
+
+	while( lower_entry_index < upper_entry_index )
+	{
+		middle_entry_index = lower_entry_index + ( ( upper_entry_index - lower_entry_index ) / 2 );
+
+		if( extent_map->entries[ middle_entry_index ].logical_offset <= offset )
+		{
+			lower_entry_index = middle_entry_index + 1;
+		}
+		else
+		{
+			upper_entry_index = middle_entry_index;
+		}
+	}
+	if( lower_entry_index > 0 )
+	{
+		entry = &( extent_map->entries[ lower_entry_index - 1 ] );
+
+		if( (size64_t) ( offset - entry->logical_offset ) < entry->size )
+		{
+			*entry_index = lower_entry_index - 1;
+
+			return( 1 );
+		}
+	}
+	*entry_index = lower_entry_index;
+
+	return( 0 );
+}
+
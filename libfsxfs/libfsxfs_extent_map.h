@@ -0,0 +1,119 @@
+/*
+ * Extent map functions
+ *
+ * Copyright (C) 2020-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSXFS_EXTENT_MAP_H )
+#define _LIBFSXFS_EXTENT_MAP_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsxfs_inode.h"
+#include "libfsxfs_io_handle.h"
+#include "libfsxfs_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfsxfs_extent_map_entry libfsxfs_extent_map_entry_t;
+
+struct libfsxfs_extent_map_entry
+{
+	/* The logical offset
+	 */
+	off64_t logical_offset;
+
+	/* The physical offset
+	 */
+	off64_t physical_offset;
+
+	/* The size
+	 */
+	size64_t size;
+
+	/* The range flags
+	 */
+	uint32_t range_flags;
+};
+
+typedef struct libfsxfs_extent_map libfsxfs_extent_map_t;
+
+struct libfsxfs_extent_map
+{
+	/* The entries, sorted by logical offset
+	 */
+	libfsxfs_extent_map_entry_t *entries;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+
+	/* The number of allocated entries
+	 */
+	int number_of_allocated_entries;
+};
+
+int libfsxfs_extent_map_initialize(
+     libfsxfs_extent_map_t **extent_map,
+     int number_of_allocated_entries,
+     libcerror_error_t **error );
+
+int libfsxfs_extent_map_initialize_from_inode(
+     libfsxfs_extent_map_t **extent_map,
+     libfsxfs_io_handle_t *io_handle,
+     libfsxfs_inode_t *inode,
+     libcerror_error_t **error );
+
+int libfsxfs_extent_map_free(
+     libfsxfs_extent_map_t **extent_map,
+     libcerror_error_t **error );
+
+int libfsxfs_extent_map_append_entry(
+     libfsxfs_extent_map_t *extent_map,
+     off64_t logical_offset,
+     off64_t physical_offset,
+     size64_t size,
+     uint32_t range_flags,
+     libcerror_error_t **error );
+
+int libfsxfs_extent_map_get_number_of_entries(
+     libfsxfs_extent_map_t *extent_map,
+     int *number_of_entries,
+     libcerror_error_t **error );
+
+int libfsxfs_extent_map_get_entry_by_index(
+     libfsxfs_extent_map_t *extent_map,
+     int entry_index,
+     libfsxfs_extent_map_entry_t **entry,
+     libcerror_error_t **error );
+
+int libfsxfs_extent_map_get_entry_index_at_offset(
+     libfsxfs_extent_map_t *extent_map,
+     off64_t offset,
+     int *entry_index,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSXFS_EXTENT_MAP_H ) */
+
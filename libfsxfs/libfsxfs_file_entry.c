@@ -24,20 +24,22 @@
 #include <types.h>
 
 #include "libfsxfs_attributes.h"
-#include "libfsxfs_data_stream.h"
 #include "libfsxfs_definitions.h"
 #include "libfsxfs_directory.h"
 #include "libfsxfs_directory_entry.h"
 #include "libfsxfs_extended_attribute.h"
+#include "libfsxfs_extent.h"
+#include "libfsxfs_extent_map.h"
 #include "libfsxfs_file_entry.h"
 #include "libfsxfs_inode.h"
+#include "libfsxfs_io_queue.h"
 #include "libfsxfs_libbfio.h"
 #include "libfsxfs_libcerror.h"
 #include "libfsxfs_libcnotify.h"
 #include "libfsxfs_libcthreads.h"
-#include "libfsxfs_libfdata.h"
 #include "libfsxfs_libfdatetime.h"
 #include "libfsxfs_libuna.h"
+#include "libfsxfs_read_vector.h"
 #include "libfsxfs_types.h"
 
 /* Creates a file entry
@@ -138,18 +140,15 @@ int libfsxfs_file_entry_initialize(
 
 			goto on_error;
 		}
-		if( libfsxfs_data_stream_initialize(
-		     &( internal_file_entry->data_stream ),
-		     io_handle,
-		     inode,
-		     internal_file_entry->data_size,
-		     error ) != 1 )
+		if( ( inode->fork_type != LIBFSXFS_FORK_TYPE_INLINE_DATA )
+		 && ( inode->fork_type != LIBFSXFS_FORK_TYPE_EXTENTS )
+		 && ( inode->fork_type != LIBFSXFS_FORK_TYPE_BTREE ) )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create data stream.",
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported data fork type.",
 			 function );
 
 			goto on_error;
@@ -296,17 +295,33 @@ int libfsxfs_file_entry_free(
 				result = -1;
 			}
 		}
-		if( internal_file_entry->data_stream != NULL )
+		if( internal_file_entry->directory_cursor != NULL )
+		{
+			if( libfsxfs_directory_free(
+			     &( internal_file_entry->directory_cursor ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free directory cursor.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( internal_file_entry->extent_map != NULL )
 		{
-			if( libfdata_stream_free(
-			     &( internal_file_entry->data_stream ),
+			if( libfsxfs_extent_map_free(
+			     &( internal_file_entry->extent_map ),
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free data stream.",
+				 "%s: unable to free extent map.",
 				 function );
 
 				result = -1;
@@ -317,6 +332,11 @@ int libfsxfs_file_entry_free(
 			memory_free(
 			 internal_file_entry->symbolic_link_data );
 		}
+		if( internal_file_entry->read_ahead_buffer != NULL )
+		{
+			memory_free(
+			 internal_file_entry->read_ahead_buffer );
+		}
 		memory_free(
 		 internal_file_entry );
 	}
@@ -410,6 +430,80 @@ on_error:
 	return( -1 );
 }
 
+/* Retrieves the extent map
+ * The extent map is created on first use, since it requires the data extents
+ * B+ tree of the inode to be read
+ * The caller is expected to hold the lock for writing, if any
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_internal_file_entry_get_extent_map(
+     libfsxfs_internal_file_entry_t *internal_file_entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_internal_file_entry_get_extent_map";
+
+	if( internal_file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file_entry->inode == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file entry - missing inode.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_file_entry->extent_map != NULL )
+	 || ( internal_file_entry->inode->fork_type == LIBFSXFS_FORK_TYPE_INLINE_DATA ) )
+	{
+		return( 1 );
+	}
+	if( libfsxfs_file_system_read_data_extents(
+	     internal_file_entry->file_system,
+	     internal_file_entry->io_handle,
+	     internal_file_entry->file_io_handle,
+	     internal_file_entry->inode_number,
+	     internal_file_entry->inode,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read data extents of inode.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsxfs_extent_map_initialize_from_inode(
+	     &( internal_file_entry->extent_map ),
+	     internal_file_entry->io_handle,
+	     internal_file_entry->inode,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create extent map.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
 /* Determines the symbolic link data
  * Returns 1 if successful or -1 on error
  */
@@ -483,13 +577,24 @@ int libfsxfs_internal_file_entry_get_symbolic_link_data(
 		}
 		internal_file_entry->symbolic_link_data_size = (size_t) internal_file_entry->data_size;
 
-		read_count = libfdata_stream_read_buffer_at_offset(
-		              internal_file_entry->data_stream,
-		              (intptr_t *) internal_file_entry->file_io_handle,
+		if( libfsxfs_internal_file_entry_get_extent_map(
+		     internal_file_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve extent map.",
+			 function );
+
+			goto on_error;
+		}
+		read_count = libfsxfs_internal_file_entry_read_buffer_at_offset(
+		              internal_file_entry,
 		              internal_file_entry->symbolic_link_data,
 		              (size_t) internal_file_entry->data_size,
 		              0,
-		              0,
 		              error );
 
 		if( read_count != (ssize_t) internal_file_entry->data_size )
@@ -498,7 +603,7 @@ int libfsxfs_internal_file_entry_get_symbolic_link_data(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_IO,
 			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read from data stream.",
+			 "%s: unable to read symbolic link data.",
 			 function );
 
 			goto on_error;
@@ -531,18 +636,34 @@ on_error:
 	return( -1 );
 }
 
-/* Retrieves the inode number
- * Returns 1 if successful or -1 on error
+/* Reads the segments of data at a specific offset
+ * If a batch is provided the stored segments are submitted to the IO queue, split at the
+ * stripe boundaries of the file IO pool, and are only read after libfsxfs_io_queue_wait
+ * has returned for the batch, also when this function fails
+ * Returns the number of bytes read or submitted or -1 on error
  */
-int libfsxfs_file_entry_get_inode_number(
-     libfsxfs_file_entry_t *file_entry,
-     uint64_t *inode_number,
-     libcerror_error_t **error )
+ssize_t libfsxfs_internal_file_entry_read_segments(
+         libfsxfs_internal_file_entry_t *internal_file_entry,
+         libfsxfs_io_queue_batch_t *batch,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error )
 {
-	libfsxfs_internal_file_entry_t *internal_file_entry = NULL;
-	static char *function                               = "libfsxfs_file_entry_get_inode_number";
+	libfsxfs_extent_map_entry_t *entry = NULL;
+	static char *function              = "libfsxfs_internal_file_entry_read_segments";
+	size_t buffer_offset               = 0;
+	size_t read_size                   = 0;
+	size_t segment_size                = 0;
+	size_t submit_offset               = 0;
+	size_t submit_size                 = 0;
+	ssize_t read_count                 = 0;
+	off64_t current_offset             = 0;
+	off64_t physical_offset            = 0;
+	int entry_index                    = 0;
+	int result                         = 0;
 
-	if( file_entry == NULL )
+	if( internal_file_entry == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -553,99 +674,117 @@ int libfsxfs_file_entry_get_inode_number(
 
 		return( -1 );
 	}
-	internal_file_entry = (libfsxfs_internal_file_entry_t *) file_entry;
-
-	if( inode_number == NULL )
+	if( ( batch != NULL )
+	 && ( ( internal_file_entry->io_handle == NULL )
+	  || ( internal_file_entry->io_handle->io_queue == NULL ) ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid inode number.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file entry - missing IO queue.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_file_entry->read_write_lock,
-	     error ) != 1 )
+	if( internal_file_entry->inode == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file entry - missing inode.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	*inode_number = internal_file_entry->inode_number;
-
-#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_file_entry->read_write_lock,
-	     error ) != 1 )
+	if( buffer == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	return( 1 );
-}
-
-/* Retrieves the creation date and time
- * The timestamp is a signed 64-bit POSIX date and time value in number of nano seconds
- * This value is retrieved from the inode
- * Returns 1 if successful, 0 if not available or -1 on error
- */
-int libfsxfs_file_entry_get_creation_time(
-     libfsxfs_file_entry_t *file_entry,
-     int64_t *posix_time,
-     libcerror_error_t **error )
-{
-	libfsxfs_internal_file_entry_t *internal_file_entry = NULL;
-	static char *function                               = "libfsxfs_file_entry_get_creation_time";
-	int result                                          = 1;
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
 
-	if( file_entry == NULL )
+		return( -1 );
+	}
+	if( offset < 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file entry.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
 		 function );
 
 		return( -1 );
 	}
-	internal_file_entry = (libfsxfs_internal_file_entry_t *) file_entry;
+	if( (size64_t) offset >= internal_file_entry->data_size )
+	{
+		return( 0 );
+	}
+	read_size = buffer_size;
 
-#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_file_entry->read_write_lock,
-	     error ) != 1 )
+	if( (size64_t) read_size > ( internal_file_entry->data_size - offset ) )
+	{
+		read_size = (size_t) ( internal_file_entry->data_size - offset );
+	}
+	if( internal_file_entry->inode->fork_type == LIBFSXFS_FORK_TYPE_INLINE_DATA )
+	{
+		if( internal_file_entry->inode->inline_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid file entry - invalid inode - missing inline data.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_copy(
+		     buffer,
+		     &( internal_file_entry->inode->inline_data[ offset ] ),
+		     read_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy inline data.",
+			 function );
+
+			return( -1 );
+		}
+		return( (ssize_t) read_size );
+	}
+	if( internal_file_entry->extent_map == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file entry - missing extent map.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	result = libfsxfs_inode_get_creation_time(
-	          internal_file_entry->inode,
-	          posix_time,
+	result = libfsxfs_extent_map_get_entry_index_at_offset(
+	          internal_file_entry->extent_map,
+	          offset,
+	          &entry_index,
 	          error );
 
 	if( result == -1 )
@@ -654,44 +793,149 @@ int libfsxfs_file_entry_get_creation_time(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve creation time.",
-		 function );
+		 "%s: unable to retrieve extent map entry index at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 offset,
+		 offset );
 
-		result = -1;
+		return( -1 );
 	}
-#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_file_entry->read_write_lock,
-	     error ) != 1 )
+	while( buffer_offset < read_size )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
-		 function );
+		current_offset = offset + (off64_t) buffer_offset;
+		segment_size   = read_size - buffer_offset;
+		entry          = NULL;
 
-		return( -1 );
+		/* The entries are sorted by logical offset, hence after the initial lookup
+		 * the entry of the next segment is the current or the next entry
+		 */
+		if( entry_index < internal_file_entry->extent_map->number_of_entries )
+		{
+			entry = &( internal_file_entry->extent_map->entries[ entry_index ] );
+
+			if( current_offset < entry->logical_offset )
+			{
+				/* The data before the entry is not stored
+				 */
+				if( (size64_t) segment_size > (size64_t) ( entry->logical_offset - current_offset ) )
+				{
+					segment_size = (size_t) ( entry->logical_offset - current_offset );
+				}
+				entry = NULL;
+			}
+			else
+			{
+				if( (size64_t) segment_size > ( entry->size - ( current_offset - entry->logical_offset ) ) )
+				{
+					segment_size = (size_t) ( entry->size - ( current_offset - entry->logical_offset ) );
+				}
+				entry_index++;
+			}
+		}
+		if( ( entry == NULL )
+		 || ( ( entry->range_flags & LIBFSXFS_EXTENT_FLAG_IS_SPARSE ) != 0 ) )
+		{
+			if( memory_set(
+			     &( buffer[ buffer_offset ] ),
+			     0,
+			     segment_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+				 "%s: unable to clear buffer.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		else
+		{
+			physical_offset = entry->physical_offset + ( current_offset - entry->logical_offset );
+
+			if( batch != NULL )
+			{
+				for( submit_offset = 0;
+				     submit_offset < segment_size;
+				     submit_offset += submit_size )
+				{
+					submit_size = (size_t) ( LIBFSXFS_FILE_IO_POOL_STRIPE_SIZE - ( ( physical_offset + submit_offset ) % LIBFSXFS_FILE_IO_POOL_STRIPE_SIZE ) );
+
+					if( submit_size > ( segment_size - submit_offset ) )
+					{
+						submit_size = segment_size - submit_offset;
+					}
+					if( libfsxfs_io_queue_submit_read(
+					     internal_file_entry->io_handle->io_queue,
+					     batch,
+					     &( buffer[ buffer_offset + submit_offset ] ),
+					     submit_size,
+					     physical_offset + (off64_t) submit_offset,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_IO,
+						 LIBCERROR_IO_ERROR_READ_FAILED,
+						 "%s: unable to submit read of data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+						 function,
+						 physical_offset + (off64_t) submit_offset,
+						 physical_offset + (off64_t) submit_offset );
+
+						return( -1 );
+					}
+				}
+				buffer_offset += segment_size;
+
+				continue;
+			}
+			read_count = libfsxfs_io_handle_read_data_at_offset(
+			              internal_file_entry->io_handle,
+			              internal_file_entry->file_io_handle,
+			              &( buffer[ buffer_offset ] ),
+			              segment_size,
+			              physical_offset,
+			              error );
+
+			if( read_count != (ssize_t) segment_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 physical_offset,
+				 physical_offset );
+
+				return( -1 );
+			}
+		}
+		buffer_offset += segment_size;
 	}
-#endif
-	return( result );
+	return( (ssize_t) buffer_offset );
 }
 
-/* Retrieves the modification date and time
- * The timestamp is a signed 64-bit POSIX date and time value in number of nano seconds
- * This value is retrieved from the inode
- * Returns 1 if successful or -1 on error
+/* Reads data at a specific offset without using or changing the current offset
+ * The extent map is not changed after the file entry has been created,
+ * hence this function does not require the read/write lock of the file entry
+ * Reads larger than a stripe of the file IO pool are processed by the IO queue if set
+ * Returns the number of bytes read or -1 on error
  */
-int libfsxfs_file_entry_get_modification_time(
-     libfsxfs_file_entry_t *file_entry,
-     int64_t *posix_time,
-     libcerror_error_t **error )
+ssize_t libfsxfs_internal_file_entry_read_buffer_at_offset(
+         libfsxfs_internal_file_entry_t *internal_file_entry,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error )
 {
-	libfsxfs_internal_file_entry_t *internal_file_entry = NULL;
-	static char *function                               = "libfsxfs_file_entry_get_modification_time";
-	int result                                          = 1;
+	libfsxfs_io_queue_batch_t batch;
 
-	if( file_entry == NULL )
+	static char *function = "libfsxfs_internal_file_entry_read_buffer_at_offset";
+	ssize_t read_count    = 0;
+
+	if( internal_file_entry == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -702,68 +946,341 @@ int libfsxfs_file_entry_get_modification_time(
 
 		return( -1 );
 	}
-	internal_file_entry = (libfsxfs_internal_file_entry_t *) file_entry;
+	if( ( internal_file_entry->io_handle == NULL )
+	 || ( internal_file_entry->io_handle->io_queue == NULL )
+	 || ( buffer_size <= LIBFSXFS_FILE_IO_POOL_STRIPE_SIZE ) )
+	{
+		return( libfsxfs_internal_file_entry_read_segments(
+		         internal_file_entry,
+		         NULL,
+		         buffer,
+		         buffer_size,
+		         offset,
+		         error ) );
+	}
+	if( memory_set(
+	     &batch,
+	     0,
+	     sizeof( libfsxfs_io_queue_batch_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear batch.",
+		 function );
 
-#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_file_entry->read_write_lock,
-	     error ) != 1 )
+		return( -1 );
+	}
+	read_count = libfsxfs_internal_file_entry_read_segments(
+	              internal_file_entry,
+	              &batch,
+	              buffer,
+	              buffer_size,
+	              offset,
+	              error );
+
+	/* The submitted reads refer to the buffer and need to complete, also on error
+	 */
+	if( libfsxfs_io_queue_wait(
+	     internal_file_entry->io_handle->io_queue,
+	     &batch,
+	     ( read_count < 0 ) ? NULL : error ) != 1 )
+	{
+		if( read_count >= 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to complete reads at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 offset,
+			 offset );
+		}
+		return( -1 );
+	}
+	return( read_count );
+}
+
+/* Reads data at a specific offset using the read-ahead buffer
+ * Reads that continue where the previous read ended are considered sequential.
+ * A sequential read smaller than the read-ahead window fills the read-ahead buffer
+ * with the window, after which the window doubles up to the maximum read-ahead size.
+ * Any other read resets the window and bypasses the read-ahead buffer
+ * The caller must hold the read/write lock for writing
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libfsxfs_internal_file_entry_read_buffer_with_read_ahead(
+         libfsxfs_internal_file_entry_t *internal_file_entry,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	uint8_t *reallocation          = NULL;
+	static char *function          = "libfsxfs_internal_file_entry_read_buffer_with_read_ahead";
+	size_t buffer_offset           = 0;
+	size_t maximum_read_ahead_size = 0;
+	size_t minimum_window_size     = 0;
+	size_t read_ahead_data_offset  = 0;
+	size_t read_size               = 0;
+	ssize_t read_count             = 0;
+	uint8_t is_sequential          = 0;
+
+	if( internal_file_entry == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	if( libfsxfs_inode_get_modification_time(
-	     internal_file_entry->inode,
-	     posix_time,
-	     error ) != 1 )
+	if( internal_file_entry->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve modification time.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file entry - missing IO handle.",
 		 function );
 
-		result = -1;
+		return( -1 );
 	}
-#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_file_entry->read_write_lock,
-	     error ) != 1 )
+	if( internal_file_entry->inode == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file entry - missing inode.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	return( result );
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	maximum_read_ahead_size = internal_file_entry->io_handle->maximum_read_ahead_size;
+
+	/* Inline data is stored in the inode and does not benefit from read-ahead
+	 */
+	if( ( maximum_read_ahead_size == 0 )
+	 || ( internal_file_entry->inode->fork_type == LIBFSXFS_FORK_TYPE_INLINE_DATA ) )
+	{
+		return( libfsxfs_internal_file_entry_read_buffer_at_offset(
+		         internal_file_entry,
+		         buffer,
+		         buffer_size,
+		         offset,
+		         error ) );
+	}
+	if( (size64_t) offset >= internal_file_entry->data_size )
+	{
+		return( 0 );
+	}
+	read_size = buffer_size;
+
+	if( (size64_t) read_size > ( internal_file_entry->data_size - offset ) )
+	{
+		read_size = (size_t) ( internal_file_entry->data_size - offset );
+	}
+	minimum_window_size = LIBFSXFS_READ_AHEAD_MINIMUM_WINDOW_SIZE;
+
+	if( minimum_window_size > maximum_read_ahead_size )
+	{
+		minimum_window_size = maximum_read_ahead_size;
+	}
+	is_sequential = (uint8_t) ( offset == internal_file_entry->read_ahead_next_offset );
+
+	internal_file_entry->read_ahead_next_offset = offset + (off64_t) read_size;
+
+	if( ( internal_file_entry->read_ahead_data_size > 0 )
+	 && ( offset >= internal_file_entry->read_ahead_offset )
+	 && ( offset < ( internal_file_entry->read_ahead_offset + (off64_t) internal_file_entry->read_ahead_data_size ) ) )
+	{
+		read_ahead_data_offset = (size_t) ( offset - internal_file_entry->read_ahead_offset );
+		buffer_offset          = internal_file_entry->read_ahead_data_size - read_ahead_data_offset;
+
+		if( buffer_offset > read_size )
+		{
+			buffer_offset = read_size;
+		}
+		if( memory_copy(
+		     buffer,
+		     &( internal_file_entry->read_ahead_buffer[ read_ahead_data_offset ] ),
+		     buffer_offset ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy read-ahead data.",
+			 function );
+
+			return( -1 );
+		}
+		internal_file_entry->number_of_read_ahead_hits += 1;
+
+		if( buffer_offset == read_size )
+		{
+			return( (ssize_t) read_size );
+		}
+		offset += (off64_t) buffer_offset;
+	}
+	else
+	{
+		internal_file_entry->number_of_read_ahead_misses += 1;
+	}
+	if( ( is_sequential == 0 )
+	 || ( internal_file_entry->read_ahead_window_size < minimum_window_size ) )
+	{
+		internal_file_entry->read_ahead_window_size = minimum_window_size;
+	}
+	if( ( is_sequential == 0 )
+	 || ( ( read_size - buffer_offset ) >= internal_file_entry->read_ahead_window_size ) )
+	{
+		read_count = libfsxfs_internal_file_entry_read_buffer_at_offset(
+		              internal_file_entry,
+		              &( buffer[ buffer_offset ] ),
+		              read_size - buffer_offset,
+		              offset,
+		              error );
+
+		if( read_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read buffer at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 offset,
+			 offset );
+
+			return( -1 );
+		}
+		return( (ssize_t) ( buffer_offset + read_count ) );
+	}
+	if( internal_file_entry->read_ahead_buffer_size < internal_file_entry->read_ahead_window_size )
+	{
+		reallocation = (uint8_t *) memory_reallocate(
+		                            internal_file_entry->read_ahead_buffer,
+		                            sizeof( uint8_t ) * internal_file_entry->read_ahead_window_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize read-ahead buffer.",
+			 function );
+
+			return( -1 );
+		}
+		internal_file_entry->read_ahead_buffer      = reallocation;
+		internal_file_entry->read_ahead_buffer_size = internal_file_entry->read_ahead_window_size;
+	}
+	internal_file_entry->read_ahead_data_size = 0;
+
+	read_count = libfsxfs_internal_file_entry_read_buffer_at_offset(
+	              internal_file_entry,
+	              internal_file_entry->read_ahead_buffer,
+	              internal_file_entry->read_ahead_window_size,
+	              offset,
+	              error );
+
+	if( read_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read read-ahead data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 offset,
+		 offset );
+
+		return( -1 );
+	}
+	internal_file_entry->read_ahead_offset    = offset;
+	internal_file_entry->read_ahead_data_size = (size_t) read_count;
+
+	if( internal_file_entry->read_ahead_window_size <= ( maximum_read_ahead_size / 2 ) )
+	{
+		internal_file_entry->read_ahead_window_size *= 2;
+	}
+	else
+	{
+		internal_file_entry->read_ahead_window_size = maximum_read_ahead_size;
+	}
+	read_size -= buffer_offset;
+
+	if( read_size > (size_t) read_count )
+	{
+		read_size = (size_t) read_count;
+	}
+	if( memory_copy(
+	     &( buffer[ buffer_offset ] ),
+	     internal_file_entry->read_ahead_buffer,
+	     read_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy read-ahead data.",
+		 function );
+
+		return( -1 );
+	}
+	return( (ssize_t) ( buffer_offset + read_size ) );
 }
 
-/* Retrieves the access date and time
- * The timestamp is a signed 64-bit POSIX date and time value in number of nano seconds
- * This value is retrieved from the inode
+/* Retrieves the inode number
  * Returns 1 if successful or -1 on error
  */
-int libfsxfs_file_entry_get_access_time(
+int libfsxfs_file_entry_get_inode_number(
      libfsxfs_file_entry_t *file_entry,
-     int64_t *posix_time,
+     uint64_t *inode_number,
      libcerror_error_t **error )
 {
 	libfsxfs_internal_file_entry_t *internal_file_entry = NULL;
-	static char *function                               = "libfsxfs_file_entry_get_access_time";
-	int result                                          = 1;
+	static char *function                               = "libfsxfs_file_entry_get_inode_number";
 
 	if( file_entry == NULL )
 	{
@@ -778,6 +1295,17 @@ int libfsxfs_file_entry_get_access_time(
 	}
 	internal_file_entry = (libfsxfs_internal_file_entry_t *) file_entry;
 
+	if( inode_number == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode number.",
+		 function );
+
+		return( -1 );
+	}
 #if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_file_entry->read_write_lock,
@@ -793,20 +1321,8 @@ int libfsxfs_file_entry_get_access_time(
 		return( -1 );
 	}
 #endif
-	if( libfsxfs_inode_get_access_time(
-	     internal_file_entry->inode,
-	     posix_time,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve access time.",
-		 function );
+	*inode_number = internal_file_entry->inode_number;
 
-		result = -1;
-	}
 #if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_read(
 	     internal_file_entry->read_write_lock,
@@ -822,21 +1338,21 @@ int libfsxfs_file_entry_get_access_time(
 		return( -1 );
 	}
 #endif
-	return( result );
+	return( 1 );
 }
 
-/* Retrieves the inode change date and time
+/* Retrieves the creation date and time
  * The timestamp is a signed 64-bit POSIX date and time value in number of nano seconds
  * This value is retrieved from the inode
- * Returns 1 if successful or -1 on error
+ * Returns 1 if successful, 0 if not available or -1 on error
  */
-int libfsxfs_file_entry_get_inode_change_time(
+int libfsxfs_file_entry_get_creation_time(
      libfsxfs_file_entry_t *file_entry,
      int64_t *posix_time,
      libcerror_error_t **error )
 {
 	libfsxfs_internal_file_entry_t *internal_file_entry = NULL;
-	static char *function                               = "libfsxfs_file_entry_get_inode_change_time";
+	static char *function                               = "libfsxfs_file_entry_get_creation_time";
 	int result                                          = 1;
 
 	if( file_entry == NULL )
@@ -867,16 +1383,18 @@ int libfsxfs_file_entry_get_inode_change_time(
 		return( -1 );
 	}
 #endif
-	if( libfsxfs_inode_get_inode_change_time(
-	     internal_file_entry->inode,
-	     posix_time,
-	     error ) != 1 )
+	result = libfsxfs_inode_get_creation_time(
+	          internal_file_entry->inode,
+	          posix_time,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve inode change time.",
+		 "%s: unable to retrieve creation time.",
 		 function );
 
 		result = -1;
@@ -899,17 +1417,18 @@ int libfsxfs_file_entry_get_inode_change_time(
 	return( result );
 }
 
-/* Retrieves the file mode
+/* Retrieves the modification date and time
+ * The timestamp is a signed 64-bit POSIX date and time value in number of nano seconds
  * This value is retrieved from the inode
  * Returns 1 if successful or -1 on error
  */
-int libfsxfs_file_entry_get_file_mode(
+int libfsxfs_file_entry_get_modification_time(
      libfsxfs_file_entry_t *file_entry,
-     uint16_t *file_mode,
+     int64_t *posix_time,
      libcerror_error_t **error )
 {
 	libfsxfs_internal_file_entry_t *internal_file_entry = NULL;
-	static char *function                               = "libfsxfs_file_entry_get_file_mode";
+	static char *function                               = "libfsxfs_file_entry_get_modification_time";
 	int result                                          = 1;
 
 	if( file_entry == NULL )
@@ -940,16 +1459,237 @@ int libfsxfs_file_entry_get_file_mode(
 		return( -1 );
 	}
 #endif
-	if( libfsxfs_inode_get_file_mode(
+	if( libfsxfs_inode_get_modification_time(
 	     internal_file_entry->inode,
-	     file_mode,
+	     posix_time,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve file mode.",
+		 "%s: unable to retrieve modification time.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the access date and time
+ * The timestamp is a signed 64-bit POSIX date and time value in number of nano seconds
+ * This value is retrieved from the inode
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_file_entry_get_access_time(
+     libfsxfs_file_entry_t *file_entry,
+     int64_t *posix_time,
+     libcerror_error_t **error )
+{
+	libfsxfs_internal_file_entry_t *internal_file_entry = NULL;
+	static char *function                               = "libfsxfs_file_entry_get_access_time";
+	int result                                          = 1;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_entry = (libfsxfs_internal_file_entry_t *) file_entry;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfsxfs_inode_get_access_time(
+	     internal_file_entry->inode,
+	     posix_time,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve access time.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the inode change date and time
+ * The timestamp is a signed 64-bit POSIX date and time value in number of nano seconds
+ * This value is retrieved from the inode
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_file_entry_get_inode_change_time(
+     libfsxfs_file_entry_t *file_entry,
+     int64_t *posix_time,
+     libcerror_error_t **error )
+{
+	libfsxfs_internal_file_entry_t *internal_file_entry = NULL;
+	static char *function                               = "libfsxfs_file_entry_get_inode_change_time";
+	int result                                          = 1;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_entry = (libfsxfs_internal_file_entry_t *) file_entry;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfsxfs_inode_get_inode_change_time(
+	     internal_file_entry->inode,
+	     posix_time,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve inode change time.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the file mode
+ * This value is retrieved from the inode
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_file_entry_get_file_mode(
+     libfsxfs_file_entry_t *file_entry,
+     uint16_t *file_mode,
+     libcerror_error_t **error )
+{
+	libfsxfs_internal_file_entry_t *internal_file_entry = NULL;
+	static char *function                               = "libfsxfs_file_entry_get_file_mode";
+	int result                                          = 1;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_entry = (libfsxfs_internal_file_entry_t *) file_entry;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfsxfs_inode_get_file_mode(
+	     internal_file_entry->inode,
+	     file_mode,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file mode.",
 		 function );
 
 		result = -1;
@@ -3252,21 +3992,19 @@ int libfsxfs_file_entry_get_sub_file_entry_by_index(
 	return( result );
 }
 
-/* Retrieves the sub file entry for an UTF-8 encoded name
- * Returns 1 if successful, 0 if no such file entry or -1 on error
+/* Retrieves the sub directory entry for the specific index
+ * This function is not multi-thread safe acquire write lock before call
+ * Returns 1 if successful or -1 on error
  */
-int libfsxfs_file_entry_get_sub_file_entry_by_utf8_name(
-     libfsxfs_file_entry_t *file_entry,
-     const uint8_t *utf8_string,
-     size_t utf8_string_length,
-     libfsxfs_file_entry_t **sub_file_entry,
+int libfsxfs_internal_file_entry_get_sub_directory_entry_by_index(
+     libfsxfs_internal_file_entry_t *internal_file_entry,
+     int sub_file_entry_index,
+     libfsxfs_directory_entry_t **sub_directory_entry,
      libcerror_error_t **error )
 {
-	libfsxfs_internal_file_entry_t *internal_file_entry = NULL;
-	static char *function                               = "libfsxfs_file_entry_get_sub_file_entry_by_utf8_name";
-	int result                                          = 1;
+	static char *function = "libfsxfs_internal_file_entry_get_sub_directory_entry_by_index";
 
-	if( file_entry == NULL )
+	if( internal_file_entry == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -3277,32 +4015,84 @@ int libfsxfs_file_entry_get_sub_file_entry_by_utf8_name(
 
 		return( -1 );
 	}
-	internal_file_entry = (libfsxfs_internal_file_entry_t *) file_entry;
+	if( internal_file_entry->directory == NULL )
+	{
+		if( libfsxfs_internal_file_entry_get_directory(
+		     internal_file_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve directory for inode: %" PRIu32 ".",
+			 function,
+			 internal_file_entry->inode_number );
 
-	if( sub_file_entry == NULL )
+			return( -1 );
+		}
+	}
+	if( libfsxfs_directory_get_entry_by_index(
+	     internal_file_entry->directory,
+	     sub_file_entry_index,
+	     sub_directory_entry,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve sub directory entry: %d.",
+		 function,
+		 sub_file_entry_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the file type of the sub file entry for the specific index
+ * The file type is determined from the directory entry without reading the inode of the sub file entry
+ * and is a file mode file type, such as LIBFSXFS_FILE_TYPE_DIRECTORY
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfsxfs_file_entry_get_sub_file_entry_file_type_by_index(
+     libfsxfs_file_entry_t *file_entry,
+     int sub_file_entry_index,
+     uint16_t *file_type,
+     libcerror_error_t **error )
+{
+	libfsxfs_directory_entry_t *sub_directory_entry     = NULL;
+	libfsxfs_internal_file_entry_t *internal_file_entry = NULL;
+	static char *function                               = "libfsxfs_file_entry_get_sub_file_entry_file_type_by_index";
+	int result                                          = 0;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid sub file entry.",
+		 "%s: invalid file entry.",
 		 function );
 
 		return( -1 );
 	}
-	if( *sub_file_entry != NULL )
+	internal_file_entry = (libfsxfs_internal_file_entry_t *) file_entry;
+
+	if( file_type == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid sub file entry value already set.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file type.",
 		 function );
 
 		return( -1 );
 	}
 #if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
+	if( libcthreads_read_write_lock_grab_for_write(
 	     internal_file_entry->read_write_lock,
 	     error ) != 1 )
 	{
@@ -3310,17 +4100,47 @@ int libfsxfs_file_entry_get_sub_file_entry_by_utf8_name(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	/* TODO implement */
-	result = -1;
+	if( libfsxfs_internal_file_entry_get_sub_directory_entry_by_index(
+	     internal_file_entry,
+	     sub_file_entry_index,
+	     &sub_directory_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve sub directory entry: %d.",
+		 function,
+		 sub_file_entry_index );
 
+		result = -1;
+	}
+	else
+	{
+		result = libfsxfs_directory_entry_get_file_type(
+		          sub_directory_entry,
+		          file_type,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file type.",
+			 function );
+		}
+	}
 #if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
+	if( libcthreads_read_write_lock_release_for_write(
 	     internal_file_entry->read_write_lock,
 	     error ) != 1 )
 	{
@@ -3328,7 +4148,7 @@ int libfsxfs_file_entry_get_sub_file_entry_by_utf8_name(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
 		return( -1 );
@@ -3337,18 +4157,19 @@ int libfsxfs_file_entry_get_sub_file_entry_by_utf8_name(
 	return( result );
 }
 
-/* Retrieves the sub file entry for an UTF-16 encoded name
- * Returns 1 if successful, 0 if no such file entry or -1 on error
+/* Retrieves the size of the UTF-8 encoded name of the sub file entry for the specific index
+ * The returned size includes the end of string character
+ * Returns 1 if successful or -1 on error
  */
-int libfsxfs_file_entry_get_sub_file_entry_by_utf16_name(
+int libfsxfs_file_entry_get_sub_file_entry_utf8_name_size_by_index(
      libfsxfs_file_entry_t *file_entry,
-     const uint16_t *utf16_string,
-     size_t utf16_string_length,
-     libfsxfs_file_entry_t **sub_file_entry,
+     int sub_file_entry_index,
+     size_t *utf8_string_size,
      libcerror_error_t **error )
 {
+	libfsxfs_directory_entry_t *sub_directory_entry     = NULL;
 	libfsxfs_internal_file_entry_t *internal_file_entry = NULL;
-	static char *function                               = "libfsxfs_file_entry_get_sub_file_entry_by_utf16_name";
+	static char *function                               = "libfsxfs_file_entry_get_sub_file_entry_utf8_name_size_by_index";
 	int result                                          = 1;
 
 	if( file_entry == NULL )
@@ -3364,48 +4185,53 @@ int libfsxfs_file_entry_get_sub_file_entry_by_utf16_name(
 	}
 	internal_file_entry = (libfsxfs_internal_file_entry_t *) file_entry;
 
-	if( sub_file_entry == NULL )
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid sub file entry.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
-	if( *sub_file_entry != NULL )
+#endif
+	if( libfsxfs_internal_file_entry_get_sub_directory_entry_by_index(
+	     internal_file_entry,
+	     sub_file_entry_index,
+	     &sub_directory_entry,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid sub file entry value already set.",
-		 function );
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve sub directory entry: %d.",
+		 function,
+		 sub_file_entry_index );
 
-		return( -1 );
+		result = -1;
 	}
-#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_file_entry->read_write_lock,
-	     error ) != 1 )
+	else if( libfsxfs_directory_entry_get_utf8_name_size(
+	          sub_directory_entry,
+	          utf8_string_size,
+	          error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 name string size.",
 		 function );
 
-		return( -1 );
+		result = -1;
 	}
-#endif
-	/* TODO implement */
-	result = -1;
-
 #if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
+	if( libcthreads_read_write_lock_release_for_write(
 	     internal_file_entry->read_write_lock,
 	     error ) != 1 )
 	{
@@ -3413,7 +4239,7 @@ int libfsxfs_file_entry_get_sub_file_entry_by_utf16_name(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
 		return( -1 );
@@ -3422,18 +4248,21 @@ int libfsxfs_file_entry_get_sub_file_entry_by_utf16_name(
 	return( result );
 }
 
-/* Reads data at the current offset
- * Returns the number of bytes read or -1 on error
+/* Retrieves the UTF-8 encoded name of the sub file entry for the specific index
+ * The size should include the end of string character
+ * Returns 1 if successful or -1 on error
  */
-ssize_t libfsxfs_file_entry_read_buffer(
-         libfsxfs_file_entry_t *file_entry,
-         void *buffer,
-         size_t buffer_size,
-         libcerror_error_t **error )
+int libfsxfs_file_entry_get_sub_file_entry_utf8_name_by_index(
+     libfsxfs_file_entry_t *file_entry,
+     int sub_file_entry_index,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
 {
+	libfsxfs_directory_entry_t *sub_directory_entry     = NULL;
 	libfsxfs_internal_file_entry_t *internal_file_entry = NULL;
-	static char *function                               = "libfsxfs_file_entry_read_buffer";
-	ssize_t read_count                                  = 0;
+	static char *function                               = "libfsxfs_file_entry_get_sub_file_entry_utf8_name_by_index";
+	int result                                          = 1;
 
 	if( file_entry == NULL )
 	{
@@ -3448,28 +4277,98 @@ ssize_t libfsxfs_file_entry_read_buffer(
 	}
 	internal_file_entry = (libfsxfs_internal_file_entry_t *) file_entry;
 
-	if( internal_file_entry->inode == NULL )
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file entry - missing inode.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( internal_file_entry->inode->file_mode & 0xf000 ) != LIBFSXFS_FILE_TYPE_REGULAR_FILE )
+#endif
+	if( libfsxfs_internal_file_entry_get_sub_directory_entry_by_index(
+	     internal_file_entry,
+	     sub_file_entry_index,
+	     &sub_directory_entry,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: invalid file entry - invalid inode - unsupported file mode not a regular file.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve sub directory entry: %d.",
+		 function,
+		 sub_file_entry_index );
+
+		result = -1;
+	}
+	else if( libfsxfs_directory_entry_get_utf8_name(
+	          sub_directory_entry,
+	          utf8_string,
+	          utf8_string_size,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 name string.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the size of the UTF-16 encoded name of the sub file entry for the specific index
+ * The returned size includes the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_file_entry_get_sub_file_entry_utf16_name_size_by_index(
+     libfsxfs_file_entry_t *file_entry,
+     int sub_file_entry_index,
+     size_t *utf16_string_size,
+     libcerror_error_t **error )
+{
+	libfsxfs_directory_entry_t *sub_directory_entry     = NULL;
+	libfsxfs_internal_file_entry_t *internal_file_entry = NULL;
+	static char *function                               = "libfsxfs_file_entry_get_sub_file_entry_utf16_name_size_by_index";
+	int result                                          = 1;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
 		 function );
 
 		return( -1 );
 	}
+	internal_file_entry = (libfsxfs_internal_file_entry_t *) file_entry;
+
 #if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_grab_for_write(
 	     internal_file_entry->read_write_lock,
@@ -3485,24 +4384,35 @@ ssize_t libfsxfs_file_entry_read_buffer(
 		return( -1 );
 	}
 #endif
-	read_count = libfdata_stream_read_buffer(
-	              internal_file_entry->data_stream,
-	              (intptr_t *) internal_file_entry->file_io_handle,
-	              buffer,
-	              buffer_size,
-	              0,
-	              error );
+	if( libfsxfs_internal_file_entry_get_sub_directory_entry_by_index(
+	     internal_file_entry,
+	     sub_file_entry_index,
+	     &sub_directory_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve sub directory entry: %d.",
+		 function,
+		 sub_file_entry_index );
 
-	if( read_count < 0 )
+		result = -1;
+	}
+	else if( libfsxfs_directory_entry_get_utf16_name_size(
+	          sub_directory_entry,
+	          utf16_string_size,
+	          error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read from data stream.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-16 name string size.",
 		 function );
 
-		read_count = -1;
+		result = -1;
 	}
 #if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_write(
@@ -3519,22 +4429,24 @@ ssize_t libfsxfs_file_entry_read_buffer(
 		return( -1 );
 	}
 #endif
-	return( read_count );
+	return( result );
 }
 
-/* Reads data at a specific offset
- * Returns the number of bytes read or -1 on error
+/* Retrieves the UTF-16 encoded name of the sub file entry for the specific index
+ * The size should include the end of string character
+ * Returns 1 if successful or -1 on error
  */
-ssize_t libfsxfs_file_entry_read_buffer_at_offset(
-         libfsxfs_file_entry_t *file_entry,
-         void *buffer,
-         size_t buffer_size,
-         off64_t offset,
-         libcerror_error_t **error )
+int libfsxfs_file_entry_get_sub_file_entry_utf16_name_by_index(
+     libfsxfs_file_entry_t *file_entry,
+     int sub_file_entry_index,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error )
 {
+	libfsxfs_directory_entry_t *sub_directory_entry     = NULL;
 	libfsxfs_internal_file_entry_t *internal_file_entry = NULL;
-	static char *function                               = "libfsxfs_file_entry_read_buffer_at_offset";
-	ssize_t read_count                                  = 0;
+	static char *function                               = "libfsxfs_file_entry_get_sub_file_entry_utf16_name_by_index";
+	int result                                          = 1;
 
 	if( file_entry == NULL )
 	{
@@ -3542,37 +4454,2016 @@ ssize_t libfsxfs_file_entry_read_buffer_at_offset(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file entry.",
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_entry = (libfsxfs_internal_file_entry_t *) file_entry;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfsxfs_internal_file_entry_get_sub_directory_entry_by_index(
+	     internal_file_entry,
+	     sub_file_entry_index,
+	     &sub_directory_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve sub directory entry: %d.",
+		 function,
+		 sub_file_entry_index );
+
+		result = -1;
+	}
+	else if( libfsxfs_directory_entry_get_utf16_name(
+	          sub_directory_entry,
+	          utf16_string,
+	          utf16_string_size,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-16 name string.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the next sub file entry
+ * The directory is read one directory block at a time, hence this does not read all the sub file entries.
+ * The cookie is an opaque value used to resume iterating the sub file entries, where 0 represents
+ * the first sub file entry, it is updated to refer to the sub file entry after the one retrieved.
+ * Returns 1 if successful, 0 if there are no more sub file entries or -1 on error
+ */
+int libfsxfs_file_entry_get_next_sub_file_entry(
+     libfsxfs_file_entry_t *file_entry,
+     uint64_t *cookie,
+     libfsxfs_file_entry_t **sub_file_entry,
+     libcerror_error_t **error )
+{
+	libfsxfs_directory_entry_t *safe_directory_entry    = NULL;
+	libfsxfs_directory_entry_t *sub_directory_entry     = NULL;
+	libfsxfs_inode_t *inode                             = NULL;
+	libfsxfs_internal_file_entry_t *internal_file_entry = NULL;
+	static char *function                               = "libfsxfs_file_entry_get_next_sub_file_entry";
+	int result                                          = 0;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_entry = (libfsxfs_internal_file_entry_t *) file_entry;
+
+	if( internal_file_entry->inode == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file entry - missing inode.",
+		 function );
+
+		return( -1 );
+	}
+	if( cookie == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cookie.",
+		 function );
+
+		return( -1 );
+	}
+	if( sub_file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sub file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *sub_file_entry != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid sub file entry value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_file_entry->inode->file_mode & 0xf000 ) != LIBFSXFS_FILE_TYPE_DIRECTORY )
+	{
+		return( 0 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_file_entry->directory_cursor == NULL )
+	{
+		if( libfsxfs_directory_initialize(
+		     &( internal_file_entry->directory_cursor ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create directory cursor.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( result != -1 )
+	{
+		result = libfsxfs_directory_get_next_entry(
+		          internal_file_entry->directory_cursor,
+		          internal_file_entry->io_handle,
+		          internal_file_entry->file_io_handle,
+		          internal_file_entry->inode,
+		          cookie,
+		          &sub_directory_entry,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve next sub directory entry.",
+			 function );
+		}
+	}
+	if( result == 1 )
+	{
+		if( libfsxfs_file_system_get_inode_by_number(
+		     internal_file_entry->file_system,
+		     internal_file_entry->io_handle,
+		     internal_file_entry->file_io_handle,
+		     sub_directory_entry->inode_number,
+		     &inode,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to retrieve sub directory entry inode: %" PRIu64 "\n",
+			 function,
+			 sub_directory_entry->inode_number );
+
+			result = -1;
+		}
+		else if( libfsxfs_directory_entry_clone(
+		          &safe_directory_entry,
+		          sub_directory_entry,
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to clone sub directory entry.",
+			 function );
+
+			libfsxfs_inode_free(
+			 &inode,
+			 NULL );
+
+			result = -1;
+		}
+		/* libfsxfs_file_entry_initialize takes over management of safe_directory_entry
+		 */
+		else if( libfsxfs_file_entry_initialize(
+		          sub_file_entry,
+		          internal_file_entry->io_handle,
+		          internal_file_entry->file_io_handle,
+		          internal_file_entry->file_system,
+		          sub_directory_entry->inode_number,
+		          inode,
+		          safe_directory_entry,
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create file entry.",
+			 function );
+
+			libfsxfs_inode_free(
+			 &inode,
+			 NULL );
+
+			libfsxfs_directory_entry_free(
+			 &safe_directory_entry,
+			 NULL );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the UTF-8 encoded name and file type of the next sub file entry
+ * Unlike libfsxfs_file_entry_get_next_sub_file_entry this does not read the inode of the sub file entry
+ * The cookie is used as in libfsxfs_file_entry_get_next_sub_file_entry and is only updated on success
+ * The size should include the end of string character
+ * The file type is a file mode file type, such as LIBFSXFS_FILE_TYPE_DIRECTORY, or 0 if not stored
+ * in the directory entry, in which case the inode needs to be read to determine the file type
+ * Returns 1 if successful, 0 if there are no more sub file entries or -1 on error
+ */
+int libfsxfs_file_entry_get_next_sub_file_entry_utf8_name(
+     libfsxfs_file_entry_t *file_entry,
+     uint64_t *cookie,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     uint16_t *file_type,
+     libcerror_error_t **error )
+{
+	libfsxfs_directory_entry_t *sub_directory_entry     = NULL;
+	libfsxfs_internal_file_entry_t *internal_file_entry = NULL;
+	static char *function                               = "libfsxfs_file_entry_get_next_sub_file_entry_utf8_name";
+	uint64_t safe_cookie                                = 0;
+	int result                                          = 0;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_entry = (libfsxfs_internal_file_entry_t *) file_entry;
+
+	if( internal_file_entry->inode == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file entry - missing inode.",
+		 function );
+
+		return( -1 );
+	}
+	if( cookie == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cookie.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file type.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_file_entry->inode->file_mode & 0xf000 ) != LIBFSXFS_FILE_TYPE_DIRECTORY )
+	{
+		return( 0 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_file_entry->directory_cursor == NULL )
+	{
+		if( libfsxfs_directory_initialize(
+		     &( internal_file_entry->directory_cursor ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create directory cursor.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( result != -1 )
+	{
+		safe_cookie = *cookie;
+
+		result = libfsxfs_directory_get_next_entry(
+		          internal_file_entry->directory_cursor,
+		          internal_file_entry->io_handle,
+		          internal_file_entry->file_io_handle,
+		          internal_file_entry->inode,
+		          &safe_cookie,
+		          &sub_directory_entry,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve next sub directory entry.",
+			 function );
+		}
+	}
+	if( result == 1 )
+	{
+		if( libfsxfs_directory_entry_get_utf8_name(
+		     sub_directory_entry,
+		     utf8_string,
+		     utf8_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve UTF-8 name string.",
+			 function );
+
+			result = -1;
+		}
+		else if( libfsxfs_directory_entry_get_file_type(
+		          sub_directory_entry,
+		          file_type,
+		          error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file type.",
+			 function );
+
+			result = -1;
+		}
+		else
+		{
+			*cookie = safe_cookie;
+		}
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the UTF-16 encoded name and file type of the next sub file entry
+ * Unlike libfsxfs_file_entry_get_next_sub_file_entry this does not read the inode of the sub file entry
+ * The cookie is used as in libfsxfs_file_entry_get_next_sub_file_entry and is only updated on success
+ * The size should include the end of string character
+ * The file type is a file mode file type, such as LIBFSXFS_FILE_TYPE_DIRECTORY, or 0 if not stored
+ * in the directory entry, in which case the inode needs to be read to determine the file type
+ * Returns 1 if successful, 0 if there are no more sub file entries or -1 on error
+ */
+int libfsxfs_file_entry_get_next_sub_file_entry_utf16_name(
+     libfsxfs_file_entry_t *file_entry,
+     uint64_t *cookie,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     uint16_t *file_type,
+     libcerror_error_t **error )
+{
+	libfsxfs_directory_entry_t *sub_directory_entry     = NULL;
+	libfsxfs_internal_file_entry_t *internal_file_entry = NULL;
+	static char *function                               = "libfsxfs_file_entry_get_next_sub_file_entry_utf16_name";
+	uint64_t safe_cookie                                = 0;
+	int result                                          = 0;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_entry = (libfsxfs_internal_file_entry_t *) file_entry;
+
+	if( internal_file_entry->inode == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file entry - missing inode.",
+		 function );
+
+		return( -1 );
+	}
+	if( cookie == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cookie.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file type.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_file_entry->inode->file_mode & 0xf000 ) != LIBFSXFS_FILE_TYPE_DIRECTORY )
+	{
+		return( 0 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_file_entry->directory_cursor == NULL )
+	{
+		if( libfsxfs_directory_initialize(
+		     &( internal_file_entry->directory_cursor ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create directory cursor.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( result != -1 )
+	{
+		safe_cookie = *cookie;
+
+		result = libfsxfs_directory_get_next_entry(
+		          internal_file_entry->directory_cursor,
+		          internal_file_entry->io_handle,
+		          internal_file_entry->file_io_handle,
+		          internal_file_entry->inode,
+		          &safe_cookie,
+		          &sub_directory_entry,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve next sub directory entry.",
+			 function );
+		}
+	}
+	if( result == 1 )
+	{
+		if( libfsxfs_directory_entry_get_utf16_name(
+		     sub_directory_entry,
+		     utf16_string,
+		     utf16_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve UTF-16 name string.",
+			 function );
+
+			result = -1;
+		}
+		else if( libfsxfs_directory_entry_get_file_type(
+		          sub_directory_entry,
+		          file_type,
+		          error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file type.",
+			 function );
+
+			result = -1;
+		}
+		else
+		{
+			*cookie = safe_cookie;
+		}
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the sub file entry for an UTF-8 encoded name
+ * Returns 1 if successful, 0 if no such file entry or -1 on error
+ */
+int libfsxfs_file_entry_get_sub_file_entry_by_utf8_name(
+     libfsxfs_file_entry_t *file_entry,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libfsxfs_file_entry_t **sub_file_entry,
+     libcerror_error_t **error )
+{
+	libfsxfs_internal_file_entry_t *internal_file_entry = NULL;
+	static char *function                               = "libfsxfs_file_entry_get_sub_file_entry_by_utf8_name";
+	int result                                          = 1;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_entry = (libfsxfs_internal_file_entry_t *) file_entry;
+
+	if( sub_file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sub file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *sub_file_entry != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid sub file entry value already set.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	/* TODO implement */
+	result = -1;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the sub file entry for an UTF-16 encoded name
+ * Returns 1 if successful, 0 if no such file entry or -1 on error
+ */
+int libfsxfs_file_entry_get_sub_file_entry_by_utf16_name(
+     libfsxfs_file_entry_t *file_entry,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     libfsxfs_file_entry_t **sub_file_entry,
+     libcerror_error_t **error )
+{
+	libfsxfs_internal_file_entry_t *internal_file_entry = NULL;
+	static char *function                               = "libfsxfs_file_entry_get_sub_file_entry_by_utf16_name";
+	int result                                          = 1;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_entry = (libfsxfs_internal_file_entry_t *) file_entry;
+
+	if( sub_file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sub file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *sub_file_entry != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid sub file entry value already set.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	/* TODO implement */
+	result = -1;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Reads data at the current offset
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libfsxfs_file_entry_read_buffer(
+         libfsxfs_file_entry_t *file_entry,
+         void *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error )
+{
+	libfsxfs_internal_file_entry_t *internal_file_entry = NULL;
+	static char *function                               = "libfsxfs_file_entry_read_buffer";
+	ssize_t read_count                                  = 0;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_entry = (libfsxfs_internal_file_entry_t *) file_entry;
+
+	if( internal_file_entry->inode == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file entry - missing inode.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_file_entry->inode->file_mode & 0xf000 ) != LIBFSXFS_FILE_TYPE_REGULAR_FILE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid file entry - invalid inode - unsupported file mode not a regular file.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfsxfs_internal_file_entry_get_extent_map(
+	     internal_file_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve extent map.",
+		 function );
+
+		read_count = -1;
+	}
+	else
+	{
+		read_count = libfsxfs_internal_file_entry_read_buffer_with_read_ahead(
+		              internal_file_entry,
+		              (uint8_t *) buffer,
+		              buffer_size,
+		              internal_file_entry->current_offset,
+		              error );
+
+		if( read_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read buffer at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 internal_file_entry->current_offset,
+			 internal_file_entry->current_offset );
+
+			read_count = -1;
+		}
+		else
+		{
+			internal_file_entry->current_offset += (off64_t) read_count;
+		}
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( read_count );
+}
+
+/* Reads data at a specific offset
+ * This function does not use or change the current offset and only holds the read/write
+ * lock for writing while the extent map is created, hence concurrent reads on the file
+ * entry are not serialized
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libfsxfs_file_entry_read_buffer_at_offset(
+         libfsxfs_file_entry_t *file_entry,
+         void *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	libfsxfs_extent_map_t *extent_map                   = NULL;
+	libfsxfs_internal_file_entry_t *internal_file_entry = NULL;
+	static char *function                               = "libfsxfs_file_entry_read_buffer_at_offset";
+	ssize_t read_count                                  = 0;
+	int result                                          = 0;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_entry = (libfsxfs_internal_file_entry_t *) file_entry;
+
+	if( internal_file_entry->inode == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file entry - missing inode.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_file_entry->inode->file_mode & 0xf000 ) != LIBFSXFS_FILE_TYPE_REGULAR_FILE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid file entry - invalid inode - unsupported file mode not a regular file.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	extent_map = internal_file_entry->extent_map;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	/* The read/write lock is only held for writing while the extent map is created
+	 */
+	if( extent_map == NULL )
+	{
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_grab_for_write(
+		     internal_file_entry->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab read/write lock for writing.",
+			 function );
+
+			return( -1 );
+		}
+#endif
+		result = libfsxfs_internal_file_entry_get_extent_map(
+		          internal_file_entry,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve extent map.",
+			 function );
+		}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_release_for_write(
+		     internal_file_entry->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read/write lock for writing.",
+			 function );
+
+			return( -1 );
+		}
+#endif
+		if( result != 1 )
+		{
+			return( -1 );
+		}
+	}
+	read_count = libfsxfs_internal_file_entry_read_buffer_at_offset(
+	              internal_file_entry,
+	              (uint8_t *) buffer,
+	              buffer_size,
+	              offset,
+	              error );
+
+	if( read_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read buffer at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 offset,
+		 offset );
+
+		return( -1 );
+	}
+	return( read_count );
+}
+
+/* Reads data of multiple ranges
+ * The ranges are read in order of their physical offset, where ranges that follow each
+ * other are merged into a single read. If the volume has an IO queue the reads of the
+ * ranges are submitted as a single batch instead. Like libfsxfs_file_entry_read_buffer_at_offset
+ * this function does not use or change the current offset
+ * Returns the total number of bytes read or -1 on error
+ */
+ssize_t libfsxfs_file_entry_read_vector(
+         libfsxfs_file_entry_t *file_entry,
+         void **buffers,
+         size_t *buffer_sizes,
+         off64_t *offsets,
+         ssize_t *read_counts,
+         int number_of_buffers,
+         libcerror_error_t **error )
+{
+	libfsxfs_io_queue_batch_t batch;
+
+	libfsxfs_extent_map_entry_t *entry                  = NULL;
+	libfsxfs_extent_map_t *extent_map                   = NULL;
+	libfsxfs_internal_file_entry_t *internal_file_entry = NULL;
+	libfsxfs_read_vector_range_t *ranges                = NULL;
+	uint8_t *merge_buffer                               = NULL;
+	static char *function                               = "libfsxfs_file_entry_read_vector";
+	size_t copy_size                                    = 0;
+	size_t merge_size                                   = 0;
+	size_t range_offset                                 = 0;
+	size_t total_size                                   = 0;
+	ssize_t read_count                                  = 0;
+	ssize_t total_read_count                            = 0;
+	off64_t merge_end_offset                            = 0;
+	int buffer_index                                    = 0;
+	int entry_index                                     = 0;
+	int last_range_index                                = 0;
+	int range_index                                     = 0;
+	int result                                          = 0;
+	int use_io_queue                                    = 0;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_entry = (libfsxfs_internal_file_entry_t *) file_entry;
+
+	if( internal_file_entry->inode == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file entry - missing inode.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_file_entry->inode->file_mode & 0xf000 ) != LIBFSXFS_FILE_TYPE_REGULAR_FILE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid file entry - invalid inode - unsupported file mode not a regular file.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffers.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_sizes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer sizes.",
+		 function );
+
+		return( -1 );
+	}
+	if( offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offsets.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_counts == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read counts.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_buffers < 0 )
+	 || ( (size_t) number_of_buffers > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libfsxfs_read_vector_range_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of buffers value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	for( buffer_index = 0;
+	     buffer_index < number_of_buffers;
+	     buffer_index++ )
+	{
+		if( buffers[ buffer_index ] == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid buffer: %d.",
+			 function,
+			 buffer_index );
+
+			return( -1 );
+		}
+		if( buffer_sizes[ buffer_index ] > ( (size_t) SSIZE_MAX - total_size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid buffer: %d size value exceeds maximum.",
+			 function,
+			 buffer_index );
+
+			return( -1 );
+		}
+		if( offsets[ buffer_index ] < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+			 "%s: invalid offset: %d value less than zero.",
+			 function,
+			 buffer_index );
+
+			return( -1 );
+		}
+		total_size += buffer_sizes[ buffer_index ];
+	}
+	if( number_of_buffers == 0 )
+	{
+		return( 0 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	extent_map = internal_file_entry->extent_map;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	/* The read/write lock is only held for writing while the extent map is created
+	 */
+	if( extent_map == NULL )
+	{
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_grab_for_write(
+		     internal_file_entry->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab read/write lock for writing.",
+			 function );
+
+			return( -1 );
+		}
+#endif
+		result = libfsxfs_internal_file_entry_get_extent_map(
+		          internal_file_entry,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve extent map.",
+			 function );
+		}
+		extent_map = internal_file_entry->extent_map;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_release_for_write(
+		     internal_file_entry->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read/write lock for writing.",
+			 function );
+
+			return( -1 );
+		}
+#endif
+		if( result != 1 )
+		{
+			return( -1 );
+		}
+	}
+	ranges = (libfsxfs_read_vector_range_t *) memory_allocate(
+	                                           sizeof( libfsxfs_read_vector_range_t ) * number_of_buffers );
+
+	if( ranges == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create ranges.",
+		 function );
+
+		goto on_error;
+	}
+	/* Inline data and data that is not stored have no physical offset
+	 * and are read before the stored data
+	 */
+	for( range_index = 0;
+	     range_index < number_of_buffers;
+	     range_index++ )
+	{
+		ranges[ range_index ].physical_offset = -1;
+		ranges[ range_index ].offset          = offsets[ range_index ];
+		ranges[ range_index ].size            = buffer_sizes[ range_index ];
+		ranges[ range_index ].buffer_index    = range_index;
+
+		if( extent_map == NULL )
+		{
+			continue;
+		}
+		result = libfsxfs_extent_map_get_entry_index_at_offset(
+		          extent_map,
+		          offsets[ range_index ],
+		          &entry_index,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve extent map entry index at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 offsets[ range_index ],
+			 offsets[ range_index ] );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			entry = &( extent_map->entries[ entry_index ] );
+
+			if( ( entry->range_flags & LIBFSXFS_EXTENT_FLAG_IS_SPARSE ) == 0 )
+			{
+				ranges[ range_index ].physical_offset = entry->physical_offset + ( offsets[ range_index ] - entry->logical_offset );
+			}
+		}
+	}
+	if( libfsxfs_read_vector_ranges_sort(
+	     ranges,
+	     number_of_buffers,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to sort ranges.",
+		 function );
+
+		goto on_error;
+	}
+	/* With an IO queue the ranges are submitted in order of their physical offset
+	 * without merging, hence the data is read directly into the buffers
+	 */
+	if( ( internal_file_entry->io_handle != NULL )
+	 && ( internal_file_entry->io_handle->io_queue != NULL ) )
+	{
+		if( memory_set(
+		     &batch,
+		     0,
+		     sizeof( libfsxfs_io_queue_batch_t ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear batch.",
+			 function );
+
+			goto on_error;
+		}
+		use_io_queue = 1;
+
+		for( range_index = 0;
+		     range_index < number_of_buffers;
+		     range_index++ )
+		{
+			buffer_index = ranges[ range_index ].buffer_index;
+
+			read_count = libfsxfs_internal_file_entry_read_segments(
+			              internal_file_entry,
+			              &batch,
+			              (uint8_t *) buffers[ buffer_index ],
+			              buffer_sizes[ buffer_index ],
+			              offsets[ buffer_index ],
+			              error );
+
+			if( read_count < 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to submit reads of buffer: %d at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 buffer_index,
+				 offsets[ buffer_index ],
+				 offsets[ buffer_index ] );
+
+				goto on_error;
+			}
+			read_counts[ buffer_index ] = read_count;
+			total_read_count           += read_count;
+		}
+		use_io_queue = 0;
+
+		if( libfsxfs_io_queue_wait(
+		     internal_file_entry->io_handle->io_queue,
+		     &batch,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to complete reads.",
+			 function );
+
+			goto on_error;
+		}
+		memory_free(
+		 ranges );
+
+		return( total_read_count );
+	}
+	range_index = 0;
+
+	while( range_index < number_of_buffers )
+	{
+		/* Determine the ranges that directly follow the current range
+		 */
+		merge_end_offset = ranges[ range_index ].offset + (off64_t) ranges[ range_index ].size;
+		merge_size       = ranges[ range_index ].size;
+
+		for( last_range_index = range_index + 1;
+		     last_range_index < number_of_buffers;
+		     last_range_index++ )
+		{
+			if( ( ranges[ last_range_index ].offset != merge_end_offset )
+			 || ( merge_size > LIBFSXFS_READ_VECTOR_MAXIMUM_MERGE_SIZE )
+			 || ( ranges[ last_range_index ].size > ( LIBFSXFS_READ_VECTOR_MAXIMUM_MERGE_SIZE - merge_size ) ) )
+			{
+				break;
+			}
+			merge_end_offset += (off64_t) ranges[ last_range_index ].size;
+			merge_size       += ranges[ last_range_index ].size;
+		}
+		if( last_range_index == ( range_index + 1 ) )
+		{
+			buffer_index = ranges[ range_index ].buffer_index;
+
+			read_count = libfsxfs_internal_file_entry_read_buffer_at_offset(
+			              internal_file_entry,
+			              (uint8_t *) buffers[ buffer_index ],
+			              buffer_sizes[ buffer_index ],
+			              offsets[ buffer_index ],
+			              error );
+
+			if( read_count < 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read buffer: %d at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 buffer_index,
+				 offsets[ buffer_index ],
+				 offsets[ buffer_index ] );
+
+				goto on_error;
+			}
+			read_counts[ buffer_index ] = read_count;
+			total_read_count           += read_count;
+		}
+		else
+		{
+			if( merge_buffer == NULL )
+			{
+				merge_buffer = (uint8_t *) memory_allocate(
+				                            sizeof( uint8_t ) * LIBFSXFS_READ_VECTOR_MAXIMUM_MERGE_SIZE );
+
+				if( merge_buffer == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+					 "%s: unable to create merge buffer.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			read_count = libfsxfs_internal_file_entry_read_buffer_at_offset(
+			              internal_file_entry,
+			              merge_buffer,
+			              merge_size,
+			              ranges[ range_index ].offset,
+			              error );
+
+			if( read_count < 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read merged buffers at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 ranges[ range_index ].offset,
+				 ranges[ range_index ].offset );
+
+				goto on_error;
+			}
+			range_offset = 0;
+
+			while( range_index < last_range_index )
+			{
+				buffer_index = ranges[ range_index ].buffer_index;
+				copy_size    = 0;
+
+				if( range_offset < (size_t) read_count )
+				{
+					copy_size = (size_t) read_count - range_offset;
+
+					if( copy_size > buffer_sizes[ buffer_index ] )
+					{
+						copy_size = buffer_sizes[ buffer_index ];
+					}
+					if( memory_copy(
+					     buffers[ buffer_index ],
+					     &( merge_buffer[ range_offset ] ),
+					     copy_size ) == NULL )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_MEMORY,
+						 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+						 "%s: unable to copy merged data to buffer: %d.",
+						 function,
+						 buffer_index );
+
+						goto on_error;
+					}
+				}
+				read_counts[ buffer_index ] = (ssize_t) copy_size;
+				total_read_count           += (ssize_t) copy_size;
+				range_offset               += buffer_sizes[ buffer_index ];
+
+				range_index++;
+			}
+		}
+		range_index = last_range_index;
+	}
+	if( merge_buffer != NULL )
+	{
+		memory_free(
+		 merge_buffer );
+	}
+	memory_free(
+	 ranges );
+
+	return( total_read_count );
+
+on_error:
+	if( use_io_queue != 0 )
+	{
+		/* The submitted reads refer to the buffers and need to complete
+		 */
+		libfsxfs_io_queue_wait(
+		 internal_file_entry->io_handle->io_queue,
+		 &batch,
+		 NULL );
+	}
+	if( merge_buffer != NULL )
+	{
+		memory_free(
+		 merge_buffer );
+	}
+	if( ranges != NULL )
+	{
+		memory_free(
+		 ranges );
+	}
+	return( -1 );
+}
+
+/* Seeks a certain offset in the data
+ * Returns the offset if seek is successful or -1 on error
+ */
+off64_t libfsxfs_file_entry_seek_offset(
+         libfsxfs_file_entry_t *file_entry,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error )
+{
+	libfsxfs_internal_file_entry_t *internal_file_entry = NULL;
+	static char *function                                = "libfsxfs_file_entry_seek_offset";
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_entry = (libfsxfs_internal_file_entry_t *) file_entry;
+
+	if( internal_file_entry->inode == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file entry - missing inode.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_file_entry->inode->file_mode & 0xf000 ) != LIBFSXFS_FILE_TYPE_REGULAR_FILE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid file entry - invalid inode - unsupported file mode not a regular file.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( whence != SEEK_CUR )
+	 && ( whence != SEEK_END )
+	 && ( whence != SEEK_SET ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported whence.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( whence == SEEK_CUR )
+	{
+		offset += internal_file_entry->current_offset;
+	}
+	else if( whence == SEEK_END )
+	{
+		offset += (off64_t) internal_file_entry->data_size;
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		offset = -1;
+	}
+	else
+	{
+		internal_file_entry->current_offset = offset;
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( offset );
+}
+
+/* Retrieves the current offset of the data
+ * Returns the offset if successful or -1 on error
+ */
+int libfsxfs_file_entry_get_offset(
+     libfsxfs_file_entry_t *file_entry,
+     off64_t *offset,
+     libcerror_error_t **error )
+{
+	libfsxfs_internal_file_entry_t *internal_file_entry = NULL;
+	static char *function                               = "libfsxfs_file_entry_get_offset";
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_entry = (libfsxfs_internal_file_entry_t *) file_entry;
+
+	if( internal_file_entry->inode == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file entry - missing inode.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_file_entry->inode->file_mode & 0xf000 ) != LIBFSXFS_FILE_TYPE_REGULAR_FILE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid file entry - invalid inode - unsupported file mode not a regular file.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offset.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*offset = internal_file_entry->current_offset;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the size of the data
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_file_entry_get_size(
+     libfsxfs_file_entry_t *file_entry,
+     size64_t *size,
+     libcerror_error_t **error )
+{
+	libfsxfs_internal_file_entry_t *internal_file_entry = NULL;
+	static char *function                               = "libfsxfs_file_entry_get_size";
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_entry = (libfsxfs_internal_file_entry_t *) file_entry;
+
+	if( size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*size = internal_file_entry->data_size;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the read-ahead statistics
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_file_entry_get_read_ahead_statistics(
+     libfsxfs_file_entry_t *file_entry,
+     size_t *window_size,
+     uint64_t *number_of_hits,
+     uint64_t *number_of_misses,
+     libcerror_error_t **error )
+{
+	libfsxfs_internal_file_entry_t *internal_file_entry = NULL;
+	static char *function                               = "libfsxfs_file_entry_get_read_ahead_statistics";
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_entry = (libfsxfs_internal_file_entry_t *) file_entry;
+
+	if( window_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid window size.",
 		 function );
 
 		return( -1 );
 	}
-	internal_file_entry = (libfsxfs_internal_file_entry_t *) file_entry;
-
-	if( internal_file_entry->inode == NULL )
+	if( number_of_hits == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file entry - missing inode.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of hits.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( internal_file_entry->inode->file_mode & 0xf000 ) != LIBFSXFS_FILE_TYPE_REGULAR_FILE )
+	if( number_of_misses == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: invalid file entry - invalid inode - unsupported file mode not a regular file.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of misses.",
 		 function );
 
 		return( -1 );
 	}
 #if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_file_entry->read_write_lock,
 	     error ) != 1 )
 	{
@@ -3580,34 +6471,18 @@ ssize_t libfsxfs_file_entry_read_buffer_at_offset(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	read_count = libfdata_stream_read_buffer_at_offset(
-	              internal_file_entry->data_stream,
-	              (intptr_t *) internal_file_entry->file_io_handle,
-	              buffer,
-	              buffer_size,
-	              offset,
-	              0,
-	              error );
-
-	if( read_count < 0 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read from data stream.",
-		 function );
+	*window_size      = internal_file_entry->read_ahead_window_size;
+	*number_of_hits   = internal_file_entry->number_of_read_ahead_hits;
+	*number_of_misses = internal_file_entry->number_of_read_ahead_misses;
 
-		read_count = -1;
-	}
 #if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libcthreads_read_write_lock_release_for_read(
 	     internal_file_entry->read_write_lock,
 	     error ) != 1 )
 	{
@@ -3615,26 +6490,37 @@ ssize_t libfsxfs_file_entry_read_buffer_at_offset(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	return( read_count );
+	return( 1 );
 }
 
-/* Seeks a certain offset in the data
- * Returns the offset if seek is successful or -1 on error
+/* Retrieves the next data range at or after a specific offset
+ * A data range consists of the stored data, sparse and unwritten extents are skipped,
+ * which allows to implement SEEK_DATA and SEEK_HOLE
+ * If the offset is inside a data range the data range offset is the offset itself
+ * and the data range size is the size of the remaining data up to the next sparse extent
+ * or the end of the data
+ * Returns 1 if successful, 0 if no data range was found or -1 on error
  */
-off64_t libfsxfs_file_entry_seek_offset(
-         libfsxfs_file_entry_t *file_entry,
-         off64_t offset,
-         int whence,
-         libcerror_error_t **error )
+int libfsxfs_file_entry_get_next_data_range(
+     libfsxfs_file_entry_t *file_entry,
+     off64_t offset,
+     off64_t *data_range_offset,
+     size64_t *data_range_size,
+     libcerror_error_t **error )
 {
+	libfsxfs_extent_map_entry_t *entry                  = NULL;
 	libfsxfs_internal_file_entry_t *internal_file_entry = NULL;
-	static char *function                                = "libfsxfs_file_entry_seek_offset";
+	static char *function                               = "libfsxfs_file_entry_get_next_data_range";
+	off64_t range_end_offset                            = 0;
+	off64_t range_start_offset                          = 0;
+	int entry_index                                     = 0;
+	int result                                          = 0;
 
 	if( file_entry == NULL )
 	{
@@ -3660,13 +6546,35 @@ off64_t libfsxfs_file_entry_seek_offset(
 
 		return( -1 );
 	}
-	if( ( internal_file_entry->inode->file_mode & 0xf000 ) != LIBFSXFS_FILE_TYPE_REGULAR_FILE )
+	if( offset < 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: invalid file entry - invalid inode - unsupported file mode not a regular file.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_range_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data range offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_range_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data range size.",
 		 function );
 
 		return( -1 );
@@ -3686,22 +6594,115 @@ off64_t libfsxfs_file_entry_seek_offset(
 		return( -1 );
 	}
 #endif
-	offset = libfdata_stream_seek_offset(
-	          internal_file_entry->data_stream,
-	          offset,
-	          whence,
-	          error );
+	if( (size64_t) offset >= internal_file_entry->data_size )
+	{
+		result = 0;
+	}
+	else if( internal_file_entry->inode->fork_type == LIBFSXFS_FORK_TYPE_INLINE_DATA )
+	{
+		range_start_offset = offset;
+		range_end_offset   = (off64_t) internal_file_entry->data_size;
+
+		result = 1;
+	}
+	else if( libfsxfs_internal_file_entry_get_extent_map(
+	          internal_file_entry,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve extent map.",
+		 function );
 
-	if( offset == -1 )
+		result = -1;
+	}
+	else if( internal_file_entry->extent_map == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_SEEK_FAILED,
-		 "%s: unable to seek offset in data stream.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file entry - missing extent map.",
 		 function );
 
-		offset = -1;
+		result = -1;
+	}
+	else
+	{
+		result = libfsxfs_extent_map_get_entry_index_at_offset(
+		          internal_file_entry->extent_map,
+		          offset,
+		          &entry_index,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve extent map entry index at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 offset,
+			 offset );
+		}
+		else
+		{
+			result = 0;
+
+			/* Skip the sparse entries, the data of the entries that follow
+			 * each other without a gap is combined into a single data range
+			 */
+			while( entry_index < internal_file_entry->extent_map->number_of_entries )
+			{
+				entry = &( internal_file_entry->extent_map->entries[ entry_index ] );
+
+				if( ( entry->range_flags & LIBFSXFS_EXTENT_FLAG_IS_SPARSE ) != 0 )
+				{
+					if( result != 0 )
+					{
+						break;
+					}
+				}
+				else if( result == 0 )
+				{
+					range_start_offset = entry->logical_offset;
+
+					if( range_start_offset < offset )
+					{
+						range_start_offset = offset;
+					}
+					range_end_offset = entry->logical_offset + (off64_t) entry->size;
+
+					result = 1;
+				}
+				else if( entry->logical_offset == range_end_offset )
+				{
+					range_end_offset += (off64_t) entry->size;
+				}
+				else
+				{
+					break;
+				}
+				entry_index++;
+			}
+			if( range_end_offset > (off64_t) internal_file_entry->data_size )
+			{
+				range_end_offset = (off64_t) internal_file_entry->data_size;
+			}
+			if( ( result != 0 )
+			 && ( range_start_offset >= range_end_offset ) )
+			{
+				result = 0;
+			}
+		}
+	}
+	if( result == 1 )
+	{
+		*data_range_offset = range_start_offset;
+		*data_range_size   = (size64_t) ( range_end_offset - range_start_offset );
 	}
 #if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_write(
@@ -3718,20 +6719,31 @@ off64_t libfsxfs_file_entry_seek_offset(
 		return( -1 );
 	}
 #endif
-	return( offset );
+	return( result );
 }
 
-/* Retrieves the current offset of the data
- * Returns the offset if successful or -1 on error
+/* Maps a range of the data into the memory map of the volume
+ * A range can be mapped when the volume is memory mapped and the data at the offset
+ * is stored contiguously. The mapped data size is the size of the range up to the end
+ * of the extent or the end of the data and remains valid until the volume is closed
+ * Returns 1 if successful, 0 if the range cannot be mapped or -1 on error
  */
-int libfsxfs_file_entry_get_offset(
+int libfsxfs_file_entry_map_range(
      libfsxfs_file_entry_t *file_entry,
-     off64_t *offset,
+     off64_t offset,
+     size_t size,
+     const uint8_t **data,
+     size_t *data_size,
      libcerror_error_t **error )
 {
+	libfsxfs_extent_map_entry_t *entry                  = NULL;
 	libfsxfs_internal_file_entry_t *internal_file_entry = NULL;
-	static char *function                               = "libfsxfs_file_entry_get_offset";
-	int result                                          = 1;
+	const uint8_t *mapped_data                          = NULL;
+	static char *function                               = "libfsxfs_file_entry_map_range";
+	size64_t range_size                                 = 0;
+	off64_t physical_offset                             = 0;
+	int entry_index                                     = 0;
+	int result                                          = 0;
 
 	if( file_entry == NULL )
 	{
@@ -3757,48 +6769,52 @@ int libfsxfs_file_entry_get_offset(
 
 		return( -1 );
 	}
-	if( ( internal_file_entry->inode->file_mode & 0xf000 ) != LIBFSXFS_FILE_TYPE_REGULAR_FILE )
+	if( offset < 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: invalid file entry - invalid inode - unsupported file mode not a regular file.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_file_entry->read_write_lock,
-	     error ) != 1 )
+	if( size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	if( libfdata_stream_get_offset(
-	     internal_file_entry->data_stream,
-	     offset,
-	     error ) != 1 )
+	if( data == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve offset from data stream.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
 		 function );
 
-		result = -1;
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
 	}
 #if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
+	if( libcthreads_read_write_lock_grab_for_write(
 	     internal_file_entry->read_write_lock,
 	     error ) != 1 )
 	{
@@ -3806,69 +6822,113 @@ int libfsxfs_file_entry_get_offset(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	return( result );
-}
-
-/* Retrieves the size of the data
- * Returns 1 if successful or -1 on error
- */
-int libfsxfs_file_entry_get_size(
-     libfsxfs_file_entry_t *file_entry,
-     size64_t *size,
-     libcerror_error_t **error )
-{
-	libfsxfs_internal_file_entry_t *internal_file_entry = NULL;
-	static char *function                               = "libfsxfs_file_entry_get_size";
-
-	if( file_entry == NULL )
+	if( ( size == 0 )
+	 || ( (size64_t) offset >= internal_file_entry->data_size )
+	 || ( internal_file_entry->io_handle == NULL )
+	 || ( internal_file_entry->io_handle->memory_map == NULL )
+	 || ( internal_file_entry->inode->fork_type == LIBFSXFS_FORK_TYPE_INLINE_DATA ) )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file entry.",
-		 function );
-
-		return( -1 );
+		result = 0;
 	}
-	internal_file_entry = (libfsxfs_internal_file_entry_t *) file_entry;
-
-	if( size == NULL )
+	else if( libfsxfs_internal_file_entry_get_extent_map(
+	          internal_file_entry,
+	          error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid size.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve extent map.",
 		 function );
 
-		return( -1 );
+		result = -1;
 	}
-#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_file_entry->read_write_lock,
-	     error ) != 1 )
+	else if( internal_file_entry->extent_map == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file entry - missing extent map.",
 		 function );
 
-		return( -1 );
+		result = -1;
 	}
-#endif
-	*size = internal_file_entry->data_size;
+	else
+	{
+		result = libfsxfs_extent_map_get_entry_index_at_offset(
+		          internal_file_entry->extent_map,
+		          offset,
+		          &entry_index,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve extent map entry index at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 offset,
+			 offset );
+		}
+		else if( result != 0 )
+		{
+			entry  = &( internal_file_entry->extent_map->entries[ entry_index ] );
+			result = 0;
 
+			/* Sparse and unwritten data is not stored and cannot be mapped
+			 */
+			if( ( ( entry->range_flags & LIBFSXFS_EXTENT_FLAG_IS_SPARSE ) == 0 )
+			 && ( offset >= entry->logical_offset ) )
+			{
+				range_size = entry->size - (size64_t) ( offset - entry->logical_offset );
+
+				if( range_size > ( internal_file_entry->data_size - (size64_t) offset ) )
+				{
+					range_size = internal_file_entry->data_size - (size64_t) offset;
+				}
+				if( range_size > (size64_t) size )
+				{
+					range_size = (size64_t) size;
+				}
+				physical_offset = entry->physical_offset + ( offset - entry->logical_offset );
+
+				result = libfsxfs_io_handle_get_mapped_data(
+				          internal_file_entry->io_handle,
+				          physical_offset,
+				          (size_t) range_size,
+				          &mapped_data,
+				          error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve mapped data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+					 function,
+					 physical_offset,
+					 physical_offset );
+				}
+			}
+		}
+	}
+	if( result == 1 )
+	{
+		*data      = mapped_data;
+		*data_size = (size_t) range_size;
+	}
 #if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
+	if( libcthreads_read_write_lock_release_for_write(
 	     internal_file_entry->read_write_lock,
 	     error ) != 1 )
 	{
@@ -3876,13 +6936,13 @@ int libfsxfs_file_entry_get_size(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	return( 1 );
+	return( result );
 }
 
 /* Retrieves the number of extents of the data
@@ -3925,10 +6985,27 @@ int libfsxfs_file_entry_get_number_of_extents(
 		return( -1 );
 	}
 #endif
-	if( libfsxfs_inode_get_number_of_data_extents(
+	if( libfsxfs_file_system_read_data_extents(
+	     internal_file_entry->file_system,
+	     internal_file_entry->io_handle,
+	     internal_file_entry->file_io_handle,
+	     internal_file_entry->inode_number,
 	     internal_file_entry->inode,
-	     number_of_extents,
 	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read data extents of inode.",
+		 function );
+
+		result = -1;
+	}
+	else if( libfsxfs_inode_get_number_of_data_extents(
+	          internal_file_entry->inode,
+	          number_of_extents,
+	          error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
@@ -4001,11 +7078,28 @@ int libfsxfs_file_entry_get_extent_by_index(
 		return( -1 );
 	}
 #endif
-	if( libfsxfs_inode_get_data_extent_by_index(
+	if( libfsxfs_file_system_read_data_extents(
+	     internal_file_entry->file_system,
+	     internal_file_entry->io_handle,
+	     internal_file_entry->file_io_handle,
+	     internal_file_entry->inode_number,
 	     internal_file_entry->inode,
-	     extent_index,
-	     &extent,
 	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read data extents of inode.",
+		 function );
+
+		result = -1;
+	}
+	else if( libfsxfs_inode_get_data_extent_by_index(
+	          internal_file_entry->inode,
+	          extent_index,
+	          &extent,
+	          error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
@@ -28,14 +28,15 @@
 #include "libfsxfs_attribute_values.h"
 #include "libfsxfs_directory.h"
 #include "libfsxfs_directory_entry.h"
+#include "libfsxfs_extent_map.h"
 #include "libfsxfs_extern.h"
 #include "libfsxfs_file_system.h"
 #include "libfsxfs_inode.h"
 #include "libfsxfs_io_handle.h"
+#include "libfsxfs_io_queue.h"
 #include "libfsxfs_libbfio.h"
 #include "libfsxfs_libcerror.h"
 #include "libfsxfs_libcthreads.h"
-#include "libfsxfs_libfdata.h"
 #include "libfsxfs_types.h"
 
 #if defined( __cplusplus )
@@ -78,13 +79,53 @@ struct libfsxfs_internal_file_entry
 	 */
 	libfsxfs_directory_t *directory;
 
+	/* The directory used to iterate the sub file entries
+	 */
+	libfsxfs_directory_t *directory_cursor;
+
 	/* The data size
 	 */
 	size64_t data_size;
 
-	/* The data stream
+	/* The extent map
+	 */
+	libfsxfs_extent_map_t *extent_map;
+
+	/* The current offset of the data
+	 */
+	off64_t current_offset;
+
+	/* The read-ahead buffer
+	 */
+	uint8_t *read_ahead_buffer;
+
+	/* The allocated size of the read-ahead buffer
+	 */
+	size_t read_ahead_buffer_size;
+
+	/* The offset of the data in the read-ahead buffer
+	 */
+	off64_t read_ahead_offset;
+
+	/* The size of the data in the read-ahead buffer
+	 */
+	size_t read_ahead_data_size;
+
+	/* The current read-ahead window size
+	 */
+	size_t read_ahead_window_size;
+
+	/* The offset at which a sequential read is expected
+	 */
+	off64_t read_ahead_next_offset;
+
+	/* The number of reads served from the read-ahead buffer
+	 */
+	uint64_t number_of_read_ahead_hits;
+
+	/* The number of reads not served from the read-ahead buffer
 	 */
-	libfdata_stream_t *data_stream;
+	uint64_t number_of_read_ahead_misses;
 
 	/* The symbolic link data
 	 */
@@ -120,10 +161,42 @@ int libfsxfs_internal_file_entry_get_directory(
      libfsxfs_internal_file_entry_t *internal_file_entry,
      libcerror_error_t **error );
 
+int libfsxfs_internal_file_entry_get_extent_map(
+     libfsxfs_internal_file_entry_t *internal_file_entry,
+     libcerror_error_t **error );
+
 int libfsxfs_internal_file_entry_get_symbolic_link_data(
      libfsxfs_internal_file_entry_t *internal_file_entry,
      libcerror_error_t **error );
 
+ssize_t libfsxfs_internal_file_entry_read_segments(
+         libfsxfs_internal_file_entry_t *internal_file_entry,
+         libfsxfs_io_queue_batch_t *batch,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error );
+
+ssize_t libfsxfs_internal_file_entry_read_buffer_at_offset(
+         libfsxfs_internal_file_entry_t *internal_file_entry,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error );
+
+ssize_t libfsxfs_internal_file_entry_read_buffer_with_read_ahead(
+         libfsxfs_internal_file_entry_t *internal_file_entry,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error );
+
+int libfsxfs_internal_file_entry_get_sub_directory_entry_by_index(
+     libfsxfs_internal_file_entry_t *internal_file_entry,
+     int sub_file_entry_index,
+     libfsxfs_directory_entry_t **sub_directory_entry,
+     libcerror_error_t **error );
+
 LIBFSXFS_EXTERN \
 int libfsxfs_file_entry_get_inode_number(
      libfsxfs_file_entry_t *file_entry,
@@ -317,6 +390,68 @@ int libfsxfs_file_entry_get_sub_file_entry_by_index(
      libfsxfs_file_entry_t **sub_file_entry,
      libcerror_error_t **error );
 
+LIBFSXFS_EXTERN \
+int libfsxfs_file_entry_get_sub_file_entry_file_type_by_index(
+     libfsxfs_file_entry_t *file_entry,
+     int sub_file_entry_index,
+     uint16_t *file_type,
+     libcerror_error_t **error );
+
+LIBFSXFS_EXTERN \
+int libfsxfs_file_entry_get_sub_file_entry_utf8_name_size_by_index(
+     libfsxfs_file_entry_t *file_entry,
+     int sub_file_entry_index,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
+LIBFSXFS_EXTERN \
+int libfsxfs_file_entry_get_sub_file_entry_utf8_name_by_index(
+     libfsxfs_file_entry_t *file_entry,
+     int sub_file_entry_index,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error );
+
+LIBFSXFS_EXTERN \
+int libfsxfs_file_entry_get_sub_file_entry_utf16_name_size_by_index(
+     libfsxfs_file_entry_t *file_entry,
+     int sub_file_entry_index,
+     size_t *utf16_string_size,
+     libcerror_error_t **error );
+
+LIBFSXFS_EXTERN \
+int libfsxfs_file_entry_get_sub_file_entry_utf16_name_by_index(
+     libfsxfs_file_entry_t *file_entry,
+     int sub_file_entry_index,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error );
+
+LIBFSXFS_EXTERN \
+int libfsxfs_file_entry_get_next_sub_file_entry(
+     libfsxfs_file_entry_t *file_entry,
+     uint64_t *cookie,
+     libfsxfs_file_entry_t **sub_file_entry,
+     libcerror_error_t **error );
+
+LIBFSXFS_EXTERN \
+int libfsxfs_file_entry_get_next_sub_file_entry_utf8_name(
+     libfsxfs_file_entry_t *file_entry,
+     uint64_t *cookie,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     uint16_t *file_type,
+     libcerror_error_t **error );
+
+LIBFSXFS_EXTERN \
+int libfsxfs_file_entry_get_next_sub_file_entry_utf16_name(
+     libfsxfs_file_entry_t *file_entry,
+     uint64_t *cookie,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     uint16_t *file_type,
+     libcerror_error_t **error );
+
 LIBFSXFS_EXTERN \
 int libfsxfs_file_entry_get_sub_file_entry_by_utf8_name(
      libfsxfs_file_entry_t *file_entry,
@@ -348,6 +483,16 @@ ssize_t libfsxfs_file_entry_read_buffer_at_offset(
          off64_t offset,
          libcerror_error_t **error );
 
+LIBFSXFS_EXTERN \
+ssize_t libfsxfs_file_entry_read_vector(
+         libfsxfs_file_entry_t *file_entry,
+         void **buffers,
+         size_t *buffer_sizes,
+         off64_t *offsets,
+         ssize_t *read_counts,
+         int number_of_buffers,
+         libcerror_error_t **error );
+
 LIBFSXFS_EXTERN \
 off64_t libfsxfs_file_entry_seek_offset(
          libfsxfs_file_entry_t *file_entry,
@@ -367,6 +512,31 @@ int libfsxfs_file_entry_get_size(
      size64_t *size,
      libcerror_error_t **error );
 
+LIBFSXFS_EXTERN \
+int libfsxfs_file_entry_get_read_ahead_statistics(
+     libfsxfs_file_entry_t *file_entry,
+     size_t *window_size,
+     uint64_t *number_of_hits,
+     uint64_t *number_of_misses,
+     libcerror_error_t **error );
+
+LIBFSXFS_EXTERN \
+int libfsxfs_file_entry_get_next_data_range(
+     libfsxfs_file_entry_t *file_entry,
+     off64_t offset,
+     off64_t *data_range_offset,
+     size64_t *data_range_size,
+     libcerror_error_t **error );
+
+LIBFSXFS_EXTERN \
+int libfsxfs_file_entry_map_range(
+     libfsxfs_file_entry_t *file_entry,
+     off64_t offset,
+     size_t size,
+     const uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error );
+
 LIBFSXFS_EXTERN \
 int libfsxfs_file_entry_get_number_of_extents(
      libfsxfs_file_entry_t *file_entry,
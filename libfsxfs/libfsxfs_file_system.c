@@ -24,11 +24,14 @@
 #include <types.h>
 
 #include "libfsxfs_definitions.h"
+#include "libfsxfs_dentry_cache.h"
 #include "libfsxfs_directory.h"
 #include "libfsxfs_directory_entry.h"
 #include "libfsxfs_file_system.h"
 #include "libfsxfs_inode.h"
 #include "libfsxfs_inode_btree.h"
+#include "libfsxfs_inode_cache.h"
+#include "libfsxfs_inode_chunk_index.h"
 #include "libfsxfs_inode_information.h"
 #include "libfsxfs_libbfio.h"
 #include "libfsxfs_libcerror.h"
@@ -115,6 +118,34 @@ int libfsxfs_file_system_initialize(
 
 		goto on_error;
 	}
+	if( libfsxfs_inode_cache_initialize(
+	     &( ( *file_system )->inode_cache ),
+	     LIBFSXFS_DEFAULT_MAXIMUM_INODE_CACHE_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create inode cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsxfs_dentry_cache_initialize(
+	     &( ( *file_system )->dentry_cache ),
+	     LIBFSXFS_DEFAULT_MAXIMUM_NUMBER_OF_DENTRY_CACHE_VALUES,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create dentry cache.",
+		 function );
+
+		goto on_error;
+	}
 #if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_initialize(
 	     &( ( *file_system )->read_write_lock ),
@@ -137,6 +168,18 @@ int libfsxfs_file_system_initialize(
 on_error:
 	if( *file_system != NULL )
 	{
+		if( ( *file_system )->dentry_cache != NULL )
+		{
+			libfsxfs_dentry_cache_free(
+			 &( ( *file_system )->dentry_cache ),
+			 NULL );
+		}
+		if( ( *file_system )->inode_cache != NULL )
+		{
+			libfsxfs_inode_cache_free(
+			 &( ( *file_system )->inode_cache ),
+			 NULL );
+		}
 		if( ( *file_system )->inode_btree != NULL )
 		{
 			libfsxfs_inode_btree_free(
@@ -189,6 +232,32 @@ int libfsxfs_file_system_free(
 			result = -1;
 		}
 #endif
+		if( libfsxfs_dentry_cache_free(
+		     &( ( *file_system )->dentry_cache ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free dentry cache.",
+			 function );
+
+			result = -1;
+		}
+		if( libfsxfs_inode_cache_free(
+		     &( ( *file_system )->inode_cache ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free inode cache.",
+			 function );
+
+			result = -1;
+		}
 		if( libfsxfs_inode_btree_free(
 		     &( ( *file_system )->inode_btree ),
 		     error ) != 1 )
@@ -210,17 +279,172 @@ int libfsxfs_file_system_free(
 	return( result );
 }
 
-/* Reads the inode information
+/* Sets the maximum (estimated) memory size of the inode cache
+ * A maximum size of 0 disables the inode cache
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_file_system_set_maximum_inode_cache_size(
+     libfsxfs_file_system_t *file_system,
+     size_t maximum_cache_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_file_system_set_maximum_inode_cache_size";
+
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsxfs_inode_cache_set_maximum_cache_size(
+	     file_system->inode_cache,
+	     maximum_cache_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set maximum inode cache size.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the maximum number of cached directory entries (dentries)
+ * A maximum of 0 disables the dentry cache
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_file_system_set_maximum_number_of_dentry_cache_values(
+     libfsxfs_file_system_t *file_system,
+     int maximum_number_of_values,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_file_system_set_maximum_number_of_dentry_cache_values";
+
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsxfs_dentry_cache_set_maximum_number_of_values(
+	     file_system->dentry_cache,
+	     maximum_number_of_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set maximum number of dentry cache values.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets if the in-memory inode chunk index should be used to map inode numbers
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_file_system_set_use_inode_chunk_index(
+     libfsxfs_file_system_t *file_system,
+     uint8_t use_inode_chunk_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_file_system_set_use_inode_chunk_index";
+
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_system->inode_btree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file system - missing inode B+ tree.",
+		 function );
+
+		return( -1 );
+	}
+	file_system->inode_btree->use_inode_chunk_index = use_inode_chunk_index;
+
+	return( 1 );
+}
+
+/* Sets the number of allocation groups
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_file_system_set_number_of_allocation_groups(
+     libfsxfs_file_system_t *file_system,
+     uint32_t number_of_allocation_groups,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_file_system_set_number_of_allocation_groups";
+
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsxfs_inode_btree_set_number_of_allocation_groups(
+	     file_system->inode_btree,
+	     number_of_allocation_groups,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set number of allocation groups in inode B+ tree.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads the inode information of a specific allocation group
+ * The inode information is only read if it was not read before
  * Returns 1 if successful or -1 on error
  */
 int libfsxfs_file_system_read_inode_information(
      libfsxfs_file_system_t *file_system,
      libfsxfs_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
-     off64_t file_offset,
+     uint32_t allocation_group_index,
      libcerror_error_t **error )
 {
-	static char *function = "libfsxfs_file_system_read_inode_information";
+	libfsxfs_inode_information_t *inode_information = NULL;
+	static char *function                           = "libfsxfs_file_system_read_inode_information";
 
 	if( file_system == NULL )
 	{
@@ -233,42 +457,123 @@ int libfsxfs_file_system_read_inode_information(
 
 		return( -1 );
 	}
-	if( libfsxfs_inode_btree_read_inode_information(
+	if( allocation_group_index > (uint32_t) INT_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid allocation group index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsxfs_inode_btree_get_inode_information(
 	     file_system->inode_btree,
 	     io_handle,
 	     file_io_handle,
-	     file_offset,
+	     (int) allocation_group_index,
+	     &inode_information,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
 		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read inode information at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 "%s: unable to read inode information: %" PRIu32 ".",
 		 function,
-		 file_offset,
-		 file_offset );
+		 allocation_group_index );
 
-		return( 1 );
+		return( -1 );
 	}
 	return( 1 );
 }
 
-/* Retrieves a specific inode
- * Returns 1 if successful, 0 if no such value or -1 on error
+/* Reads the inode information of a specific allocation group from data
+ * Returns 1 if successful or -1 on error
  */
-int libfsxfs_file_system_get_inode_by_number(
+int libfsxfs_file_system_read_inode_information_data(
+     libfsxfs_file_system_t *file_system,
+     libfsxfs_io_handle_t *io_handle,
+     uint32_t allocation_group_index,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_file_system_read_inode_information_data";
+
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	if( allocation_group_index > (uint32_t) INT_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid allocation group index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsxfs_inode_btree_read_inode_information_data(
+	     file_system->inode_btree,
+	     io_handle,
+	     (int) allocation_group_index,
+	     data,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read inode information: %" PRIu32 ".",
+		 function,
+		 allocation_group_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Verifies the metadata of a specific allocation group
+ * The inode information, the inode B+ tree, the allocated inodes, the directories and
+ * the data extents B+ trees of the allocation group are read and checked
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_file_system_verify_allocation_group(
      libfsxfs_file_system_t *file_system,
      libfsxfs_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
-     uint64_t inode_number,
-     libfsxfs_inode_t **inode,
+     uint32_t allocation_group_index,
+     uint64_t *number_of_inodes,
+     uint64_t *metadata_size,
      libcerror_error_t **error )
 {
-	libfsxfs_inode_t *safe_inode = NULL;
-	static char *function        = "libfsxfs_file_system_get_inode_by_number";
-	off64_t file_offset          = 0;
-	int result                   = 0;
+	libfsxfs_directory_t *directory                 = NULL;
+	libfsxfs_inode_t *inode                         = NULL;
+	libfsxfs_inode_chunk_index_t *inode_chunk_index = NULL;
+	libfsxfs_inode_information_t *inode_information = NULL;
+	static char *function                           = "libfsxfs_file_system_verify_allocation_group";
+	uint64_t chunk_allocation_bitmap                = 0;
+	uint64_t inode_number                           = 0;
+	uint64_t maximum_number_of_inodes               = 0;
+	uint64_t number_of_used_inodes                  = 0;
+	uint64_t safe_metadata_size                     = 0;
+	uint32_t chunk_inode_number                     = 0;
+	uint8_t chunk_inode_index                       = 0;
+	int chunk_index                                 = 0;
+	int number_of_chunks                            = 0;
+	int result                                      = 0;
 
 	if( file_system == NULL )
 	{
@@ -292,105 +597,1190 @@ int libfsxfs_file_system_get_inode_by_number(
 
 		return( -1 );
 	}
-	if( io_handle->inode_size == 0 )
+	if( ( io_handle->block_size == 0 )
+	 || ( io_handle->inode_size == 0 ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid IO handle - inode size value out of bounds.",
+		 "%s: invalid IO handle - block size or inode size value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( inode_number == 0 )
-	 || ( inode_number > (uint64_t) UINT32_MAX ) )
+	if( allocation_group_index > (uint32_t) INT_MAX )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid inode number value out of bounds.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid allocation group index value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	result = libfsxfs_inode_btree_get_inode_by_number(
-	          file_system->inode_btree,
-	          io_handle,
-	          file_io_handle,
-	          inode_number,
-	          &file_offset,
-	          error );
+	if( number_of_inodes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of inodes.",
+		 function );
 
-	if( result == -1 )
+		return( -1 );
+	}
+	if( metadata_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to retrieve inode: %" PRIu64 "\n",
-		 function,
-		 inode_number );
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid metadata size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsxfs_inode_information_initialize(
+	     &inode_information,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create inode information.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsxfs_inode_chunk_index_initialize(
+	     &inode_chunk_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create inode chunk index.",
+		 function );
+
+		goto on_error;
+	}
+	/* The inode B+ tree is read into a separate inode chunk index, this checks the signature,
+	 * checksum and number of records of every node and the ordering of the inode chunks
+	 */
+	if( libfsxfs_inode_btree_read_allocation_group(
+	     file_system->inode_btree,
+	     io_handle,
+	     file_io_handle,
+	     (int) allocation_group_index,
+	     inode_information,
+	     inode_chunk_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read allocation group: %" PRIu32 ".",
+		 function,
+		 allocation_group_index );
+
+		goto on_error;
+	}
+	/* The inode information is read as a sector of at least 512 bytes
+	 */
+	safe_metadata_size = 512;
+
+	if( io_handle->sector_size > 512 )
+	{
+		safe_metadata_size = (uint64_t) io_handle->sector_size;
+	}
+
+	if( libfsxfs_inode_chunk_index_get_number_of_chunks(
+	     inode_chunk_index,
+	     &number_of_chunks,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of inode chunks.",
+		 function );
+
+		goto on_error;
+	}
+	maximum_number_of_inodes = (uint64_t) io_handle->allocation_group_size * ( io_handle->block_size / io_handle->inode_size );
+
+	for( chunk_index = 0;
+	     chunk_index < number_of_chunks;
+	     chunk_index++ )
+	{
+		if( libfsxfs_inode_chunk_index_get_chunk_by_index(
+		     inode_chunk_index,
+		     chunk_index,
+		     &chunk_inode_number,
+		     &chunk_allocation_bitmap,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve inode chunk: %d.",
+			 function,
+			 chunk_index );
+
+			goto on_error;
+		}
+		if( ( (uint64_t) chunk_inode_number + LIBFSXFS_INODE_CHUNK_NUMBER_OF_INODES ) > maximum_number_of_inodes )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid inode chunk: %d - inode number: %" PRIu32 " value out of bounds.",
+			 function,
+			 chunk_index,
+			 chunk_inode_number );
+
+			goto on_error;
+		}
+		/* A bit that is set in the chunk allocation bitmap indicates an unused inode
+		 */
+		for( chunk_inode_index = 0;
+		     chunk_inode_index < LIBFSXFS_INODE_CHUNK_NUMBER_OF_INODES;
+		     chunk_inode_index++ )
+		{
+			if( ( chunk_allocation_bitmap & ( (uint64_t) 1 << chunk_inode_index ) ) != 0 )
+			{
+				continue;
+			}
+			if( io_handle->abort != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_ABORT_REQUESTED,
+				 "%s: abort requested.",
+				 function );
+
+				goto on_error;
+			}
+			inode_number = ( (uint64_t) allocation_group_index << io_handle->number_of_relative_inode_number_bits )
+			             | ( chunk_inode_number + chunk_inode_index );
+
+			result = libfsxfs_file_system_get_inode_by_number(
+			          file_system,
+			          io_handle,
+			          file_io_handle,
+			          inode_number,
+			          &inode,
+			          error );
+
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve inode: %" PRIu64 ".",
+				 function,
+				 inode_number );
+
+				goto on_error;
+			}
+			if( ( inode->file_mode & 0xf000 ) == 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: invalid inode: %" PRIu64 " - unsupported file type.",
+				 function,
+				 inode_number );
+
+				goto on_error;
+			}
+			if( ( io_handle->format_version == 5 )
+			 && ( inode->format_version != 3 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: invalid inode: %" PRIu64 " - unsupported format version.",
+				 function,
+				 inode_number );
+
+				goto on_error;
+			}
+			safe_metadata_size += io_handle->inode_size;
+
+			if( ( inode->file_mode & 0xf000 ) == LIBFSXFS_FILE_TYPE_DIRECTORY )
+			{
+				if( libfsxfs_directory_initialize(
+				     &directory,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+					 "%s: unable to create directory.",
+					 function );
+
+					goto on_error;
+				}
+				if( libfsxfs_directory_read_file_io_handle(
+				     directory,
+				     io_handle,
+				     file_io_handle,
+				     inode,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read directory of inode: %" PRIu64 ".",
+					 function,
+					 inode_number );
+
+					goto on_error;
+				}
+				if( libfsxfs_directory_free(
+				     &directory,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free directory.",
+					 function );
+
+					goto on_error;
+				}
+				if( inode->fork_type != LIBFSXFS_FORK_TYPE_INLINE_DATA )
+				{
+					safe_metadata_size += inode->size;
+				}
+			}
+			else if( libfsxfs_file_system_read_data_extents(
+			          file_system,
+			          io_handle,
+			          file_io_handle,
+			          inode_number,
+			          inode,
+			          error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read data extents of inode: %" PRIu64 ".",
+				 function,
+				 inode_number );
+
+				goto on_error;
+			}
+			if( libfsxfs_inode_free(
+			     &inode,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free inode.",
+				 function );
+
+				goto on_error;
+			}
+			number_of_used_inodes++;
+		}
+	}
+	/* The number of used inodes in the inode B+ tree must match the inode information
+	 */
+	if( (uint64_t) inode_information->number_of_unused_inodes > (uint64_t) inode_information->number_of_inodes )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid inode information - number of unused inodes value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_used_inodes != (uint64_t) ( inode_information->number_of_inodes - inode_information->number_of_unused_inodes ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: mismatch in number of used inodes ( inode B+ tree: %" PRIu64 ", inode information: %" PRIu32 " ).",
+		 function,
+		 number_of_used_inodes,
+		 inode_information->number_of_inodes - inode_information->number_of_unused_inodes );
+
+		goto on_error;
+	}
+	if( libfsxfs_inode_chunk_index_free(
+	     &inode_chunk_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free inode chunk index.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsxfs_inode_information_free(
+	     &inode_information,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free inode information.",
+		 function );
+
+		goto on_error;
+	}
+	*number_of_inodes = number_of_used_inodes;
+	*metadata_size    = safe_metadata_size;
+
+	return( 1 );
+
+on_error:
+	if( directory != NULL )
+	{
+		libfsxfs_directory_free(
+		 &directory,
+		 NULL );
+	}
+	if( inode != NULL )
+	{
+		libfsxfs_inode_free(
+		 &inode,
+		 NULL );
+	}
+	if( inode_chunk_index != NULL )
+	{
+		libfsxfs_inode_chunk_index_free(
+		 &inode_chunk_index,
+		 NULL );
+	}
+	if( inode_information != NULL )
+	{
+		libfsxfs_inode_information_free(
+		 &inode_information,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the first allocated inode number at or after a specific inode number
+ * The allocation groups are scanned in order using the inode chunk index, hence
+ * the inode numbers are returned in ascending (on-disk) order
+ * Returns 1 if successful, 0 if no such inode number or -1 on error
+ */
+int libfsxfs_file_system_get_next_allocated_inode_number(
+     libfsxfs_file_system_t *file_system,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint32_t number_of_allocation_groups,
+     uint64_t inode_number,
+     uint64_t *next_inode_number,
+     libcerror_error_t **error )
+{
+	libfsxfs_inode_chunk_index_t *inode_chunk_index = NULL;
+	static char *function                           = "libfsxfs_file_system_get_next_allocated_inode_number";
+	uint64_t allocation_group_index                 = 0;
+	uint64_t relative_inode_number_mask             = 0;
+	uint32_t next_relative_inode_number             = 0;
+	uint32_t relative_inode_number                  = 0;
+	int result                                      = 0;
+
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( io_handle->number_of_relative_inode_number_bits == 0 )
+	 || ( io_handle->number_of_relative_inode_number_bits > 32 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid IO handle - number of relative inode number bits value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_allocation_groups > (uint32_t) INT_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of allocation groups value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( next_inode_number == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid next inode number.",
+		 function );
+
+		return( -1 );
+	}
+	relative_inode_number_mask = ( (uint64_t) 1 << io_handle->number_of_relative_inode_number_bits ) - 1;
+
+	allocation_group_index = inode_number >> io_handle->number_of_relative_inode_number_bits;
+	relative_inode_number  = (uint32_t) ( inode_number & relative_inode_number_mask );
+
+	while( allocation_group_index < (uint64_t) number_of_allocation_groups )
+	{
+		if( libfsxfs_inode_btree_get_inode_chunk_index(
+		     file_system->inode_btree,
+		     io_handle,
+		     file_io_handle,
+		     (int) allocation_group_index,
+		     &inode_chunk_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve inode chunk index: %" PRIu64 ".",
+			 function,
+			 allocation_group_index );
+
+			return( -1 );
+		}
+		result = libfsxfs_inode_chunk_index_get_next_allocated_inode_number(
+		          inode_chunk_index,
+		          relative_inode_number,
+		          &next_relative_inode_number,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve next allocated inode number in allocation group: %" PRIu64 ".",
+			 function,
+			 allocation_group_index );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			*next_inode_number = ( allocation_group_index << io_handle->number_of_relative_inode_number_bits )
+			                   | next_relative_inode_number;
+
+			return( 1 );
+		}
+		allocation_group_index++;
+
+		relative_inode_number = 0;
+	}
+	return( 0 );
+}
+
+/* Retrieves a specific inode
+ * The inode is reference counted and must be released with libfsxfs_inode_free
+ * Returns 1 if successful, 0 if no such value or -1 on error
+ */
+int libfsxfs_file_system_get_inode_by_number(
+     libfsxfs_file_system_t *file_system,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint64_t inode_number,
+     libfsxfs_inode_t **inode,
+     libcerror_error_t **error )
+{
+	libfsxfs_inode_t *safe_inode = NULL;
+	static char *function        = "libfsxfs_file_system_get_inode_by_number";
+	size_t maximum_cache_size    = 0;
+	off64_t file_offset          = 0;
+	int result                   = 0;
+
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->inode_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid IO handle - inode size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( inode_number == 0 )
+	 || ( inode_number > (uint64_t) UINT32_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid inode number value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( inode == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfsxfs_inode_cache_get_inode_by_number(
+	          file_system->inode_cache,
+	          inode_number,
+	          inode,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve inode: %" PRIu64 " from cache.",
+		 function,
+		 inode_number );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		return( 1 );
+	}
+	if( libfsxfs_inode_cache_get_maximum_cache_size(
+	     file_system->inode_cache,
+	     &maximum_cache_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve maximum inode cache size.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_cache_size > 0 )
+	{
+		result = libfsxfs_file_system_read_inode_chunk(
+		          file_system,
+		          io_handle,
+		          file_io_handle,
+		          inode_number,
+		          inode,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read inode chunk of inode: %" PRIu64 ".",
+			 function,
+			 inode_number );
+
+			return( -1 );
+		}
+		return( result );
+	}
+	result = libfsxfs_inode_btree_get_inode_by_number(
+	          file_system->inode_btree,
+	          io_handle,
+	          file_io_handle,
+	          inode_number,
+	          &file_offset,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to retrieve inode: %" PRIu64 "\n",
+		 function,
+		 inode_number );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		if( libfsxfs_inode_initialize(
+		     &safe_inode,
+		     io_handle->inode_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create inode.",
+			 function );
+
+			goto on_error;
+		}
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "Reading inode: %" PRIu64 " at offset: %" PRIi64 " (0x%08" PRIx64 ").\n",
+			 inode_number,
+			 file_offset,
+			 file_offset );
+		}
+#endif
+		if( libfsxfs_inode_read_file_io_handle(
+		     safe_inode,
+		     io_handle,
+		     file_io_handle,
+		     file_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read inode: %" PRIu64 " at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 inode_number,
+			 file_offset,
+			 file_offset );
+
+			goto on_error;
+		}
+		if( libfsxfs_inode_cache_insert_inode(
+		     file_system->inode_cache,
+		     inode_number,
+		     safe_inode,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to insert inode: %" PRIu64 " into cache.",
+			 function,
+			 inode_number );
+
+			goto on_error;
+		}
+		*inode = safe_inode;
+	}
+	return( result );
+
+on_error:
+	if( safe_inode != NULL )
+	{
+		libfsxfs_inode_free(
+		 &safe_inode,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads the data extents of an inode if they were not read before
+ * The memory size of the inode in the inode cache is updated after the data extents were read
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_file_system_read_data_extents(
+     libfsxfs_file_system_t *file_system,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint64_t inode_number,
+     libfsxfs_inode_t *inode,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_file_system_read_data_extents";
+	int result            = 0;
+
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfsxfs_inode_read_data_extents(
+	          inode,
+	          io_handle,
+	          file_io_handle,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read data extents of inode: %" PRIu64 ".",
+		 function,
+		 inode_number );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		if( libfsxfs_inode_cache_update_inode(
+		     file_system->inode_cache,
+		     inode_number,
+		     inode,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update inode: %" PRIu64 " in cache.",
+			 function,
+			 inode_number );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Reads the inode chunk that contains a specific inode
+ * The chunk is read with a single read and its allocated inodes are added to the inode cache
+ * The inode is reference counted and must be released with libfsxfs_inode_free
+ * Returns 1 if successful, 0 if no such value or -1 on error
+ */
+int libfsxfs_file_system_read_inode_chunk(
+     libfsxfs_file_system_t *file_system,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint64_t inode_number,
+     libfsxfs_inode_t **inode,
+     libcerror_error_t **error )
+{
+	libfsxfs_inode_t *chunk_inode    = NULL;
+	libfsxfs_inode_t *safe_inode     = NULL;
+	const uint8_t *data              = NULL;
+	uint8_t *chunk_data              = NULL;
+	static char *function            = "libfsxfs_file_system_read_inode_chunk";
+	size_t chunk_data_offset         = 0;
+	size_t chunk_data_size           = 0;
+	ssize_t read_count               = 0;
+	off64_t chunk_file_offset        = 0;
+	uint64_t chunk_allocation_bitmap = 0;
+	uint64_t chunk_inode_number      = 0;
+	uint64_t current_inode_number    = 0;
+	int inode_index                  = 0;
+	int result                       = 0;
+
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->inode_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid IO handle - inode size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( inode == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfsxfs_inode_btree_get_inode_chunk_by_number(
+	          file_system->inode_btree,
+	          io_handle,
+	          file_io_handle,
+	          inode_number,
+	          &chunk_file_offset,
+	          &chunk_inode_number,
+	          &chunk_allocation_bitmap,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve inode chunk of inode: %" PRIu64 ".",
+		 function,
+		 inode_number );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	chunk_data_size = (size_t) LIBFSXFS_INODE_CHUNK_NUMBER_OF_INODES * io_handle->inode_size;
+
+	/* If the volume is mapped the inodes are read directly from the memory map
+	 */
+	result = libfsxfs_io_handle_get_mapped_data(
+	          io_handle,
+	          chunk_file_offset,
+	          chunk_data_size,
+	          &data,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve mapped inode chunk data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 chunk_file_offset,
+		 chunk_file_offset );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		chunk_data = (uint8_t *) memory_allocate(
+		                          sizeof( uint8_t ) * chunk_data_size );
+
+		if( chunk_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create inode chunk data.",
+			 function );
+
+			goto on_error;
+		}
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "Reading inode chunk: %" PRIu64 " at offset: %" PRIi64 " (0x%08" PRIx64 ").\n",
+			 chunk_inode_number,
+			 chunk_file_offset,
+			 chunk_file_offset );
+		}
+#endif
+		read_count = libbfio_handle_read_buffer_at_offset(
+		              file_io_handle,
+		              chunk_data,
+		              chunk_data_size,
+		              chunk_file_offset,
+		              error );
+
+		if( read_count != (ssize_t) chunk_data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read inode chunk data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 chunk_file_offset,
+			 chunk_file_offset );
 
-		goto on_error;
+			goto on_error;
+		}
+		data = chunk_data;
 	}
-	else if( result != 0 )
+	for( inode_index = 0;
+	     inode_index < LIBFSXFS_INODE_CHUNK_NUMBER_OF_INODES;
+	     inode_index++ )
 	{
-		if( libfsxfs_inode_initialize(
-		     &safe_inode,
-		     io_handle->inode_size,
-		     error ) != 1 )
+		current_inode_number = chunk_inode_number + inode_index;
+		chunk_data_offset    = (size_t) inode_index * io_handle->inode_size;
+
+		if( current_inode_number == inode_number )
+		{
+			if( libfsxfs_inode_initialize(
+			     &safe_inode,
+			     io_handle->inode_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create inode.",
+				 function );
+
+				goto on_error;
+			}
+			if( libfsxfs_inode_read_buffer(
+			     safe_inode,
+			     io_handle,
+			     file_io_handle,
+			     &( data[ chunk_data_offset ] ),
+			     chunk_data_size - chunk_data_offset,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read inode: %" PRIu64 ".",
+				 function,
+				 inode_number );
+
+				goto on_error;
+			}
+			if( libfsxfs_inode_cache_insert_inode(
+			     file_system->inode_cache,
+			     inode_number,
+			     safe_inode,
+			     error ) == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to insert inode: %" PRIu64 " into cache.",
+				 function,
+				 inode_number );
+
+				goto on_error;
+			}
+			continue;
+		}
+		/* Inodes marked as free in the chunk allocation bitmap are not read ahead
+		 */
+		if( ( ( chunk_allocation_bitmap >> inode_index ) & 0x00000001UL ) != 0 )
+		{
+			continue;
+		}
+		if( ( current_inode_number == 0 )
+		 || ( current_inode_number > (uint64_t) UINT32_MAX ) )
+		{
+			continue;
+		}
+		result = libfsxfs_inode_cache_get_inode_by_number(
+		          file_system->inode_cache,
+		          current_inode_number,
+		          &chunk_inode,
+		          error );
+
+		if( result == -1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create inode.",
-			 function );
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve inode: %" PRIu64 " from cache.",
+			 function,
+			 current_inode_number );
 
 			goto on_error;
 		}
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
+		else if( result == 0 )
 		{
-			libcnotify_printf(
-			 "Reading inode: %" PRIu64 " at offset: %" PRIi64 " (0x%08" PRIx64 ").\n",
-			 inode_number,
-			 file_offset,
-			 file_offset );
+			if( libfsxfs_inode_initialize(
+			     &chunk_inode,
+			     io_handle->inode_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create inode: %" PRIu64 ".",
+				 function,
+				 current_inode_number );
+
+				goto on_error;
+			}
+			/* An inode in the chunk that cannot be read is not considered an error
+			 * since it is read ahead and was not requested
+			 */
+			if( libfsxfs_inode_read_buffer(
+			     chunk_inode,
+			     io_handle,
+			     file_io_handle,
+			     &( data[ chunk_data_offset ] ),
+			     chunk_data_size - chunk_data_offset,
+			     NULL ) == 1 )
+			{
+				if( libfsxfs_inode_cache_insert_inode(
+				     file_system->inode_cache,
+				     current_inode_number,
+				     chunk_inode,
+				     error ) == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to insert inode: %" PRIu64 " into cache.",
+					 function,
+					 current_inode_number );
+
+					goto on_error;
+				}
+			}
 		}
-#endif
-		if( libfsxfs_inode_read_file_io_handle(
-		     safe_inode,
-		     io_handle,
-		     file_io_handle,
-		     file_offset,
+		if( libfsxfs_inode_free(
+		     &chunk_inode,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read inode: %" PRIu64 " at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free inode: %" PRIu64 ".",
 			 function,
-			 inode_number,
-			 file_offset,
-			 file_offset );
+			 current_inode_number );
 
 			goto on_error;
 		}
-		*inode = safe_inode;
 	}
-	return( result );
+	if( chunk_data != NULL )
+	{
+		memory_free(
+		 chunk_data );
+
+		chunk_data = NULL;
+	}
+
+	if( safe_inode == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing inode: %" PRIu64 " in inode chunk: %" PRIu64 ".",
+		 function,
+		 inode_number,
+		 chunk_inode_number );
+
+		goto on_error;
+	}
+	*inode = safe_inode;
+
+	return( 1 );
 
 on_error:
+	if( chunk_inode != NULL )
+	{
+		libfsxfs_inode_free(
+		 &chunk_inode,
+		 NULL );
+	}
 	if( safe_inode != NULL )
 	{
 		libfsxfs_inode_free(
 		 &safe_inode,
 		 NULL );
 	}
+	if( chunk_data != NULL )
+	{
+		memory_free(
+		 chunk_data );
+	}
 	return( -1 );
 }
 
@@ -408,16 +1798,17 @@ int libfsxfs_file_system_get_directory_entry_by_utf8_path(
      libfsxfs_directory_entry_t **directory_entry,
      libcerror_error_t **error )
 {
-	libfsxfs_directory_t *directory                  = NULL;
-	libfsxfs_directory_entry_t *safe_directory_entry = NULL;
-	libfsxfs_inode_t *safe_inode                     = NULL;
-	const uint8_t *utf8_string_segment               = NULL;
-	static char *function                            = "libfsxfs_file_system_get_directory_entry_by_utf8_path";
-	libuna_unicode_character_t unicode_character     = 0;
-	size_t utf8_string_index                         = 0;
-	size_t utf8_string_segment_length                = 0;
-	uint64_t safe_inode_number                       = 0;
-	int result                                       = 0;
+	libfsxfs_directory_t *directory                    = NULL;
+	libfsxfs_directory_entry_t *cached_directory_entry = NULL;
+	libfsxfs_directory_entry_t *safe_directory_entry   = NULL;
+	libfsxfs_inode_t *safe_inode                       = NULL;
+	const uint8_t *utf8_string_segment                 = NULL;
+	static char *function                              = "libfsxfs_file_system_get_directory_entry_by_utf8_path";
+	libuna_unicode_character_t unicode_character       = 0;
+	size_t utf8_string_index                           = 0;
+	size_t utf8_string_segment_length                  = 0;
+	uint64_t safe_inode_number                         = 0;
+	int result                                         = 0;
 
 	if( file_system == NULL )
 	{
@@ -510,52 +1901,24 @@ int libfsxfs_file_system_get_directory_entry_by_utf8_path(
 	}
 	else while( utf8_string_index < utf8_string_length )
 	{
-		if( directory != NULL )
+		if( cached_directory_entry != NULL )
 		{
-			if( libfsxfs_directory_free(
-			     &directory,
+			if( libfsxfs_directory_entry_free(
+			     &cached_directory_entry,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free directory.",
+				 "%s: unable to free cached directory entry.",
 				 function );
 
 				goto on_error;
 			}
 		}
-		if( libfsxfs_directory_initialize(
-		     &directory,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create directory.",
-			 function );
-
-			goto on_error;
-		}
-		if( libfsxfs_directory_read_file_io_handle(
-		     directory,
-		     io_handle,
-		     file_io_handle,
-		     safe_inode,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read directory from inode: %" PRIu64 ".",
-			 function,
-			 safe_inode_number );
+		safe_directory_entry = NULL;
 
-			goto on_error;
-		}
 		utf8_string_segment        = &( utf8_string[ utf8_string_index ] );
 		utf8_string_segment_length = utf8_string_index;
 
@@ -593,26 +1956,111 @@ int libfsxfs_file_system_get_directory_entry_by_utf8_path(
 		}
 		else
 		{
-			result = libfsxfs_directory_get_entry_by_utf8_name(
-			          directory,
+			result = libfsxfs_dentry_cache_get_directory_entry(
+			          file_system->dentry_cache,
+			          safe_inode_number,
 			          utf8_string_segment,
 			          utf8_string_segment_length,
-			          &safe_directory_entry,
+			          &cached_directory_entry,
 			          error );
-		}
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve directory entry by UTF-8 name.",
-			 function );
 
-			goto on_error;
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve directory entry from dentry cache.",
+				 function );
+
+				goto on_error;
+			}
+			else if( result != 0 )
+			{
+				/* The cached directory entry is NULL for a negative value
+				 */
+				safe_directory_entry = cached_directory_entry;
+			}
+			else
+			{
+				if( directory != NULL )
+				{
+					if( libfsxfs_directory_free(
+					     &directory,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+						 "%s: unable to free directory.",
+						 function );
+
+						goto on_error;
+					}
+				}
+				if( libfsxfs_directory_initialize(
+				     &directory,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+					 "%s: unable to create directory.",
+					 function );
+
+					goto on_error;
+				}
+				result = libfsxfs_directory_read_entry_by_utf8_name(
+				          directory,
+				          io_handle,
+				          file_io_handle,
+				          safe_inode,
+				          utf8_string_segment,
+				          utf8_string_segment_length,
+				          &safe_directory_entry,
+				          error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve directory entry by UTF-8 name.",
+					 function );
+
+					goto on_error;
+				}
+				else if( result == 0 )
+				{
+					safe_directory_entry = NULL;
+				}
+				if( libfsxfs_dentry_cache_insert_directory_entry(
+				     file_system->dentry_cache,
+				     safe_inode_number,
+				     utf8_string_segment,
+				     utf8_string_segment_length,
+				     safe_directory_entry,
+				     error ) == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to insert directory entry into dentry cache.",
+					 function );
+
+					goto on_error;
+				}
+			}
 		}
-		else if( result == 0 )
+		if( ( result == 0 )
+		 || ( safe_directory_entry == NULL ) )
 		{
+			result = 0;
+
 			break;
 		}
 		if( libfsxfs_directory_entry_get_inode_number(
@@ -683,6 +2131,12 @@ int libfsxfs_file_system_get_directory_entry_by_utf8_path(
 			}
 		}
 	}
+	else if( ( safe_directory_entry != NULL )
+	      && ( safe_directory_entry == cached_directory_entry ) )
+	{
+		*directory_entry       = cached_directory_entry;
+		cached_directory_entry = NULL;
+	}
 	else
 	{
 		if( libfsxfs_directory_entry_clone(
@@ -700,6 +2154,22 @@ int libfsxfs_file_system_get_directory_entry_by_utf8_path(
 			goto on_error;
 		}
 	}
+	if( cached_directory_entry != NULL )
+	{
+		if( libfsxfs_directory_entry_free(
+		     &cached_directory_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free cached directory entry.",
+			 function );
+
+			goto on_error;
+		}
+	}
 	/* Directory needs to be freed after making a clone of directory_entry
 	 */
 	if( directory != NULL )
@@ -724,6 +2194,12 @@ int libfsxfs_file_system_get_directory_entry_by_utf8_path(
 	return( result );
 
 on_error:
+	if( cached_directory_entry != NULL )
+	{
+		libfsxfs_directory_entry_free(
+		 &cached_directory_entry,
+		 NULL );
+	}
 	if( directory != NULL )
 	{
 		libfsxfs_directory_free(
@@ -759,16 +2235,20 @@ int libfsxfs_file_system_get_directory_entry_by_utf16_path(
      libfsxfs_directory_entry_t **directory_entry,
      libcerror_error_t **error )
 {
-	libfsxfs_directory_t *directory                  = NULL;
-	libfsxfs_directory_entry_t *safe_directory_entry = NULL;
-	libfsxfs_inode_t *safe_inode                     = NULL;
-	const uint16_t *utf16_string_segment             = NULL;
-	static char *function                            = "libfsxfs_file_system_get_directory_entry_by_utf16_path";
-	libuna_unicode_character_t unicode_character     = 0;
-	size_t utf16_string_index                        = 0;
-	size_t utf16_string_segment_length               = 0;
-	uint64_t safe_inode_number                       = 0;
-	int result                                       = 0;
+	libfsxfs_directory_t *directory                    = NULL;
+	libfsxfs_directory_entry_t *cached_directory_entry = NULL;
+	libfsxfs_directory_entry_t *safe_directory_entry   = NULL;
+	libfsxfs_inode_t *safe_inode                       = NULL;
+	const uint16_t *utf16_string_segment               = NULL;
+	uint8_t utf8_string_segment[ 256 ];
+	static char *function                              = "libfsxfs_file_system_get_directory_entry_by_utf16_path";
+	libuna_unicode_character_t unicode_character       = 0;
+	size_t utf16_string_index                          = 0;
+	size_t utf16_string_segment_length                 = 0;
+	size_t utf8_string_segment_length                  = 0;
+	size_t utf8_string_segment_size                    = 0;
+	uint64_t safe_inode_number                         = 0;
+	int result                                         = 0;
 
 	if( file_system == NULL )
 	{
@@ -861,52 +2341,24 @@ int libfsxfs_file_system_get_directory_entry_by_utf16_path(
 	}
 	else while( utf16_string_index < utf16_string_length )
 	{
-		if( directory != NULL )
+		if( cached_directory_entry != NULL )
 		{
-			if( libfsxfs_directory_free(
-			     &directory,
+			if( libfsxfs_directory_entry_free(
+			     &cached_directory_entry,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free directory.",
+				 "%s: unable to free cached directory entry.",
 				 function );
 
 				goto on_error;
 			}
 		}
-		if( libfsxfs_directory_initialize(
-		     &directory,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create directory.",
-			 function );
-
-			goto on_error;
-		}
-		if( libfsxfs_directory_read_file_io_handle(
-		     directory,
-		     io_handle,
-		     file_io_handle,
-		     safe_inode,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read directory from inode: %" PRIu64 ".",
-			 function,
-			 safe_inode_number );
+		safe_directory_entry = NULL;
 
-			goto on_error;
-		}
 		utf16_string_segment        = &( utf16_string[ utf16_string_index ] );
 		utf16_string_segment_length = utf16_string_index;
 
@@ -938,32 +2390,162 @@ int libfsxfs_file_system_get_directory_entry_by_utf16_path(
 		}
 		utf16_string_segment_length = utf16_string_index - utf16_string_segment_length;
 
+		/* The dentry cache is keyed by the UTF-8 encoded name so that UTF-8 and UTF-16
+		 * path lookups share the cached values
+		 */
+		utf8_string_segment_length = 0;
+
+		if( utf16_string_segment_length > 0 )
+		{
+			if( libuna_utf8_string_size_from_utf16(
+			     utf16_string_segment,
+			     utf16_string_segment_length,
+			     &utf8_string_segment_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve UTF-8 string segment size.",
+				 function );
+
+				goto on_error;
+			}
+			/* Names that do not fit in a directory entry are not cached
+			 */
+			if( utf8_string_segment_size <= 256 )
+			{
+				if( libuna_utf8_string_copy_from_utf16(
+				     utf8_string_segment,
+				     utf8_string_segment_size,
+				     utf16_string_segment,
+				     utf16_string_segment_length,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+					 "%s: unable to copy UTF-16 string segment to UTF-8.",
+					 function );
+
+					goto on_error;
+				}
+				utf8_string_segment_length = utf8_string_segment_size - 1;
+			}
+		}
 		if( utf16_string_segment_length == 0 )
 		{
 			result = 0;
 		}
 		else
 		{
-			result = libfsxfs_directory_get_entry_by_utf16_name(
-			          directory,
-			          utf16_string_segment,
-			          utf16_string_segment_length,
-			          &safe_directory_entry,
+			result = libfsxfs_dentry_cache_get_directory_entry(
+			          file_system->dentry_cache,
+			          safe_inode_number,
+			          utf8_string_segment,
+			          utf8_string_segment_length,
+			          &cached_directory_entry,
 			          error );
-		}
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve directory entry by UTF-16 name.",
-			 function );
 
-			goto on_error;
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve directory entry from dentry cache.",
+				 function );
+
+				goto on_error;
+			}
+			else if( result != 0 )
+			{
+				/* The cached directory entry is NULL for a negative value
+				 */
+				safe_directory_entry = cached_directory_entry;
+			}
+			else
+			{
+				if( directory != NULL )
+				{
+					if( libfsxfs_directory_free(
+					     &directory,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+						 "%s: unable to free directory.",
+						 function );
+
+						goto on_error;
+					}
+				}
+				if( libfsxfs_directory_initialize(
+				     &directory,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+					 "%s: unable to create directory.",
+					 function );
+
+					goto on_error;
+				}
+				result = libfsxfs_directory_read_entry_by_utf16_name(
+				          directory,
+				          io_handle,
+				          file_io_handle,
+				          safe_inode,
+				          utf16_string_segment,
+				          utf16_string_segment_length,
+				          &safe_directory_entry,
+				          error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve directory entry by UTF-16 name.",
+					 function );
+
+					goto on_error;
+				}
+				else if( result == 0 )
+				{
+					safe_directory_entry = NULL;
+				}
+				if( libfsxfs_dentry_cache_insert_directory_entry(
+				     file_system->dentry_cache,
+				     safe_inode_number,
+				     utf8_string_segment,
+				     utf8_string_segment_length,
+				     safe_directory_entry,
+				     error ) == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to insert directory entry into dentry cache.",
+					 function );
+
+					goto on_error;
+				}
+			}
 		}
-		else if( result == 0 )
+		if( ( result == 0 )
+		 || ( safe_directory_entry == NULL ) )
 		{
+			result = 0;
+
 			break;
 		}
 		if( libfsxfs_directory_entry_get_inode_number(
@@ -1034,6 +2616,12 @@ int libfsxfs_file_system_get_directory_entry_by_utf16_path(
 			}
 		}
 	}
+	else if( ( safe_directory_entry != NULL )
+	      && ( safe_directory_entry == cached_directory_entry ) )
+	{
+		*directory_entry       = cached_directory_entry;
+		cached_directory_entry = NULL;
+	}
 	else
 	{
 		if( libfsxfs_directory_entry_clone(
@@ -1051,6 +2639,22 @@ int libfsxfs_file_system_get_directory_entry_by_utf16_path(
 			goto on_error;
 		}
 	}
+	if( cached_directory_entry != NULL )
+	{
+		if( libfsxfs_directory_entry_free(
+		     &cached_directory_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free cached directory entry.",
+			 function );
+
+			goto on_error;
+		}
+	}
 	/* Directory needs to be freed after making a clone of directory_entry
 	 */
 	if( directory != NULL )
@@ -1075,6 +2679,12 @@ int libfsxfs_file_system_get_directory_entry_by_utf16_path(
 	return( result );
 
 on_error:
+	if( cached_directory_entry != NULL )
+	{
+		libfsxfs_directory_entry_free(
+		 &cached_directory_entry,
+		 NULL );
+	}
 	if( directory != NULL )
 	{
 		libfsxfs_directory_free(
@@ -25,9 +25,11 @@
 #include <common.h>
 #include <types.h>
 
+#include "libfsxfs_dentry_cache.h"
 #include "libfsxfs_directory_entry.h"
 #include "libfsxfs_inode.h"
 #include "libfsxfs_inode_btree.h"
+#include "libfsxfs_inode_cache.h"
 #include "libfsxfs_libbfio.h"
 #include "libfsxfs_libcerror.h"
 #include "libfsxfs_libcthreads.h"
@@ -44,6 +46,14 @@ struct libfsxfs_file_system
 	 */
 	libfsxfs_inode_btree_t *inode_btree;
 
+	/* The inode cache
+	 */
+	libfsxfs_inode_cache_t *inode_cache;
+
+	/* The directory entry (dentry) cache
+	 */
+	libfsxfs_dentry_cache_t *dentry_cache;
+
 	/* The root directory inode number
 	 */
 	uint64_t root_directory_inode_number;
@@ -64,11 +74,57 @@ int libfsxfs_file_system_free(
      libfsxfs_file_system_t **file_system,
      libcerror_error_t **error );
 
+int libfsxfs_file_system_set_maximum_inode_cache_size(
+     libfsxfs_file_system_t *file_system,
+     size_t maximum_cache_size,
+     libcerror_error_t **error );
+
+int libfsxfs_file_system_set_maximum_number_of_dentry_cache_values(
+     libfsxfs_file_system_t *file_system,
+     int maximum_number_of_values,
+     libcerror_error_t **error );
+
+int libfsxfs_file_system_set_use_inode_chunk_index(
+     libfsxfs_file_system_t *file_system,
+     uint8_t use_inode_chunk_index,
+     libcerror_error_t **error );
+
+int libfsxfs_file_system_set_number_of_allocation_groups(
+     libfsxfs_file_system_t *file_system,
+     uint32_t number_of_allocation_groups,
+     libcerror_error_t **error );
+
 int libfsxfs_file_system_read_inode_information(
      libfsxfs_file_system_t *file_system,
      libfsxfs_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
-     off64_t file_offset,
+     uint32_t allocation_group_index,
+     libcerror_error_t **error );
+
+int libfsxfs_file_system_read_inode_information_data(
+     libfsxfs_file_system_t *file_system,
+     libfsxfs_io_handle_t *io_handle,
+     uint32_t allocation_group_index,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libfsxfs_file_system_verify_allocation_group(
+     libfsxfs_file_system_t *file_system,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint32_t allocation_group_index,
+     uint64_t *number_of_inodes,
+     uint64_t *metadata_size,
+     libcerror_error_t **error );
+
+int libfsxfs_file_system_get_next_allocated_inode_number(
+     libfsxfs_file_system_t *file_system,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint32_t number_of_allocation_groups,
+     uint64_t inode_number,
+     uint64_t *next_inode_number,
      libcerror_error_t **error );
 
 int libfsxfs_file_system_get_inode_by_number(
@@ -79,6 +135,22 @@ int libfsxfs_file_system_get_inode_by_number(
      libfsxfs_inode_t **inode,
      libcerror_error_t **error );
 
+int libfsxfs_file_system_read_data_extents(
+     libfsxfs_file_system_t *file_system,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint64_t inode_number,
+     libfsxfs_inode_t *inode,
+     libcerror_error_t **error );
+
+int libfsxfs_file_system_read_inode_chunk(
+     libfsxfs_file_system_t *file_system,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint64_t inode_number,
+     libfsxfs_inode_t **inode,
+     libcerror_error_t **error );
+
 int libfsxfs_file_system_get_directory_entry_by_utf8_path(
      libfsxfs_file_system_t *file_system,
      libfsxfs_io_handle_t *io_handle,
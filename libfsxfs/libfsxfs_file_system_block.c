@@ -23,6 +23,7 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libfsxfs_checksum.h"
 #include "libfsxfs_file_system_block.h"
 #include "libfsxfs_file_system_block_header.h"
 #include "libfsxfs_io_handle.h"
@@ -295,6 +296,25 @@ int libfsxfs_file_system_block_read_data(
 
 		goto on_error;
 	}
+	if( ( io_handle->verify_checksums != 0 )
+	 && ( io_handle->format_version == 5 ) )
+	{
+		if( libfsxfs_checksum_verify_metadata_checksum(
+		     data,
+		     data_size,
+		     12,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_INPUT,
+			 LIBCERROR_INPUT_ERROR_CHECKSUM_MISMATCH,
+			 "%s: unable to verify file system block checksum.",
+			 function );
+
+			goto on_error;
+		}
+	}
 	return( 1 );
 
 on_error:
@@ -352,7 +372,8 @@ int libfsxfs_file_system_block_read_file_io_handle(
 		 file_offset );
 	}
 #endif
-	read_count = libbfio_handle_read_buffer_at_offset(
+	read_count = libfsxfs_io_handle_read_buffer_at_offset(
+	              io_handle,
 	              file_io_handle,
 	              file_system_block->data,
 	              file_system_block->data_size,
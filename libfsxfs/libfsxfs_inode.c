@@ -25,6 +25,7 @@
 #include <types.h>
 
 #include "libfsxfs_attribute_values.h"
+#include "libfsxfs_checksum.h"
 #include "libfsxfs_debug.h"
 #include "libfsxfs_definitions.h"
 #include "libfsxfs_extent.h"
@@ -34,6 +35,7 @@
 #include "libfsxfs_io_handle.h"
 #include "libfsxfs_libcerror.h"
 #include "libfsxfs_libcnotify.h"
+#include "libfsxfs_libcthreads.h"
 #include "libfsxfs_libfdatetime.h"
 #include "libfsxfs_libfguid.h"
 
@@ -135,11 +137,33 @@ int libfsxfs_inode_initialize(
 	}
 	( *inode )->data_size = inode_size;
 
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( ( *inode )->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	( *inode )->reference_count = 1;
+
 	return( 1 );
 
 on_error:
 	if( *inode != NULL )
 	{
+		if( ( *inode )->data != NULL )
+		{
+			memory_free(
+			 ( *inode )->data );
+		}
 		memory_free(
 		 *inode );
 
@@ -149,6 +173,7 @@ on_error:
 }
 
 /* Frees a inode
+ * The inode is only freed when the last reference is released
  * Returns 1 if successful or -1 on error
  */
 int libfsxfs_inode_free(
@@ -156,6 +181,7 @@ int libfsxfs_inode_free(
      libcerror_error_t **error )
 {
 	static char *function = "libfsxfs_inode_free";
+	int reference_count   = 0;
 	int result            = 1;
 
 	if( inode == NULL )
@@ -171,6 +197,61 @@ int libfsxfs_inode_free(
 	}
 	if( *inode != NULL )
 	{
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_grab_for_write(
+		     ( *inode )->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab read/write lock for writing.",
+			 function );
+
+			return( -1 );
+		}
+#endif
+		( *inode )->reference_count -= 1;
+
+		reference_count = ( *inode )->reference_count;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_release_for_write(
+		     ( *inode )->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read/write lock for writing.",
+			 function );
+
+			return( -1 );
+		}
+#endif
+		if( reference_count > 0 )
+		{
+			*inode = NULL;
+
+			return( 1 );
+		}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( ( *inode )->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+#endif
 		if( ( *inode )->data != NULL )
 		{
 			memory_free(
@@ -218,6 +299,78 @@ int libfsxfs_inode_free(
 	return( result );
 }
 
+/* Increments the reference count of an inode
+ * Every reference must be released with libfsxfs_inode_free
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_inode_increment_reference_count(
+     libfsxfs_inode_t *inode,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_inode_increment_reference_count";
+
+	if( inode == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     inode->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( inode->reference_count >= INT_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid inode - reference count value out of bounds.",
+		 function );
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+		libcthreads_read_write_lock_release_for_write(
+		 inode->read_write_lock,
+		 NULL );
+#endif
+		return( -1 );
+	}
+	inode->reference_count += 1;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     inode->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
 /* Reads the inode data
  * Returns 1 if successful or -1 on error
  */
@@ -871,11 +1024,8 @@ int libfsxfs_inode_read_file_io_handle(
      off64_t file_offset,
      libcerror_error_t **error )
 {
-	libfsxfs_extent_btree_t *extent_btree = NULL;
-	static char *function                 = "libfsxfs_inode_read_file_io_handle";
-	ssize_t read_count                    = 0;
-	uint64_t number_of_blocks             = 0;
-	uint8_t add_sparse_extents            = 0;
+	static char *function = "libfsxfs_inode_read_file_io_handle";
+	ssize_t read_count    = 0;
 
 	if( inode == NULL )
 	{
@@ -946,107 +1096,268 @@ int libfsxfs_inode_read_file_io_handle(
 
 		return( -1 );
 	}
-	number_of_blocks = inode->size / io_handle->block_size;
+	if( ( io_handle->verify_checksums != 0 )
+	 && ( inode->format_version == 3 ) )
+	{
+		if( libfsxfs_checksum_verify_metadata_checksum(
+		     inode->data,
+		     inode->data_size,
+		     100,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_INPUT,
+			 LIBCERROR_INPUT_ERROR_CHECKSUM_MISMATCH,
+			 "%s: unable to verify inode checksum.",
+			 function );
 
-	if( ( inode->size % io_handle->block_size ) != 0 )
+			return( -1 );
+		}
+	}
+	if( libfsxfs_inode_read_forks(
+	     inode,
+	     io_handle,
+	     file_io_handle,
+	     error ) != 1 )
 	{
-		number_of_blocks++;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read inode forks.",
+		 function );
+
+		return( -1 );
 	}
-	if( ( inode->file_mode & 0xf000 ) != LIBFSXFS_FILE_TYPE_DIRECTORY )
+	return( 1 );
+}
+
+/* Reads the inode from a buffer
+ * The buffer must contain at least the inode size bytes of inode data
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_inode_read_buffer(
+     libfsxfs_inode_t *inode,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_inode_read_buffer";
+
+	if( inode == NULL )
 	{
-		add_sparse_extents = 1;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode.",
+		 function );
+
+		return( -1 );
 	}
-	if( inode->fork_type == LIBFSXFS_FORK_TYPE_DEVICE )
+	if( io_handle == NULL )
 	{
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "%s: device identifier data:\n",
-			 function );
-			libcnotify_print_data(
-			 &( inode->data[ inode->data_fork_offset ] ),
-			 4,
-			 0 );
-		}
-#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
 
-		byte_stream_copy_to_uint32_big_endian(
-		 &( inode->data[ inode->data_fork_offset ] ),
-		 inode->device_identifier );
+		return( -1 );
 	}
-	else if( inode->fork_type == LIBFSXFS_FORK_TYPE_INLINE_DATA )
+	if( buffer == NULL )
 	{
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "%s: inline data:\n",
-			 function );
-			libcnotify_print_data(
-			 &( inode->data[ inode->data_fork_offset ] ),
-			 (size_t) inode->size,
-			 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
-		}
-#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
 
-		inode->inline_data = &( inode->data[ inode->data_fork_offset ] );
+		return( -1 );
 	}
-	else if( inode->fork_type == LIBFSXFS_FORK_TYPE_EXTENTS )
+	if( ( buffer_size < inode->data_size )
+	 || ( buffer_size > (size_t) SSIZE_MAX ) )
 	{
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "%s: data extent list:\n",
-			 function );
-			libcnotify_print_data(
-			 &( inode->data[ inode->data_fork_offset ] ),
-			 (size_t) inode->data_fork_size,
-			 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
-		}
-#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buffer size value out of bounds.",
+		 function );
 
-		if( libcdata_array_initialize(
-		     &( inode->data_extents_array ),
-		     0,
+		return( -1 );
+	}
+	if( memory_copy(
+	     inode->data,
+	     buffer,
+	     inode->data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy inode data.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsxfs_inode_read_data(
+	     inode,
+	     inode->data,
+	     inode->data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read inode.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( io_handle->verify_checksums != 0 )
+	 && ( inode->format_version == 3 ) )
+	{
+		if( libfsxfs_checksum_verify_metadata_checksum(
+		     inode->data,
+		     inode->data_size,
+		     100,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create data extents array.",
+			 LIBCERROR_ERROR_DOMAIN_INPUT,
+			 LIBCERROR_INPUT_ERROR_CHECKSUM_MISMATCH,
+			 "%s: unable to verify inode checksum.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
-		if( libfsxfs_extent_list_read_data(
-		     inode->data_extents_array,
-		     number_of_blocks,
-		     inode->number_of_data_extents,
-		     &( inode->data[ inode->data_fork_offset ] ),
-		     inode->data_fork_size,
-		     add_sparse_extents,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read data extent list.",
+	}
+	if( libfsxfs_inode_read_forks(
+	     inode,
+	     io_handle,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read inode forks.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads the data and attributes forks of the inode
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_inode_read_forks(
+     libfsxfs_inode_t *inode,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	libfsxfs_extent_btree_t *extent_btree = NULL;
+	static char *function                 = "libfsxfs_inode_read_forks";
+	uint64_t number_of_blocks             = 0;
+	uint8_t add_sparse_extents            = 0;
+
+	if( inode == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->block_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid IO handle - block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_blocks = inode->size / io_handle->block_size;
+
+	if( ( inode->size % io_handle->block_size ) != 0 )
+	{
+		number_of_blocks++;
+	}
+	if( ( inode->file_mode & 0xf000 ) != LIBFSXFS_FILE_TYPE_DIRECTORY )
+	{
+		add_sparse_extents = 1;
+	}
+	if( inode->fork_type == LIBFSXFS_FORK_TYPE_DEVICE )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: device identifier data:\n",
 			 function );
+			libcnotify_print_data(
+			 &( inode->data[ inode->data_fork_offset ] ),
+			 4,
+			 0 );
+		}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
 
-			goto on_error;
+		byte_stream_copy_to_uint32_big_endian(
+		 &( inode->data[ inode->data_fork_offset ] ),
+		 inode->device_identifier );
+	}
+	else if( inode->fork_type == LIBFSXFS_FORK_TYPE_INLINE_DATA )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: inline data:\n",
+			 function );
+			libcnotify_print_data(
+			 &( inode->data[ inode->data_fork_offset ] ),
+			 (size_t) inode->size,
+			 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
 		}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+		inode->inline_data = &( inode->data[ inode->data_fork_offset ] );
 	}
-	else if( inode->fork_type == LIBFSXFS_FORK_TYPE_BTREE )
+	else if( inode->fork_type == LIBFSXFS_FORK_TYPE_EXTENTS )
 	{
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libcnotify_verbose != 0 )
 		{
 			libcnotify_printf(
-			 "%s: data extent B+ tree:\n",
+			 "%s: data extent list:\n",
 			 function );
 			libcnotify_print_data(
 			 &( inode->data[ inode->data_fork_offset ] ),
@@ -1069,51 +1380,60 @@ int libfsxfs_inode_read_file_io_handle(
 
 			goto on_error;
 		}
-		if( libfsxfs_extent_btree_initialize(
-		     &extent_btree,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create data extents B+ tree.",
-			 function );
-
-			goto on_error;
-		}
-		if( libfsxfs_extent_btree_get_extents_from_root_node(
-		     extent_btree,
-		     io_handle,
-		     file_io_handle,
+		if( libfsxfs_extent_list_read_data(
+		     inode->data_extents_array,
 		     number_of_blocks,
+		     inode->number_of_data_extents,
 		     &( inode->data[ inode->data_fork_offset ] ),
 		     inode->data_fork_size,
-		     inode->data_extents_array,
 		     add_sparse_extents,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve data extents from extent B+ tree.",
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read data extent list.",
 			 function );
 
 			goto on_error;
 		}
-		if( libfsxfs_extent_btree_free(
-		     &extent_btree,
-		     error ) != 1 )
+	}
+	else if( inode->fork_type == LIBFSXFS_FORK_TYPE_BTREE )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free data extents B+ tree.",
+			libcnotify_printf(
+			 "%s: data extent B+ tree:\n",
 			 function );
+			libcnotify_print_data(
+			 &( inode->data[ inode->data_fork_offset ] ),
+			 (size_t) inode->data_fork_size,
+			 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
+		}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
 
-			goto on_error;
+		/* The data extents B+ tree of a directory is needed to read the directory entries,
+		 * for other file types it is read on demand by libfsxfs_inode_read_data_extents
+		 */
+		if( ( inode->file_mode & 0xf000 ) == LIBFSXFS_FILE_TYPE_DIRECTORY )
+		{
+			if( libfsxfs_inode_read_data_extents_btree(
+			     inode,
+			     io_handle,
+			     file_io_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read data extents B+ tree.",
+				 function );
+
+				goto on_error;
+			}
 		}
 	}
 	if( inode->attributes_fork_size > 0 )
@@ -1280,6 +1600,241 @@ on_error:
 	return( -1 );
 }
 
+/* Reads the data extents B+ tree of the inode
+ * The caller is expected to hold the lock for writing, if any
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_inode_read_data_extents_btree(
+     libfsxfs_inode_t *inode,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	libcdata_array_t *data_extents_array  = NULL;
+	libfsxfs_extent_btree_t *extent_btree = NULL;
+	static char *function                 = "libfsxfs_inode_read_data_extents_btree";
+	uint64_t number_of_blocks             = 0;
+	uint8_t add_sparse_extents            = 0;
+
+	if( inode == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode.",
+		 function );
+
+		return( -1 );
+	}
+	if( inode->data_extents_array != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid inode - data extents array value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->block_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid IO handle - block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_blocks = inode->size / io_handle->block_size;
+
+	if( ( inode->size % io_handle->block_size ) != 0 )
+	{
+		number_of_blocks++;
+	}
+	if( ( inode->file_mode & 0xf000 ) != LIBFSXFS_FILE_TYPE_DIRECTORY )
+	{
+		add_sparse_extents = 1;
+	}
+	if( libcdata_array_initialize(
+	     &data_extents_array,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create data extents array.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsxfs_extent_btree_initialize(
+	     &extent_btree,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create data extents B+ tree.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsxfs_extent_btree_get_extents_from_root_node(
+	     extent_btree,
+	     io_handle,
+	     file_io_handle,
+	     number_of_blocks,
+	     &( inode->data[ inode->data_fork_offset ] ),
+	     inode->data_fork_size,
+	     data_extents_array,
+	     add_sparse_extents,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve data extents from extent B+ tree.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsxfs_extent_btree_free(
+	     &extent_btree,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free data extents B+ tree.",
+		 function );
+
+		goto on_error;
+	}
+	inode->data_extents_array = data_extents_array;
+
+	return( 1 );
+
+on_error:
+	if( extent_btree != NULL )
+	{
+		libfsxfs_extent_btree_free(
+		 &extent_btree,
+		 NULL );
+	}
+	if( data_extents_array != NULL )
+	{
+		libcdata_array_free(
+		 &data_extents_array,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libfsxfs_extent_free,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads the data extents of the inode if they were not read before
+ * The data extents B+ tree of a non-directory inode is not read by libfsxfs_inode_read_forks,
+ * this function must be called before the data extents are retrieved
+ * Returns 1 if the data extents were read, 0 if they were read before or are not stored in a B+ tree or -1 on error
+ */
+int libfsxfs_inode_read_data_extents(
+     libfsxfs_inode_t *inode,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_inode_read_data_extents";
+	int result            = 0;
+
+	if( inode == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode.",
+		 function );
+
+		return( -1 );
+	}
+	if( inode->fork_type != LIBFSXFS_FORK_TYPE_BTREE )
+	{
+		return( 0 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     inode->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( inode->data_extents_array == NULL )
+	{
+		if( libfsxfs_inode_read_data_extents_btree(
+		     inode,
+		     io_handle,
+		     file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read data extents B+ tree.",
+			 function );
+
+			result = -1;
+		}
+		else
+		{
+			result = 1;
+		}
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     inode->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
 /* Retrieves the creation time
  * The timestamp is a signed 64-bit POSIX date and time value in number of nano seconds
  * Returns 1 if successful, 0 if not available or -1 on error
@@ -1874,3 +2429,80 @@ int libfsxfs_inode_get_attributes_extent_by_index(
 	return( 1 );
 }
 
+/* Retrieves the (estimated) memory size of the inode
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_inode_get_memory_size(
+     libfsxfs_inode_t *inode,
+     size_t *memory_size,
+     libcerror_error_t **error )
+{
+	static char *function   = "libfsxfs_inode_get_memory_size";
+	size_t safe_memory_size = 0;
+	int number_of_extents   = 0;
+
+	if( inode == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory size.",
+		 function );
+
+		return( -1 );
+	}
+	safe_memory_size = sizeof( libfsxfs_inode_t ) + inode->data_size;
+
+	if( inode->data_extents_array != NULL )
+	{
+		if( libcdata_array_get_number_of_entries(
+		     inode->data_extents_array,
+		     &number_of_extents,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of data extents.",
+			 function );
+
+			return( -1 );
+		}
+		safe_memory_size += (size_t) number_of_extents * ( sizeof( libfsxfs_extent_t ) + sizeof( intptr_t * ) );
+	}
+	if( inode->attributes_extents_array != NULL )
+	{
+		if( libcdata_array_get_number_of_entries(
+		     inode->attributes_extents_array,
+		     &number_of_extents,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of attributes extents.",
+			 function );
+
+			return( -1 );
+		}
+		safe_memory_size += (size_t) number_of_extents * ( sizeof( libfsxfs_extent_t ) + sizeof( intptr_t * ) );
+	}
+	*memory_size = safe_memory_size;
+
+	return( 1 );
+}
+
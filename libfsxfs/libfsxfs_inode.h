@@ -30,6 +30,7 @@
 #include "libfsxfs_libbfio.h"
 #include "libfsxfs_libcdata.h"
 #include "libfsxfs_libcerror.h"
+#include "libfsxfs_libcthreads.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -138,6 +139,16 @@ struct libfsxfs_inode
 	/* (Extended) attributes fork size
 	 */
 	uint16_t attributes_fork_size;
+
+	/* The reference count
+	 */
+	int reference_count;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
 };
 
 int libfsxfs_inode_initialize(
@@ -149,6 +160,10 @@ int libfsxfs_inode_free(
      libfsxfs_inode_t **inode,
      libcerror_error_t **error );
 
+int libfsxfs_inode_increment_reference_count(
+     libfsxfs_inode_t *inode,
+     libcerror_error_t **error );
+
 int libfsxfs_inode_read_data(
      libfsxfs_inode_t *inode,
      const uint8_t *data,
@@ -162,6 +177,32 @@ int libfsxfs_inode_read_file_io_handle(
      off64_t file_offset,
      libcerror_error_t **error );
 
+int libfsxfs_inode_read_buffer(
+     libfsxfs_inode_t *inode,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     libcerror_error_t **error );
+
+int libfsxfs_inode_read_forks(
+     libfsxfs_inode_t *inode,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+int libfsxfs_inode_read_data_extents_btree(
+     libfsxfs_inode_t *inode,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+int libfsxfs_inode_read_data_extents(
+     libfsxfs_inode_t *inode,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
 int libfsxfs_inode_get_creation_time(
      libfsxfs_inode_t *inode,
      int64_t *posix_time,
@@ -240,6 +281,11 @@ int libfsxfs_inode_get_attributes_extent_by_index(
      libfsxfs_extent_t **extent,
      libcerror_error_t **error );
 
+int libfsxfs_inode_get_memory_size(
+     libfsxfs_inode_t *inode,
+     size_t *memory_size,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
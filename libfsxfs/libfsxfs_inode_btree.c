@@ -29,11 +29,15 @@
 #include "libfsxfs_definitions.h"
 #include "libfsxfs_inode_btree.h"
 #include "libfsxfs_inode_btree_record.h"
+#include "libfsxfs_inode_chunk_index.h"
 #include "libfsxfs_inode_information.h"
 #include "libfsxfs_libbfio.h"
 #include "libfsxfs_libcdata.h"
 #include "libfsxfs_libcerror.h"
 #include "libfsxfs_libcnotify.h"
+#include "libfsxfs_libcthreads.h"
+
+#include "fsxfs_btree.h"
 
 /* Creates an inode B+ tree
  * Make sure the value inode_btree is referencing, is set to NULL
@@ -114,11 +118,56 @@ int libfsxfs_inode_btree_initialize(
 
 		goto on_error;
 	}
+	if( libcdata_array_initialize(
+	     &( ( *inode_btree )->inode_chunk_index_array ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create inode chunk index array.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( ( *inode_btree )->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	( *inode_btree )->use_inode_chunk_index = 1;
+
 	return( 1 );
 
 on_error:
 	if( *inode_btree != NULL )
 	{
+		if( ( *inode_btree )->inode_chunk_index_array != NULL )
+		{
+			libcdata_array_free(
+			 &( ( *inode_btree )->inode_chunk_index_array ),
+			 NULL,
+			 NULL );
+		}
+		if( ( *inode_btree )->inode_information_array != NULL )
+		{
+			libcdata_array_free(
+			 &( ( *inode_btree )->inode_information_array ),
+			 NULL,
+			 NULL );
+		}
 		memory_free(
 		 *inode_btree );
 
@@ -164,6 +213,35 @@ int libfsxfs_inode_btree_free(
 
 			result = -1;
 		}
+		if( libcdata_array_free(
+		     &( ( *inode_btree )->inode_chunk_index_array ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libfsxfs_inode_chunk_index_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free inode chunk index array.",
+			 function );
+
+			result = -1;
+		}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( ( *inode_btree )->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+#endif
 		memory_free(
 		 *inode_btree );
 
@@ -172,19 +250,16 @@ int libfsxfs_inode_btree_free(
 	return( result );
 }
 
-/* Reads the inode information
+/* Sets the number of allocation groups
+ * The inode information and inode chunk index of an allocation group are read on first use
  * Returns 1 if successful or -1 on error
  */
-int libfsxfs_inode_btree_read_inode_information(
+int libfsxfs_inode_btree_set_number_of_allocation_groups(
      libfsxfs_inode_btree_t *inode_btree,
-     libfsxfs_io_handle_t *io_handle,
-     libbfio_handle_t *file_io_handle,
-     off64_t file_offset,
+     uint32_t number_of_allocation_groups,
      libcerror_error_t **error )
 {
-	libfsxfs_inode_information_t *inode_information = NULL;
-	static char *function                           = "libfsxfs_file_system_read_inode_information";
-	int entry_index                                 = 0;
+	static char *function = "libfsxfs_inode_btree_set_number_of_allocation_groups";
 
 	if( inode_btree == NULL )
 	{
@@ -197,86 +272,68 @@ int libfsxfs_inode_btree_read_inode_information(
 
 		return( -1 );
 	}
-	if( libfsxfs_inode_information_initialize(
-	     &inode_information,
-	     error ) != 1 )
+	if( ( number_of_allocation_groups == 0 )
+	 || ( number_of_allocation_groups > (uint32_t) INT_MAX ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create inode information.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of allocation groups value out of bounds.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libfsxfs_inode_information_read_file_io_handle(
-	     inode_information,
-	     io_handle,
-	     file_io_handle,
-	     file_offset,
+	if( libcdata_array_resize(
+	     inode_btree->inode_information_array,
+	     (int) number_of_allocation_groups,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libfsxfs_inode_information_free,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read inode information at offset: %" PRIi64 " (0x%08" PRIx64 ").",
-		 function,
-		 file_offset,
-		 file_offset );
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize inode information array.",
+		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libcdata_array_append_entry(
-	     inode_btree->inode_information_array,
-	     &entry_index,
-	     (intptr_t *) inode_information,
+	if( libcdata_array_resize(
+	     inode_btree->inode_chunk_index_array,
+	     (int) number_of_allocation_groups,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libfsxfs_inode_chunk_index_free,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-		 "%s: unable to append inode information to array.",
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize inode chunk index array.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
 	return( 1 );
-
-on_error:
-	if( inode_information != NULL )
-	{
-		libfsxfs_inode_information_free(
-		 &inode_information,
-		 NULL );
-	}
-	return( -1 );
 }
 
-/* Retrieves the inode from the inode B+ tree branch node
+/* Retrieves the inode information of a specific allocation group
+ * The inode information is read from the allocation group on first use
  * Returns 1 if successful or -1 on error
  */
-int libfsxfs_inode_btree_get_inode_from_branch_node(
+int libfsxfs_inode_btree_get_inode_information(
      libfsxfs_inode_btree_t *inode_btree,
      libfsxfs_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
-     uint64_t allocation_group_block_number,
-     uint16_t number_of_records,
-     const uint8_t *records_data,
-     size_t records_data_size,
-     uint64_t relative_inode_number,
-     int recursion_depth,
+     int allocation_group_index,
+     libfsxfs_inode_information_t **inode_information,
      libcerror_error_t **error )
 {
-	static char *function              = "libfsxfs_inode_btree_get_inode_from_branch_node";
-	size_t number_of_key_value_pairs   = 0;
-	size_t records_data_offset         = 0;
-	uint32_t relative_key_inode_number = 0;
-	uint32_t relative_sub_block_number = 0;
-	uint16_t record_index              = 0;
-	int result                         = 0;
+	libfsxfs_inode_information_t *existing_inode_information = NULL;
+	libfsxfs_inode_information_t *safe_inode_information     = NULL;
+	static char *function                                    = "libfsxfs_inode_btree_get_inode_information";
+	off64_t file_offset                                      = 0;
+	int result                                               = 1;
 
 	if( inode_btree == NULL )
 	{
@@ -289,285 +346,421 @@ int libfsxfs_inode_btree_get_inode_from_branch_node(
 
 		return( -1 );
 	}
-	if( records_data == NULL )
+	if( io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid records data.",
+		 "%s: invalid IO handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( records_data_size == 0 )
-	 || ( records_data_size > (size_t) SSIZE_MAX ) )
+	if( inode_information == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid records data size value out of bounds.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode information.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( recursion_depth < 0 )
-	 || ( recursion_depth > LIBFSXFS_MAXIMUM_RECURSION_DEPTH ) )
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     inode_btree->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid recursion depth value out of bounds.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
-	number_of_key_value_pairs = records_data_size / 8;
+#endif
+	if( libcdata_array_get_entry_by_index(
+	     inode_btree->inode_information_array,
+	     allocation_group_index,
+	     (intptr_t **) &existing_inode_information,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve inode information: %d.",
+		 function,
+		 allocation_group_index );
 
-	if( (size_t) number_of_records > number_of_key_value_pairs )
+		result = -1;
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     inode_btree->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid number of records value out of bounds.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
-	for( record_index = 0;
-	     record_index < number_of_records;
-	     record_index++ )
-	{
-		byte_stream_copy_to_uint32_big_endian(
-		 &( records_data[ records_data_offset ] ),
-		 relative_key_inode_number );
-
-		records_data_offset += 4;
-
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "%s: inode number\t\t: %" PRIu32 "\n",
-			 function,
-			 relative_key_inode_number );
-		}
 #endif
-		if( relative_inode_number < relative_key_inode_number )
-		{
-			break;
-		}
+	if( result != 1 )
+	{
+		return( -1 );
 	}
-	if( ( record_index > 0 )
-	 && ( record_index <= number_of_records ) )
+	if( existing_inode_information != NULL )
 	{
-		records_data_offset = ( number_of_key_value_pairs + record_index - 1 ) * 4;
-
-		byte_stream_copy_to_uint32_big_endian(
-		 &( records_data[ records_data_offset ] ),
-		 relative_sub_block_number );
-
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "%s: sub block number\t: %" PRIu32 "\n",
-			 function,
-			 relative_sub_block_number );
-
-			libcnotify_printf(
-			 "\n" );
-		}
-#endif
-		result = libfsxfs_inode_btree_get_inode_from_node(
-		          inode_btree,
-		          io_handle,
-		          file_io_handle,
-		          allocation_group_block_number,
-		          relative_sub_block_number,
-		          relative_inode_number,
-		          recursion_depth + 1,
-		          error );
-
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve inode from node.",
-			 function );
+		*inode_information = existing_inode_information;
 
-			return( -1 );
-		}
+		return( 1 );
 	}
+	/* The inode information (AGI) is stored in the third sector of the allocation group
+	 */
+	file_offset = ( (off64_t) allocation_group_index * io_handle->allocation_group_size * io_handle->block_size )
+	            + ( 2 * (off64_t) io_handle->sector_size );
+
 #if defined( HAVE_DEBUG_OUTPUT )
-	else if( libcnotify_verbose != 0 )
+	if( libcnotify_verbose != 0 )
 	{
 		libcnotify_printf(
-		 "\n" );
+		 "Reading inode information: %d at offset: %" PRIi64 " (0x%08" PRIx64 ").\n",
+		 allocation_group_index,
+		 file_offset,
+		 file_offset );
 	}
 #endif
-	return( result );
-}
-
-/* Retrieves the inode from the inode B+ tree leaf node
- * Returns 1 if successful or -1 on error
- */
-int libfsxfs_inode_btree_get_inode_from_leaf_node(
-     libfsxfs_inode_btree_t *inode_btree,
-     uint16_t number_of_records,
-     const uint8_t *records_data,
-     size_t records_data_size,
-     uint64_t inode_number,
-     libcerror_error_t **error )
-{
-	libfsxfs_inode_btree_record_t *inode_btree_record = NULL;
-	static char *function                             = "libfsxfs_inode_btree_get_inode_from_leaf_node";
-	size_t records_data_offset                        = 0;
-	uint16_t record_index                             = 0;
-	int result                                        = 0;
-
-	if( inode_btree == NULL )
+	if( libfsxfs_inode_information_initialize(
+	     &safe_inode_information,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid inode B+ tree.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create inode information.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( records_data == NULL )
+	if( libfsxfs_inode_information_read_file_io_handle(
+	     safe_inode_information,
+	     io_handle,
+	     file_io_handle,
+	     file_offset,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid records data.",
-		 function );
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read inode information: %d at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 allocation_group_index,
+		 file_offset,
+		 file_offset );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( ( records_data_size == 0 )
-	 || ( records_data_size > (size_t) SSIZE_MAX ) )
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     inode_btree->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid records data size value out of bounds.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( (size_t) number_of_records > ( records_data_size / 16 ) )
+#endif
+	/* Another thread could have read the inode information in the meantime
+	 */
+	if( libcdata_array_get_entry_by_index(
+	     inode_btree->inode_information_array,
+	     allocation_group_index,
+	     (intptr_t **) &existing_inode_information,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid number of records value out of bounds.",
-		 function );
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve inode information: %d.",
+		 function,
+		 allocation_group_index );
 
-		return( -1 );
+		result = -1;
 	}
-	for( record_index = 0;
-	     record_index < number_of_records;
-	     record_index++ )
+	else if( existing_inode_information == NULL )
 	{
-		if( libfsxfs_inode_btree_record_initialize(
-		     &inode_btree_record,
+		if( libcdata_array_set_entry_by_index(
+		     inode_btree->inode_information_array,
+		     allocation_group_index,
+		     (intptr_t *) safe_inode_information,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create inode B+ tree record: %" PRIu16 ".",
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set inode information: %d.",
 			 function,
-			 record_index );
+			 allocation_group_index );
 
-			goto on_error;
+			result = -1;
+		}
+		else
+		{
+			existing_inode_information = safe_inode_information;
+			safe_inode_information     = NULL;
 		}
-		if( libfsxfs_inode_btree_record_read_data(
-		     inode_btree_record,
-		     &( records_data[ records_data_offset ] ),
-		     16,
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     inode_btree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	if( result != 1 )
+	{
+		goto on_error;
+	}
+	if( safe_inode_information != NULL )
+	{
+		if( libfsxfs_inode_information_free(
+		     &safe_inode_information,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read inode B+ tree record: %" PRIu16 ".",
-			 function,
-			 record_index );
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free inode information.",
+			 function );
 
 			goto on_error;
 		}
-		records_data_offset += 16;
+	}
+	*inode_information = existing_inode_information;
+
+	return( 1 );
+
+on_error:
+	if( safe_inode_information != NULL )
+	{
+		libfsxfs_inode_information_free(
+		 &safe_inode_information,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads the inode information of a specific allocation group from data
+ * The inode information is not replaced if it was read before
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_inode_btree_read_inode_information_data(
+     libfsxfs_inode_btree_t *inode_btree,
+     libfsxfs_io_handle_t *io_handle,
+     int allocation_group_index,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libfsxfs_inode_information_t *existing_inode_information = NULL;
+	libfsxfs_inode_information_t *safe_inode_information     = NULL;
+	static char *function                                    = "libfsxfs_inode_btree_read_inode_information_data";
+	int result                                               = 1;
+
+	if( inode_btree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode B+ tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsxfs_inode_information_initialize(
+	     &safe_inode_information,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create inode information.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsxfs_inode_information_read_data(
+	     safe_inode_information,
+	     io_handle,
+	     data,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read inode information: %d.",
+		 function,
+		 allocation_group_index );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     inode_btree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	if( libcdata_array_get_entry_by_index(
+	     inode_btree->inode_information_array,
+	     allocation_group_index,
+	     (intptr_t **) &existing_inode_information,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve inode information: %d.",
+		 function,
+		 allocation_group_index );
+
+		result = -1;
+	}
+	else if( existing_inode_information == NULL )
+	{
+		if( libcdata_array_set_entry_by_index(
+		     inode_btree->inode_information_array,
+		     allocation_group_index,
+		     (intptr_t *) safe_inode_information,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set inode information: %d.",
+			 function,
+			 allocation_group_index );
 
-		if( ( inode_number >= inode_btree_record->inode_number )
-		 && ( inode_number < ( inode_btree_record->inode_number + 64 ) ) )
+			result = -1;
+		}
+		else
 		{
-/* TODO check bitmap */
-			result = 1;
+			safe_inode_information = NULL;
 		}
-/* TODO cache records in block */
-		if( libfsxfs_inode_btree_record_free(
-		     &inode_btree_record,
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     inode_btree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	if( result != 1 )
+	{
+		goto on_error;
+	}
+	if( safe_inode_information != NULL )
+	{
+		if( libfsxfs_inode_information_free(
+		     &safe_inode_information,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free inode B+ tree record: %" PRIu16 ".",
-			 function,
-			 record_index );
+			 "%s: unable to free inode information.",
+			 function );
 
 			goto on_error;
 		}
-		if( result != 0 )
-		{
-			break;
-		}
 	}
-	return( result );
+	return( 1 );
 
 on_error:
-	if( inode_btree_record != NULL )
+	if( safe_inode_information != NULL )
 	{
-		libfsxfs_inode_btree_record_free(
-		 &inode_btree_record,
+		libfsxfs_inode_information_free(
+		 &safe_inode_information,
 		 NULL );
 	}
 	return( -1 );
 }
 
-/* Retrieves the inode from the inode B+ tree node
- * Returns 1 if successful or -1 on error
+/* Retrieves the inode from the inode B+ tree branch node
+ * Returns 1 if successful, 0 if no such value or -1 on error
  */
-int libfsxfs_inode_btree_get_inode_from_node(
+int libfsxfs_inode_btree_get_inode_from_branch_node(
      libfsxfs_inode_btree_t *inode_btree,
      libfsxfs_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
      uint64_t allocation_group_block_number,
-     uint64_t relative_block_number,
+     uint16_t number_of_records,
+     const uint8_t *records_data,
+     size_t records_data_size,
      uint64_t relative_inode_number,
+     libfsxfs_inode_btree_record_t *inode_btree_record,
      int recursion_depth,
      libcerror_error_t **error )
 {
-	libfsxfs_btree_block_t *btree_block = NULL;
-	static char *function               = "libfsxfs_inode_btree_get_inode_from_node";
-	off64_t btree_block_offset          = 0;
-	int compare_result                  = 0;
-	int result                          = 0;
+	static char *function              = "libfsxfs_inode_btree_get_inode_from_branch_node";
+	size_t number_of_key_value_pairs   = 0;
+	size_t records_data_offset         = 0;
+	uint32_t relative_key_inode_number = 0;
+	uint32_t relative_sub_block_number = 0;
+	uint16_t lower_record_index        = 0;
+	uint16_t record_index              = 0;
+	uint16_t upper_record_index        = 0;
+	int result                         = 0;
 
 	if( inode_btree == NULL )
 	{
@@ -580,210 +773,1342 @@ int libfsxfs_inode_btree_get_inode_from_node(
 
 		return( -1 );
 	}
-	if( io_handle == NULL )
+	if( records_data == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid IO handle.",
+		 "%s: invalid records data.",
 		 function );
 
 		return( -1 );
 	}
-	if( io_handle->block_size == 0 )
+	if( ( records_data_size == 0 )
+	 || ( records_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid records data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( recursion_depth < 0 )
+	 || ( recursion_depth > LIBFSXFS_MAXIMUM_RECURSION_DEPTH ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid IO handle - block size value out of bounds.",
+		 "%s: invalid recursion depth value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	if( allocation_group_block_number > (uint64_t) ( INT64_MAX / io_handle->block_size ) )
+	number_of_key_value_pairs = records_data_size / 8;
+
+	if( (size_t) number_of_records > number_of_key_value_pairs )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of records value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* Find the number of keys that are less than or equal to the inode number
+	 * the last of these keys refers to the sub node that contains the inode
+	 */
+	lower_record_index = 0;
+	upper_record_index = number_of_records;
+
+	while( lower_record_index < upper_record_index )
+	{
+		record_index        = lower_record_index + ( ( upper_record_index - lower_record_index ) / 2 );
+		records_data_offset = (size_t) record_index * 4;
+
+		byte_stream_copy_to_uint32_big_endian(
+		 &( records_data[ records_data_offset ] ),
+		 relative_key_inode_number );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: inode number\t\t: %" PRIu32 "\n",
+			 function,
+			 relative_key_inode_number );
+		}
+#endif
+		if( relative_inode_number < relative_key_inode_number )
+		{
+			upper_record_index = record_index;
+		}
+		else
+		{
+			lower_record_index = record_index + 1;
+		}
+	}
+	record_index = lower_record_index;
+
+	if( ( record_index > 0 )
+	 && ( record_index <= number_of_records ) )
+	{
+		records_data_offset = ( number_of_key_value_pairs + record_index - 1 ) * 4;
+
+		byte_stream_copy_to_uint32_big_endian(
+		 &( records_data[ records_data_offset ] ),
+		 relative_sub_block_number );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: sub block number\t: %" PRIu32 "\n",
+			 function,
+			 relative_sub_block_number );
+
+			libcnotify_printf(
+			 "\n" );
+		}
+#endif
+		result = libfsxfs_inode_btree_get_inode_from_node(
+		          inode_btree,
+		          io_handle,
+		          file_io_handle,
+		          allocation_group_block_number,
+		          relative_sub_block_number,
+		          relative_inode_number,
+		          inode_btree_record,
+		          recursion_depth + 1,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve inode from node.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	else if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the inode from the inode B+ tree leaf node
+ * Returns 1 if successful, 0 if no such value or -1 on error
+ */
+int libfsxfs_inode_btree_get_inode_from_leaf_node(
+     libfsxfs_inode_btree_t *inode_btree,
+     uint16_t number_of_records,
+     const uint8_t *records_data,
+     size_t records_data_size,
+     uint64_t inode_number,
+     libfsxfs_inode_btree_record_t *inode_btree_record,
+     libcerror_error_t **error )
+{
+	static char *function            = "libfsxfs_inode_btree_get_inode_from_leaf_node";
+	size_t records_data_offset       = 0;
+	uint64_t chunk_allocation_bitmap = 0;
+	uint32_t chunk_inode_number      = 0;
+	uint32_t number_of_unused_inodes = 0;
+	uint16_t lower_record_index      = 0;
+	uint16_t record_index            = 0;
+	uint16_t upper_record_index      = 0;
+
+	if( inode_btree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode B+ tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( records_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid records data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( records_data_size == 0 )
+	 || ( records_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid records data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size_t) number_of_records > ( records_data_size / 16 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of records value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* The records are stored in ascending order of their inode number
+	 * find the last record that starts at or before the inode number
+	 */
+	lower_record_index = 0;
+	upper_record_index = number_of_records;
+
+	while( lower_record_index < upper_record_index )
+	{
+		record_index        = lower_record_index + ( ( upper_record_index - lower_record_index ) / 2 );
+		records_data_offset = (size_t) record_index * sizeof( fsxfs_inode_btree_record_t );
+
+		byte_stream_copy_to_uint32_big_endian(
+		 ( (fsxfs_inode_btree_record_t *) &( records_data[ records_data_offset ] ) )->inode_number,
+		 chunk_inode_number );
+
+		if( inode_number < chunk_inode_number )
+		{
+			upper_record_index = record_index;
+		}
+		else
+		{
+			lower_record_index = record_index + 1;
+		}
+	}
+	if( lower_record_index == 0 )
+	{
+		return( 0 );
+	}
+	records_data_offset = (size_t) ( lower_record_index - 1 ) * sizeof( fsxfs_inode_btree_record_t );
+
+	byte_stream_copy_to_uint32_big_endian(
+	 ( (fsxfs_inode_btree_record_t *) &( records_data[ records_data_offset ] ) )->inode_number,
+	 chunk_inode_number );
+
+	byte_stream_copy_to_uint32_big_endian(
+	 ( (fsxfs_inode_btree_record_t *) &( records_data[ records_data_offset ] ) )->number_of_unused_inodes,
+	 number_of_unused_inodes );
+
+	byte_stream_copy_to_uint64_big_endian(
+	 ( (fsxfs_inode_btree_record_t *) &( records_data[ records_data_offset ] ) )->chunk_allocation_bitmap,
+	 chunk_allocation_bitmap );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: inode number\t\t\t: %" PRIu32 "\n",
+		 function,
+		 chunk_inode_number );
+
+		libcnotify_printf(
+		 "%s: number of unused inodes\t: %" PRIu32 "\n",
+		 function,
+		 number_of_unused_inodes );
+
+		libcnotify_printf(
+		 "%s: chunk allocation bitmap\t: 0x%08" PRIx64 "\n",
+		 function,
+		 chunk_allocation_bitmap );
+
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+	if( inode_number >= ( (uint64_t) chunk_inode_number + LIBFSXFS_INODE_CHUNK_NUMBER_OF_INODES ) )
+	{
+		return( 0 );
+	}
+	if( inode_btree_record != NULL )
+	{
+		inode_btree_record->inode_number            = chunk_inode_number;
+		inode_btree_record->number_of_unused_inodes = number_of_unused_inodes;
+		inode_btree_record->chunk_allocation_bitmap = chunk_allocation_bitmap;
+	}
+	return( 1 );
+}
+
+/* Retrieves the inode from the inode B+ tree node
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_inode_btree_get_inode_from_node(
+     libfsxfs_inode_btree_t *inode_btree,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint64_t allocation_group_block_number,
+     uint64_t relative_block_number,
+     uint64_t relative_inode_number,
+     libfsxfs_inode_btree_record_t *inode_btree_record,
+     int recursion_depth,
+     libcerror_error_t **error )
+{
+	libfsxfs_btree_block_t *btree_block = NULL;
+	static char *function               = "libfsxfs_inode_btree_get_inode_from_node";
+	off64_t btree_block_offset          = 0;
+	int compare_result                  = 0;
+	int result                          = 0;
+
+	if( inode_btree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode B+ tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->block_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid IO handle - block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( allocation_group_block_number > (uint64_t) ( INT64_MAX / io_handle->block_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid allocation group block number value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( relative_block_number > ( (uint64_t) ( INT64_MAX / io_handle->block_size ) - allocation_group_block_number ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid relative block number value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	btree_block_offset = ( allocation_group_block_number + relative_block_number ) * io_handle->block_size;
+
+	if( libfsxfs_btree_block_initialize(
+	     &btree_block,
+	     io_handle->block_size,
+	     4,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create B+ tree block.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsxfs_btree_block_read_file_io_handle(
+	     btree_block,
+	     io_handle,
+	     file_io_handle,
+	     btree_block_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read inode B+ tree block: %" PRIu32 " at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 relative_block_number,
+		 btree_block_offset,
+		 btree_block_offset );
+
+		goto on_error;
+	}
+	if( io_handle->format_version == 5 )
+	{
+		compare_result = memory_compare(
+		                  btree_block->header->signature,
+		                  "IAB3",
+		                  4 );
+	}
+	else
+	{
+		compare_result = memory_compare(
+		                  btree_block->header->signature,
+		                  "IABT",
+		                  4 );
+	}
+	if( compare_result != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported block signature.",
+		 function );
+
+		goto on_error;
+	}
+/* TODO
+	if( btree_block->header->level > inode_btree->maximum_depth )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported B+ tree node level.",
+		 function );
+
+		goto on_error;
+	}
+*/
+	if( btree_block->header->level == 0 )
+	{
+		result = libfsxfs_inode_btree_get_inode_from_leaf_node(
+		          inode_btree,
+		          btree_block->header->number_of_records,
+		          btree_block->records_data,
+		          btree_block->records_data_size,
+		          relative_inode_number,
+		          inode_btree_record,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve inode from leaf node.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else
+	{
+		result = libfsxfs_inode_btree_get_inode_from_branch_node(
+		          inode_btree,
+		          io_handle,
+		          file_io_handle,
+		          allocation_group_block_number,
+		          btree_block->header->number_of_records,
+		          btree_block->records_data,
+		          btree_block->records_data_size,
+		          relative_inode_number,
+		          inode_btree_record,
+		          recursion_depth,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve inode from branch node.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libfsxfs_btree_block_free(
+	     &btree_block,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free B+ tree block.",
+		 function );
+
+		goto on_error;
+	}
+	return( result );
+
+on_error:
+	if( btree_block != NULL )
+	{
+		libfsxfs_btree_block_free(
+		 &btree_block,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads the inode chunk index from the inode B+ tree branch node
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_inode_btree_read_inode_chunk_index_from_branch_node(
+     libfsxfs_inode_btree_t *inode_btree,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint64_t allocation_group_block_number,
+     uint16_t number_of_records,
+     const uint8_t *records_data,
+     size_t records_data_size,
+     libfsxfs_inode_chunk_index_t *inode_chunk_index,
+     int recursion_depth,
+     libcerror_error_t **error )
+{
+	static char *function              = "libfsxfs_inode_btree_read_inode_chunk_index_from_branch_node";
+	size_t number_of_key_value_pairs   = 0;
+	size_t records_data_offset         = 0;
+	uint32_t relative_sub_block_number = 0;
+	uint16_t record_index              = 0;
+
+	if( inode_btree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode B+ tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( records_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid records data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( records_data_size == 0 )
+	 || ( records_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid records data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( recursion_depth < 0 )
+	 || ( recursion_depth > LIBFSXFS_MAXIMUM_RECURSION_DEPTH ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid recursion depth value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_key_value_pairs = records_data_size / 8;
+
+	if( (size_t) number_of_records > number_of_key_value_pairs )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of records value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* The sub nodes are read in key order so the chunks are appended in ascending order
+	 */
+	for( record_index = 0;
+	     record_index < number_of_records;
+	     record_index++ )
+	{
+		records_data_offset = ( number_of_key_value_pairs + record_index ) * 4;
+
+		byte_stream_copy_to_uint32_big_endian(
+		 &( records_data[ records_data_offset ] ),
+		 relative_sub_block_number );
+
+		if( libfsxfs_inode_btree_read_inode_chunk_index_from_node(
+		     inode_btree,
+		     io_handle,
+		     file_io_handle,
+		     allocation_group_block_number,
+		     relative_sub_block_number,
+		     inode_chunk_index,
+		     recursion_depth + 1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read inode chunk index from node: %" PRIu32 ".",
+			 function,
+			 relative_sub_block_number );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Reads the inode chunk index from the inode B+ tree leaf node
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_inode_btree_read_inode_chunk_index_from_leaf_node(
+     libfsxfs_inode_btree_t *inode_btree,
+     uint16_t number_of_records,
+     const uint8_t *records_data,
+     size_t records_data_size,
+     libfsxfs_inode_chunk_index_t *inode_chunk_index,
+     libcerror_error_t **error )
+{
+	static char *function            = "libfsxfs_inode_btree_read_inode_chunk_index_from_leaf_node";
+	size_t records_data_offset       = 0;
+	uint64_t chunk_allocation_bitmap = 0;
+	uint32_t chunk_inode_number      = 0;
+	uint16_t record_index            = 0;
+
+	if( inode_btree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode B+ tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( records_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid records data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( records_data_size == 0 )
+	 || ( records_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid records data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size_t) number_of_records > ( records_data_size / sizeof( fsxfs_inode_btree_record_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of records value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	for( record_index = 0;
+	     record_index < number_of_records;
+	     record_index++ )
+	{
+		byte_stream_copy_to_uint32_big_endian(
+		 ( (fsxfs_inode_btree_record_t *) &( records_data[ records_data_offset ] ) )->inode_number,
+		 chunk_inode_number );
+
+		byte_stream_copy_to_uint64_big_endian(
+		 ( (fsxfs_inode_btree_record_t *) &( records_data[ records_data_offset ] ) )->chunk_allocation_bitmap,
+		 chunk_allocation_bitmap );
+
+		records_data_offset += sizeof( fsxfs_inode_btree_record_t );
+
+		if( libfsxfs_inode_chunk_index_append_chunk(
+		     inode_chunk_index,
+		     chunk_inode_number,
+		     chunk_allocation_bitmap,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append chunk: %" PRIu32 " to inode chunk index.",
+			 function,
+			 chunk_inode_number );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Reads the inode chunk index from the inode B+ tree node
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_inode_btree_read_inode_chunk_index_from_node(
+     libfsxfs_inode_btree_t *inode_btree,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint64_t allocation_group_block_number,
+     uint64_t relative_block_number,
+     libfsxfs_inode_chunk_index_t *inode_chunk_index,
+     int recursion_depth,
+     libcerror_error_t **error )
+{
+	libfsxfs_btree_block_t *btree_block = NULL;
+	static char *function               = "libfsxfs_inode_btree_read_inode_chunk_index_from_node";
+	off64_t btree_block_offset          = 0;
+	int compare_result                  = 0;
+	int result                          = 0;
+
+	if( inode_btree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode B+ tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->block_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid IO handle - block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( allocation_group_block_number > (uint64_t) ( INT64_MAX / io_handle->block_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid allocation group block number value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( relative_block_number > ( (uint64_t) ( INT64_MAX / io_handle->block_size ) - allocation_group_block_number ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid relative block number value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	btree_block_offset = ( allocation_group_block_number + relative_block_number ) * io_handle->block_size;
+
+	if( libfsxfs_btree_block_initialize(
+	     &btree_block,
+	     io_handle->block_size,
+	     4,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create B+ tree block.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsxfs_btree_block_read_file_io_handle(
+	     btree_block,
+	     io_handle,
+	     file_io_handle,
+	     btree_block_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read inode B+ tree block: %" PRIu64 " at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 relative_block_number,
+		 btree_block_offset,
+		 btree_block_offset );
+
+		goto on_error;
+	}
+	if( io_handle->format_version == 5 )
+	{
+		compare_result = memory_compare(
+		                  btree_block->header->signature,
+		                  "IAB3",
+		                  4 );
+	}
+	else
+	{
+		compare_result = memory_compare(
+		                  btree_block->header->signature,
+		                  "IABT",
+		                  4 );
+	}
+	if( compare_result != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported block signature.",
+		 function );
+
+		goto on_error;
+	}
+	if( btree_block->header->level == 0 )
+	{
+		result = libfsxfs_inode_btree_read_inode_chunk_index_from_leaf_node(
+		          inode_btree,
+		          btree_block->header->number_of_records,
+		          btree_block->records_data,
+		          btree_block->records_data_size,
+		          inode_chunk_index,
+		          error );
+	}
+	else
+	{
+		result = libfsxfs_inode_btree_read_inode_chunk_index_from_branch_node(
+		          inode_btree,
+		          io_handle,
+		          file_io_handle,
+		          allocation_group_block_number,
+		          btree_block->header->number_of_records,
+		          btree_block->records_data,
+		          btree_block->records_data_size,
+		          inode_chunk_index,
+		          recursion_depth,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read inode chunk index from node.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsxfs_btree_block_free(
+	     &btree_block,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free B+ tree block.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( btree_block != NULL )
+	{
+		libfsxfs_btree_block_free(
+		 &btree_block,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the inode chunk index of a specific allocation group
+ * The inode chunk index is read from the inode B+ tree on first use
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_inode_btree_get_inode_chunk_index(
+     libfsxfs_inode_btree_t *inode_btree,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     int allocation_group_index,
+     libfsxfs_inode_chunk_index_t **inode_chunk_index,
+     libcerror_error_t **error )
+{
+	libfsxfs_inode_chunk_index_t *existing_inode_chunk_index = NULL;
+	libfsxfs_inode_chunk_index_t *safe_inode_chunk_index     = NULL;
+	libfsxfs_inode_information_t *inode_information          = NULL;
+	static char *function                                    = "libfsxfs_inode_btree_get_inode_chunk_index";
+	uint64_t allocation_group_block_number                   = 0;
+	int result                                               = 1;
+
+	if( inode_btree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode B+ tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( inode_chunk_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode chunk index.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     inode_btree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libcdata_array_get_entry_by_index(
+	     inode_btree->inode_chunk_index_array,
+	     allocation_group_index,
+	     (intptr_t **) &existing_inode_chunk_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve inode chunk index: %d.",
+		 function,
+		 allocation_group_index );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     inode_btree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( result != 1 )
+	{
+		return( -1 );
+	}
+	if( existing_inode_chunk_index != NULL )
+	{
+		*inode_chunk_index = existing_inode_chunk_index;
+
+		return( 1 );
+	}
+	if( libfsxfs_inode_btree_get_inode_information(
+	     inode_btree,
+	     io_handle,
+	     file_io_handle,
+	     allocation_group_index,
+	     &inode_information,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve inode information: %d.",
+		 function,
+		 allocation_group_index );
+
+		goto on_error;
+	}
+	allocation_group_block_number = (uint64_t) allocation_group_index * io_handle->allocation_group_size;
+
+	if( libfsxfs_inode_chunk_index_initialize(
+	     &safe_inode_chunk_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create inode chunk index.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsxfs_inode_btree_read_inode_chunk_index_from_node(
+	     inode_btree,
+	     io_handle,
+	     file_io_handle,
+	     allocation_group_block_number,
+	     inode_information->inode_btree_root_block_number,
+	     safe_inode_chunk_index,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read inode chunk index from root node: %" PRIu32 ".",
+		 function,
+		 inode_information->inode_btree_root_block_number );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     inode_btree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	/* Another thread could have built the inode chunk index in the meantime
+	 */
+	if( libcdata_array_get_entry_by_index(
+	     inode_btree->inode_chunk_index_array,
+	     allocation_group_index,
+	     (intptr_t **) &existing_inode_chunk_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve inode chunk index: %d.",
+		 function,
+		 allocation_group_index );
+
+		result = -1;
+	}
+	else if( existing_inode_chunk_index == NULL )
+	{
+		if( libcdata_array_set_entry_by_index(
+		     inode_btree->inode_chunk_index_array,
+		     allocation_group_index,
+		     (intptr_t *) safe_inode_chunk_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set inode chunk index: %d.",
+			 function,
+			 allocation_group_index );
+
+			result = -1;
+		}
+		else
+		{
+			existing_inode_chunk_index = safe_inode_chunk_index;
+			safe_inode_chunk_index     = NULL;
+		}
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     inode_btree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	if( result != 1 )
+	{
+		goto on_error;
+	}
+	if( safe_inode_chunk_index != NULL )
+	{
+		if( libfsxfs_inode_chunk_index_free(
+		     &safe_inode_chunk_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free inode chunk index.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	*inode_chunk_index = existing_inode_chunk_index;
+
+	return( 1 );
+
+on_error:
+	if( safe_inode_chunk_index != NULL )
+	{
+		libfsxfs_inode_chunk_index_free(
+		 &safe_inode_chunk_index,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads the inode information and inode chunk index of a specific allocation group
+ * The values are read from the file IO handle and are not stored in the inode B+ tree,
+ * this is used to verify the metadata of the allocation group
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_inode_btree_read_allocation_group(
+     libfsxfs_inode_btree_t *inode_btree,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     int allocation_group_index,
+     libfsxfs_inode_information_t *inode_information,
+     libfsxfs_inode_chunk_index_t *inode_chunk_index,
+     libcerror_error_t **error )
+{
+	static char *function                  = "libfsxfs_inode_btree_read_allocation_group";
+	off64_t file_offset                    = 0;
+	uint64_t allocation_group_block_number = 0;
+
+	if( inode_btree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode B+ tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid allocation group block number value out of bounds.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( relative_block_number > ( (uint64_t) ( INT64_MAX / io_handle->block_size ) - allocation_group_block_number ) )
+	if( ( io_handle->allocation_group_size == 0 )
+	 || ( io_handle->block_size == 0 ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid relative block number value out of bounds.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid IO handle - allocation group size or block size value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	btree_block_offset = ( allocation_group_block_number + relative_block_number ) * io_handle->block_size;
-
-	if( libfsxfs_btree_block_initialize(
-	     &btree_block,
-	     io_handle->block_size,
-	     4,
-	     error ) != 1 )
+	if( ( allocation_group_index < 0 )
+	 || ( (uint64_t) allocation_group_index > ( (uint64_t) INT64_MAX / ( (uint64_t) io_handle->allocation_group_size * io_handle->block_size ) ) ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create B+ tree block.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid allocation group index value out of bounds.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libfsxfs_btree_block_read_file_io_handle(
-	     btree_block,
+	/* The inode information (AGI) is stored in the third sector of the allocation group
+	 */
+	file_offset = ( (off64_t) allocation_group_index * io_handle->allocation_group_size * io_handle->block_size )
+	            + ( 2 * (off64_t) io_handle->sector_size );
+
+	if( libfsxfs_inode_information_read_file_io_handle(
+	     inode_information,
 	     io_handle,
 	     file_io_handle,
-	     btree_block_offset,
+	     file_offset,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
 		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read inode B+ tree block: %" PRIu32 " at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 "%s: unable to read inode information: %d at offset: %" PRIi64 " (0x%08" PRIx64 ").",
 		 function,
-		 relative_block_number,
-		 btree_block_offset,
-		 btree_block_offset );
+		 allocation_group_index,
+		 file_offset,
+		 file_offset );
 
-		goto on_error;
-	}
-	if( io_handle->format_version == 5 )
-	{
-		compare_result = memory_compare(
-		                  btree_block->header->signature,
-		                  "IAB3",
-		                  4 );
-	}
-	else
-	{
-		compare_result = memory_compare(
-		                  btree_block->header->signature,
-		                  "IABT",
-		                  4 );
+		return( -1 );
 	}
-	if( compare_result != 0 )
+	if( ( inode_information->inode_btree_depth == 0 )
+	 || ( inode_information->inode_btree_depth > (uint32_t) LIBFSXFS_MAXIMUM_RECURSION_DEPTH ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported block signature.",
-		 function );
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid inode information: %d - inode B+ tree depth value out of bounds.",
+		 function,
+		 allocation_group_index );
 
-		goto on_error;
+		return( -1 );
 	}
-/* TODO
-	if( btree_block->header->level > inode_btree->maximum_depth )
+	if( inode_information->inode_btree_root_block_number >= io_handle->allocation_group_size )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported B+ tree node level.",
-		 function );
-
-		goto on_error;
-	}
-*/
-	if( btree_block->header->level == 0 )
-	{
-		result = libfsxfs_inode_btree_get_inode_from_leaf_node(
-		          inode_btree,
-		          btree_block->header->number_of_records,
-		          btree_block->records_data,
-		          btree_block->records_data_size,
-		          relative_inode_number,
-		          error );
-
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve inode from leaf node.",
-			 function );
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid inode information: %d - inode B+ tree root block number value out of bounds.",
+		 function,
+		 allocation_group_index );
 
-			goto on_error;
-		}
+		return( -1 );
 	}
-	else
-	{
-		result = libfsxfs_inode_btree_get_inode_from_branch_node(
-		          inode_btree,
-		          io_handle,
-		          file_io_handle,
-		          allocation_group_block_number,
-		          btree_block->header->number_of_records,
-		          btree_block->records_data,
-		          btree_block->records_data_size,
-		          relative_inode_number,
-		          recursion_depth,
-		          error );
-
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve inode from branch node.",
-			 function );
+	allocation_group_block_number = (uint64_t) allocation_group_index * io_handle->allocation_group_size;
 
-			goto on_error;
-		}
-	}
-	if( libfsxfs_btree_block_free(
-	     &btree_block,
+	if( libfsxfs_inode_btree_read_inode_chunk_index_from_node(
+	     inode_btree,
+	     io_handle,
+	     file_io_handle,
+	     allocation_group_block_number,
+	     inode_information->inode_btree_root_block_number,
+	     inode_chunk_index,
+	     0,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free B+ tree block.",
-		 function );
-
-		goto on_error;
-	}
-	return( result );
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read inode chunk index from root node: %" PRIu32 ".",
+		 function,
+		 inode_information->inode_btree_root_block_number );
 
-on_error:
-	if( btree_block != NULL )
-	{
-		libfsxfs_btree_block_free(
-		 &btree_block,
-		 NULL );
+		return( -1 );
 	}
-	return( -1 );
+	return( 1 );
 }
 
-/* Retrieves a specific inode from the inode B+ tree
+/* Retrieves the inode chunk that contains a specific inode from the inode B+ tree
+ * An inode chunk consists of 64 consecutively stored inodes
  * Returns 1 if successful, 0 if no such value or -1 on error
  */
-int libfsxfs_inode_btree_get_inode_by_number(
+int libfsxfs_inode_btree_get_inode_chunk_by_number(
      libfsxfs_inode_btree_t *inode_btree,
      libfsxfs_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
      uint64_t absolute_inode_number,
-     off64_t *file_offset,
+     off64_t *chunk_file_offset,
+     uint64_t *chunk_inode_number,
+     uint64_t *chunk_allocation_bitmap,
      libcerror_error_t **error )
 {
+	libfsxfs_inode_btree_record_t inode_btree_record;
+
+	libfsxfs_inode_chunk_index_t *inode_chunk_index = NULL;
 	libfsxfs_inode_information_t *inode_information = NULL;
-	static char *function                           = "libfsxfs_inode_btree_get_inode_by_number";
+	static char *function                           = "libfsxfs_inode_btree_get_inode_chunk_by_number";
 	uint64_t allocation_group_block_number          = 0;
 	uint64_t relative_inode_number                  = 0;
 	int allocation_group_index                      = 0;
@@ -833,13 +2158,35 @@ int libfsxfs_inode_btree_get_inode_by_number(
 
 		return( -1 );
 	}
-	if( file_offset == NULL )
+	if( chunk_file_offset == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file offset.",
+		 "%s: invalid chunk file offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_inode_number == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk inode number.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_allocation_bitmap == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk allocation bitmap.",
 		 function );
 
 		return( -1 );
@@ -865,10 +2212,12 @@ int libfsxfs_inode_btree_get_inode_by_number(
 	}
 #endif /* defined( HAVE_DEBUG_OUTPUT ) */
 
-	if( libcdata_array_get_entry_by_index(
-	     inode_btree->inode_information_array,
+	if( libfsxfs_inode_btree_get_inode_information(
+	     inode_btree,
+	     io_handle,
+	     file_io_handle,
 	     allocation_group_index,
-	     (intptr_t **) &inode_information,
+	     &inode_information,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -883,25 +2232,126 @@ int libfsxfs_inode_btree_get_inode_by_number(
 	}
 	allocation_group_block_number = (uint64_t) allocation_group_index * io_handle->allocation_group_size;
 
-	if( inode_information == NULL )
+	if( inode_btree->use_inode_chunk_index != 0 )
+	{
+		if( relative_inode_number > (uint64_t) UINT32_MAX )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid relative inode number value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		if( libfsxfs_inode_btree_get_inode_chunk_index(
+		     inode_btree,
+		     io_handle,
+		     file_io_handle,
+		     allocation_group_index,
+		     &inode_chunk_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve inode chunk index: %d.",
+			 function,
+			 allocation_group_index );
+
+			return( -1 );
+		}
+		result = libfsxfs_inode_chunk_index_get_chunk_by_inode_number(
+		          inode_chunk_index,
+		          (uint32_t) relative_inode_number,
+		          &( inode_btree_record.inode_number ),
+		          &( inode_btree_record.chunk_allocation_bitmap ),
+		          error );
+	}
+	else
+	{
+		result = libfsxfs_inode_btree_get_inode_from_node(
+		          inode_btree,
+		          io_handle,
+		          file_io_handle,
+		          allocation_group_block_number,
+		          inode_information->inode_btree_root_block_number,
+		          relative_inode_number,
+		          &inode_btree_record,
+		          0,
+		          error );
+	}
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: missing inode information.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve inode: %" PRIu64 " from root node: %" PRIu32 ".",
+		 function,
+		 relative_inode_number,
+		 inode_information->inode_btree_root_block_number );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		*chunk_file_offset       = ( (off64_t) allocation_group_block_number * io_handle->block_size ) + ( (off64_t) inode_btree_record.inode_number * io_handle->inode_size );
+		*chunk_inode_number      = ( (uint64_t) allocation_group_index << io_handle->number_of_relative_inode_number_bits ) | inode_btree_record.inode_number;
+		*chunk_allocation_bitmap = inode_btree_record.chunk_allocation_bitmap;
+	}
+	return( result );
+}
+
+/* Retrieves a specific inode from the inode B+ tree
+ * Returns 1 if successful, 0 if no such value or -1 on error
+ */
+int libfsxfs_inode_btree_get_inode_by_number(
+     libfsxfs_inode_btree_t *inode_btree,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint64_t absolute_inode_number,
+     off64_t *file_offset,
+     libcerror_error_t **error )
+{
+	static char *function            = "libfsxfs_inode_btree_get_inode_by_number";
+	off64_t chunk_file_offset        = 0;
+	uint64_t chunk_allocation_bitmap = 0;
+	uint64_t chunk_inode_number      = 0;
+	int result                       = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file offset.",
 		 function );
 
 		return( -1 );
 	}
-	result = libfsxfs_inode_btree_get_inode_from_node(
+	result = libfsxfs_inode_btree_get_inode_chunk_by_number(
 	          inode_btree,
 	          io_handle,
 	          file_io_handle,
-	          allocation_group_block_number,
-	          inode_information->inode_btree_root_block_number,
-	          relative_inode_number,
-	          0,
+	          absolute_inode_number,
+	          &chunk_file_offset,
+	          &chunk_inode_number,
+	          &chunk_allocation_bitmap,
 	          error );
 
 	if( result == -1 )
@@ -910,16 +2360,15 @@ int libfsxfs_inode_btree_get_inode_by_number(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve inode: %" PRIu64 " from root node: %" PRIu32 ".",
+		 "%s: unable to retrieve inode chunk of inode: %" PRIu64 ".",
 		 function,
-		 relative_inode_number,
-		 inode_information->inode_btree_root_block_number );
+		 absolute_inode_number );
 
 		return( -1 );
 	}
 	else if( result != 0 )
 	{
-		*file_offset = ( (off64_t) allocation_group_block_number * io_handle->block_size ) + ( (off64_t) relative_inode_number * io_handle->inode_size );
+		*file_offset = chunk_file_offset + ( (off64_t) ( absolute_inode_number - chunk_inode_number ) * io_handle->inode_size );
 	}
 	return( result );
 }
@@ -26,11 +26,13 @@
 #include <types.h>
 
 #include "libfsxfs_inode_btree_record.h"
+#include "libfsxfs_inode_chunk_index.h"
 #include "libfsxfs_inode_information.h"
 #include "libfsxfs_io_handle.h"
 #include "libfsxfs_libbfio.h"
 #include "libfsxfs_libcdata.h"
 #include "libfsxfs_libcerror.h"
+#include "libfsxfs_libcthreads.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -40,9 +42,23 @@ typedef struct libfsxfs_inode_btree libfsxfs_inode_btree_t;
 
 struct libfsxfs_inode_btree
 {
-	/* Inode information array
+	/* Inode information array, with a (lazy read) inode information per allocation group
 	 */
 	libcdata_array_t *inode_information_array;
+
+	/* Inode chunk index array, with an (lazy built) inode chunk index per allocation group
+	 */
+	libcdata_array_t *inode_chunk_index_array;
+
+	/* Value to indicate the inode chunk index should be used
+	 */
+	uint8_t use_inode_chunk_index;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
 };
 
 int libfsxfs_inode_btree_initialize(
@@ -53,11 +69,25 @@ int libfsxfs_inode_btree_free(
      libfsxfs_inode_btree_t **inode_btree,
      libcerror_error_t **error );
 
-int libfsxfs_inode_btree_read_inode_information(
+int libfsxfs_inode_btree_set_number_of_allocation_groups(
+     libfsxfs_inode_btree_t *inode_btree,
+     uint32_t number_of_allocation_groups,
+     libcerror_error_t **error );
+
+int libfsxfs_inode_btree_get_inode_information(
      libfsxfs_inode_btree_t *inode_btree,
      libfsxfs_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
-     off64_t file_offset,
+     int allocation_group_index,
+     libfsxfs_inode_information_t **inode_information,
+     libcerror_error_t **error );
+
+int libfsxfs_inode_btree_read_inode_information_data(
+     libfsxfs_inode_btree_t *inode_btree,
+     libfsxfs_io_handle_t *io_handle,
+     int allocation_group_index,
+     const uint8_t *data,
+     size_t data_size,
      libcerror_error_t **error );
 
 int libfsxfs_inode_btree_get_inode_from_branch_node(
@@ -69,6 +99,7 @@ int libfsxfs_inode_btree_get_inode_from_branch_node(
      const uint8_t *records_data,
      size_t records_data_size,
      uint64_t relative_inode_number,
+     libfsxfs_inode_btree_record_t *inode_btree_record,
      int recursion_depth,
      libcerror_error_t **error );
 
@@ -78,6 +109,7 @@ int libfsxfs_inode_btree_get_inode_from_leaf_node(
      const uint8_t *records_data,
      size_t records_data_size,
      uint64_t relative_inode_number,
+     libfsxfs_inode_btree_record_t *inode_btree_record,
      libcerror_error_t **error );
 
 int libfsxfs_inode_btree_get_inode_from_node(
@@ -87,9 +119,67 @@ int libfsxfs_inode_btree_get_inode_from_node(
      uint64_t allocation_group_block_number,
      uint64_t relative_block_number,
      uint64_t relative_inode_number,
+     libfsxfs_inode_btree_record_t *inode_btree_record,
+     int recursion_depth,
+     libcerror_error_t **error );
+
+int libfsxfs_inode_btree_read_inode_chunk_index_from_branch_node(
+     libfsxfs_inode_btree_t *inode_btree,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint64_t allocation_group_block_number,
+     uint16_t number_of_records,
+     const uint8_t *records_data,
+     size_t records_data_size,
+     libfsxfs_inode_chunk_index_t *inode_chunk_index,
+     int recursion_depth,
+     libcerror_error_t **error );
+
+int libfsxfs_inode_btree_read_inode_chunk_index_from_leaf_node(
+     libfsxfs_inode_btree_t *inode_btree,
+     uint16_t number_of_records,
+     const uint8_t *records_data,
+     size_t records_data_size,
+     libfsxfs_inode_chunk_index_t *inode_chunk_index,
+     libcerror_error_t **error );
+
+int libfsxfs_inode_btree_read_inode_chunk_index_from_node(
+     libfsxfs_inode_btree_t *inode_btree,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint64_t allocation_group_block_number,
+     uint64_t relative_block_number,
+     libfsxfs_inode_chunk_index_t *inode_chunk_index,
      int recursion_depth,
      libcerror_error_t **error );
 
+int libfsxfs_inode_btree_get_inode_chunk_index(
+     libfsxfs_inode_btree_t *inode_btree,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     int allocation_group_index,
+     libfsxfs_inode_chunk_index_t **inode_chunk_index,
+     libcerror_error_t **error );
+
+int libfsxfs_inode_btree_read_allocation_group(
+     libfsxfs_inode_btree_t *inode_btree,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     int allocation_group_index,
+     libfsxfs_inode_information_t *inode_information,
+     libfsxfs_inode_chunk_index_t *inode_chunk_index,
+     libcerror_error_t **error );
+
+int libfsxfs_inode_btree_get_inode_chunk_by_number(
+     libfsxfs_inode_btree_t *inode_btree,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint64_t absolute_inode_number,
+     off64_t *chunk_file_offset,
+     uint64_t *chunk_inode_number,
+     uint64_t *chunk_allocation_bitmap,
+     libcerror_error_t **error );
+
 int libfsxfs_inode_btree_get_inode_by_number(
      libfsxfs_inode_btree_t *inode_btree,
      libfsxfs_io_handle_t *io_handle,
@@ -0,0 +1,1173 @@
+/*
+ * Inode cache functions
+ *
+ * Copyright (C) 2020-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfsxfs_definitions.h"
+#include "libfsxfs_inode.h"
+#include "libfsxfs_inode_cache.h"
+#include "libfsxfs_libcerror.h"
+#include "libfsxfs_libcthreads.h"
+
+/* Creates an inode cache
+ * Make sure the value inode_cache is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_inode_cache_initialize(
+     libfsxfs_inode_cache_t **inode_cache,
+     size_t maximum_cache_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_inode_cache_initialize";
+	int shard_index       = 0;
+
+	if( inode_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *inode_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid inode cache value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_cache_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid maximum cache size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	*inode_cache = memory_allocate_structure(
+	                libfsxfs_inode_cache_t );
+
+	if( *inode_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create inode cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *inode_cache,
+	     0,
+	     sizeof( libfsxfs_inode_cache_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear inode cache.",
+		 function );
+
+		memory_free(
+		 *inode_cache );
+
+		*inode_cache = NULL;
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	for( shard_index = 0;
+	     shard_index < LIBFSXFS_INODE_CACHE_NUMBER_OF_SHARDS;
+	     shard_index++ )
+	{
+		if( libcthreads_read_write_lock_initialize(
+		     &( ( *inode_cache )->shards[ shard_index ].read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize shard: %d read/write lock.",
+			 function,
+			 shard_index );
+
+			goto on_error;
+		}
+	}
+#endif
+	/* The maximum cache size is divided over the shards, where the remainder
+	 * is assigned to the first shards so that the sum matches the maximum cache size
+	 */
+	for( shard_index = 0;
+	     shard_index < LIBFSXFS_INODE_CACHE_NUMBER_OF_SHARDS;
+	     shard_index++ )
+	{
+		( *inode_cache )->shards[ shard_index ].maximum_size = maximum_cache_size / LIBFSXFS_INODE_CACHE_NUMBER_OF_SHARDS;
+
+		if( (size_t) shard_index < ( maximum_cache_size % LIBFSXFS_INODE_CACHE_NUMBER_OF_SHARDS ) )
+		{
+			( *inode_cache )->shards[ shard_index ].maximum_size += 1;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( *inode_cache != NULL )
+	{
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+		for( shard_index = 0;
+		     shard_index < LIBFSXFS_INODE_CACHE_NUMBER_OF_SHARDS;
+		     shard_index++ )
+		{
+			if( ( *inode_cache )->shards[ shard_index ].read_write_lock != NULL )
+			{
+				libcthreads_read_write_lock_free(
+				 &( ( *inode_cache )->shards[ shard_index ].read_write_lock ),
+				 NULL );
+			}
+		}
+#endif
+		memory_free(
+		 *inode_cache );
+
+		*inode_cache = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an inode cache
+ * The references to the cached inodes are released
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_inode_cache_free(
+     libfsxfs_inode_cache_t **inode_cache,
+     libcerror_error_t **error )
+{
+	libfsxfs_inode_cache_shard_t *shard = NULL;
+	static char *function               = "libfsxfs_inode_cache_free";
+	int result                          = 1;
+	int shard_index                     = 0;
+
+	if( inode_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *inode_cache != NULL )
+	{
+		for( shard_index = 0;
+		     shard_index < LIBFSXFS_INODE_CACHE_NUMBER_OF_SHARDS;
+		     shard_index++ )
+		{
+			shard = &( ( *inode_cache )->shards[ shard_index ] );
+
+			while( shard->last_value != NULL )
+			{
+				if( libfsxfs_inode_cache_shard_remove_last_value(
+				     shard,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+					 "%s: unable to remove last value from shard: %d.",
+					 function,
+					 shard_index );
+
+					result = -1;
+
+					break;
+				}
+			}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+			if( libcthreads_read_write_lock_free(
+			     &( shard->read_write_lock ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free shard: %d read/write lock.",
+				 function,
+				 shard_index );
+
+				result = -1;
+			}
+#endif
+		}
+		memory_free(
+		 *inode_cache );
+
+		*inode_cache = NULL;
+	}
+	return( result );
+}
+
+/* Removes a specific value from a shard
+ * The caller is expected to hold the shard lock for writing
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_inode_cache_shard_remove_value(
+     libfsxfs_inode_cache_shard_t *shard,
+     libfsxfs_inode_cache_value_t *value,
+     libcerror_error_t **error )
+{
+	libfsxfs_inode_cache_value_t *bucket_value = NULL;
+	static char *function                      = "libfsxfs_inode_cache_shard_remove_value";
+	int bucket_index                           = 0;
+	int result                                 = 1;
+
+	if( shard == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid shard.",
+		 function );
+
+		return( -1 );
+	}
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	bucket_index = (int) ( ( value->inode_number / LIBFSXFS_INODE_CACHE_NUMBER_OF_SHARDS ) % LIBFSXFS_INODE_CACHE_NUMBER_OF_BUCKETS );
+
+	if( shard->buckets[ bucket_index ] == value )
+	{
+		shard->buckets[ bucket_index ] = value->next_bucket_value;
+	}
+	else
+	{
+		bucket_value = shard->buckets[ bucket_index ];
+
+		while( bucket_value != NULL )
+		{
+			if( bucket_value->next_bucket_value == value )
+			{
+				bucket_value->next_bucket_value = value->next_bucket_value;
+
+				break;
+			}
+			bucket_value = bucket_value->next_bucket_value;
+		}
+	}
+	if( value->previous_value != NULL )
+	{
+		value->previous_value->next_value = value->next_value;
+	}
+	else
+	{
+		shard->first_value = value->next_value;
+	}
+	if( value->next_value != NULL )
+	{
+		value->next_value->previous_value = value->previous_value;
+	}
+	else
+	{
+		shard->last_value = value->previous_value;
+	}
+	shard->current_size     -= value->inode_size;
+	shard->number_of_values -= 1;
+
+	if( libfsxfs_inode_free(
+	     &( value->inode ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free inode: %" PRIu64 ".",
+		 function,
+		 value->inode_number );
+
+		result = -1;
+	}
+	memory_free(
+	 value );
+
+	return( result );
+}
+
+/* Removes the least recently used value from a shard
+ * The caller is expected to hold the shard lock for writing
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_inode_cache_shard_remove_last_value(
+     libfsxfs_inode_cache_shard_t *shard,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_inode_cache_shard_remove_last_value";
+
+	if( shard == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid shard.",
+		 function );
+
+		return( -1 );
+	}
+	if( shard->last_value == NULL )
+	{
+		return( 1 );
+	}
+	if( libfsxfs_inode_cache_shard_remove_value(
+	     shard,
+	     shard->last_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+		 "%s: unable to remove last value.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the maximum (estimated) memory size of the cached inodes
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_inode_cache_get_maximum_cache_size(
+     libfsxfs_inode_cache_t *inode_cache,
+     size_t *maximum_cache_size,
+     libcerror_error_t **error )
+{
+	libfsxfs_inode_cache_shard_t *shard = NULL;
+	static char *function               = "libfsxfs_inode_cache_get_maximum_cache_size";
+	size_t safe_maximum_cache_size      = 0;
+	int shard_index                     = 0;
+
+	if( inode_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_cache_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid maximum cache size.",
+		 function );
+
+		return( -1 );
+	}
+	for( shard_index = 0;
+	     shard_index < LIBFSXFS_INODE_CACHE_NUMBER_OF_SHARDS;
+	     shard_index++ )
+	{
+		shard = &( inode_cache->shards[ shard_index ] );
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_grab_for_read(
+		     shard->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab shard: %d read/write lock for reading.",
+			 function,
+			 shard_index );
+
+			return( -1 );
+		}
+#endif
+		safe_maximum_cache_size += shard->maximum_size;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_release_for_read(
+		     shard->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release shard: %d read/write lock for reading.",
+			 function,
+			 shard_index );
+
+			return( -1 );
+		}
+#endif
+	}
+	*maximum_cache_size = safe_maximum_cache_size;
+
+	return( 1 );
+}
+
+/* Sets the maximum (estimated) memory size of the cached inodes
+ * Inodes are evicted when the cache exceeds the new maximum size
+ * A maximum size of 0 disables the cache
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_inode_cache_set_maximum_cache_size(
+     libfsxfs_inode_cache_t *inode_cache,
+     size_t maximum_cache_size,
+     libcerror_error_t **error )
+{
+	libfsxfs_inode_cache_shard_t *shard = NULL;
+	static char *function               = "libfsxfs_inode_cache_set_maximum_cache_size";
+	size_t maximum_shard_size           = 0;
+	int result                          = 1;
+	int shard_index                     = 0;
+
+	if( inode_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_cache_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid maximum cache size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	for( shard_index = 0;
+	     shard_index < LIBFSXFS_INODE_CACHE_NUMBER_OF_SHARDS;
+	     shard_index++ )
+	{
+		shard = &( inode_cache->shards[ shard_index ] );
+
+		maximum_shard_size = maximum_cache_size / LIBFSXFS_INODE_CACHE_NUMBER_OF_SHARDS;
+
+		if( (size_t) shard_index < ( maximum_cache_size % LIBFSXFS_INODE_CACHE_NUMBER_OF_SHARDS ) )
+		{
+			maximum_shard_size += 1;
+		}
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_grab_for_write(
+		     shard->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab shard: %d read/write lock for writing.",
+			 function,
+			 shard_index );
+
+			return( -1 );
+		}
+#endif
+		shard->maximum_size = maximum_shard_size;
+
+		while( ( shard->last_value != NULL )
+		    && ( shard->current_size > shard->maximum_size ) )
+		{
+			if( libfsxfs_inode_cache_shard_remove_last_value(
+			     shard,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+				 "%s: unable to remove last value from shard: %d.",
+				 function,
+				 shard_index );
+
+				result = -1;
+
+				break;
+			}
+		}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_release_for_write(
+		     shard->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release shard: %d read/write lock for writing.",
+			 function,
+			 shard_index );
+
+			return( -1 );
+		}
+#endif
+		if( result != 1 )
+		{
+			break;
+		}
+	}
+	return( result );
+}
+
+/* Retrieves the number of cached inodes
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_inode_cache_get_number_of_inodes(
+     libfsxfs_inode_cache_t *inode_cache,
+     int *number_of_inodes,
+     libcerror_error_t **error )
+{
+	libfsxfs_inode_cache_shard_t *shard = NULL;
+	static char *function               = "libfsxfs_inode_cache_get_number_of_inodes";
+	int safe_number_of_inodes           = 0;
+	int shard_index                     = 0;
+
+	if( inode_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_inodes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of inodes.",
+		 function );
+
+		return( -1 );
+	}
+	for( shard_index = 0;
+	     shard_index < LIBFSXFS_INODE_CACHE_NUMBER_OF_SHARDS;
+	     shard_index++ )
+	{
+		shard = &( inode_cache->shards[ shard_index ] );
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_grab_for_read(
+		     shard->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab shard: %d read/write lock for reading.",
+			 function,
+			 shard_index );
+
+			return( -1 );
+		}
+#endif
+		safe_number_of_inodes += shard->number_of_values;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_release_for_read(
+		     shard->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release shard: %d read/write lock for reading.",
+			 function,
+			 shard_index );
+
+			return( -1 );
+		}
+#endif
+	}
+	*number_of_inodes = safe_number_of_inodes;
+
+	return( 1 );
+}
+
+/* Retrieves a specific inode from the cache
+ * On success a new reference to the inode is returned, which must be
+ * released with libfsxfs_inode_free
+ * Returns 1 if successful, 0 if not cached or -1 on error
+ */
+int libfsxfs_inode_cache_get_inode_by_number(
+     libfsxfs_inode_cache_t *inode_cache,
+     uint64_t inode_number,
+     libfsxfs_inode_t **inode,
+     libcerror_error_t **error )
+{
+	libfsxfs_inode_cache_shard_t *shard = NULL;
+	libfsxfs_inode_cache_value_t *value = NULL;
+	static char *function               = "libfsxfs_inode_cache_get_inode_by_number";
+	int bucket_index                    = 0;
+	int result                          = 0;
+	int shard_index                     = 0;
+
+	if( inode_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( inode == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode.",
+		 function );
+
+		return( -1 );
+	}
+	/* The inodes are distributed over the shards by inode number, so that
+	 * neighbouring inodes, which are typically accessed together, do not
+	 * contend for the same shard lock
+	 */
+	shard_index  = (int) ( inode_number % LIBFSXFS_INODE_CACHE_NUMBER_OF_SHARDS );
+	bucket_index = (int) ( ( inode_number / LIBFSXFS_INODE_CACHE_NUMBER_OF_SHARDS ) % LIBFSXFS_INODE_CACHE_NUMBER_OF_BUCKETS );
+
+	shard = &( inode_cache->shards[ shard_index ] );
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     shard->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	value = shard->buckets[ bucket_index ];
+
+	while( value != NULL )
+	{
+		if( value->inode_number == inode_number )
+		{
+			break;
+		}
+		value = value->next_bucket_value;
+	}
+	if( value != NULL )
+	{
+		if( libfsxfs_inode_increment_reference_count(
+		     value->inode,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to increment inode: %" PRIu64 " reference count.",
+			 function,
+			 inode_number );
+
+			goto on_error;
+		}
+		/* Move the value to the front of the LRU list
+		 */
+		if( value != shard->first_value )
+		{
+			value->previous_value->next_value = value->next_value;
+
+			if( value->next_value != NULL )
+			{
+				value->next_value->previous_value = value->previous_value;
+			}
+			else
+			{
+				shard->last_value = value->previous_value;
+			}
+			value->previous_value = NULL;
+			value->next_value     = shard->first_value;
+
+			shard->first_value->previous_value = value;
+			shard->first_value                 = value;
+		}
+		*inode = value->inode;
+
+		result = 1;
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     shard->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		if( result == 1 )
+		{
+			libfsxfs_inode_free(
+			 inode,
+			 NULL );
+		}
+		return( -1 );
+	}
+#endif
+	return( result );
+
+on_error:
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_write(
+	 shard->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Inserts an inode into the cache
+ * The cache takes its own reference to the inode, the caller retains theirs
+ * Least recently used inodes are evicted when the shard exceeds its share
+ * of the maximum cache size
+ * Returns 1 if successful, 0 if not inserted or -1 on error
+ */
+int libfsxfs_inode_cache_insert_inode(
+     libfsxfs_inode_cache_t *inode_cache,
+     uint64_t inode_number,
+     libfsxfs_inode_t *inode,
+     libcerror_error_t **error )
+{
+	libfsxfs_inode_cache_shard_t *shard = NULL;
+	libfsxfs_inode_cache_value_t *value = NULL;
+	static char *function               = "libfsxfs_inode_cache_insert_inode";
+	size_t inode_size                   = 0;
+	int bucket_index                    = 0;
+	int result                          = 0;
+	int shard_index                     = 0;
+
+	if( inode_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( inode == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsxfs_inode_get_memory_size(
+	     inode,
+	     &inode_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve inode memory size.",
+		 function );
+
+		return( -1 );
+	}
+	inode_size += sizeof( libfsxfs_inode_cache_value_t );
+
+	shard_index  = (int) ( inode_number % LIBFSXFS_INODE_CACHE_NUMBER_OF_SHARDS );
+	bucket_index = (int) ( ( inode_number / LIBFSXFS_INODE_CACHE_NUMBER_OF_SHARDS ) % LIBFSXFS_INODE_CACHE_NUMBER_OF_BUCKETS );
+
+	shard = &( inode_cache->shards[ shard_index ] );
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     shard->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	value = shard->buckets[ bucket_index ];
+
+	while( value != NULL )
+	{
+		if( value->inode_number == inode_number )
+		{
+			break;
+		}
+		value = value->next_bucket_value;
+	}
+	/* Another thread might have inserted the same inode and an inode
+	 * that exceeds the maximum size of the shard is not cached
+	 */
+	if( ( value == NULL )
+	 && ( inode_size <= shard->maximum_size ) )
+	{
+		value = memory_allocate_structure(
+		         libfsxfs_inode_cache_value_t );
+
+		if( value == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create value.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     value,
+		     0,
+		     sizeof( libfsxfs_inode_cache_value_t ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear value.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfsxfs_inode_increment_reference_count(
+		     inode,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to increment inode: %" PRIu64 " reference count.",
+			 function,
+			 inode_number );
+
+			goto on_error;
+		}
+		value->inode_number      = inode_number;
+		value->inode             = inode;
+		value->inode_size        = inode_size;
+		value->next_bucket_value = shard->buckets[ bucket_index ];
+		value->next_value        = shard->first_value;
+
+		shard->buckets[ bucket_index ] = value;
+
+		if( shard->first_value != NULL )
+		{
+			shard->first_value->previous_value = value;
+		}
+		else
+		{
+			shard->last_value = value;
+		}
+		shard->first_value = value;
+
+		shard->current_size     += inode_size;
+		shard->number_of_values += 1;
+
+		value = NULL;
+
+		while( shard->current_size > shard->maximum_size )
+		{
+			if( libfsxfs_inode_cache_shard_remove_last_value(
+			     shard,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+				 "%s: unable to remove last value.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		result = 1;
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     shard->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+
+on_error:
+	if( value != NULL )
+	{
+		memory_free(
+		 value );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_write(
+	 shard->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Updates the (estimated) memory size of a cached inode
+ * This function must be called after data is added to an inode that was inserted in the cache,
+ * such as data extents that are read on demand, so that the maximum cache size is maintained
+ * The inode is evicted when it exceeds the maximum size of the shard
+ * Returns 1 if successful, 0 if not cached or -1 on error
+ */
+int libfsxfs_inode_cache_update_inode(
+     libfsxfs_inode_cache_t *inode_cache,
+     uint64_t inode_number,
+     libfsxfs_inode_t *inode,
+     libcerror_error_t **error )
+{
+	libfsxfs_inode_cache_shard_t *shard = NULL;
+	libfsxfs_inode_cache_value_t *value = NULL;
+	static char *function               = "libfsxfs_inode_cache_update_inode";
+	size_t inode_size                   = 0;
+	int bucket_index                    = 0;
+	int result                          = 0;
+	int shard_index                     = 0;
+
+	if( inode_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( inode == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsxfs_inode_get_memory_size(
+	     inode,
+	     &inode_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve inode memory size.",
+		 function );
+
+		return( -1 );
+	}
+	inode_size += sizeof( libfsxfs_inode_cache_value_t );
+
+	shard_index  = (int) ( inode_number % LIBFSXFS_INODE_CACHE_NUMBER_OF_SHARDS );
+	bucket_index = (int) ( ( inode_number / LIBFSXFS_INODE_CACHE_NUMBER_OF_SHARDS ) % LIBFSXFS_INODE_CACHE_NUMBER_OF_BUCKETS );
+
+	shard = &( inode_cache->shards[ shard_index ] );
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     shard->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	value = shard->buckets[ bucket_index ];
+
+	while( value != NULL )
+	{
+		if( value->inode_number == inode_number )
+		{
+			break;
+		}
+		value = value->next_bucket_value;
+	}
+	/* The cached inode might have been evicted and replaced by another instance
+	 */
+	if( ( value != NULL )
+	 && ( value->inode == inode ) )
+	{
+		shard->current_size -= value->inode_size;
+		shard->current_size += inode_size;
+		value->inode_size    = inode_size;
+
+		/* The caller retains its own reference to the inode
+		 */
+		if( inode_size > shard->maximum_size )
+		{
+			if( libfsxfs_inode_cache_shard_remove_value(
+			     shard,
+			     value,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+				 "%s: unable to remove value.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		while( shard->current_size > shard->maximum_size )
+		{
+			if( libfsxfs_inode_cache_shard_remove_last_value(
+			     shard,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+				 "%s: unable to remove last value.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		result = 1;
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     shard->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+
+on_error:
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_write(
+	 shard->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
@@ -0,0 +1,166 @@
+/*
+ * Inode cache functions
+ *
+ * Copyright (C) 2020-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSXFS_INODE_CACHE_H )
+#define _LIBFSXFS_INODE_CACHE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsxfs_definitions.h"
+#include "libfsxfs_inode.h"
+#include "libfsxfs_libcerror.h"
+#include "libfsxfs_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfsxfs_inode_cache_value libfsxfs_inode_cache_value_t;
+
+struct libfsxfs_inode_cache_value
+{
+	/* The inode number
+	 */
+	uint64_t inode_number;
+
+	/* The inode
+	 */
+	libfsxfs_inode_t *inode;
+
+	/* The (estimated) memory size of the inode
+	 */
+	size_t inode_size;
+
+	/* The previous (more recently used) value
+	 */
+	libfsxfs_inode_cache_value_t *previous_value;
+
+	/* The next (less recently used) value
+	 */
+	libfsxfs_inode_cache_value_t *next_value;
+
+	/* The next value in the same hash bucket
+	 */
+	libfsxfs_inode_cache_value_t *next_bucket_value;
+};
+
+typedef struct libfsxfs_inode_cache_shard libfsxfs_inode_cache_shard_t;
+
+struct libfsxfs_inode_cache_shard
+{
+	/* The hash buckets
+	 */
+	libfsxfs_inode_cache_value_t *buckets[ LIBFSXFS_INODE_CACHE_NUMBER_OF_BUCKETS ];
+
+	/* The most recently used value
+	 */
+	libfsxfs_inode_cache_value_t *first_value;
+
+	/* The least recently used value
+	 */
+	libfsxfs_inode_cache_value_t *last_value;
+
+	/* The number of values
+	 */
+	int number_of_values;
+
+	/* The current (estimated) memory size of the cached inodes
+	 */
+	size_t current_size;
+
+	/* The maximum (estimated) memory size of the cached inodes
+	 */
+	size_t maximum_size;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
+};
+
+typedef struct libfsxfs_inode_cache libfsxfs_inode_cache_t;
+
+struct libfsxfs_inode_cache
+{
+	/* The shards
+	 */
+	libfsxfs_inode_cache_shard_t shards[ LIBFSXFS_INODE_CACHE_NUMBER_OF_SHARDS ];
+};
+
+int libfsxfs_inode_cache_initialize(
+     libfsxfs_inode_cache_t **inode_cache,
+     size_t maximum_cache_size,
+     libcerror_error_t **error );
+
+int libfsxfs_inode_cache_free(
+     libfsxfs_inode_cache_t **inode_cache,
+     libcerror_error_t **error );
+
+int libfsxfs_inode_cache_shard_remove_value(
+     libfsxfs_inode_cache_shard_t *shard,
+     libfsxfs_inode_cache_value_t *value,
+     libcerror_error_t **error );
+
+int libfsxfs_inode_cache_shard_remove_last_value(
+     libfsxfs_inode_cache_shard_t *shard,
+     libcerror_error_t **error );
+
+int libfsxfs_inode_cache_get_maximum_cache_size(
+     libfsxfs_inode_cache_t *inode_cache,
+     size_t *maximum_cache_size,
+     libcerror_error_t **error );
+
+int libfsxfs_inode_cache_set_maximum_cache_size(
+     libfsxfs_inode_cache_t *inode_cache,
+     size_t maximum_cache_size,
+     libcerror_error_t **error );
+
+int libfsxfs_inode_cache_get_number_of_inodes(
+     libfsxfs_inode_cache_t *inode_cache,
+     int *number_of_inodes,
+     libcerror_error_t **error );
+
+int libfsxfs_inode_cache_get_inode_by_number(
+     libfsxfs_inode_cache_t *inode_cache,
+     uint64_t inode_number,
+     libfsxfs_inode_t **inode,
+     libcerror_error_t **error );
+
+int libfsxfs_inode_cache_insert_inode(
+     libfsxfs_inode_cache_t *inode_cache,
+     uint64_t inode_number,
+     libfsxfs_inode_t *inode,
+     libcerror_error_t **error );
+
+int libfsxfs_inode_cache_update_inode(
+     libfsxfs_inode_cache_t *inode_cache,
+     uint64_t inode_number,
+     libfsxfs_inode_t *inode,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSXFS_INODE_CACHE_H ) */
+
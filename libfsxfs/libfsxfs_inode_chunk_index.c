@@ -0,0 +1,513 @@
+/*
+ * Inode chunk index functions
+ *
+ * Copyright (C) 2020-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfsxfs_definitions.h"
+#include "libfsxfs_inode_chunk_index.h"
+#include "libfsxfs_libcerror.h"
+
+/* Creates an inode chunk index
+ * Make sure the value inode_chunk_index is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_inode_chunk_index_initialize(
+     libfsxfs_inode_chunk_index_t **inode_chunk_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_inode_chunk_index_initialize";
+
+	if( inode_chunk_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode chunk index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *inode_chunk_index != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid inode chunk index value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*inode_chunk_index = memory_allocate_structure(
+	                      libfsxfs_inode_chunk_index_t );
+
+	if( *inode_chunk_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create inode chunk index.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *inode_chunk_index,
+	     0,
+	     sizeof( libfsxfs_inode_chunk_index_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear inode chunk index.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *inode_chunk_index != NULL )
+	{
+		memory_free(
+		 *inode_chunk_index );
+
+		*inode_chunk_index = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an inode chunk index
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_inode_chunk_index_free(
+     libfsxfs_inode_chunk_index_t **inode_chunk_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_inode_chunk_index_free";
+
+	if( inode_chunk_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode chunk index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *inode_chunk_index != NULL )
+	{
+		if( ( *inode_chunk_index )->chunk_allocation_bitmaps != NULL )
+		{
+			memory_free(
+			 ( *inode_chunk_index )->chunk_allocation_bitmaps );
+		}
+		if( ( *inode_chunk_index )->chunk_inode_numbers != NULL )
+		{
+			memory_free(
+			 ( *inode_chunk_index )->chunk_inode_numbers );
+		}
+		memory_free(
+		 *inode_chunk_index );
+
+		*inode_chunk_index = NULL;
+	}
+	return( 1 );
+}
+
+/* Appends a chunk to the inode chunk index
+ * Chunks must be appended in ascending order of their (relative) inode number
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_inode_chunk_index_append_chunk(
+     libfsxfs_inode_chunk_index_t *inode_chunk_index,
+     uint32_t chunk_inode_number,
+     uint64_t chunk_allocation_bitmap,
+     libcerror_error_t **error )
+{
+	uint64_t *reallocation_bitmaps       = NULL;
+	uint32_t *reallocation_inode_numbers = NULL;
+	static char *function                = "libfsxfs_inode_chunk_index_append_chunk";
+	int number_of_allocated_chunks       = 0;
+
+	if( inode_chunk_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode chunk index.",
+		 function );
+
+		return( -1 );
+	}
+	if( inode_chunk_index->number_of_chunks > 0 )
+	{
+		if( (uint64_t) chunk_inode_number < ( (uint64_t) inode_chunk_index->chunk_inode_numbers[ inode_chunk_index->number_of_chunks - 1 ] + LIBFSXFS_INODE_CHUNK_NUMBER_OF_INODES ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid chunk inode number: %" PRIu32 " value out of bounds.",
+			 function,
+			 chunk_inode_number );
+
+			return( -1 );
+		}
+	}
+	if( inode_chunk_index->number_of_chunks >= inode_chunk_index->number_of_allocated_chunks )
+	{
+		if( inode_chunk_index->number_of_allocated_chunks == 0 )
+		{
+			number_of_allocated_chunks = 64;
+		}
+		else if( inode_chunk_index->number_of_allocated_chunks > ( INT_MAX / 2 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of allocated chunks value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		else
+		{
+			number_of_allocated_chunks = inode_chunk_index->number_of_allocated_chunks * 2;
+		}
+		reallocation_inode_numbers = (uint32_t *) memory_reallocate(
+		                                           inode_chunk_index->chunk_inode_numbers,
+		                                           sizeof( uint32_t ) * number_of_allocated_chunks );
+
+		if( reallocation_inode_numbers == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize chunk inode numbers.",
+			 function );
+
+			return( -1 );
+		}
+		inode_chunk_index->chunk_inode_numbers = reallocation_inode_numbers;
+
+		reallocation_bitmaps = (uint64_t *) memory_reallocate(
+		                                     inode_chunk_index->chunk_allocation_bitmaps,
+		                                     sizeof( uint64_t ) * number_of_allocated_chunks );
+
+		if( reallocation_bitmaps == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize chunk allocation bitmaps.",
+			 function );
+
+			return( -1 );
+		}
+		inode_chunk_index->chunk_allocation_bitmaps   = reallocation_bitmaps;
+		inode_chunk_index->number_of_allocated_chunks = number_of_allocated_chunks;
+	}
+	inode_chunk_index->chunk_inode_numbers[ inode_chunk_index->number_of_chunks ]      = chunk_inode_number;
+	inode_chunk_index->chunk_allocation_bitmaps[ inode_chunk_index->number_of_chunks ] = chunk_allocation_bitmap;
+
+	inode_chunk_index->number_of_chunks += 1;
+
+	return( 1 );
+}
+
+/* Retrieves the number of chunks
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_inode_chunk_index_get_number_of_chunks(
+     libfsxfs_inode_chunk_index_t *inode_chunk_index,
+     int *number_of_chunks,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_inode_chunk_index_get_number_of_chunks";
+
+	if( inode_chunk_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode chunk index.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_chunks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of chunks.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_chunks = inode_chunk_index->number_of_chunks;
+
+	return( 1 );
+}
+
+/* Retrieves a specific chunk
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_inode_chunk_index_get_chunk_by_index(
+     libfsxfs_inode_chunk_index_t *inode_chunk_index,
+     int chunk_index,
+     uint32_t *chunk_inode_number,
+     uint64_t *chunk_allocation_bitmap,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_inode_chunk_index_get_chunk_by_index";
+
+	if( inode_chunk_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode chunk index.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( chunk_index < 0 )
+	 || ( chunk_index >= inode_chunk_index->number_of_chunks ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid chunk index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_inode_number == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk inode number.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_allocation_bitmap == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk allocation bitmap.",
+		 function );
+
+		return( -1 );
+	}
+	*chunk_inode_number      = inode_chunk_index->chunk_inode_numbers[ chunk_index ];
+	*chunk_allocation_bitmap = inode_chunk_index->chunk_allocation_bitmaps[ chunk_index ];
+
+	return( 1 );
+}
+
+/* Retrieves the chunk that contains a specific (relative) inode number
+ * Returns 1 if successful, 0 if no such value or -1 on error
+ */
+int libfsxfs_inode_chunk_index_get_chunk_by_inode_number(
+     libfsxfs_inode_chunk_index_t *inode_chunk_index,
+     uint32_t inode_number,
+     uint32_t *chunk_inode_number,
+     uint64_t *chunk_allocation_bitmap,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_inode_chunk_index_get_chunk_by_inode_number";
+	int chunk_index       = 0;
+	int lower_index       = 0;
+	int upper_index       = 0;
+
+	if( inode_chunk_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode chunk index.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_inode_number == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk inode number.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_allocation_bitmap == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk allocation bitmap.",
+		 function );
+
+		return( -1 );
+	}
+	/* Find the last chunk that starts at or before the inode number
+	 */
+	upper_index = inode_chunk_index->number_of_chunks;
+
+	while( lower_index < upper_index )
+	{
+		chunk_index = lower_index + ( ( upper_index - lower_index ) / 2 );
+
+		if( inode_number < inode_chunk_index->chunk_inode_numbers[ chunk_index ] )
+		{
+			upper_index = chunk_index;
+		}
+		else
+		{
+			lower_index = chunk_index + 1;
+		}
+	}
+	if( lower_index == 0 )
+	{
+		return( 0 );
+	}
+	chunk_index = lower_index - 1;
+
+	if( ( inode_number - inode_chunk_index->chunk_inode_numbers[ chunk_index ] ) >= LIBFSXFS_INODE_CHUNK_NUMBER_OF_INODES )
+	{
+		return( 0 );
+	}
+	*chunk_inode_number      = inode_chunk_index->chunk_inode_numbers[ chunk_index ];
+	*chunk_allocation_bitmap = inode_chunk_index->chunk_allocation_bitmaps[ chunk_index ];
+
+	return( 1 );
+}
+
+/* Retrieves the first allocated (relative) inode number at or after a specific (relative) inode number
+ * Returns 1 if successful, 0 if no such inode number or -1 on error
+ */
+int libfsxfs_inode_chunk_index_get_next_allocated_inode_number(
+     libfsxfs_inode_chunk_index_t *inode_chunk_index,
+     uint32_t inode_number,
+     uint32_t *next_inode_number,
+     libcerror_error_t **error )
+{
+	static char *function            = "libfsxfs_inode_chunk_index_get_next_allocated_inode_number";
+	uint64_t chunk_allocation_bitmap = 0;
+	uint32_t chunk_inode_number      = 0;
+	uint8_t chunk_inode_index        = 0;
+	int chunk_index                  = 0;
+	int lower_index                  = 0;
+	int upper_index                  = 0;
+
+	if( inode_chunk_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode chunk index.",
+		 function );
+
+		return( -1 );
+	}
+	if( next_inode_number == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid next inode number.",
+		 function );
+
+		return( -1 );
+	}
+	/* Find the first chunk that ends after the inode number
+	 */
+	upper_index = inode_chunk_index->number_of_chunks;
+
+	while( lower_index < upper_index )
+	{
+		chunk_index = lower_index + ( ( upper_index - lower_index ) / 2 );
+
+		if( (uint64_t) inode_number < ( (uint64_t) inode_chunk_index->chunk_inode_numbers[ chunk_index ] + LIBFSXFS_INODE_CHUNK_NUMBER_OF_INODES ) )
+		{
+			upper_index = chunk_index;
+		}
+		else
+		{
+			lower_index = chunk_index + 1;
+		}
+	}
+	for( chunk_index = lower_index;
+	     chunk_index < inode_chunk_index->number_of_chunks;
+	     chunk_index++ )
+	{
+		chunk_inode_number      = inode_chunk_index->chunk_inode_numbers[ chunk_index ];
+		chunk_allocation_bitmap = inode_chunk_index->chunk_allocation_bitmaps[ chunk_index ];
+
+		chunk_inode_index = 0;
+
+		if( inode_number > chunk_inode_number )
+		{
+			chunk_inode_index = (uint8_t) ( inode_number - chunk_inode_number );
+		}
+		/* A bit that is set in the chunk allocation bitmap indicates an unused inode
+		 */
+		while( chunk_inode_index < LIBFSXFS_INODE_CHUNK_NUMBER_OF_INODES )
+		{
+			if( ( chunk_allocation_bitmap & ( (uint64_t) 1 << chunk_inode_index ) ) == 0 )
+			{
+				*next_inode_number = chunk_inode_number + chunk_inode_index;
+
+				return( 1 );
+			}
+			chunk_inode_index++;
+		}
+	}
+	return( 0 );
+}
+
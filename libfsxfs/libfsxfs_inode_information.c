@@ -24,6 +24,7 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libfsxfs_checksum.h"
 #include "libfsxfs_debug.h"
 #include "libfsxfs_inode_information.h"
 #include "libfsxfs_io_handle.h"
@@ -148,6 +149,7 @@ int libfsxfs_inode_information_read_data(
      libcerror_error_t **error )
 {
 	static char *function              = "libfsxfs_inode_information_read_data";
+	size_t checksum_data_size          = 0;
 	size_t inode_information_data_size = 0;
 	uint32_t format_version            = 0;
 
@@ -236,10 +238,52 @@ int libfsxfs_inode_information_read_data(
 
 		return( -1 );
 	}
+	if( ( io_handle->verify_checksums != 0 )
+	 && ( io_handle->format_version >= 5 ) )
+	{
+		/* The checksum covers the sector that contains the inode information
+		 */
+		checksum_data_size = data_size;
+
+		if( io_handle->sector_size != 0 )
+		{
+			checksum_data_size = (size_t) io_handle->sector_size;
+		}
+		if( checksum_data_size > data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid data size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		if( libfsxfs_checksum_verify_metadata_checksum(
+		     data,
+		     checksum_data_size,
+		     312,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_INPUT,
+			 LIBCERROR_INPUT_ERROR_CHECKSUM_MISMATCH,
+			 "%s: unable to verify inode information checksum.",
+			 function );
+
+			return( -1 );
+		}
+	}
 	byte_stream_copy_to_uint32_big_endian(
 	 ( (fsxfs_inode_information_t *) data )->format_version,
 	 format_version );
 
+	byte_stream_copy_to_uint32_big_endian(
+	 ( (fsxfs_inode_information_t *) data )->number_of_inodes,
+	 inode_information->number_of_inodes );
+
 	byte_stream_copy_to_uint32_big_endian(
 	 ( (fsxfs_inode_information_t *) data )->inode_btree_root_block_number,
 	 inode_information->inode_btree_root_block_number );
@@ -248,6 +292,10 @@ int libfsxfs_inode_information_read_data(
 	 ( (fsxfs_inode_information_t *) data )->inode_btree_depth,
 	 inode_information->inode_btree_depth );
 
+	byte_stream_copy_to_uint32_big_endian(
+	 ( (fsxfs_inode_information_t *) data )->number_of_unused_inodes,
+	 inode_information->number_of_unused_inodes );
+
 	byte_stream_copy_to_uint32_big_endian(
 	 ( (fsxfs_inode_information_t *) data )->last_allocated_chunk,
 	 inode_information->last_allocated_chunk );
@@ -284,13 +332,10 @@ int libfsxfs_inode_information_read_data(
 		 function,
 		 value_32bit );
 
-		byte_stream_copy_to_uint32_big_endian(
-		 ( (fsxfs_inode_information_t *) data )->number_of_inodes,
-		 value_32bit );
 		libcnotify_printf(
 		 "%s: number of inodes\t\t\t\t: %" PRIu32 "\n",
 		 function,
-		 value_32bit );
+		 inode_information->number_of_inodes );
 
 		libcnotify_printf(
 		 "%s: inode B+ tree root block number\t\t: %" PRIu32 "\n",
@@ -302,13 +347,10 @@ int libfsxfs_inode_information_read_data(
 		 function,
 		 inode_information->inode_btree_depth );
 
-		byte_stream_copy_to_uint32_big_endian(
-		 ( (fsxfs_inode_information_t *) data )->number_of_unused_inodes,
-		 value_32bit );
 		libcnotify_printf(
 		 "%s: number of unused inodes\t\t\t: %" PRIu32 "\n",
 		 function,
-		 value_32bit );
+		 inode_information->number_of_unused_inodes );
 
 		libcnotify_printf(
 		 "%s: last allocated chunk\t\t\t: %" PRIu32 "\n",
@@ -426,11 +468,28 @@ int libfsxfs_inode_information_read_file_io_handle(
      off64_t file_offset,
      libcerror_error_t **error )
 {
-	uint8_t data[ 512 ];
-
+	uint8_t *data         = NULL;
 	static char *function = "libfsxfs_inode_information_read_file_io_handle";
+	size_t data_size      = 512;
 	ssize_t read_count    = 0;
 
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	/* The inode information is stored in a sector
+	 */
+	if( io_handle->sector_size > 512 )
+	{
+		data_size = (size_t) io_handle->sector_size;
+	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
@@ -441,14 +500,29 @@ int libfsxfs_inode_information_read_file_io_handle(
 		 file_offset );
 	}
 #endif
-	read_count = libbfio_handle_read_buffer_at_offset(
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * data_size );
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data.",
+		 function );
+
+		goto on_error;
+	}
+	read_count = libfsxfs_io_handle_read_buffer_at_offset(
+	              io_handle,
 	              file_io_handle,
 	              data,
-	              512,
+	              data_size,
 	              file_offset,
 	              error );
 
-	if( read_count != (ssize_t) 512 )
+	if( read_count != (ssize_t) data_size )
 	{
 		libcerror_error_set(
 		 error,
@@ -459,13 +533,13 @@ int libfsxfs_inode_information_read_file_io_handle(
 		 file_offset,
 		 file_offset );
 
-		return( -1 );
+		goto on_error;
 	}
 	if( libfsxfs_inode_information_read_data(
 	     inode_information,
 	     io_handle,
 	     data,
-	     512,
+	     data_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -477,8 +551,19 @@ int libfsxfs_inode_information_read_file_io_handle(
 		 file_offset,
 		 file_offset );
 
-		return( -1 );
+		goto on_error;
 	}
+	memory_free(
+	 data );
+
 	return( 1 );
+
+on_error:
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( -1 );
 }
 
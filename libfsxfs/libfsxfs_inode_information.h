@@ -37,6 +37,14 @@ typedef struct libfsxfs_inode_information libfsxfs_inode_information_t;
 
 struct libfsxfs_inode_information
 {
+	/* Number of inodes
+	 */
+	uint32_t number_of_inodes;
+
+	/* Number of unused inodes
+	 */
+	uint32_t number_of_unused_inodes;
+
 	/* Inode B+ tree root block number
 	 */
 	uint32_t inode_btree_root_block_number;
@@ -25,11 +25,15 @@
 #include <system_string.h>
 #include <types.h>
 
+#include "libfsxfs_block_cache.h"
 #include "libfsxfs_debug.h"
+#include "libfsxfs_definitions.h"
 #include "libfsxfs_io_handle.h"
+#include "libfsxfs_io_queue.h"
 #include "libfsxfs_libbfio.h"
 #include "libfsxfs_libcerror.h"
 #include "libfsxfs_libcnotify.h"
+#include "libfsxfs_memory_map.h"
 
 /* Creates an IO handle
  * Make sure the value io_handle is referencing, is set to NULL
@@ -127,6 +131,54 @@ int libfsxfs_io_handle_free(
 	}
 	if( *io_handle != NULL )
 	{
+		if( ( *io_handle )->memory_map != NULL )
+		{
+			if( libfsxfs_memory_map_free(
+			     &( ( *io_handle )->memory_map ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free memory map.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *io_handle )->io_queue != NULL )
+		{
+			if( libfsxfs_io_queue_free(
+			     &( ( *io_handle )->io_queue ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free IO queue.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *io_handle )->block_cache != NULL )
+		{
+			if( libfsxfs_block_cache_free(
+			     &( ( *io_handle )->block_cache ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free block cache.",
+				 function );
+
+				result = -1;
+			}
+		}
 		memory_free(
 		 *io_handle );
 
@@ -155,6 +207,54 @@ int libfsxfs_io_handle_clear(
 
 		return( -1 );
 	}
+	if( io_handle->memory_map != NULL )
+	{
+		if( libfsxfs_memory_map_free(
+		     &( io_handle->memory_map ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free memory map.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( io_handle->io_queue != NULL )
+	{
+		if( libfsxfs_io_queue_free(
+		     &( io_handle->io_queue ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free IO queue.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( io_handle->block_cache != NULL )
+	{
+		if( libfsxfs_block_cache_free(
+		     &( io_handle->block_cache ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free block cache.",
+			 function );
+
+			return( -1 );
+		}
+	}
 	if( memory_set(
 	     io_handle,
 	     0,
@@ -172,3 +272,303 @@ int libfsxfs_io_handle_clear(
 	return( 1 );
 }
 
+/* Retrieves the data of a range of the volume from the memory map
+ * The data remains valid until the volume is closed
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfsxfs_io_handle_get_mapped_data(
+     libfsxfs_io_handle_t *io_handle,
+     off64_t file_offset,
+     size_t data_size,
+     const uint8_t **data,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_io_handle_get_mapped_data";
+	int result            = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->memory_map == NULL )
+	{
+		return( 0 );
+	}
+	result = libfsxfs_memory_map_get_data(
+	          io_handle->memory_map,
+	          file_offset,
+	          data_size,
+	          data,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve mapped data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 file_offset,
+		 file_offset );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Reads a buffer of metadata at a specific offset
+ * The metadata block cache is used when available
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libfsxfs_io_handle_read_buffer_at_offset(
+         libfsxfs_io_handle_t *io_handle,
+         libbfio_handle_t *file_io_handle,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t file_offset,
+         libcerror_error_t **error )
+{
+	const uint8_t *mapped_data = NULL;
+	static char *function      = "libfsxfs_io_handle_read_buffer_at_offset";
+	ssize_t read_count         = 0;
+	int result                 = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfsxfs_io_handle_get_mapped_data(
+	          io_handle,
+	          file_offset,
+	          buffer_size,
+	          &mapped_data,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve mapped data.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		/* The memory map is backed by the page cache and is not cached twice
+		 */
+		if( memory_copy(
+		     buffer,
+		     mapped_data,
+		     buffer_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy mapped data.",
+			 function );
+
+			return( -1 );
+		}
+		read_count = (ssize_t) buffer_size;
+	}
+	else if( io_handle->block_cache != NULL )
+	{
+		read_count = libfsxfs_block_cache_read_buffer_at_offset(
+		              io_handle->block_cache,
+		              file_io_handle,
+		              buffer,
+		              buffer_size,
+		              file_offset,
+		              error );
+	}
+	else
+	{
+		read_count = libbfio_handle_read_buffer_at_offset(
+		              file_io_handle,
+		              buffer,
+		              buffer_size,
+		              file_offset,
+		              error );
+	}
+	if( read_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read buffer at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 file_offset,
+		 file_offset );
+
+		return( -1 );
+	}
+	return( read_count );
+}
+
+/* Reads a buffer of file data at a specific offset
+ * The file data is not cached. If a file IO pool is set the data is read using the handle
+ * of the pool that corresponds with the stripe of the offset, which allows concurrent reads
+ * of different parts of the volume to be issued using different handles
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libfsxfs_io_handle_read_data_at_offset(
+         libfsxfs_io_handle_t *io_handle,
+         libbfio_handle_t *file_io_handle,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t file_offset,
+         libcerror_error_t **error )
+{
+	libbfio_handle_t *pool_file_io_handle = NULL;
+	const uint8_t *mapped_data            = NULL;
+	static char *function                 = "libfsxfs_io_handle_read_data_at_offset";
+	ssize_t read_count                    = 0;
+	int pool_entry                        = 0;
+	int result                            = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid file offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfsxfs_io_handle_get_mapped_data(
+	          io_handle,
+	          file_offset,
+	          buffer_size,
+	          &mapped_data,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve mapped data.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		if( buffer == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid buffer.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_copy(
+		     buffer,
+		     mapped_data,
+		     buffer_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy mapped data.",
+			 function );
+
+			return( -1 );
+		}
+		return( (ssize_t) buffer_size );
+	}
+	if( ( io_handle->file_io_pool != NULL )
+	 && ( io_handle->number_of_file_io_pool_handles > 1 ) )
+	{
+		pool_entry = (int) ( ( file_offset / LIBFSXFS_FILE_IO_POOL_STRIPE_SIZE ) % io_handle->number_of_file_io_pool_handles );
+
+		if( libbfio_pool_get_handle(
+		     io_handle->file_io_pool,
+		     pool_entry,
+		     &pool_file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file IO handle: %d from pool.",
+			 function,
+			 pool_entry );
+
+			return( -1 );
+		}
+		file_io_handle = pool_file_io_handle;
+	}
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              buffer,
+	              buffer_size,
+	              file_offset,
+	              error );
+
+	if( read_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read buffer at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 file_offset,
+		 file_offset );
+
+		return( -1 );
+	}
+	return( read_count );
+}
+
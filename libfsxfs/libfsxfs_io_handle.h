@@ -25,8 +25,11 @@
 #include <common.h>
 #include <types.h>
 
+#include "libfsxfs_block_cache.h"
+#include "libfsxfs_io_queue.h"
 #include "libfsxfs_libbfio.h"
 #include "libfsxfs_libcerror.h"
+#include "libfsxfs_memory_map.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -40,10 +43,18 @@ struct libfsxfs_io_handle
 	 */
 	int format_version;
 
+	/* Feature flags
+	 */
+	uint16_t feature_flags;
+
 	/* Secondary feature flags
 	 */
 	uint32_t secondary_feature_flags;
 
+	/* The sector size
+	 */
+	uint16_t sector_size;
+
 	/* The block size
 	 */
 	uint32_t block_size;
@@ -68,6 +79,34 @@ struct libfsxfs_io_handle
 	 */
 	uint8_t number_of_relative_inode_number_bits;
 
+	/* Value to indicate the checksums of version 5 metadata should be verified
+	 */
+	uint8_t verify_checksums;
+
+	/* The metadata block cache
+	 */
+	libfsxfs_block_cache_t *block_cache;
+
+	/* The memory map of the volume or NULL if not set
+	 */
+	libfsxfs_memory_map_t *memory_map;
+
+	/* The file IO pool used to read file data or NULL if not set
+	 */
+	libbfio_pool_t *file_io_pool;
+
+	/* The number of handles in the file IO pool
+	 */
+	int number_of_file_io_pool_handles;
+
+	/* The IO queue used to read file data asynchronously or NULL if not set
+	 */
+	libfsxfs_io_queue_t *io_queue;
+
+	/* The maximum size of the file data read-ahead window
+	 */
+	size_t maximum_read_ahead_size;
+
 	/* Value to indicate if abort was signalled
 	 */
 	int abort;
@@ -85,6 +124,29 @@ int libfsxfs_io_handle_clear(
      libfsxfs_io_handle_t *io_handle,
      libcerror_error_t **error );
 
+int libfsxfs_io_handle_get_mapped_data(
+     libfsxfs_io_handle_t *io_handle,
+     off64_t file_offset,
+     size_t data_size,
+     const uint8_t **data,
+     libcerror_error_t **error );
+
+ssize_t libfsxfs_io_handle_read_buffer_at_offset(
+         libfsxfs_io_handle_t *io_handle,
+         libbfio_handle_t *file_io_handle,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t file_offset,
+         libcerror_error_t **error );
+
+ssize_t libfsxfs_io_handle_read_data_at_offset(
+         libfsxfs_io_handle_t *io_handle,
+         libbfio_handle_t *file_io_handle,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t file_offset,
+         libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
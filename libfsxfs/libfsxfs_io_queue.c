@@ -0,0 +1,661 @@
+/*
+ * Asynchronous IO queue functions
+ *
+ * Copyright (C) 2020-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfsxfs_definitions.h"
+#include "libfsxfs_io_queue.h"
+#include "libfsxfs_libbfio.h"
+#include "libfsxfs_libcerror.h"
+#include "libfsxfs_libcnotify.h"
+#include "libfsxfs_libcthreads.h"
+
+/* Creates an IO queue
+ * Make sure the value io_queue is referencing, is set to NULL
+ * The reads are processed by a pool of number of threads. If multi-threading is not
+ * supported the reads are processed synchronously when they are submitted
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_io_queue_initialize(
+     libfsxfs_io_queue_t **io_queue,
+     int number_of_threads,
+     intptr_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     ssize_t (*read_function)(
+              intptr_t *io_handle,
+              libbfio_handle_t *file_io_handle,
+              uint8_t *buffer,
+              size_t buffer_size,
+              off64_t file_offset,
+              libcerror_error_t **error ),
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_io_queue_initialize";
+
+	if( io_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( *io_queue != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid IO queue value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_threads <= 0 )
+	 || ( number_of_threads > LIBFSXFS_IO_QUEUE_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read function.",
+		 function );
+
+		return( -1 );
+	}
+	*io_queue = memory_allocate_structure(
+	             libfsxfs_io_queue_t );
+
+	if( *io_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create IO queue.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *io_queue,
+	     0,
+	     sizeof( libfsxfs_io_queue_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear IO queue.",
+		 function );
+
+		memory_free(
+		 *io_queue );
+
+		*io_queue = NULL;
+
+		return( -1 );
+	}
+	( *io_queue )->io_handle         = io_handle;
+	( *io_queue )->file_io_handle    = file_io_handle;
+	( *io_queue )->read_function     = read_function;
+	( *io_queue )->number_of_threads = number_of_threads;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *io_queue )->batch_mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create batch mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_condition_initialize(
+	     &( ( *io_queue )->completion_condition ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create completion condition.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_thread_pool_create(
+	     &( ( *io_queue )->thread_pool ),
+	     NULL,
+	     number_of_threads,
+	     LIBFSXFS_IO_QUEUE_MAXIMUM_NUMBER_OF_READS,
+	     (int (*)(intptr_t *, void *)) &libfsxfs_io_queue_process_read,
+	     (void *) *io_queue,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create thread pool.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( *io_queue != NULL )
+	{
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+		if( ( *io_queue )->completion_condition != NULL )
+		{
+			libcthreads_condition_free(
+			 &( ( *io_queue )->completion_condition ),
+			 NULL );
+		}
+		if( ( *io_queue )->batch_mutex != NULL )
+		{
+			libcthreads_mutex_free(
+			 &( ( *io_queue )->batch_mutex ),
+			 NULL );
+		}
+#endif
+		memory_free(
+		 *io_queue );
+
+		*io_queue = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an IO queue
+ * The reads that were submitted are completed before the IO queue is freed
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_io_queue_free(
+     libfsxfs_io_queue_t **io_queue,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_io_queue_free";
+	int result            = 1;
+
+	if( io_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( *io_queue != NULL )
+	{
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+		if( libcthreads_thread_pool_join(
+		     &( ( *io_queue )->thread_pool ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join thread pool.",
+			 function );
+
+			result = -1;
+		}
+		if( libcthreads_condition_free(
+		     &( ( *io_queue )->completion_condition ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free completion condition.",
+			 function );
+
+			result = -1;
+		}
+		if( libcthreads_mutex_free(
+		     &( ( *io_queue )->batch_mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free batch mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		/* The io_handle and file_io_handle references are freed elsewhere
+		 */
+		memory_free(
+		 *io_queue );
+
+		*io_queue = NULL;
+	}
+	return( result );
+}
+
+/* Processes a read, this function is called by the threads of the thread pool
+ * The queue read is freed after the batch has been updated
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_io_queue_process_read(
+     libfsxfs_io_queue_read_t *queue_read,
+     libfsxfs_io_queue_t *io_queue )
+{
+	libcerror_error_t *error = NULL;
+	ssize_t read_count       = 0;
+	int result               = 1;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	static char *function    = "libfsxfs_io_queue_process_read";
+#endif
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	int is_locked            = 0;
+#endif
+
+	if( queue_read == NULL )
+	{
+		return( -1 );
+	}
+	if( io_queue == NULL )
+	{
+		io_queue = queue_read->io_queue;
+	}
+	read_count = io_queue->read_function(
+	              io_queue->io_handle,
+	              io_queue->file_io_handle,
+	              queue_read->buffer,
+	              queue_read->buffer_size,
+	              queue_read->file_offset,
+	              &error );
+
+	if( read_count != (ssize_t) queue_read->buffer_size )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: unable to read: %" PRIzd " bytes at offset: %" PRIi64 " (0x%08" PRIx64 ").\n",
+			 function,
+			 queue_read->buffer_size,
+			 queue_read->file_offset,
+			 queue_read->file_offset );
+
+			if( error != NULL )
+			{
+				libcnotify_print_error_backtrace(
+				 error );
+			}
+		}
+#endif
+		if( error != NULL )
+		{
+			libcerror_error_free(
+			 &error );
+		}
+		result = -1;
+	}
+	/* The completion of the read is always accounted for, otherwise
+	 * libfsxfs_io_queue_wait would block indefinitely on the batch
+	 */
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     io_queue->batch_mutex,
+	     NULL ) == 1 )
+	{
+		is_locked = 1;
+	}
+	else
+	{
+		result = -1;
+	}
+#endif
+	queue_read->batch->number_of_pending_reads -= 1;
+
+	if( result != 1 )
+	{
+		queue_read->batch->number_of_failed_reads += 1;
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_condition_broadcast(
+	     io_queue->completion_condition,
+	     NULL ) != 1 )
+	{
+		result = -1;
+	}
+	if( is_locked != 0 )
+	{
+		if( libcthreads_mutex_release(
+		     io_queue->batch_mutex,
+		     NULL ) != 1 )
+		{
+			result = -1;
+		}
+	}
+#endif
+	memory_free(
+	 queue_read );
+
+	return( result );
+}
+
+/* Submits a read of a buffer at a specific offset
+ * The buffer must remain available until libfsxfs_io_queue_wait has returned for the batch
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_io_queue_submit_read(
+     libfsxfs_io_queue_t *io_queue,
+     libfsxfs_io_queue_batch_t *batch,
+     uint8_t *buffer,
+     size_t buffer_size,
+     off64_t file_offset,
+     libcerror_error_t **error )
+{
+	libfsxfs_io_queue_read_t *queue_read = NULL;
+	static char *function                = "libfsxfs_io_queue_submit_read";
+
+	if( io_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid file offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	queue_read = memory_allocate_structure(
+	              libfsxfs_io_queue_read_t );
+
+	if( queue_read == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create queue read.",
+		 function );
+
+		return( -1 );
+	}
+	queue_read->io_queue    = io_queue;
+	queue_read->batch       = batch;
+	queue_read->buffer      = buffer;
+	queue_read->buffer_size = buffer_size;
+	queue_read->file_offset = file_offset;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     io_queue->batch_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab batch mutex.",
+		 function );
+
+		memory_free(
+		 queue_read );
+
+		return( -1 );
+	}
+	batch->number_of_pending_reads += 1;
+
+	if( libcthreads_mutex_release(
+	     io_queue->batch_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release batch mutex.",
+		 function );
+
+		memory_free(
+		 queue_read );
+
+		return( -1 );
+	}
+	/* The thread pool blocks when the maximum number of reads are queued
+	 */
+	if( libcthreads_thread_pool_push(
+	     io_queue->thread_pool,
+	     (intptr_t *) queue_read,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to push read onto thread pool.",
+		 function );
+
+		if( libcthreads_mutex_grab(
+		     io_queue->batch_mutex,
+		     NULL ) == 1 )
+		{
+			batch->number_of_pending_reads -= 1;
+
+			libcthreads_mutex_release(
+			 io_queue->batch_mutex,
+			 NULL );
+		}
+		memory_free(
+		 queue_read );
+
+		return( -1 );
+	}
+#else
+	batch->number_of_pending_reads += 1;
+
+	/* Without multi-threading support the read is processed directly,
+	 * a failed read is reported by libfsxfs_io_queue_wait
+	 */
+	libfsxfs_io_queue_process_read(
+	 queue_read,
+	 io_queue );
+#endif
+	return( 1 );
+}
+
+/* Waits for the submitted reads of a batch to complete
+ * Returns 1 if successful or -1 on error or if a read failed
+ */
+int libfsxfs_io_queue_wait(
+     libfsxfs_io_queue_t *io_queue,
+     libfsxfs_io_queue_batch_t *batch,
+     libcerror_error_t **error )
+{
+	static char *function      = "libfsxfs_io_queue_wait";
+	int number_of_failed_reads = 0;
+
+	if( io_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     io_queue->batch_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab batch mutex.",
+		 function );
+
+		return( -1 );
+	}
+	while( batch->number_of_pending_reads > 0 )
+	{
+		if( libcthreads_condition_wait(
+		     io_queue->completion_condition,
+		     io_queue->batch_mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to wait for completion condition.",
+			 function );
+
+			libcthreads_mutex_release(
+			 io_queue->batch_mutex,
+			 NULL );
+
+			return( -1 );
+		}
+	}
+#endif
+	number_of_failed_reads = batch->number_of_failed_reads;
+
+	batch->number_of_failed_reads = 0;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     io_queue->batch_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release batch mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( number_of_failed_reads > 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to complete %d read(s).",
+		 function,
+		 number_of_failed_reads );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,155 @@
+/*
+ * Asynchronous IO queue functions
+ *
+ * Copyright (C) 2020-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSXFS_IO_QUEUE_H )
+#define _LIBFSXFS_IO_QUEUE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsxfs_libbfio.h"
+#include "libfsxfs_libcerror.h"
+#include "libfsxfs_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfsxfs_io_queue_batch libfsxfs_io_queue_batch_t;
+
+struct libfsxfs_io_queue_batch
+{
+	/* The number of submitted reads that have not completed
+	 */
+	int number_of_pending_reads;
+
+	/* The number of reads that failed
+	 */
+	int number_of_failed_reads;
+};
+
+typedef struct libfsxfs_io_queue libfsxfs_io_queue_t;
+
+struct libfsxfs_io_queue
+{
+	/* The IO handle passed to the read function
+	 */
+	intptr_t *io_handle;
+
+	/* The file IO handle passed to the read function
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* The read function
+	 */
+	ssize_t (*read_function)(
+	           intptr_t *io_handle,
+	           libbfio_handle_t *file_io_handle,
+	           uint8_t *buffer,
+	           size_t buffer_size,
+	           off64_t file_offset,
+	           libcerror_error_t **error );
+
+	/* The number of threads
+	 */
+	int number_of_threads;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	/* The thread pool that processes the reads
+	 */
+	libcthreads_thread_pool_t *thread_pool;
+
+	/* The mutex that protects the batches
+	 */
+	libcthreads_mutex_t *batch_mutex;
+
+	/* The condition that signals a completed read
+	 */
+	libcthreads_condition_t *completion_condition;
+#endif
+};
+
+typedef struct libfsxfs_io_queue_read libfsxfs_io_queue_read_t;
+
+struct libfsxfs_io_queue_read
+{
+	/* The IO queue
+	 */
+	libfsxfs_io_queue_t *io_queue;
+
+	/* The batch
+	 */
+	libfsxfs_io_queue_batch_t *batch;
+
+	/* The buffer
+	 */
+	uint8_t *buffer;
+
+	/* The buffer size
+	 */
+	size_t buffer_size;
+
+	/* The file offset
+	 */
+	off64_t file_offset;
+};
+
+int libfsxfs_io_queue_initialize(
+     libfsxfs_io_queue_t **io_queue,
+     int number_of_threads,
+     intptr_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     ssize_t (*read_function)(
+              intptr_t *io_handle,
+              libbfio_handle_t *file_io_handle,
+              uint8_t *buffer,
+              size_t buffer_size,
+              off64_t file_offset,
+              libcerror_error_t **error ),
+     libcerror_error_t **error );
+
+int libfsxfs_io_queue_free(
+     libfsxfs_io_queue_t **io_queue,
+     libcerror_error_t **error );
+
+int libfsxfs_io_queue_process_read(
+     libfsxfs_io_queue_read_t *queue_read,
+     libfsxfs_io_queue_t *io_queue );
+
+int libfsxfs_io_queue_submit_read(
+     libfsxfs_io_queue_t *io_queue,
+     libfsxfs_io_queue_batch_t *batch,
+     uint8_t *buffer,
+     size_t buffer_size,
+     off64_t file_offset,
+     libcerror_error_t **error );
+
+int libfsxfs_io_queue_wait(
+     libfsxfs_io_queue_t *io_queue,
+     libfsxfs_io_queue_batch_t *batch,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSXFS_IO_QUEUE_H ) */
+
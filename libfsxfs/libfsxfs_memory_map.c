@@ -0,0 +1,440 @@
+/*
+ * Memory mapped file functions
+ *
+ * Copyright (C) 2020-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_FCNTL_H )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_SYS_STAT_H )
+#include <sys/stat.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#if defined( HAVE_ERRNO_H )
+#include <errno.h>
+#endif
+
+#include "libfsxfs_libcerror.h"
+#include "libfsxfs_memory_map.h"
+
+#if defined( HAVE_LIBFSXFS_MEMORY_MAP_SUPPORT )
+#include <sys/mman.h>
+#endif
+
+/* Creates a memory map
+ * Make sure the value memory_map is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_memory_map_initialize(
+     libfsxfs_memory_map_t **memory_map,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_memory_map_initialize";
+
+	if( memory_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory map.",
+		 function );
+
+		return( -1 );
+	}
+	if( *memory_map != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid memory map value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*memory_map = memory_allocate_structure(
+	               libfsxfs_memory_map_t );
+
+	if( *memory_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create memory map.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *memory_map,
+	     0,
+	     sizeof( libfsxfs_memory_map_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear memory map.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *memory_map != NULL )
+	{
+		memory_free(
+		 *memory_map );
+
+		*memory_map = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a memory map
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_memory_map_free(
+     libfsxfs_memory_map_t **memory_map,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_memory_map_free";
+	int result            = 1;
+
+	if( memory_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory map.",
+		 function );
+
+		return( -1 );
+	}
+	if( *memory_map != NULL )
+	{
+		if( libfsxfs_memory_map_close(
+		     *memory_map,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close memory map.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *memory_map );
+
+		*memory_map = NULL;
+	}
+	return( result );
+}
+
+/* Opens a memory map of a file
+ * The file is mapped read-only, block devices are supported
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_memory_map_open(
+     libfsxfs_memory_map_t *memory_map,
+     const char *filename,
+     libcerror_error_t **error )
+{
+#if defined( HAVE_LIBFSXFS_MEMORY_MAP_SUPPORT )
+	struct stat file_statistics;
+
+	void *data            = NULL;
+	off_t file_size       = 0;
+	int file_descriptor   = -1;
+#endif
+	static char *function = "libfsxfs_memory_map_open";
+
+	if( memory_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory map.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_map->data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid memory map - data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_MEMORY_MAP_SUPPORT )
+	file_descriptor = open(
+	                   filename,
+	                   O_RDONLY );
+
+	if( file_descriptor == -1 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 errno,
+		 "%s: unable to open file: %s.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	if( fstat(
+	     file_descriptor,
+	     &file_statistics ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 errno,
+		 "%s: unable to retrieve file statistics.",
+		 function );
+
+		goto on_error;
+	}
+	if( S_ISREG( file_statistics.st_mode ) )
+	{
+		file_size = file_statistics.st_size;
+	}
+	else
+	{
+		/* The size of a block device is determined by seeking its end
+		 */
+		file_size = lseek(
+		             file_descriptor,
+		             0,
+		             SEEK_END );
+	}
+	if( ( file_size <= 0 )
+	 || ( (uint64_t) file_size > (uint64_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	data = mmap(
+	        NULL,
+	        (size_t) file_size,
+	        PROT_READ,
+	        MAP_SHARED,
+	        file_descriptor,
+	        0 );
+
+	if( data == MAP_FAILED )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 errno,
+		 "%s: unable to map file: %s.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	/* The mapping remains valid after the file descriptor is closed
+	 */
+	if( close(
+	     file_descriptor ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 errno,
+		 "%s: unable to close file: %s.",
+		 function,
+		 filename );
+
+		munmap(
+		 data,
+		 (size_t) file_size );
+
+		return( -1 );
+	}
+	memory_map->data      = (uint8_t *) data;
+	memory_map->data_size = (size64_t) file_size;
+
+	return( 1 );
+
+on_error:
+	if( file_descriptor != -1 )
+	{
+		close(
+		 file_descriptor );
+	}
+	return( -1 );
+#else
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: memory mapped files are not supported.",
+	 function );
+
+	return( -1 );
+#endif /* defined( HAVE_LIBFSXFS_MEMORY_MAP_SUPPORT ) */
+}
+
+/* Closes a memory map
+ * Returns 0 if successful or -1 on error
+ */
+int libfsxfs_memory_map_close(
+     libfsxfs_memory_map_t *memory_map,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_memory_map_close";
+	int result            = 0;
+
+	if( memory_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory map.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_MEMORY_MAP_SUPPORT )
+	if( memory_map->data != NULL )
+	{
+		if( munmap(
+		     memory_map->data,
+		     (size_t) memory_map->data_size ) != 0 )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 errno,
+			 "%s: unable to unmap data.",
+			 function );
+
+			result = -1;
+		}
+	}
+#endif
+	memory_map->data      = NULL;
+	memory_map->data_size = 0;
+
+	return( result );
+}
+
+/* Retrieves the mapped data of a range
+ * Returns 1 if successful, 0 if the range is not mapped or -1 on error
+ */
+int libfsxfs_memory_map_get_data(
+     libfsxfs_memory_map_t *memory_map,
+     off64_t offset,
+     size_t size,
+     const uint8_t **data,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_memory_map_get_data";
+
+	if( memory_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory map.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( memory_map->data == NULL )
+	 || ( (size64_t) offset > memory_map->data_size )
+	 || ( (size64_t) size > ( memory_map->data_size - (size64_t) offset ) ) )
+	{
+		return( 0 );
+	}
+	*data = &( memory_map->data[ offset ] );
+
+	return( 1 );
+}
+
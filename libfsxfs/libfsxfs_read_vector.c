@@ -0,0 +1,138 @@
+/*
+ * Read vector functions
+ *
+ * Copyright (C) 2020-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsxfs_libcerror.h"
+#include "libfsxfs_read_vector.h"
+
+/* Compares two ranges by physical offset, offset and buffer index
+ * Returns -1 if the first range sorts before the second range, 1 if after or 0 if equal
+ */
+int libfsxfs_read_vector_range_compare(
+     libfsxfs_read_vector_range_t *first_range,
+     libfsxfs_read_vector_range_t *second_range )
+{
+	if( first_range->physical_offset != second_range->physical_offset )
+	{
+		return( ( first_range->physical_offset < second_range->physical_offset ) ? -1 : 1 );
+	}
+	if( first_range->offset != second_range->offset )
+	{
+		return( ( first_range->offset < second_range->offset ) ? -1 : 1 );
+	}
+	if( first_range->buffer_index != second_range->buffer_index )
+	{
+		return( ( first_range->buffer_index < second_range->buffer_index ) ? -1 : 1 );
+	}
+	return( 0 );
+}
+
+/* Sorts the ranges by physical offset
+ * The ranges are sorted in place using a heap sort, which does not require additional memory
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_read_vector_ranges_sort(
+     libfsxfs_read_vector_range_t *ranges,
+     int number_of_ranges,
+     libcerror_error_t **error )
+{
+	libfsxfs_read_vector_range_t swap_range;
+
+	static char *function = "libfsxfs_read_vector_ranges_sort";
+	int child_index       = 0;
+	int heap_size         = 0;
+	int parent_index      = 0;
+	int range_index       = 0;
+
+	if( ranges == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid ranges.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_ranges < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of ranges value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	/* The first half of the iterations builds a max-heap, the second half
+	 * repeatedly moves the largest range of the heap to the end of the ranges
+	 */
+	for( range_index = ( number_of_ranges / 2 ) - 1;
+	     range_index >= ( 1 - number_of_ranges );
+	     range_index-- )
+	{
+		if( range_index >= 0 )
+		{
+			parent_index = range_index;
+			heap_size    = number_of_ranges;
+		}
+		else
+		{
+			heap_size = number_of_ranges + range_index;
+
+			swap_range          = ranges[ 0 ];
+			ranges[ 0 ]         = ranges[ heap_size ];
+			ranges[ heap_size ] = swap_range;
+
+			parent_index = 0;
+		}
+		child_index = ( parent_index * 2 ) + 1;
+
+		while( child_index < heap_size )
+		{
+			if( ( ( child_index + 1 ) < heap_size )
+			 && ( libfsxfs_read_vector_range_compare(
+			       &( ranges[ child_index ] ),
+			       &( ranges[ child_index + 1 ] ) ) < 0 ) )
+			{
+				child_index++;
+			}
+			if( libfsxfs_read_vector_range_compare(
+			     &( ranges[ parent_index ] ),
+			     &( ranges[ child_index ] ) ) >= 0 )
+			{
+				break;
+			}
+			swap_range             = ranges[ parent_index ];
+			ranges[ parent_index ] = ranges[ child_index ];
+			ranges[ child_index ]  = swap_range;
+
+			parent_index = child_index;
+			child_index  = ( parent_index * 2 ) + 1;
+		}
+	}
+	return( 1 );
+}
+
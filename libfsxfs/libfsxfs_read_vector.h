@@ -0,0 +1,69 @@
+/*
+ * Read vector functions
+ *
+ * Copyright (C) 2020-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSXFS_READ_VECTOR_H )
+#define _LIBFSXFS_READ_VECTOR_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsxfs_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfsxfs_read_vector_range libfsxfs_read_vector_range_t;
+
+struct libfsxfs_read_vector_range
+{
+	/* The physical offset of the start of the range or -1 if the start is not stored
+	 */
+	off64_t physical_offset;
+
+	/* The (logical) offset
+	 */
+	off64_t offset;
+
+	/* The size
+	 */
+	size_t size;
+
+	/* The index of the buffer of the range
+	 */
+	int buffer_index;
+};
+
+int libfsxfs_read_vector_range_compare(
+     libfsxfs_read_vector_range_t *first_range,
+     libfsxfs_read_vector_range_t *second_range );
+
+int libfsxfs_read_vector_ranges_sort(
+     libfsxfs_read_vector_range_t *ranges,
+     int number_of_ranges,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSXFS_READ_VECTOR_H ) */
+
@@ -24,6 +24,7 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libfsxfs_checksum.h"
 #include "libfsxfs_debug.h"
 #include "libfsxfs_libbfio.h"
 #include "libfsxfs_libcerror.h"
@@ -885,6 +886,184 @@ int libfsxfs_superblock_read_file_io_handle(
 	return( 1 );
 }
 
+/* Verifies the superblock checksum
+ * The checksum is only verified for format version 5
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_superblock_verify_checksum(
+     libfsxfs_superblock_t *superblock,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_superblock_verify_checksum";
+
+	if( superblock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid superblock.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < (size_t) superblock->sector_size )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( superblock->format_version != 5 )
+	{
+		return( 1 );
+	}
+	/* The checksum is stored at offset 224 and covers the sector
+	 * that contains the superblock
+	 */
+	if( libfsxfs_checksum_verify_metadata_checksum(
+	     data,
+	     (size_t) superblock->sector_size,
+	     224,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_CHECKSUM_MISMATCH,
+		 "%s: unable to verify superblock checksum.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Verifies the superblock checksum using a Basic File IO (bfio) handle
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_superblock_verify_checksum_file_io_handle(
+     libfsxfs_superblock_t *superblock,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     libcerror_error_t **error )
+{
+	uint8_t *data         = NULL;
+	static char *function = "libfsxfs_superblock_verify_checksum_file_io_handle";
+	size_t data_size      = 0;
+	ssize_t read_count    = 0;
+
+	if( superblock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid superblock.",
+		 function );
+
+		return( -1 );
+	}
+	if( superblock->format_version != 5 )
+	{
+		return( 1 );
+	}
+	data_size = (size_t) superblock->sector_size;
+
+	if( data_size < 512 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid superblock - sector size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * data_size );
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data.",
+		 function );
+
+		goto on_error;
+	}
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              data,
+	              data_size,
+	              file_offset,
+	              error );
+
+	if( read_count != (ssize_t) data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read superblock at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 file_offset,
+		 file_offset );
+
+		goto on_error;
+	}
+	if( libfsxfs_superblock_verify_checksum(
+	     superblock,
+	     data,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_CHECKSUM_MISMATCH,
+		 "%s: unable to verify superblock at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 file_offset,
+		 file_offset );
+
+		goto on_error;
+	}
+	memory_free(
+	 data );
+
+	return( 1 );
+
+on_error:
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( -1 );
+}
+
 /* Retrieves the size of the UTF-8 encoded volume label
  * The returned size includes the end of string character
  * Returns 1 if successful, 0 if not available or -1 on error
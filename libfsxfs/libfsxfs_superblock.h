@@ -119,6 +119,18 @@ int libfsxfs_superblock_read_file_io_handle(
      off64_t file_offset,
      libcerror_error_t **error );
 
+int libfsxfs_superblock_verify_checksum(
+     libfsxfs_superblock_t *superblock,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libfsxfs_superblock_verify_checksum_file_io_handle(
+     libfsxfs_superblock_t *superblock,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     libcerror_error_t **error );
+
 int libfsxfs_superblock_get_utf8_volume_label_size(
      libfsxfs_superblock_t *superblock,
      size_t *utf8_string_size,
@@ -25,6 +25,7 @@
 #include <types.h>
 #include <wide_string.h>
 
+#include "libfsxfs_block_cache.h"
 #include "libfsxfs_debug.h"
 #include "libfsxfs_definitions.h"
 #include "libfsxfs_directory_entry.h"
@@ -32,11 +33,13 @@
 #include "libfsxfs_file_system.h"
 #include "libfsxfs_inode.h"
 #include "libfsxfs_io_handle.h"
+#include "libfsxfs_io_queue.h"
 #include "libfsxfs_libcdata.h"
 #include "libfsxfs_libcerror.h"
 #include "libfsxfs_libcnotify.h"
 #include "libfsxfs_libcthreads.h"
 #include "libfsxfs_libuna.h"
+#include "libfsxfs_memory_map.h"
 #include "libfsxfs_superblock.h"
 #include "libfsxfs_volume.h"
 
@@ -132,6 +135,12 @@ int libfsxfs_volume_initialize(
 		goto on_error;
 	}
 #endif
+	internal_volume->maximum_inode_cache_size              = LIBFSXFS_DEFAULT_MAXIMUM_INODE_CACHE_SIZE;
+	internal_volume->maximum_block_cache_size              = LIBFSXFS_DEFAULT_MAXIMUM_BLOCK_CACHE_SIZE;
+	internal_volume->maximum_number_of_dentry_cache_values = LIBFSXFS_DEFAULT_MAXIMUM_NUMBER_OF_DENTRY_CACHE_VALUES;
+	internal_volume->maximum_read_ahead_size               = LIBFSXFS_DEFAULT_MAXIMUM_READ_AHEAD_SIZE;
+	internal_volume->use_inode_chunk_index                 = 1;
+
 	*volume = (libfsxfs_volume_t *) internal_volume;
 
 	return( 1 );
@@ -279,6 +288,7 @@ int libfsxfs_volume_open(
 {
 	libbfio_handle_t *file_io_handle            = NULL;
 	libfsxfs_internal_volume_t *internal_volume = NULL;
+	libfsxfs_memory_map_t *memory_map           = NULL;
 	static char *function                       = "libfsxfs_volume_open";
 
 	if( volume == NULL )
@@ -373,6 +383,52 @@ int libfsxfs_volume_open(
 
 		goto on_error;
 	}
+	if( internal_volume->use_memory_map != 0 )
+	{
+		if( internal_volume->io_handle->memory_map != NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+			 "%s: invalid volume - invalid IO handle - memory map value already set.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfsxfs_memory_map_initialize(
+		     &memory_map,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create memory map.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfsxfs_memory_map_open(
+		     memory_map,
+		     filename,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open memory map of: %s.",
+			 function,
+			 filename );
+
+			goto on_error;
+		}
+		/* The memory map is set before the volume is opened so that
+		 * the metadata is read from the memory map
+		 */
+		internal_volume->io_handle->memory_map = memory_map;
+	}
 	if( libfsxfs_volume_open_file_io_handle(
 	     volume,
 	     file_io_handle,
@@ -426,6 +482,16 @@ int libfsxfs_volume_open(
 	return( 1 );
 
 on_error:
+	if( memory_map != NULL )
+	{
+		if( internal_volume->io_handle->memory_map == memory_map )
+		{
+			internal_volume->io_handle->memory_map = NULL;
+		}
+		libfsxfs_memory_map_free(
+		 &memory_map,
+		 NULL );
+	}
 	if( file_io_handle != NULL )
 	{
 		libbfio_handle_free(
@@ -778,16 +844,26 @@ on_error:
 	return( -1 );
 }
 
-/* Closes a volume
- * Returns 0 if successful or -1 on error
+/* Opens a volume using a Basic File IO (bfio) pool
+ * Every handle in the pool must refer to the same volume data, the first handle
+ * is used to read the metadata and file data is read using all the handles
+ * Returns 1 if successful or -1 on error
  */
-int libfsxfs_volume_close(
+int libfsxfs_volume_open_file_io_pool(
      libfsxfs_volume_t *volume,
+     libbfio_pool_t *file_io_pool,
+     int access_flags,
      libcerror_error_t **error )
 {
-	libfsxfs_internal_volume_t *internal_volume = NULL;
-	static char *function                       = "libfsxfs_volume_close";
-	int result                                  = 0;
+	libbfio_handle_t *file_io_handle                = NULL;
+	libfsxfs_internal_volume_t *internal_volume     = NULL;
+	uint8_t *file_io_pool_entries_opened_in_library = NULL;
+	static char *function                           = "libfsxfs_volume_open_file_io_pool";
+	int bfio_access_flags                           = 0;
+	int file_io_handle_is_open                      = 0;
+	int maximum_number_of_open_handles              = 0;
+	int number_of_handles                           = 0;
+	int pool_entry                                  = 0;
 
 	if( volume == NULL )
 	{
@@ -802,395 +878,2135 @@ int libfsxfs_volume_close(
 	}
 	internal_volume = (libfsxfs_internal_volume_t *) volume;
 
-	if( internal_volume->file_io_handle == NULL )
+	if( internal_volume->file_io_handle != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid volume - missing file IO handle.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid volume - file IO handle already set.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
-	     internal_volume->read_write_lock,
-	     error ) != 1 )
+	if( file_io_pool == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO pool.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	if( ( ( access_flags & LIBFSXFS_ACCESS_FLAG_READ ) == 0 )
+	 && ( ( access_flags & LIBFSXFS_ACCESS_FLAG_WRITE ) == 0 ) )
 	{
-		if( internal_volume->file_io_handle_created_in_library != 0 )
-		{
-			if( libfsxfs_debug_print_read_offsets(
-			     internal_volume->file_io_handle,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
-				 "%s: unable to print the read offsets.",
-				 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access flags.",
+		 function );
 
-				result = -1;
-			}
-		}
+		return( -1 );
 	}
-#endif
-	if( internal_volume->file_io_handle_opened_in_library != 0 )
+	if( ( access_flags & LIBFSXFS_ACCESS_FLAG_WRITE ) != 0 )
 	{
-		if( libbfio_handle_close(
-		     internal_volume->file_io_handle,
-		     error ) != 0 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
-			 "%s: unable to close file IO handle.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: write access currently not supported.",
+		 function );
 
-			result = -1;
-		}
-		internal_volume->file_io_handle_opened_in_library = 0;
+		return( -1 );
 	}
-	if( internal_volume->file_io_handle_created_in_library != 0 )
+	if( ( access_flags & LIBFSXFS_ACCESS_FLAG_READ ) != 0 )
 	{
-		if( libbfio_handle_free(
-		     &( internal_volume->file_io_handle ),
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free file IO handle.",
-			 function );
-
-			result = -1;
-		}
-		internal_volume->file_io_handle_created_in_library = 0;
+		bfio_access_flags = LIBBFIO_ACCESS_FLAG_READ;
 	}
-	internal_volume->file_io_handle = NULL;
-
-	if( libfsxfs_io_handle_clear(
-	     internal_volume->io_handle,
+	if( libbfio_pool_get_number_of_handles(
+	     file_io_pool,
+	     &number_of_handles,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to clear IO handle.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of handles in file IO pool.",
 		 function );
 
-		result = -1;
-	}
-	if( internal_volume->superblock != NULL )
-	{
-		if( libfsxfs_superblock_free(
-		     &( internal_volume->superblock ),
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free superblock.",
-			 function );
-
-			result = -1;
-		}
-	}
-	if( internal_volume->file_system != NULL )
-	{
-		if( libfsxfs_file_system_free(
-		     &( internal_volume->file_system ),
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free file system.",
-			 function );
-
-			result = -1;
-		}
+		goto on_error;
 	}
-#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
-	     internal_volume->read_write_lock,
-	     error ) != 1 )
+	if( number_of_handles <= 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file IO pool - number of handles value out of bounds.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-#endif
-	return( result );
-}
-
-/* Opens a volume for reading
- * Returns 1 if successful or -1 on error
- */
-int libfsxfs_internal_volume_open_read(
-     libfsxfs_internal_volume_t *internal_volume,
-     libbfio_handle_t *file_io_handle,
-     libcerror_error_t **error )
-{
-	libfsxfs_superblock_t *superblock = NULL;
-	static char *function             = "libfsxfs_internal_volume_open_read";
-	off64_t allocation_group_size     = 0;
-	off64_t inode_information_offset  = 0;
-	off64_t superblock_offset         = 0;
-	uint32_t allocation_group_index   = 0;
-
-	if( internal_volume == NULL )
+	if( libbfio_pool_get_maximum_number_of_open_handles(
+	     file_io_pool,
+	     &maximum_number_of_open_handles,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid internal volume.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve maximum number of open handles of file IO pool.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( internal_volume->io_handle == NULL )
+	/* The handles are used directly, hence the pool should not close them
+	 */
+	if( ( maximum_number_of_open_handles != LIBBFIO_POOL_UNLIMITED_NUMBER_OF_OPEN_HANDLES )
+	 && ( maximum_number_of_open_handles < number_of_handles ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid internal volume - missing IO handle.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file IO pool - maximum number of open handles value out of bounds.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( internal_volume->superblock != NULL )
+	/* Only the handles opened by the library are closed, handles opened by the caller are left open
+	 */
+	file_io_pool_entries_opened_in_library = (uint8_t *) memory_allocate(
+	                                                      sizeof( uint8_t ) * number_of_handles );
+
+	if( file_io_pool_entries_opened_in_library == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid volume - superblock value already set.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create file IO pool entries opened in library.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( internal_volume->file_system != NULL )
+	if( memory_set(
+	     file_io_pool_entries_opened_in_library,
+	     0,
+	     sizeof( uint8_t ) * number_of_handles ) == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid volume - file system value already set.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear file IO pool entries opened in library.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	do
+	for( pool_entry = 0;
+	     pool_entry < number_of_handles;
+	     pool_entry++ )
 	{
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "Reading superblock: %" PRIu32 " at offset: %" PRIi64 " (0x%08" PRIx64 ").\n",
-			 allocation_group_index,
-			 superblock_offset,
-			 superblock_offset );
-		}
-#endif
-		if( libfsxfs_superblock_initialize(
-		     &superblock,
+		if( libbfio_pool_get_handle(
+		     file_io_pool,
+		     pool_entry,
+		     &file_io_handle,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create superblock: %" PRIu32 ".",
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file IO handle: %d from pool.",
 			 function,
-			 allocation_group_index );
+			 pool_entry );
 
 			goto on_error;
 		}
-		if( libfsxfs_superblock_read_file_io_handle(
-		     superblock,
-		     file_io_handle,
-		     superblock_offset,
-		     error ) != 1 )
+		file_io_handle_is_open = libbfio_handle_is_open(
+		                          file_io_handle,
+		                          error );
+
+		if( file_io_handle_is_open == -1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read superblock: %" PRIu32 " at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to determine if file IO handle: %d is open.",
 			 function,
-			 allocation_group_index,
-			 superblock_offset,
-			 superblock_offset );
+			 pool_entry );
 
 			goto on_error;
 		}
-		if( internal_volume->superblock == NULL )
+		else if( file_io_handle_is_open == 0 )
 		{
-			internal_volume->superblock                                      = superblock;
-			internal_volume->io_handle->format_version                       = superblock->format_version;
-			internal_volume->io_handle->secondary_feature_flags              = superblock->secondary_feature_flags;
-			internal_volume->io_handle->block_size                           = superblock->block_size;
-			internal_volume->io_handle->allocation_group_size                = superblock->allocation_group_size;
-			internal_volume->io_handle->inode_size                           = superblock->inode_size;
-			internal_volume->io_handle->directory_block_size                 = superblock->directory_block_size;
-			internal_volume->io_handle->number_of_relative_block_number_bits = superblock->number_of_relative_block_number_bits;
-			internal_volume->io_handle->number_of_relative_inode_number_bits = superblock->number_of_relative_inode_number_bits;
+			if( libbfio_pool_open(
+			     file_io_pool,
+			     pool_entry,
+			     bfio_access_flags,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_OPEN_FAILED,
+				 "%s: unable to open file IO handle: %d in pool.",
+				 function,
+				 pool_entry );
 
-			superblock = NULL;
+				goto on_error;
+			}
+			file_io_pool_entries_opened_in_library[ pool_entry ] = 1;
 		}
-		inode_information_offset = superblock_offset + 2 * internal_volume->superblock->sector_size;
+	}
+	if( libbfio_pool_get_handle(
+	     file_io_pool,
+	     0,
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file IO handle: 0 from pool.",
+		 function );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
+		goto on_error;
+	}
+	if( libfsxfs_internal_volume_open_read(
+	     internal_volume,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read from file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	internal_volume->file_io_handle                            = file_io_handle;
+	internal_volume->file_io_pool                              = file_io_pool;
+	internal_volume->file_io_pool_entries_opened_in_library    = file_io_pool_entries_opened_in_library;
+	internal_volume->io_handle->file_io_pool                   = file_io_pool;
+	internal_volume->io_handle->number_of_file_io_pool_handles = number_of_handles;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		internal_volume->file_io_handle                            = NULL;
+		internal_volume->file_io_pool                              = NULL;
+		internal_volume->file_io_pool_entries_opened_in_library    = NULL;
+		internal_volume->io_handle->file_io_pool                   = NULL;
+		internal_volume->io_handle->number_of_file_io_pool_handles = 0;
+
+		goto on_error;
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( file_io_pool_entries_opened_in_library != NULL )
+	{
+		for( pool_entry = 0;
+		     pool_entry < number_of_handles;
+		     pool_entry++ )
 		{
-			libcnotify_printf(
-			 "Reading inode information: %" PRIu32 " at offset: %" PRIi64 " (0x%08" PRIx64 ").\n",
-			 allocation_group_index,
-			 inode_information_offset,
-			 inode_information_offset );
+			if( file_io_pool_entries_opened_in_library[ pool_entry ] != 0 )
+			{
+				libbfio_pool_close(
+				 file_io_pool,
+				 pool_entry,
+				 NULL );
+			}
 		}
+		memory_free(
+		 file_io_pool_entries_opened_in_library );
+	}
+	return( -1 );
+}
+
+/* Closes a volume
+ * Returns 0 if successful or -1 on error
+ */
+int libfsxfs_volume_close(
+     libfsxfs_volume_t *volume,
+     libcerror_error_t **error )
+{
+	libfsxfs_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfsxfs_volume_close";
+	int pool_entry                              = 0;
+	int result                                  = 0;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsxfs_internal_volume_t *) volume;
+
+	if( internal_volume->file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
 #endif
-		if( internal_volume->file_system == NULL )
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		if( internal_volume->file_io_handle_created_in_library != 0 )
 		{
-			if( libfsxfs_file_system_initialize(
-			     &( internal_volume->file_system ),
-			     internal_volume->superblock->root_directory_inode_number,
+			if( libfsxfs_debug_print_read_offsets(
+			     internal_volume->file_io_handle,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create file system.",
+				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+				 "%s: unable to print the read offsets.",
 				 function );
 
-				goto on_error;
+				result = -1;
 			}
 		}
-		if( libfsxfs_file_system_read_inode_information(
-		     internal_volume->file_system,
-		     internal_volume->io_handle,
-		     file_io_handle,
-		     inode_information_offset,
+	}
+#endif
+	/* The IO queue is freed before the file IO handle it reads from is closed
+	 */
+	if( internal_volume->io_handle->io_queue != NULL )
+	{
+		if( libfsxfs_io_queue_free(
+		     &( internal_volume->io_handle->io_queue ),
 		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free IO queue.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_volume->file_io_handle_opened_in_library != 0 )
+	{
+		if( libbfio_handle_close(
+		     internal_volume->file_io_handle,
+		     error ) != 0 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read inode B+ tree.",
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close file IO handle.",
 			 function );
 
-			goto on_error;
+			result = -1;
 		}
-		if( superblock != NULL )
+		internal_volume->file_io_handle_opened_in_library = 0;
+	}
+	if( internal_volume->file_io_handle_created_in_library != 0 )
+	{
+		if( libbfio_handle_free(
+		     &( internal_volume->file_io_handle ),
+		     error ) != 1 )
 		{
-			if( libfsxfs_superblock_free(
-			     &superblock,
-			     error ) != 1 )
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file IO handle.",
+			 function );
+
+			result = -1;
+		}
+		internal_volume->file_io_handle_created_in_library = 0;
+	}
+	internal_volume->file_io_handle = NULL;
+
+	if( internal_volume->file_io_pool_entries_opened_in_library != NULL )
+	{
+		for( pool_entry = 0;
+		     pool_entry < internal_volume->io_handle->number_of_file_io_pool_handles;
+		     pool_entry++ )
+		{
+			if( internal_volume->file_io_pool_entries_opened_in_library[ pool_entry ] == 0 )
+			{
+				continue;
+			}
+			if( libbfio_pool_close(
+			     internal_volume->file_io_pool,
+			     pool_entry,
+			     error ) != 0 )
 			{
 				libcerror_error_set(
 				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free superblock.",
-				 function );
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close file IO pool handle: %d.",
+				 function,
+				 pool_entry );
 
-				goto on_error;
+				result = -1;
 			}
 		}
-		allocation_group_size = (off64_t) internal_volume->io_handle->allocation_group_size * internal_volume->io_handle->block_size;
+		memory_free(
+		 internal_volume->file_io_pool_entries_opened_in_library );
 
-		if( ( allocation_group_size == 0 )
-		 || ( superblock_offset > ( (off64_t) INT64_MAX - allocation_group_size ) ) )
+		internal_volume->file_io_pool_entries_opened_in_library = NULL;
+	}
+	internal_volume->file_io_pool = NULL;
+
+	if( libfsxfs_io_handle_clear(
+	     internal_volume->io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear IO handle.",
+		 function );
+
+		result = -1;
+	}
+	if( internal_volume->superblock != NULL )
+	{
+		if( libfsxfs_superblock_free(
+		     &( internal_volume->superblock ),
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: invalid next superblock offset value out of bounds.",
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free superblock.",
 			 function );
 
-			goto on_error;
+			result = -1;
 		}
-		superblock_offset += allocation_group_size;
-
+	}
+	if( internal_volume->file_system != NULL )
+	{
+		if( libfsxfs_file_system_free(
+		     &( internal_volume->file_system ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file system.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Opens a volume for reading
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_internal_volume_open_read(
+     libfsxfs_internal_volume_t *internal_volume,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	libfsxfs_superblock_t *superblock = NULL;
+	static char *function             = "libfsxfs_internal_volume_open_read";
+	off64_t allocation_group_size     = 0;
+	off64_t superblock_offset         = 0;
+	uint32_t allocation_group_index   = 0;
+
+	if( internal_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid internal volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_volume->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid internal volume - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_volume->superblock != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid volume - superblock value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_volume->file_system != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid volume - file system value already set.",
+		 function );
+
+		return( -1 );
+	}
+	do
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "Reading superblock: %" PRIu32 " at offset: %" PRIi64 " (0x%08" PRIx64 ").\n",
+			 allocation_group_index,
+			 superblock_offset,
+			 superblock_offset );
+		}
+#endif
+		if( libfsxfs_superblock_initialize(
+		     &superblock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create superblock: %" PRIu32 ".",
+			 function,
+			 allocation_group_index );
+
+			goto on_error;
+		}
+		if( libfsxfs_superblock_read_file_io_handle(
+		     superblock,
+		     file_io_handle,
+		     superblock_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read superblock: %" PRIu32 " at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 allocation_group_index,
+			 superblock_offset,
+			 superblock_offset );
+
+			goto on_error;
+		}
+		if( internal_volume->verify_checksums != 0 )
+		{
+			if( libfsxfs_superblock_verify_checksum_file_io_handle(
+			     superblock,
+			     file_io_handle,
+			     superblock_offset,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_INPUT,
+				 LIBCERROR_INPUT_ERROR_CHECKSUM_MISMATCH,
+				 "%s: unable to verify superblock: %" PRIu32 ".",
+				 function,
+				 allocation_group_index );
+
+				goto on_error;
+			}
+		}
+		if( internal_volume->superblock == NULL )
+		{
+			internal_volume->superblock                                      = superblock;
+			internal_volume->io_handle->format_version                       = superblock->format_version;
+			internal_volume->io_handle->feature_flags                        = superblock->feature_flags;
+			internal_volume->io_handle->secondary_feature_flags              = superblock->secondary_feature_flags;
+			internal_volume->io_handle->sector_size                          = superblock->sector_size;
+			internal_volume->io_handle->block_size                           = superblock->block_size;
+			internal_volume->io_handle->allocation_group_size                = superblock->allocation_group_size;
+			internal_volume->io_handle->inode_size                           = superblock->inode_size;
+			internal_volume->io_handle->directory_block_size                 = superblock->directory_block_size;
+			internal_volume->io_handle->number_of_relative_block_number_bits = superblock->number_of_relative_block_number_bits;
+			internal_volume->io_handle->number_of_relative_inode_number_bits = superblock->number_of_relative_inode_number_bits;
+			internal_volume->io_handle->maximum_read_ahead_size              = internal_volume->maximum_read_ahead_size;
+			internal_volume->io_handle->verify_checksums                     = internal_volume->verify_checksums;
+
+			superblock = NULL;
+
+			if( ( internal_volume->maximum_block_cache_size > 0 )
+			 && ( internal_volume->io_handle->block_cache == NULL ) )
+			{
+				if( libfsxfs_block_cache_initialize(
+				     &( internal_volume->io_handle->block_cache ),
+				     internal_volume->maximum_block_cache_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+					 "%s: unable to create block cache.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			if( ( internal_volume->number_of_io_threads > 0 )
+			 && ( internal_volume->io_handle->io_queue == NULL ) )
+			{
+				if( libfsxfs_io_queue_initialize(
+				     &( internal_volume->io_handle->io_queue ),
+				     internal_volume->number_of_io_threads,
+				     (intptr_t *) internal_volume->io_handle,
+				     file_io_handle,
+				     (ssize_t (*)(intptr_t *, libbfio_handle_t *, uint8_t *, size_t, off64_t, libcerror_error_t **)) &libfsxfs_io_handle_read_data_at_offset,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+					 "%s: unable to create IO queue.",
+					 function );
+
+					goto on_error;
+				}
+			}
+		}
+		if( internal_volume->file_system == NULL )
+		{
+			if( libfsxfs_file_system_initialize(
+			     &( internal_volume->file_system ),
+			     internal_volume->superblock->root_directory_inode_number,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create file system.",
+				 function );
+
+				goto on_error;
+			}
+			if( libfsxfs_file_system_set_maximum_inode_cache_size(
+			     internal_volume->file_system,
+			     internal_volume->maximum_inode_cache_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set maximum inode cache size.",
+				 function );
+
+				goto on_error;
+			}
+			if( libfsxfs_file_system_set_maximum_number_of_dentry_cache_values(
+			     internal_volume->file_system,
+			     internal_volume->maximum_number_of_dentry_cache_values,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set maximum number of dentry cache values.",
+				 function );
+
+				goto on_error;
+			}
+			if( libfsxfs_file_system_set_use_inode_chunk_index(
+			     internal_volume->file_system,
+			     internal_volume->use_inode_chunk_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set use inode chunk index.",
+				 function );
+
+				goto on_error;
+			}
+			if( libfsxfs_file_system_set_number_of_allocation_groups(
+			     internal_volume->file_system,
+			     internal_volume->superblock->number_of_allocation_groups,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set number of allocation groups.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		/* Without validation the inode information of an allocation group is read on first use
+		 * With an IO queue the allocation groups are read in batches after the loop
+		 */
+		if( ( internal_volume->validate_allocation_groups == 0 )
+		 || ( internal_volume->io_handle->io_queue != NULL ) )
+		{
+			break;
+		}
+		if( libfsxfs_file_system_read_inode_information(
+		     internal_volume->file_system,
+		     internal_volume->io_handle,
+		     file_io_handle,
+		     allocation_group_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read inode information: %" PRIu32 ".",
+			 function,
+			 allocation_group_index );
+
+			goto on_error;
+		}
+		if( superblock != NULL )
+		{
+			if( libfsxfs_superblock_free(
+			     &superblock,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free superblock.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		allocation_group_size = (off64_t) internal_volume->io_handle->allocation_group_size * internal_volume->io_handle->block_size;
+
+		if( ( allocation_group_size == 0 )
+		 || ( superblock_offset > ( (off64_t) INT64_MAX - allocation_group_size ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid next superblock offset value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		superblock_offset += allocation_group_size;
+
 		allocation_group_index++;
 	}
-	while( allocation_group_index < internal_volume->superblock->number_of_allocation_groups );
+	while( allocation_group_index < internal_volume->superblock->number_of_allocation_groups );
+
+	if( internal_volume->validate_allocation_groups != 0 )
+	{
+		if( internal_volume->io_handle->io_queue != NULL )
+		{
+			if( libfsxfs_internal_volume_read_allocation_groups(
+			     internal_volume,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read allocation groups.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		else if( allocation_group_index != internal_volume->superblock->number_of_allocation_groups )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid last allocation group index value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( internal_volume->io_handle->io_queue != NULL )
+	{
+		libfsxfs_io_queue_free(
+		 &( internal_volume->io_handle->io_queue ),
+		 NULL );
+	}
+	if( internal_volume->io_handle->block_cache != NULL )
+	{
+		libfsxfs_block_cache_free(
+		 &( internal_volume->io_handle->block_cache ),
+		 NULL );
+	}
+	if( internal_volume->file_system != NULL )
+	{
+		libfsxfs_file_system_free(
+		 &( internal_volume->file_system ),
+		 NULL );
+	}
+	if( internal_volume->superblock != NULL )
+	{
+		libfsxfs_superblock_free(
+		 &( internal_volume->superblock ),
+		 NULL );
+	}
+	if( superblock != NULL )
+	{
+		libfsxfs_superblock_free(
+		 &superblock,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads the superblock and inode information of all allocation groups using the IO queue
+ * The reads of a batch of allocation groups are submitted together and their results
+ * are processed in allocation group order
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_internal_volume_read_allocation_groups(
+     libfsxfs_internal_volume_t *internal_volume,
+     libcerror_error_t **error )
+{
+	libfsxfs_io_queue_batch_t batch;
+
+	libfsxfs_superblock_t *superblock          = NULL;
+	uint8_t *headers_data                      = NULL;
+	static char *function                      = "libfsxfs_internal_volume_read_allocation_groups";
+	size_t header_data_size                    = 512;
+	size_t headers_data_offset                 = 0;
+	off64_t allocation_group_offset            = 0;
+	off64_t allocation_group_size              = 0;
+	uint32_t allocation_group_index            = 0;
+	uint32_t batch_allocation_group_index      = 0;
+	uint32_t number_of_allocation_groups       = 0;
+	uint32_t number_of_batch_allocation_groups = 0;
+	uint8_t batch_submitted                    = 0;
+
+	if( internal_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid internal volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_volume->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid internal volume - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_volume->io_handle->io_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid internal volume - invalid IO handle - missing IO queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_volume->superblock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid internal volume - missing superblock.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_allocation_groups = internal_volume->superblock->number_of_allocation_groups;
+
+	allocation_group_size = (off64_t) internal_volume->io_handle->allocation_group_size * internal_volume->io_handle->block_size;
+
+	if( ( allocation_group_size == 0 )
+	 || ( number_of_allocation_groups == 0 )
+	 || ( allocation_group_size > ( (off64_t) INT64_MAX / number_of_allocation_groups ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid allocation group size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* Each allocation group requires a sector for the superblock and a sector for the inode information
+	 */
+	if( internal_volume->io_handle->sector_size > 512 )
+	{
+		header_data_size = (size_t) internal_volume->io_handle->sector_size;
+	}
+	headers_data = (uint8_t *) memory_allocate(
+	                            sizeof( uint8_t ) * LIBFSXFS_ALLOCATION_GROUP_SCAN_BATCH_SIZE * 2 * header_data_size );
+
+	if( headers_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create headers data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsxfs_superblock_initialize(
+	     &superblock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create superblock.",
+		 function );
+
+		goto on_error;
+	}
+	batch.number_of_pending_reads = 0;
+	batch.number_of_failed_reads  = 0;
+
+	while( allocation_group_index < number_of_allocation_groups )
+	{
+		number_of_batch_allocation_groups = number_of_allocation_groups - allocation_group_index;
+
+		if( number_of_batch_allocation_groups > LIBFSXFS_ALLOCATION_GROUP_SCAN_BATCH_SIZE )
+		{
+			number_of_batch_allocation_groups = LIBFSXFS_ALLOCATION_GROUP_SCAN_BATCH_SIZE;
+		}
+		batch_submitted     = 1;
+		headers_data_offset = 0;
+
+		for( batch_allocation_group_index = 0;
+		     batch_allocation_group_index < number_of_batch_allocation_groups;
+		     batch_allocation_group_index++ )
+		{
+			allocation_group_offset = (off64_t) ( allocation_group_index + batch_allocation_group_index ) * allocation_group_size;
+
+			if( libfsxfs_io_queue_submit_read(
+			     internal_volume->io_handle->io_queue,
+			     &batch,
+			     &( headers_data[ headers_data_offset ] ),
+			     header_data_size,
+			     allocation_group_offset,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to submit read of superblock: %" PRIu32 ".",
+				 function,
+				 allocation_group_index + batch_allocation_group_index );
+
+				goto on_error;
+			}
+			if( libfsxfs_io_queue_submit_read(
+			     internal_volume->io_handle->io_queue,
+			     &batch,
+			     &( headers_data[ headers_data_offset + header_data_size ] ),
+			     header_data_size,
+			     allocation_group_offset + ( 2 * (off64_t) internal_volume->io_handle->sector_size ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to submit read of inode information: %" PRIu32 ".",
+				 function,
+				 allocation_group_index + batch_allocation_group_index );
+
+				goto on_error;
+			}
+			headers_data_offset += 2 * header_data_size;
+		}
+		batch_submitted = 0;
+
+		if( libfsxfs_io_queue_wait(
+		     internal_volume->io_handle->io_queue,
+		     &batch,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read headers of allocation groups: %" PRIu32 " to %" PRIu32 ".",
+			 function,
+			 allocation_group_index,
+			 allocation_group_index + number_of_batch_allocation_groups - 1 );
+
+			goto on_error;
+		}
+		headers_data_offset = 0;
+
+		for( batch_allocation_group_index = 0;
+		     batch_allocation_group_index < number_of_batch_allocation_groups;
+		     batch_allocation_group_index++ )
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "Reading superblock and inode information: %" PRIu32 ".\n",
+				 allocation_group_index );
+			}
+#endif
+			if( libfsxfs_superblock_read_data(
+			     superblock,
+			     &( headers_data[ headers_data_offset ] ),
+			     512,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read superblock: %" PRIu32 ".",
+				 function,
+				 allocation_group_index );
+
+				goto on_error;
+			}
+			if( internal_volume->io_handle->verify_checksums != 0 )
+			{
+				if( libfsxfs_superblock_verify_checksum(
+				     superblock,
+				     &( headers_data[ headers_data_offset ] ),
+				     header_data_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_INPUT,
+					 LIBCERROR_INPUT_ERROR_CHECKSUM_MISMATCH,
+					 "%s: unable to verify superblock: %" PRIu32 ".",
+					 function,
+					 allocation_group_index );
+
+					goto on_error;
+				}
+			}
+			if( libfsxfs_file_system_read_inode_information_data(
+			     internal_volume->file_system,
+			     internal_volume->io_handle,
+			     allocation_group_index,
+			     &( headers_data[ headers_data_offset + header_data_size ] ),
+			     header_data_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read inode information: %" PRIu32 ".",
+				 function,
+				 allocation_group_index );
+
+				goto on_error;
+			}
+			headers_data_offset += 2 * header_data_size;
+
+			allocation_group_index++;
+		}
+	}
+	if( libfsxfs_superblock_free(
+	     &superblock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free superblock.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 headers_data );
+
+	return( 1 );
+
+on_error:
+	if( batch_submitted != 0 )
+	{
+		libfsxfs_io_queue_wait(
+		 internal_volume->io_handle->io_queue,
+		 &batch,
+		 NULL );
+	}
+	if( superblock != NULL )
+	{
+		libfsxfs_superblock_free(
+		 &superblock,
+		 NULL );
+	}
+	if( headers_data != NULL )
+	{
+		memory_free(
+		 headers_data );
+	}
+	return( -1 );
+}
+
+/* Sets the maximum (estimated) memory size of the inode cache
+ * A maximum size of 0 disables the inode cache
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_volume_set_maximum_inode_cache_size(
+     libfsxfs_volume_t *volume,
+     size_t maximum_cache_size,
+     libcerror_error_t **error )
+{
+	libfsxfs_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfsxfs_volume_set_maximum_inode_cache_size";
+	int result                                  = 1;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsxfs_internal_volume_t *) volume;
+
+	if( maximum_cache_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid maximum cache size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	internal_volume->maximum_inode_cache_size = maximum_cache_size;
+
+	if( internal_volume->file_system != NULL )
+	{
+		if( libfsxfs_file_system_set_maximum_inode_cache_size(
+		     internal_volume->file_system,
+		     maximum_cache_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set maximum inode cache size.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Sets the maximum number of values in the directory entry (dentry) cache
+ * A maximum of 0 disables the dentry cache
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_volume_set_maximum_number_of_dentry_cache_values(
+     libfsxfs_volume_t *volume,
+     int maximum_number_of_values,
+     libcerror_error_t **error )
+{
+	libfsxfs_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfsxfs_volume_set_maximum_number_of_dentry_cache_values";
+	int result                                  = 1;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsxfs_internal_volume_t *) volume;
+
+	if( maximum_number_of_values < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid maximum number of values value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	internal_volume->maximum_number_of_dentry_cache_values = maximum_number_of_values;
+
+	if( internal_volume->file_system != NULL )
+	{
+		if( libfsxfs_file_system_set_maximum_number_of_dentry_cache_values(
+		     internal_volume->file_system,
+		     maximum_number_of_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set maximum number of dentry cache values.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Sets the maximum memory size of the metadata block cache
+ * A maximum size of 0 disables the metadata block cache
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_volume_set_maximum_block_cache_size(
+     libfsxfs_volume_t *volume,
+     size_t maximum_cache_size,
+     libcerror_error_t **error )
+{
+	libfsxfs_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfsxfs_volume_set_maximum_block_cache_size";
+	int result                                  = 1;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsxfs_internal_volume_t *) volume;
+
+	if( internal_volume->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_cache_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid maximum cache size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	internal_volume->maximum_block_cache_size = maximum_cache_size;
+
+	if( internal_volume->io_handle->block_cache != NULL )
+	{
+		if( libfsxfs_block_cache_set_maximum_cache_size(
+		     internal_volume->io_handle->block_cache,
+		     maximum_cache_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set maximum block cache size.",
+			 function );
+
+			result = -1;
+		}
+	}
+	else if( ( internal_volume->superblock != NULL )
+	      && ( maximum_cache_size > 0 ) )
+	{
+		if( libfsxfs_block_cache_initialize(
+		     &( internal_volume->io_handle->block_cache ),
+		     maximum_cache_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create block cache.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Sets the maximum size of the file data read-ahead window
+ * A maximum size of 0 disables read-ahead
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_volume_set_maximum_read_ahead_size(
+     libfsxfs_volume_t *volume,
+     size_t maximum_read_ahead_size,
+     libcerror_error_t **error )
+{
+	libfsxfs_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfsxfs_volume_set_maximum_read_ahead_size";
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsxfs_internal_volume_t *) volume;
+
+	if( internal_volume->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_read_ahead_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid maximum read-ahead size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	internal_volume->maximum_read_ahead_size = maximum_read_ahead_size;
+
+	if( internal_volume->superblock != NULL )
+	{
+		internal_volume->io_handle->maximum_read_ahead_size = maximum_read_ahead_size;
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Sets the number of threads used to read file data asynchronously
+ * A number of 0 disables the IO queue. The number is applied on open
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_volume_set_number_of_io_threads(
+     libfsxfs_volume_t *volume,
+     int number_of_io_threads,
+     libcerror_error_t **error )
+{
+	libfsxfs_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfsxfs_volume_set_number_of_io_threads";
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsxfs_internal_volume_t *) volume;
+
+	if( ( number_of_io_threads < 0 )
+	 || ( number_of_io_threads > LIBFSXFS_IO_QUEUE_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of IO threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	internal_volume->number_of_io_threads = number_of_io_threads;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the metadata block cache statistics
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_volume_get_block_cache_statistics(
+     libfsxfs_volume_t *volume,
+     uint64_t *number_of_hits,
+     uint64_t *number_of_misses,
+     libcerror_error_t **error )
+{
+	libfsxfs_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfsxfs_volume_get_block_cache_statistics";
+	int result                                  = 1;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsxfs_internal_volume_t *) volume;
+
+	if( internal_volume->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_hits == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of hits.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_misses == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of misses.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_volume->io_handle->block_cache == NULL )
+	{
+		*number_of_hits   = 0;
+		*number_of_misses = 0;
+	}
+	else if( libfsxfs_block_cache_get_statistics(
+	          internal_volume->io_handle->block_cache,
+	          number_of_hits,
+	          number_of_misses,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve block cache statistics.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Sets if the in-memory inode chunk index should be used
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_volume_set_use_inode_chunk_index(
+     libfsxfs_volume_t *volume,
+     uint8_t use_inode_chunk_index,
+     libcerror_error_t **error )
+{
+	libfsxfs_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfsxfs_volume_set_use_inode_chunk_index";
+	int result                                  = 1;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsxfs_internal_volume_t *) volume;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	internal_volume->use_inode_chunk_index = use_inode_chunk_index;
+
+	if( internal_volume->file_system != NULL )
+	{
+		if( libfsxfs_file_system_set_use_inode_chunk_index(
+		     internal_volume->file_system,
+		     use_inode_chunk_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set use inode chunk index.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Sets if the volume should be memory mapped
+ * The memory map is only used when the volume is opened by filename
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_volume_set_use_memory_map(
+     libfsxfs_volume_t *volume,
+     uint8_t use_memory_map,
+     libcerror_error_t **error )
+{
+	libfsxfs_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfsxfs_volume_set_use_memory_map";
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsxfs_internal_volume_t *) volume;
+
+#if !defined( HAVE_LIBFSXFS_MEMORY_MAP_SUPPORT )
+	if( use_memory_map != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: memory mapped files are not supported.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	internal_volume->use_memory_map = use_memory_map;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Sets if the headers of all allocation groups should be read and validated on open
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_volume_set_validate_allocation_groups(
+     libfsxfs_volume_t *volume,
+     uint8_t validate_allocation_groups,
+     libcerror_error_t **error )
+{
+	libfsxfs_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfsxfs_volume_set_validate_allocation_groups";
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsxfs_internal_volume_t *) volume;
+
+	/* The allocation groups are validated on open
+	 */
+	if( internal_volume->file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid volume - file IO handle already set.",
+		 function );
+
+		return( -1 );
+	}
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	internal_volume->validate_allocation_groups = validate_allocation_groups;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Sets if the checksums of version 5 metadata should be verified
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_volume_set_verify_checksums(
+     libfsxfs_volume_t *volume,
+     uint8_t verify_checksums,
+     libcerror_error_t **error )
+{
+	libfsxfs_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfsxfs_volume_set_verify_checksums";
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsxfs_internal_volume_t *) volume;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	internal_volume->verify_checksums = verify_checksums;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the format version
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_volume_get_format_version(
+     libfsxfs_volume_t *volume,
+     uint8_t *format_version,
+     libcerror_error_t **error )
+{
+	libfsxfs_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfsxfs_volume_get_format_version";
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsxfs_internal_volume_t *) volume;
+
+	if( internal_volume->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( format_version == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid format version.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*format_version = internal_volume->io_handle->format_version;
 
-	if( allocation_group_index != internal_volume->superblock->number_of_allocation_groups )
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid last allocation group index value out of bounds.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
+#endif
 	return( 1 );
-
-on_error:
-	if( internal_volume->file_system != NULL )
-	{
-		libfsxfs_file_system_free(
-		 &( internal_volume->file_system ),
-		 NULL );
-	}
-	if( internal_volume->superblock != NULL )
-	{
-		libfsxfs_superblock_free(
-		 &( internal_volume->superblock ),
-		 NULL );
-	}
-	if( superblock != NULL )
-	{
-		libfsxfs_superblock_free(
-		 &superblock,
-		 NULL );
-	}
-	return( -1 );
 }
 
-/* Retrieves the format version
+/* Retrieves the number of allocation groups
  * Returns 1 if successful or -1 on error
  */
-int libfsxfs_volume_get_format_version(
+int libfsxfs_volume_get_number_of_allocation_groups(
      libfsxfs_volume_t *volume,
-     uint8_t *format_version,
+     uint32_t *number_of_allocation_groups,
      libcerror_error_t **error )
 {
 	libfsxfs_internal_volume_t *internal_volume = NULL;
-	static char *function                       = "libfsxfs_volume_get_format_version";
+	static char *function                       = "libfsxfs_volume_get_number_of_allocation_groups";
 
 	if( volume == NULL )
 	{
@@ -1205,24 +3021,24 @@ int libfsxfs_volume_get_format_version(
 	}
 	internal_volume = (libfsxfs_internal_volume_t *) volume;
 
-	if( internal_volume->io_handle == NULL )
+	if( internal_volume->superblock == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid volume - missing IO handle.",
+		 "%s: invalid volume - missing superblock.",
 		 function );
 
 		return( -1 );
 	}
-	if( format_version == NULL )
+	if( number_of_allocation_groups == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid format version.",
+		 "%s: invalid number of allocation groups.",
 		 function );
 
 		return( -1 );
@@ -1242,7 +3058,7 @@ int libfsxfs_volume_get_format_version(
 		return( -1 );
 	}
 #endif
-	*format_version = internal_volume->io_handle->format_version;
+	*number_of_allocation_groups = internal_volume->superblock->number_of_allocation_groups;
 
 #if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_read(
@@ -1936,6 +3752,158 @@ int libfsxfs_volume_get_file_entry_by_inode(
 	return( result );
 }
 
+/* Retrieves the file entry of the next allocated inode
+ * The inodes are returned in ascending inode number order, which corresponds with
+ * their on-disk order within an allocation group, hence inode chunks are read sequentially
+ * The cookie is an opaque value used to resume iterating the inodes, set it to 0 to retrieve the first file entry
+ * Returns 1 if successful, 0 if no more file entries or -1 on error
+ */
+int libfsxfs_volume_get_next_file_entry(
+     libfsxfs_volume_t *volume,
+     uint64_t *cookie,
+     libfsxfs_file_entry_t **file_entry,
+     libcerror_error_t **error )
+{
+	libfsxfs_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfsxfs_volume_get_next_file_entry";
+	uint64_t inode_number                       = 0;
+	int result                                  = 0;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsxfs_internal_volume_t *) volume;
+
+	if( internal_volume->superblock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing superblock.",
+		 function );
+
+		return( -1 );
+	}
+	if( cookie == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cookie.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *file_entry != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file entry value already set.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libfsxfs_file_system_get_next_allocated_inode_number(
+	          internal_volume->file_system,
+	          internal_volume->io_handle,
+	          internal_volume->file_io_handle,
+	          internal_volume->superblock->number_of_allocation_groups,
+	          *cookie,
+	          &inode_number,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve next allocated inode number.",
+		 function );
+	}
+	else if( result != 0 )
+	{
+		if( libfsxfs_internal_volume_get_file_entry_by_inode(
+		     internal_volume,
+		     inode_number,
+		     file_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve inode: %" PRIu64 ".",
+			 function,
+			 inode_number );
+
+			result = -1;
+		}
+		else
+		{
+			*cookie = inode_number + 1;
+		}
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		libfsxfs_file_entry_free(
+		 file_entry,
+		 NULL );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
 /* Retrieves the file entry for an UTF-8 encoded path
  * Returns 1 if successful, 0 if no such file entry or -1 on error
  */
@@ -2326,3 +4294,107 @@ int libfsxfs_volume_get_file_entry_by_utf16_path(
 	return( result );
 }
 
+/* Verifies the metadata of a specific allocation group
+ * The inode information, the inode B+ tree, the allocated inodes, the directories and
+ * the data extents B+ trees of the allocation group are read and checked, the checksums
+ * are verified when enabled with libfsxfs_volume_set_verify_checksums
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_volume_verify_allocation_group(
+     libfsxfs_volume_t *volume,
+     uint32_t allocation_group_index,
+     uint64_t *number_of_inodes,
+     uint64_t *metadata_size,
+     libcerror_error_t **error )
+{
+	libfsxfs_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfsxfs_volume_verify_allocation_group";
+	int result                                  = 1;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsxfs_internal_volume_t *) volume;
+
+	if( internal_volume->superblock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing superblock.",
+		 function );
+
+		return( -1 );
+	}
+	if( allocation_group_index >= internal_volume->superblock->number_of_allocation_groups )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid allocation group index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfsxfs_file_system_verify_allocation_group(
+	     internal_volume->file_system,
+	     internal_volume->io_handle,
+	     internal_volume->file_io_handle,
+	     allocation_group_index,
+	     number_of_inodes,
+	     metadata_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to verify allocation group: %" PRIu32 ".",
+		 function,
+		 allocation_group_index );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
@@ -72,6 +72,50 @@ struct libfsxfs_internal_volume
 	 */
 	uint8_t file_io_handle_opened_in_library;
 
+	/* The file IO pool
+	 */
+	libbfio_pool_t *file_io_pool;
+
+	/* Values to indicate which entries of the file IO pool were opened inside the library
+	 */
+	uint8_t *file_io_pool_entries_opened_in_library;
+
+	/* The maximum (estimated) memory size of the inode cache
+	 */
+	size_t maximum_inode_cache_size;
+
+	/* The maximum memory size of the metadata block cache
+	 */
+	size_t maximum_block_cache_size;
+
+	/* The maximum number of values in the directory entry (dentry) cache
+	 */
+	int maximum_number_of_dentry_cache_values;
+
+	/* The maximum size of the file data read-ahead window
+	 */
+	size_t maximum_read_ahead_size;
+
+	/* The number of threads used to read file data asynchronously, where 0 disables the IO queue
+	 */
+	int number_of_io_threads;
+
+	/* Value to indicate the in-memory inode chunk index should be used
+	 */
+	uint8_t use_inode_chunk_index;
+
+	/* Value to indicate the volume should be memory mapped when opened by filename
+	 */
+	uint8_t use_memory_map;
+
+	/* Value to indicate the headers of all allocation groups should be read and validated on open
+	 */
+	uint8_t validate_allocation_groups;
+
+	/* Value to indicate the checksums of version 5 metadata should be verified
+	 */
+	uint8_t verify_checksums;
+
 #if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
 	/* The read/write lock
 	 */
@@ -119,6 +163,13 @@ int libfsxfs_volume_open_file_io_handle(
      int access_flags,
      libcerror_error_t **error );
 
+LIBFSXFS_EXTERN \
+int libfsxfs_volume_open_file_io_pool(
+     libfsxfs_volume_t *volume,
+     libbfio_pool_t *file_io_pool,
+     int access_flags,
+     libcerror_error_t **error );
+
 LIBFSXFS_EXTERN \
 int libfsxfs_volume_close(
      libfsxfs_volume_t *volume,
@@ -129,12 +180,83 @@ int libfsxfs_internal_volume_open_read(
      libbfio_handle_t *file_io_handle,
      libcerror_error_t **error );
 
+int libfsxfs_internal_volume_read_allocation_groups(
+     libfsxfs_internal_volume_t *internal_volume,
+     libcerror_error_t **error );
+
+LIBFSXFS_EXTERN \
+int libfsxfs_volume_set_maximum_inode_cache_size(
+     libfsxfs_volume_t *volume,
+     size_t maximum_cache_size,
+     libcerror_error_t **error );
+
+LIBFSXFS_EXTERN \
+int libfsxfs_volume_set_maximum_number_of_dentry_cache_values(
+     libfsxfs_volume_t *volume,
+     int maximum_number_of_values,
+     libcerror_error_t **error );
+
+LIBFSXFS_EXTERN \
+int libfsxfs_volume_set_maximum_block_cache_size(
+     libfsxfs_volume_t *volume,
+     size_t maximum_cache_size,
+     libcerror_error_t **error );
+
+LIBFSXFS_EXTERN \
+int libfsxfs_volume_set_maximum_read_ahead_size(
+     libfsxfs_volume_t *volume,
+     size_t maximum_read_ahead_size,
+     libcerror_error_t **error );
+
+LIBFSXFS_EXTERN \
+int libfsxfs_volume_set_number_of_io_threads(
+     libfsxfs_volume_t *volume,
+     int number_of_io_threads,
+     libcerror_error_t **error );
+
+LIBFSXFS_EXTERN \
+int libfsxfs_volume_get_block_cache_statistics(
+     libfsxfs_volume_t *volume,
+     uint64_t *number_of_hits,
+     uint64_t *number_of_misses,
+     libcerror_error_t **error );
+
+LIBFSXFS_EXTERN \
+int libfsxfs_volume_set_use_inode_chunk_index(
+     libfsxfs_volume_t *volume,
+     uint8_t use_inode_chunk_index,
+     libcerror_error_t **error );
+
+LIBFSXFS_EXTERN \
+int libfsxfs_volume_set_use_memory_map(
+     libfsxfs_volume_t *volume,
+     uint8_t use_memory_map,
+     libcerror_error_t **error );
+
+LIBFSXFS_EXTERN \
+int libfsxfs_volume_set_validate_allocation_groups(
+     libfsxfs_volume_t *volume,
+     uint8_t validate_allocation_groups,
+     libcerror_error_t **error );
+
+LIBFSXFS_EXTERN \
+int libfsxfs_volume_set_verify_checksums(
+     libfsxfs_volume_t *volume,
+     uint8_t verify_checksums,
+     libcerror_error_t **error );
+
 LIBFSXFS_EXTERN \
 int libfsxfs_volume_get_format_version(
      libfsxfs_volume_t *volume,
      uint8_t *format_version,
      libcerror_error_t **error );
 
+LIBFSXFS_EXTERN \
+int libfsxfs_volume_get_number_of_allocation_groups(
+     libfsxfs_volume_t *volume,
+     uint32_t *number_of_allocation_groups,
+     libcerror_error_t **error );
+
 LIBFSXFS_EXTERN \
 int libfsxfs_volume_get_utf8_label_size(
      libfsxfs_volume_t *volume,
@@ -180,6 +302,13 @@ int libfsxfs_volume_get_file_entry_by_inode(
      libfsxfs_file_entry_t **file_entry,
      libcerror_error_t **error );
 
+LIBFSXFS_EXTERN \
+int libfsxfs_volume_get_next_file_entry(
+     libfsxfs_volume_t *volume,
+     uint64_t *cookie,
+     libfsxfs_file_entry_t **file_entry,
+     libcerror_error_t **error );
+
 int libfsxfs_internal_volume_get_file_entry_by_utf8_path(
      libfsxfs_internal_volume_t *internal_volume,
      const uint8_t *utf8_string,
@@ -210,6 +339,14 @@ int libfsxfs_volume_get_file_entry_by_utf16_path(
      libfsxfs_file_entry_t **file_entry,
      libcerror_error_t **error );
 
+LIBFSXFS_EXTERN \
+int libfsxfs_volume_verify_allocation_group(
+     libfsxfs_volume_t *volume,
+     uint32_t allocation_group_index,
+     uint64_t *number_of_inodes,
+     uint64_t *metadata_size,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
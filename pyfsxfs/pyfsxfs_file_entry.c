@@ -216,6 +216,13 @@ PyMethodDef pyfsxfs_file_entry_object_methods[] = {
 	  "\n"
 	  "Reads a buffer of data at a specific offset." },
 
+	{ "read_vector",
+	  (PyCFunction) pyfsxfs_file_entry_read_vector,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "read_vector(ranges)-> List of Bytes\n"
+	  "\n"
+	  "Reads the data of multiple ranges, where ranges is a sequence of (offset, size) tuples." },
+
 	{ "seek_offset",
 	  (PyCFunction) pyfsxfs_file_entry_seek_offset,
 	  METH_VARARGS | METH_KEYWORDS,
@@ -2797,6 +2804,282 @@ PyObject *pyfsxfs_file_entry_read_buffer_at_offset(
 	return( string_object );
 }
 
+/* Reads data of multiple ranges
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfsxfs_file_entry_read_vector(
+           pyfsxfs_file_entry_t *pyfsxfs_file_entry,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	PyObject *list_object       = NULL;
+	PyObject *ranges_object     = NULL;
+	PyObject *sequence_object   = NULL;
+	PyObject *string_object     = NULL;
+	libcerror_error_t *error    = NULL;
+	void **buffers              = NULL;
+	size_t *buffer_sizes        = NULL;
+	off64_t *offsets            = NULL;
+	ssize_t *read_counts        = NULL;
+	static char *function       = "pyfsxfs_file_entry_read_vector";
+	static char *keyword_list[] = { "ranges", NULL };
+	Py_ssize_t number_of_ranges = 0;
+	Py_ssize_t range_index      = 0;
+	ssize_t read_count          = 0;
+	PY_LONG_LONG range_offset   = 0;
+	PY_LONG_LONG range_size     = 0;
+
+	if( pyfsxfs_file_entry == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "O",
+	     keyword_list,
+	     &ranges_object ) == 0 )
+	{
+		return( NULL );
+	}
+	sequence_object = PySequence_Fast(
+	                   ranges_object,
+	                   "ranges must be a sequence" );
+
+	if( sequence_object == NULL )
+	{
+		return( NULL );
+	}
+	number_of_ranges = PySequence_Fast_GET_SIZE(
+	                    sequence_object );
+
+	if( number_of_ranges > (Py_ssize_t) INT_MAX )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid number of ranges value exceeds maximum.",
+		 function );
+
+		goto on_error;
+	}
+	list_object = PyList_New(
+	               number_of_ranges );
+
+	if( list_object == NULL )
+	{
+		goto on_error;
+	}
+	if( number_of_ranges == 0 )
+	{
+		Py_DecRef(
+		 sequence_object );
+
+		return( list_object );
+	}
+	buffers = (void **) PyMem_Malloc(
+	                     sizeof( void * ) * number_of_ranges );
+
+	buffer_sizes = (size_t *) PyMem_Malloc(
+	                           sizeof( size_t ) * number_of_ranges );
+
+	offsets = (off64_t *) PyMem_Malloc(
+	                       sizeof( off64_t ) * number_of_ranges );
+
+	read_counts = (ssize_t *) PyMem_Malloc(
+	                           sizeof( ssize_t ) * number_of_ranges );
+
+	if( ( buffers == NULL )
+	 || ( buffer_sizes == NULL )
+	 || ( offsets == NULL )
+	 || ( read_counts == NULL ) )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create ranges.",
+		 function );
+
+		goto on_error;
+	}
+	for( range_index = 0;
+	     range_index < number_of_ranges;
+	     range_index++ )
+	{
+		if( PyArg_ParseTuple(
+		     PySequence_Fast_GET_ITEM(
+		      sequence_object,
+		      range_index ),
+		     "LL",
+		     &range_offset,
+		     &range_size ) == 0 )
+		{
+			goto on_error;
+		}
+		if( range_offset < 0 )
+		{
+			PyErr_Format(
+			 PyExc_ValueError,
+			 "%s: invalid range: %zd offset value less than zero.",
+			 function,
+			 range_index );
+
+			goto on_error;
+		}
+		if( ( range_size < 0 )
+		 || ( range_size > (PY_LONG_LONG) INT_MAX )
+		 || ( range_size > (PY_LONG_LONG) SSIZE_MAX ) )
+		{
+			PyErr_Format(
+			 PyExc_ValueError,
+			 "%s: invalid range: %zd size value out of bounds.",
+			 function,
+			 range_index );
+
+			goto on_error;
+		}
+#if PY_MAJOR_VERSION >= 3
+		string_object = PyBytes_FromStringAndSize(
+		                 NULL,
+		                 (Py_ssize_t) range_size );
+#else
+		string_object = PyString_FromStringAndSize(
+		                 NULL,
+		                 (Py_ssize_t) range_size );
+#endif
+		if( string_object == NULL )
+		{
+			goto on_error;
+		}
+		/* The list takes over the reference
+		 */
+		PyList_SET_ITEM(
+		 list_object,
+		 range_index,
+		 string_object );
+
+#if PY_MAJOR_VERSION >= 3
+		buffers[ range_index ] = PyBytes_AsString(
+		                          string_object );
+#else
+		buffers[ range_index ] = PyString_AsString(
+		                          string_object );
+#endif
+		buffer_sizes[ range_index ] = (size_t) range_size;
+		offsets[ range_index ]      = (off64_t) range_offset;
+		read_counts[ range_index ]  = 0;
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	read_count = libfsxfs_file_entry_read_vector(
+	              pyfsxfs_file_entry->file_entry,
+	              buffers,
+	              buffer_sizes,
+	              offsets,
+	              read_counts,
+	              (int) number_of_ranges,
+	              &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( read_count == -1 )
+	{
+		pyfsxfs_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to read data.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	/* Need to resize the strings here in case a range was not fully read.
+	 */
+	for( range_index = 0;
+	     range_index < number_of_ranges;
+	     range_index++ )
+	{
+		if( (size_t) read_counts[ range_index ] == buffer_sizes[ range_index ] )
+		{
+			continue;
+		}
+		string_object = PyList_GET_ITEM(
+		                 list_object,
+		                 range_index );
+
+		PyList_SET_ITEM(
+		 list_object,
+		 range_index,
+		 NULL );
+
+#if PY_MAJOR_VERSION >= 3
+		if( _PyBytes_Resize(
+		     &string_object,
+		     (Py_ssize_t) read_counts[ range_index ] ) != 0 )
+#else
+		if( _PyString_Resize(
+		     &string_object,
+		     (Py_ssize_t) read_counts[ range_index ] ) != 0 )
+#endif
+		{
+			goto on_error;
+		}
+		PyList_SET_ITEM(
+		 list_object,
+		 range_index,
+		 string_object );
+	}
+	PyMem_Free(
+	 read_counts );
+	PyMem_Free(
+	 offsets );
+	PyMem_Free(
+	 buffer_sizes );
+	PyMem_Free(
+	 buffers );
+
+	Py_DecRef(
+	 sequence_object );
+
+	return( list_object );
+
+on_error:
+	if( read_counts != NULL )
+	{
+		PyMem_Free(
+		 read_counts );
+	}
+	if( offsets != NULL )
+	{
+		PyMem_Free(
+		 offsets );
+	}
+	if( buffer_sizes != NULL )
+	{
+		PyMem_Free(
+		 buffer_sizes );
+	}
+	if( buffers != NULL )
+	{
+		PyMem_Free(
+		 buffers );
+	}
+	if( list_object != NULL )
+	{
+		Py_DecRef(
+		 list_object );
+	}
+	Py_DecRef(
+	 sequence_object );
+
+	return( NULL );
+}
+
 /* Seeks a certain offset
  * Returns a Python object if successful or NULL on error
  */
@@ -185,6 +185,11 @@ PyObject *pyfsxfs_file_entry_read_buffer_at_offset(
            PyObject *arguments,
            PyObject *keywords );
 
+PyObject *pyfsxfs_file_entry_read_vector(
+           pyfsxfs_file_entry_t *pyfsxfs_file_entry,
+           PyObject *arguments,
+           PyObject *keywords );
+
 PyObject *pyfsxfs_file_entry_seek_offset(
            pyfsxfs_file_entry_t *pyfsxfs_file_entry,
            PyObject *arguments,
@@ -0,0 +1,967 @@
+/*
+ * Library block_cache type test program
+ *
+ * Copyright (C) 2020-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsxfs_test_libcerror.h"
+#include "fsxfs_test_libfsxfs.h"
+#include "fsxfs_test_macros.h"
+#include "fsxfs_test_memory.h"
+#include "fsxfs_test_unused.h"
+
+#include "../libfsxfs/libfsxfs_block_cache.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
+
+/* Tests the libfsxfs_block_cache_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_block_cache_initialize(
+     void )
+{
+	libcerror_error_t *error            = NULL;
+	libfsxfs_block_cache_t *block_cache = NULL;
+	int result                          = 0;
+
+#if defined( HAVE_FSXFS_TEST_MEMORY )
+	int number_of_malloc_fail_tests     = 1;
+	int number_of_memset_fail_tests     = 1;
+	int test_number                     = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_block_cache_initialize(
+	          &block_cache,
+	          4096,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "block_cache",
+	 block_cache );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_block_cache_free(
+	          &block_cache,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "block_cache",
+	 block_cache );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_block_cache_initialize(
+	          NULL,
+	          4096,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_block_cache_initialize(
+	          &block_cache,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	block_cache = (libfsxfs_block_cache_t *) 0x12345678UL;
+
+	result = libfsxfs_block_cache_initialize(
+	          &block_cache,
+	          4096,
+	          &error );
+
+	block_cache = NULL;
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FSXFS_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsxfs_block_cache_initialize with malloc failing
+		 */
+		fsxfs_test_malloc_attempts_before_fail = test_number;
+
+		result = libfsxfs_block_cache_initialize(
+		          &block_cache,
+		          4096,
+		          &error );
+
+		if( fsxfs_test_malloc_attempts_before_fail != -1 )
+		{
+			fsxfs_test_malloc_attempts_before_fail = -1;
+
+			if( block_cache != NULL )
+			{
+				libfsxfs_block_cache_free(
+				 &block_cache,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSXFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSXFS_TEST_ASSERT_IS_NULL(
+			 "block_cache",
+			 block_cache );
+
+			FSXFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsxfs_block_cache_initialize with memset failing
+		 */
+		fsxfs_test_memset_attempts_before_fail = test_number;
+
+		result = libfsxfs_block_cache_initialize(
+		          &block_cache,
+		          4096,
+		          &error );
+
+		if( fsxfs_test_memset_attempts_before_fail != -1 )
+		{
+			fsxfs_test_memset_attempts_before_fail = -1;
+
+			if( block_cache != NULL )
+			{
+				libfsxfs_block_cache_free(
+				 &block_cache,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSXFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSXFS_TEST_ASSERT_IS_NULL(
+			 "block_cache",
+			 block_cache );
+
+			FSXFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FSXFS_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( block_cache != NULL )
+	{
+		libfsxfs_block_cache_free(
+		 &block_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_block_cache_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_block_cache_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsxfs_block_cache_free(
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_block_cache_insert_data and libfsxfs_block_cache_get_data functions
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_block_cache_get_data(
+     void )
+{
+	uint8_t block_data[ 1024 ];
+	uint8_t data[ 1024 ];
+
+	libcerror_error_t *error            = NULL;
+	libfsxfs_block_cache_t *block_cache = NULL;
+	uint64_t number_of_hits             = 0;
+	uint64_t number_of_misses           = 0;
+	size_t data_index                   = 0;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	for( data_index = 0;
+	     data_index < 1024;
+	     data_index++ )
+	{
+		block_data[ data_index ] = (uint8_t) data_index;
+	}
+	result = libfsxfs_block_cache_initialize(
+	          &block_cache,
+	          2048,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "block_cache",
+	 block_cache );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_block_cache_get_data(
+	          block_cache,
+	          0,
+	          data,
+	          1024,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_block_cache_insert_data(
+	          block_cache,
+	          0,
+	          block_data,
+	          1024,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_block_cache_insert_data(
+	          block_cache,
+	          0,
+	          block_data,
+	          1024,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_block_cache_get_data(
+	          block_cache,
+	          0,
+	          data,
+	          1024,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          data,
+	          block_data,
+	          1024 );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test that a block of a different size at the same offset is not returned
+	 */
+	result = libfsxfs_block_cache_get_data(
+	          block_cache,
+	          0,
+	          data,
+	          512,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that a block that was not referenced since the clock hand passed it is evicted
+	 */
+	result = libfsxfs_block_cache_insert_data(
+	          block_cache,
+	          1024,
+	          block_data,
+	          1024,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_block_cache_insert_data(
+	          block_cache,
+	          2048,
+	          block_data,
+	          1024,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_block_cache_get_data(
+	          block_cache,
+	          0,
+	          data,
+	          1024,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_block_cache_get_data(
+	          block_cache,
+	          1024,
+	          data,
+	          1024,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_block_cache_get_data(
+	          block_cache,
+	          2048,
+	          data,
+	          1024,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that a block larger than the cache is not inserted
+	 */
+	result = libfsxfs_block_cache_set_maximum_cache_size(
+	          block_cache,
+	          512,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "block_cache->number_of_values",
+	 block_cache->number_of_values,
+	 0 );
+
+	result = libfsxfs_block_cache_insert_data(
+	          block_cache,
+	          0,
+	          block_data,
+	          1024,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_block_cache_get_statistics(
+	          block_cache,
+	          &number_of_hits,
+	          &number_of_misses,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_hits",
+	 number_of_hits,
+	 (uint64_t) 3 );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_misses",
+	 number_of_misses,
+	 (uint64_t) 3 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_block_cache_get_data(
+	          NULL,
+	          0,
+	          data,
+	          1024,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_block_cache_get_data(
+	          block_cache,
+	          -1,
+	          data,
+	          1024,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_block_cache_get_data(
+	          block_cache,
+	          0,
+	          NULL,
+	          1024,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_block_cache_get_data(
+	          block_cache,
+	          0,
+	          data,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_block_cache_insert_data(
+	          NULL,
+	          0,
+	          block_data,
+	          1024,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_block_cache_insert_data(
+	          block_cache,
+	          -1,
+	          block_data,
+	          1024,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_block_cache_insert_data(
+	          block_cache,
+	          0,
+	          NULL,
+	          1024,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_block_cache_insert_data(
+	          block_cache,
+	          0,
+	          block_data,
+	          0,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_block_cache_free(
+	          &block_cache,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "block_cache",
+	 block_cache );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( block_cache != NULL )
+	{
+		libfsxfs_block_cache_free(
+		 &block_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the distribution of the values of the block cache over the buckets
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_block_cache_insert_data(
+     void )
+{
+	uint8_t block_data[ 16 ];
+	uint8_t data[ 16 ];
+
+	libcerror_error_t *error            = NULL;
+	libfsxfs_block_cache_t *block_cache = NULL;
+	off64_t file_offset                 = 0;
+	int block_index                     = 0;
+	int bucket_index                    = 0;
+	int number_of_used_buckets          = 0;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_block_cache_initialize(
+	          &block_cache,
+	          1024 * 1024,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "block_cache",
+	 block_cache );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( block_index = 0;
+	     block_index < 256;
+	     block_index++ )
+	{
+		file_offset = (off64_t) block_index * 4096;
+
+		memory_set(
+		 block_data,
+		 (uint8_t) block_index,
+		 16 );
+
+		result = libfsxfs_block_cache_insert_data(
+		          block_cache,
+		          file_offset,
+		          block_data,
+		          16,
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	for( block_index = 0;
+	     block_index < 256;
+	     block_index++ )
+	{
+		file_offset = (off64_t) block_index * 4096;
+
+		memory_set(
+		 block_data,
+		 (uint8_t) block_index,
+		 16 );
+
+		result = libfsxfs_block_cache_get_data(
+		          block_cache,
+		          file_offset,
+		          data,
+		          16,
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          data,
+		          block_data,
+		          16 );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	/* Test if offsets of 4096 byte blocks are not limited to 1 in 8 buckets
+	 */
+	for( bucket_index = 0;
+	     bucket_index < LIBFSXFS_BLOCK_CACHE_NUMBER_OF_BUCKETS;
+	     bucket_index++ )
+	{
+		if( block_cache->buckets[ bucket_index ] != NULL )
+		{
+			number_of_used_buckets++;
+		}
+	}
+	FSXFS_TEST_ASSERT_GREATER_THAN_INT(
+	 "number_of_used_buckets",
+	 number_of_used_buckets,
+	 LIBFSXFS_BLOCK_CACHE_NUMBER_OF_BUCKETS / 8 );
+
+	/* Clean up
+	 */
+	result = libfsxfs_block_cache_free(
+	          &block_cache,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "block_cache",
+	 block_cache );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( block_cache != NULL )
+	{
+		libfsxfs_block_cache_free(
+		 &block_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSXFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSXFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSXFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSXFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSXFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSXFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_block_cache_initialize",
+	 fsxfs_test_block_cache_initialize );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_block_cache_free",
+	 fsxfs_test_block_cache_free );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_block_cache_get_data",
+	 fsxfs_test_block_cache_get_data );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_block_cache_insert_data",
+	 fsxfs_test_block_cache_insert_data );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
+}
+
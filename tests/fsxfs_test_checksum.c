@@ -0,0 +1,340 @@
+/*
+ * Library checksum functions test program
+ *
+ * Copyright (C) 2020-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsxfs_test_libcerror.h"
+#include "fsxfs_test_libfsxfs.h"
+#include "fsxfs_test_macros.h"
+#include "fsxfs_test_unused.h"
+
+#include "../libfsxfs/libfsxfs_checksum.h"
+
+uint8_t fsxfs_test_checksum_data1[ 9 ] = {
+	'1', '2', '3', '4', '5', '6', '7', '8', '9' };
+
+#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
+
+/* Tests the libfsxfs_checksum_calculate_crc32c function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_checksum_calculate_crc32c(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint32_t checksum        = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_checksum_calculate_crc32c(
+	          &checksum,
+	          fsxfs_test_checksum_data1,
+	          9,
+	          0xffffffffUL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT32(
+	 "checksum",
+	 ( checksum ^ 0xffffffffUL ),
+	 (uint32_t) 0xe3069283UL );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test the table based calculation
+	 */
+	checksum = libfsxfs_checksum_calculate_crc32c_table(
+	            0xffffffffUL,
+	            fsxfs_test_checksum_data1,
+	            9 );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT32(
+	 "checksum",
+	 ( checksum ^ 0xffffffffUL ),
+	 (uint32_t) 0xe3069283UL );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_checksum_calculate_crc32c(
+	          NULL,
+	          fsxfs_test_checksum_data1,
+	          9,
+	          0xffffffffUL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_checksum_calculate_crc32c(
+	          &checksum,
+	          NULL,
+	          9,
+	          0xffffffffUL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_checksum_calculate_crc32c(
+	          &checksum,
+	          fsxfs_test_checksum_data1,
+	          (size_t) SSIZE_MAX + 1,
+	          0xffffffffUL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_checksum_verify_metadata_checksum function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_checksum_verify_metadata_checksum(
+     void )
+{
+	uint8_t data[ 512 ];
+
+	libcerror_error_t *error = NULL;
+	void *memset_result      = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	memset_result = memory_set(
+	                 data,
+	                 0,
+	                 512 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "memset_result",
+	 memset_result );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 224 ] ),
+	 0x30fcedc0UL );
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_checksum_verify_metadata_checksum(
+	          data,
+	          512,
+	          224,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_checksum_verify_metadata_checksum(
+	          NULL,
+	          512,
+	          224,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_checksum_verify_metadata_checksum(
+	          data,
+	          (size_t) SSIZE_MAX + 1,
+	          224,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_checksum_verify_metadata_checksum(
+	          data,
+	          512,
+	          510,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test verify with a checksum mismatch
+	 */
+	data[ 0 ] ^= 0x01;
+
+	result = libfsxfs_checksum_verify_metadata_checksum(
+	          data,
+	          512,
+	          224,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	result = libcerror_error_matches(
+	          error,
+	          LIBCERROR_ERROR_DOMAIN_INPUT,
+	          LIBCERROR_INPUT_ERROR_CHECKSUM_MISMATCH );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSXFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSXFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSXFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSXFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSXFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSXFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_checksum_calculate_crc32c",
+	 fsxfs_test_checksum_calculate_crc32c );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_checksum_verify_metadata_checksum",
+	 fsxfs_test_checksum_verify_metadata_checksum );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
+}
+
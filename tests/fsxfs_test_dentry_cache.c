@@ -0,0 +1,761 @@
+/*
+ * Library dentry_cache type test program
+ *
+ * Copyright (C) 2020-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsxfs_test_libcerror.h"
+#include "fsxfs_test_libfsxfs.h"
+#include "fsxfs_test_macros.h"
+#include "fsxfs_test_memory.h"
+#include "fsxfs_test_unused.h"
+
+#include "../libfsxfs/libfsxfs_dentry_cache.h"
+#include "../libfsxfs/libfsxfs_directory_entry.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
+
+/* Tests the libfsxfs_dentry_cache_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_dentry_cache_initialize(
+     void )
+{
+	libcerror_error_t *error              = NULL;
+	libfsxfs_dentry_cache_t *dentry_cache = NULL;
+	int result                            = 0;
+
+#if defined( HAVE_FSXFS_TEST_MEMORY )
+	int number_of_malloc_fail_tests       = 1;
+	int number_of_memset_fail_tests       = 1;
+	int test_number                       = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_dentry_cache_initialize(
+	          &dentry_cache,
+	          16,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "dentry_cache",
+	 dentry_cache );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_dentry_cache_free(
+	          &dentry_cache,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "dentry_cache",
+	 dentry_cache );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_dentry_cache_initialize(
+	          NULL,
+	          16,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_dentry_cache_initialize(
+	          &dentry_cache,
+	          -1,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	dentry_cache = (libfsxfs_dentry_cache_t *) 0x12345678UL;
+
+	result = libfsxfs_dentry_cache_initialize(
+	          &dentry_cache,
+	          16,
+	          &error );
+
+	dentry_cache = NULL;
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FSXFS_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsxfs_dentry_cache_initialize with malloc failing
+		 */
+		fsxfs_test_malloc_attempts_before_fail = test_number;
+
+		result = libfsxfs_dentry_cache_initialize(
+		          &dentry_cache,
+		          16,
+		          &error );
+
+		if( fsxfs_test_malloc_attempts_before_fail != -1 )
+		{
+			fsxfs_test_malloc_attempts_before_fail = -1;
+
+			if( dentry_cache != NULL )
+			{
+				libfsxfs_dentry_cache_free(
+				 &dentry_cache,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSXFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSXFS_TEST_ASSERT_IS_NULL(
+			 "dentry_cache",
+			 dentry_cache );
+
+			FSXFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsxfs_dentry_cache_initialize with memset failing
+		 */
+		fsxfs_test_memset_attempts_before_fail = test_number;
+
+		result = libfsxfs_dentry_cache_initialize(
+		          &dentry_cache,
+		          16,
+		          &error );
+
+		if( fsxfs_test_memset_attempts_before_fail != -1 )
+		{
+			fsxfs_test_memset_attempts_before_fail = -1;
+
+			if( dentry_cache != NULL )
+			{
+				libfsxfs_dentry_cache_free(
+				 &dentry_cache,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSXFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSXFS_TEST_ASSERT_IS_NULL(
+			 "dentry_cache",
+			 dentry_cache );
+
+			FSXFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FSXFS_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( dentry_cache != NULL )
+	{
+		libfsxfs_dentry_cache_free(
+		 &dentry_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_dentry_cache_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_dentry_cache_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsxfs_dentry_cache_free(
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_dentry_cache_insert_directory_entry and libfsxfs_dentry_cache_get_directory_entry functions
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_dentry_cache_get_directory_entry(
+     void )
+{
+	libcerror_error_t *error                    = NULL;
+	libfsxfs_dentry_cache_t *dentry_cache       = NULL;
+	libfsxfs_directory_entry_t *cached_entry    = NULL;
+	libfsxfs_directory_entry_t *directory_entry = NULL;
+	uint64_t inode_number                       = 0;
+	int number_of_values                        = 0;
+	int result                                  = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_dentry_cache_initialize(
+	          &dentry_cache,
+	          2,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "dentry_cache",
+	 dentry_cache );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_directory_entry_initialize(
+	          &directory_entry,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "directory_entry",
+	 directory_entry );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	directory_entry->inode_number = 131;
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_dentry_cache_get_directory_entry(
+	          dentry_cache,
+	          128,
+	          (uint8_t *) "testdir1",
+	          8,
+	          &cached_entry,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "cached_entry",
+	 cached_entry );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_dentry_cache_insert_directory_entry(
+	          dentry_cache,
+	          128,
+	          (uint8_t *) "testdir1",
+	          8,
+	          directory_entry,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Insert a negative value
+	 */
+	result = libfsxfs_dentry_cache_insert_directory_entry(
+	          dentry_cache,
+	          128,
+	          (uint8_t *) "missing",
+	          7,
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_dentry_cache_get_directory_entry(
+	          dentry_cache,
+	          128,
+	          (uint8_t *) "testdir1",
+	          8,
+	          &cached_entry,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "cached_entry",
+	 cached_entry );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_directory_entry_get_inode_number(
+	          cached_entry,
+	          &inode_number,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT64(
+	 "inode_number",
+	 inode_number,
+	 (uint64_t) 131 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_directory_entry_free(
+	          &cached_entry,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_dentry_cache_get_directory_entry(
+	          dentry_cache,
+	          128,
+	          (uint8_t *) "missing",
+	          7,
+	          &cached_entry,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "cached_entry",
+	 cached_entry );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The same name in another parent directory is not cached
+	 */
+	result = libfsxfs_dentry_cache_get_directory_entry(
+	          dentry_cache,
+	          129,
+	          (uint8_t *) "testdir1",
+	          8,
+	          &cached_entry,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Inserting a third value evicts the least recently used value "testdir1"
+	 */
+	result = libfsxfs_dentry_cache_insert_directory_entry(
+	          dentry_cache,
+	          131,
+	          (uint8_t *) "file1",
+	          5,
+	          directory_entry,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_dentry_cache_get_number_of_values(
+	          dentry_cache,
+	          &number_of_values,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_values",
+	 number_of_values,
+	 2 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_dentry_cache_get_directory_entry(
+	          dentry_cache,
+	          128,
+	          (uint8_t *) "testdir1",
+	          8,
+	          &cached_entry,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Names that do not fit in a directory entry are not cached
+	 */
+	result = libfsxfs_dentry_cache_insert_directory_entry(
+	          dentry_cache,
+	          128,
+	          (uint8_t *) "testdir1",
+	          256,
+	          directory_entry,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_dentry_cache_get_directory_entry(
+	          NULL,
+	          128,
+	          (uint8_t *) "testdir1",
+	          8,
+	          &cached_entry,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_dentry_cache_get_directory_entry(
+	          dentry_cache,
+	          128,
+	          NULL,
+	          8,
+	          &cached_entry,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_dentry_cache_get_directory_entry(
+	          dentry_cache,
+	          128,
+	          (uint8_t *) "testdir1",
+	          8,
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_dentry_cache_insert_directory_entry(
+	          NULL,
+	          128,
+	          (uint8_t *) "testdir1",
+	          8,
+	          directory_entry,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_directory_entry_free(
+	          &directory_entry,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_dentry_cache_free(
+	          &dentry_cache,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "dentry_cache",
+	 dentry_cache );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( cached_entry != NULL )
+	{
+		libfsxfs_directory_entry_free(
+		 &cached_entry,
+		 NULL );
+	}
+	if( directory_entry != NULL )
+	{
+		libfsxfs_directory_entry_free(
+		 &directory_entry,
+		 NULL );
+	}
+	if( dentry_cache != NULL )
+	{
+		libfsxfs_dentry_cache_free(
+		 &dentry_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSXFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSXFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSXFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSXFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSXFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSXFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_dentry_cache_initialize",
+	 fsxfs_test_dentry_cache_initialize );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_dentry_cache_free",
+	 fsxfs_test_dentry_cache_free );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_dentry_cache_get_directory_entry",
+	 fsxfs_test_dentry_cache_get_directory_entry );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
+}
+
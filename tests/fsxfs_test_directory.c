@@ -0,0 +1,1290 @@
+/*
+ * Library directory type test program
+ *
+ * Copyright (C) 2020-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsxfs_test_functions.h"
+#include "fsxfs_test_libbfio.h"
+#include "fsxfs_test_libcdata.h"
+#include "fsxfs_test_libcerror.h"
+#include "fsxfs_test_libfsxfs.h"
+#include "fsxfs_test_macros.h"
+#include "fsxfs_test_memory.h"
+#include "fsxfs_test_unused.h"
+
+#include "../libfsxfs/libfsxfs_directory.h"
+#include "../libfsxfs/libfsxfs_directory_entry.h"
+#include "../libfsxfs/libfsxfs_extent.h"
+#include "../libfsxfs/libfsxfs_inode.h"
+#include "../libfsxfs/libfsxfs_io_handle.h"
+
+/* Short-form directory with the entries: "a" (0x30), "bb" (0x40) and "ccc" (0x50)
+ */
+uint8_t fsxfs_test_directory_data1[ 33 ] = {
+	0x03, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x30, 0x61, 0x00, 0x00, 0x00, 0x83, 0x02, 0x00,
+	0x40, 0x62, 0x62, 0x00, 0x00, 0x00, 0x84, 0x03, 0x00, 0x50, 0x63, 0x63, 0x63, 0x00, 0x00, 0x00,
+	0x85 };
+
+/* Volume with 64-byte blocks that contains 3 directory data blocks:
+ * block 1 with the entries: "." (0x10), "a" (0x20) and "bb" (0x30)
+ * block 2 with the entries: "ccc" (0x10), free space (0x20) and "dddd" (0x30)
+ * block 3 with the entries: "eeeee" (0x10) and free space (0x20)
+ */
+uint8_t fsxfs_test_directory_data2[ 256 ] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x58, 0x44, 0x32, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0x01, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x02, 0x62, 0x62, 0x00, 0x00, 0x00, 0x00, 0x30,
+	0x58, 0x44, 0x32, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x03, 0x63, 0x63, 0x63, 0x00, 0x00, 0x00, 0x10,
+	0xff, 0xff, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x04, 0x64, 0x64, 0x64, 0x64, 0x00, 0x00, 0x30,
+	0x58, 0x44, 0x32, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x05, 0x65, 0x65, 0x65, 0x65, 0x65, 0x00, 0x10,
+	0xff, 0xff, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20 };
+
+#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
+
+/* Tests the libfsxfs_directory_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_directory_initialize(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libfsxfs_directory_t *directory = NULL;
+	int result                      = 0;
+
+#if defined( HAVE_FSXFS_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 3;
+	int number_of_memset_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_directory_initialize(
+	          &directory,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "directory",
+	 directory );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_directory_free(
+	          &directory,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "directory",
+	 directory );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_directory_initialize(
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	directory = (libfsxfs_directory_t *) 0x12345678UL;
+
+	result = libfsxfs_directory_initialize(
+	          &directory,
+	          &error );
+
+	directory = NULL;
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FSXFS_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsxfs_directory_initialize with malloc failing
+		 */
+		fsxfs_test_malloc_attempts_before_fail = test_number;
+
+		result = libfsxfs_directory_initialize(
+		          &directory,
+		          &error );
+
+		if( fsxfs_test_malloc_attempts_before_fail != -1 )
+		{
+			fsxfs_test_malloc_attempts_before_fail = -1;
+
+			if( directory != NULL )
+			{
+				libfsxfs_directory_free(
+				 &directory,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSXFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSXFS_TEST_ASSERT_IS_NULL(
+			 "directory",
+			 directory );
+
+			FSXFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsxfs_directory_initialize with memset failing
+		 */
+		fsxfs_test_memset_attempts_before_fail = test_number;
+
+		result = libfsxfs_directory_initialize(
+		          &directory,
+		          &error );
+
+		if( fsxfs_test_memset_attempts_before_fail != -1 )
+		{
+			fsxfs_test_memset_attempts_before_fail = -1;
+
+			if( directory != NULL )
+			{
+				libfsxfs_directory_free(
+				 &directory,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSXFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSXFS_TEST_ASSERT_IS_NULL(
+			 "directory",
+			 directory );
+
+			FSXFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FSXFS_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( directory != NULL )
+	{
+		libfsxfs_directory_free(
+		 &directory,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_directory_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_directory_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsxfs_directory_free(
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_directory_get_next_entry function on a short-form directory
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_directory_get_next_entry_with_short_form(
+     void )
+{
+	const char *expected_names[ 3 ]             = { "a", "bb", "ccc" };
+	uint64_t expected_offsets[ 3 ]              = { 0x30, 0x40, 0x50 };
+	uint64_t resume_cookies[ 8 ]                = { 0, 0x30, 0x31, 0x40, 0x41, 0x45, 0x50, 0x51 };
+	int resume_entry_indexes[ 8 ]               = { 0, 0, 1, 1, 2, 2, 2, 3 };
+	libcerror_error_t *error                    = NULL;
+	libfsxfs_directory_entry_t *directory_entry = NULL;
+	libfsxfs_directory_t *directory             = NULL;
+	libfsxfs_inode_t *inode                     = NULL;
+	libfsxfs_io_handle_t *io_handle             = NULL;
+	uint64_t cookie                             = 0;
+	int entry_index                             = 0;
+	int resume_index                            = 0;
+	int result                                  = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->format_version       = 4;
+	io_handle->block_size           = 4096;
+	io_handle->directory_block_size = 4096;
+
+	result = libfsxfs_inode_initialize(
+	          &inode,
+	          256,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "inode",
+	 inode );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	inode->fork_type   = LIBFSXFS_FORK_TYPE_INLINE_DATA;
+	inode->inline_data = fsxfs_test_directory_data1;
+	inode->size        = 33;
+
+	result = libfsxfs_directory_initialize(
+	          &directory,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "directory",
+	 directory );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	cookie = 0;
+
+	for( entry_index = 0;
+	     entry_index < 3;
+	     entry_index++ )
+	{
+		directory_entry = NULL;
+
+		result = libfsxfs_directory_get_next_entry(
+		          directory,
+		          io_handle,
+		          NULL,
+		          inode,
+		          &cookie,
+		          &directory_entry,
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSXFS_TEST_ASSERT_IS_NOT_NULL(
+		 "directory_entry",
+		 directory_entry );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		FSXFS_TEST_ASSERT_EQUAL_UINT64(
+		 "directory_entry->offset",
+		 directory_entry->offset,
+		 expected_offsets[ entry_index ] );
+
+		FSXFS_TEST_ASSERT_EQUAL_UINT64(
+		 "cookie",
+		 cookie,
+		 expected_offsets[ entry_index ] + 1 );
+
+		FSXFS_TEST_ASSERT_EQUAL_SIZE(
+		 "directory_entry->name_size",
+		 (size_t) directory_entry->name_size,
+		 narrow_string_length( expected_names[ entry_index ] ) );
+
+		result = memory_compare(
+		          directory_entry->name,
+		          expected_names[ entry_index ],
+		          directory_entry->name_size );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	/* The short-form directory is treated as a single block that ends at the leaf offset
+	 */
+	FSXFS_TEST_ASSERT_EQUAL_UINT8(
+	 "directory->has_block",
+	 directory->has_block,
+	 1 );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT64(
+	 "directory->block_end_offset",
+	 directory->block_end_offset,
+	 (uint64_t) LIBFSXFS_DIRECTORY_LEAF_OFFSET );
+
+	result = libfsxfs_directory_get_next_entry(
+	          directory,
+	          io_handle,
+	          NULL,
+	          inode,
+	          &cookie,
+	          &directory_entry,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "directory_entry",
+	 directory_entry );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT64(
+	 "cookie",
+	 cookie,
+	 (uint64_t) LIBFSXFS_DIRECTORY_LEAF_OFFSET );
+
+	/* Test resuming with a previously returned or intermediate cookie
+	 */
+	for( resume_index = 0;
+	     resume_index < 8;
+	     resume_index++ )
+	{
+		result = libfsxfs_directory_free(
+		          &directory,
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfsxfs_directory_initialize(
+		          &directory,
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		cookie      = resume_cookies[ resume_index ];
+		entry_index = resume_entry_indexes[ resume_index ];
+
+		result = libfsxfs_directory_get_next_entry(
+		          directory,
+		          io_handle,
+		          NULL,
+		          inode,
+		          &cookie,
+		          &directory_entry,
+		          &error );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( entry_index < 3 )
+		{
+			FSXFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			FSXFS_TEST_ASSERT_IS_NOT_NULL(
+			 "directory_entry",
+			 directory_entry );
+
+			FSXFS_TEST_ASSERT_EQUAL_UINT64(
+			 "directory_entry->offset",
+			 directory_entry->offset,
+			 expected_offsets[ entry_index ] );
+
+			FSXFS_TEST_ASSERT_EQUAL_UINT64(
+			 "cookie",
+			 cookie,
+			 expected_offsets[ entry_index ] + 1 );
+		}
+		else
+		{
+			FSXFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 0 );
+
+			FSXFS_TEST_ASSERT_IS_NULL(
+			 "directory_entry",
+			 directory_entry );
+
+			FSXFS_TEST_ASSERT_EQUAL_UINT64(
+			 "cookie",
+			 cookie,
+			 (uint64_t) LIBFSXFS_DIRECTORY_LEAF_OFFSET );
+		}
+	}
+	/* Test error cases
+	 */
+	cookie = 0;
+
+	result = libfsxfs_directory_get_next_entry(
+	          NULL,
+	          io_handle,
+	          NULL,
+	          inode,
+	          &cookie,
+	          &directory_entry,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_directory_get_next_entry(
+	          directory,
+	          io_handle,
+	          NULL,
+	          inode,
+	          NULL,
+	          &directory_entry,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_directory_get_next_entry(
+	          directory,
+	          io_handle,
+	          NULL,
+	          inode,
+	          &cookie,
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_directory_free(
+	          &directory,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "directory",
+	 directory );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	inode->inline_data = NULL;
+
+	result = libfsxfs_inode_free(
+	          &inode,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "inode",
+	 inode );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( directory != NULL )
+	{
+		libfsxfs_directory_free(
+		 &directory,
+		 NULL );
+	}
+	if( inode != NULL )
+	{
+		inode->inline_data = NULL;
+
+		libfsxfs_inode_free(
+		 &inode,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libfsxfs_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_directory_get_next_entry function on a directory stored in blocks
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_directory_get_next_entry_with_blocks(
+     void )
+{
+	const char *expected_names[ 5 ]             = { "a", "bb", "ccc", "dddd", "eeeee" };
+	uint64_t expected_offsets[ 5 ]              = { 32, 48, 144, 176, 208 };
+	uint64_t resume_cookies[ 13 ]               = { 0, 16, 33, 49, 64, 100, 128, 145, 160, 177, 192, 209, 256 };
+	int resume_entry_indexes[ 13 ]              = { 0, 0, 1, 2, 2, 2, 2, 3, 3, 4, 4, 5, 5 };
+	uint64_t extent_values[ 3 ][ 3 ]            = { { 0, 1, 1 }, { 2, 2, 2 }, { LIBFSXFS_DIRECTORY_LEAF_OFFSET / 64, 0, 1 } };
+	libbfio_handle_t *file_io_handle            = NULL;
+	libcerror_error_t *error                    = NULL;
+	libfsxfs_directory_entry_t *directory_entry = NULL;
+	libfsxfs_directory_t *directory             = NULL;
+	libfsxfs_extent_t *extent                   = NULL;
+	libfsxfs_inode_t *inode                     = NULL;
+	libfsxfs_io_handle_t *io_handle             = NULL;
+	uint64_t cookie                             = 0;
+	int array_entry_index                       = 0;
+	int entry_index                             = 0;
+	int extent_index                            = 0;
+	int resume_index                            = 0;
+	int result                                  = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->format_version                       = 4;
+	io_handle->block_size                           = 64;
+	io_handle->directory_block_size                 = 64;
+	io_handle->allocation_group_size                = 4096;
+	io_handle->number_of_relative_block_number_bits = 12;
+
+	result = libfsxfs_inode_initialize(
+	          &inode,
+	          256,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "inode",
+	 inode );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	inode->fork_type = LIBFSXFS_FORK_TYPE_EXTENTS;
+
+	result = libcdata_array_initialize(
+	          &( inode->data_extents_array ),
+	          0,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The extents map logical block 0 to physical block 1 and logical blocks 2 and 3 to physical blocks 2 and 3,
+	 * logical block 1 is not allocated and the last extent starts at the leaf offset
+	 */
+	for( extent_index = 0;
+	     extent_index < 3;
+	     extent_index++ )
+	{
+		result = libfsxfs_extent_initialize(
+		          &extent,
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSXFS_TEST_ASSERT_IS_NOT_NULL(
+		 "extent",
+		 extent );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		extent->logical_block_number  = extent_values[ extent_index ][ 0 ];
+		extent->physical_block_number = extent_values[ extent_index ][ 1 ];
+		extent->number_of_blocks      = (uint32_t) extent_values[ extent_index ][ 2 ];
+
+		result = libcdata_array_append_entry(
+		          inode->data_extents_array,
+		          &array_entry_index,
+		          (intptr_t *) extent,
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		extent = NULL;
+	}
+	result = fsxfs_test_open_file_io_handle(
+	          &file_io_handle,
+	          fsxfs_test_directory_data2,
+	          256,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_directory_initialize(
+	          &directory,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "directory",
+	 directory );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	cookie = 0;
+
+	for( entry_index = 0;
+	     entry_index < 5;
+	     entry_index++ )
+	{
+		directory_entry = NULL;
+
+		result = libfsxfs_directory_get_next_entry(
+		          directory,
+		          io_handle,
+		          file_io_handle,
+		          inode,
+		          &cookie,
+		          &directory_entry,
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSXFS_TEST_ASSERT_IS_NOT_NULL(
+		 "directory_entry",
+		 directory_entry );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		FSXFS_TEST_ASSERT_EQUAL_UINT64(
+		 "directory_entry->offset",
+		 directory_entry->offset,
+		 expected_offsets[ entry_index ] );
+
+		FSXFS_TEST_ASSERT_EQUAL_UINT64(
+		 "cookie",
+		 cookie,
+		 expected_offsets[ entry_index ] + 1 );
+
+		FSXFS_TEST_ASSERT_EQUAL_SIZE(
+		 "directory_entry->name_size",
+		 (size_t) directory_entry->name_size,
+		 narrow_string_length( expected_names[ entry_index ] ) );
+
+		result = memory_compare(
+		          directory_entry->name,
+		          expected_names[ entry_index ],
+		          directory_entry->name_size );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		if( entry_index == 2 )
+		{
+			/* Logical block 1 is not allocated hence the next directory block starts at offset 128
+			 */
+			FSXFS_TEST_ASSERT_EQUAL_UINT64(
+			 "directory->block_offset",
+			 directory->block_offset,
+			 (uint64_t) 128 );
+
+			FSXFS_TEST_ASSERT_EQUAL_UINT64(
+			 "directory->block_end_offset",
+			 directory->block_end_offset,
+			 (uint64_t) 192 );
+		}
+	}
+	/* The extent at the leaf offset is not part of the directory data blocks
+	 */
+	result = libfsxfs_directory_get_next_entry(
+	          directory,
+	          io_handle,
+	          file_io_handle,
+	          inode,
+	          &cookie,
+	          &directory_entry,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "directory_entry",
+	 directory_entry );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT64(
+	 "cookie",
+	 cookie,
+	 (uint64_t) LIBFSXFS_DIRECTORY_LEAF_OFFSET );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT8(
+	 "directory->has_block",
+	 directory->has_block,
+	 0 );
+
+	result = libfsxfs_directory_get_next_entry(
+	          directory,
+	          io_handle,
+	          file_io_handle,
+	          inode,
+	          &cookie,
+	          &directory_entry,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "directory_entry",
+	 directory_entry );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test resuming with a previously returned or intermediate cookie
+	 */
+	for( resume_index = 0;
+	     resume_index < 13;
+	     resume_index++ )
+	{
+		result = libfsxfs_directory_free(
+		          &directory,
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfsxfs_directory_initialize(
+		          &directory,
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		cookie      = resume_cookies[ resume_index ];
+		entry_index = resume_entry_indexes[ resume_index ];
+
+		result = libfsxfs_directory_get_next_entry(
+		          directory,
+		          io_handle,
+		          file_io_handle,
+		          inode,
+		          &cookie,
+		          &directory_entry,
+		          &error );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( entry_index < 5 )
+		{
+			FSXFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			FSXFS_TEST_ASSERT_IS_NOT_NULL(
+			 "directory_entry",
+			 directory_entry );
+
+			FSXFS_TEST_ASSERT_EQUAL_UINT64(
+			 "directory_entry->offset",
+			 directory_entry->offset,
+			 expected_offsets[ entry_index ] );
+
+			FSXFS_TEST_ASSERT_EQUAL_UINT64(
+			 "cookie",
+			 cookie,
+			 expected_offsets[ entry_index ] + 1 );
+		}
+		else
+		{
+			FSXFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 0 );
+
+			FSXFS_TEST_ASSERT_IS_NULL(
+			 "directory_entry",
+			 directory_entry );
+
+			FSXFS_TEST_ASSERT_EQUAL_UINT64(
+			 "cookie",
+			 cookie,
+			 (uint64_t) LIBFSXFS_DIRECTORY_LEAF_OFFSET );
+		}
+	}
+	/* Test error cases
+	 */
+	io_handle->directory_block_size = 32;
+
+	cookie = 0;
+
+	result = libfsxfs_directory_get_next_entry(
+	          directory,
+	          io_handle,
+	          file_io_handle,
+	          inode,
+	          &cookie,
+	          &directory_entry,
+	          &error );
+
+	io_handle->directory_block_size = 64;
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_directory_free(
+	          &directory,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "directory",
+	 directory );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fsxfs_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_inode_free(
+	          &inode,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "inode",
+	 inode );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( directory != NULL )
+	{
+		libfsxfs_directory_free(
+		 &directory,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( extent != NULL )
+	{
+		libfsxfs_extent_free(
+		 &extent,
+		 NULL );
+	}
+	if( inode != NULL )
+	{
+		libfsxfs_inode_free(
+		 &inode,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libfsxfs_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSXFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSXFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSXFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSXFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSXFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSXFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_directory_initialize",
+	 fsxfs_test_directory_initialize );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_directory_free",
+	 fsxfs_test_directory_free );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_directory_get_next_entry",
+	 fsxfs_test_directory_get_next_entry_with_short_form );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_directory_get_next_entry",
+	 fsxfs_test_directory_get_next_entry_with_blocks );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
+}
+
@@ -0,0 +1,731 @@
+/*
+ * Library directory_arena type test program
+ *
+ * Copyright (C) 2020-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsxfs_test_libcerror.h"
+#include "fsxfs_test_libfsxfs.h"
+#include "fsxfs_test_macros.h"
+#include "fsxfs_test_memory.h"
+#include "fsxfs_test_unused.h"
+
+#include "../libfsxfs/libfsxfs_directory_arena.h"
+#include "../libfsxfs/libfsxfs_directory_entry.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
+
+/* Tests the libfsxfs_directory_arena_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_directory_arena_initialize(
+     void )
+{
+	libcerror_error_t *error                    = NULL;
+	libfsxfs_directory_arena_t *directory_arena = NULL;
+	int result                                  = 0;
+
+#if defined( HAVE_FSXFS_TEST_MEMORY )
+	int number_of_malloc_fail_tests             = 1;
+	int number_of_memset_fail_tests             = 1;
+	int test_number                             = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_directory_arena_initialize(
+	          &directory_arena,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "directory_arena",
+	 directory_arena );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_directory_arena_free(
+	          &directory_arena,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "directory_arena",
+	 directory_arena );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_directory_arena_initialize(
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	directory_arena = (libfsxfs_directory_arena_t *) 0x12345678UL;
+
+	result = libfsxfs_directory_arena_initialize(
+	          &directory_arena,
+	          &error );
+
+	directory_arena = NULL;
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FSXFS_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsxfs_directory_arena_initialize with malloc failing
+		 */
+		fsxfs_test_malloc_attempts_before_fail = test_number;
+
+		result = libfsxfs_directory_arena_initialize(
+		          &directory_arena,
+		          &error );
+
+		if( fsxfs_test_malloc_attempts_before_fail != -1 )
+		{
+			fsxfs_test_malloc_attempts_before_fail = -1;
+
+			if( directory_arena != NULL )
+			{
+				libfsxfs_directory_arena_free(
+				 &directory_arena,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSXFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSXFS_TEST_ASSERT_IS_NULL(
+			 "directory_arena",
+			 directory_arena );
+
+			FSXFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsxfs_directory_arena_initialize with memset failing
+		 */
+		fsxfs_test_memset_attempts_before_fail = test_number;
+
+		result = libfsxfs_directory_arena_initialize(
+		          &directory_arena,
+		          &error );
+
+		if( fsxfs_test_memset_attempts_before_fail != -1 )
+		{
+			fsxfs_test_memset_attempts_before_fail = -1;
+
+			if( directory_arena != NULL )
+			{
+				libfsxfs_directory_arena_free(
+				 &directory_arena,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSXFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSXFS_TEST_ASSERT_IS_NULL(
+			 "directory_arena",
+			 directory_arena );
+
+			FSXFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FSXFS_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( directory_arena != NULL )
+	{
+		libfsxfs_directory_arena_free(
+		 &directory_arena,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_directory_arena_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_directory_arena_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsxfs_directory_arena_free(
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_directory_arena_allocate function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_directory_arena_allocate(
+     void )
+{
+	libcerror_error_t *error                    = NULL;
+	libfsxfs_directory_arena_t *directory_arena = NULL;
+	uint8_t *data                               = NULL;
+	uint8_t *first_data                         = NULL;
+	int data_index                              = 0;
+	int result                                  = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_directory_arena_initialize(
+	          &directory_arena,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "directory_arena",
+	 directory_arena );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_directory_arena_allocate(
+	          directory_arena,
+	          3,
+	          &first_data,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "first_data",
+	 first_data );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_directory_arena_allocate(
+	          directory_arena,
+	          8,
+	          &data,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "data - first_data",
+	 (int) ( data - first_data ),
+	 8 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test allocating more than fits in a single block
+	 */
+	for( data_index = 0;
+	     data_index < 256;
+	     data_index++ )
+	{
+		result = libfsxfs_directory_arena_allocate(
+		          directory_arena,
+		          255,
+		          &data,
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "data alignment",
+		 (int) ( (intptr_t) data % 8 ),
+		 0 );
+
+		memory_set(
+		 data,
+		 0xff,
+		 255 );
+	}
+	/* Test error cases
+	 */
+	result = libfsxfs_directory_arena_allocate(
+	          NULL,
+	          8,
+	          &data,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_directory_arena_allocate(
+	          directory_arena,
+	          0,
+	          &data,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_directory_arena_allocate(
+	          directory_arena,
+	          (size_t) LIBFSXFS_DIRECTORY_ARENA_MAXIMUM_BLOCK_SIZE + 1,
+	          &data,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_directory_arena_allocate(
+	          directory_arena,
+	          8,
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_directory_arena_free(
+	          &directory_arena,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "directory_arena",
+	 directory_arena );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( directory_arena != NULL )
+	{
+		libfsxfs_directory_arena_free(
+		 &directory_arena,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the directory arena references held by directory entries
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_directory_arena_references(
+     void )
+{
+	libcerror_error_t *error                           = NULL;
+	libfsxfs_directory_arena_t *directory_arena        = NULL;
+	libfsxfs_directory_entry_t *cloned_directory_entry = NULL;
+	libfsxfs_directory_entry_t *directory_entry        = NULL;
+	int result                                         = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_directory_arena_initialize(
+	          &directory_arena,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_directory_entry_initialize_from_arena(
+	          &directory_entry,
+	          directory_arena,
+	          4,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "directory_entry",
+	 directory_entry );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "directory_arena->number_of_references",
+	 directory_arena->number_of_references,
+	 2 );
+
+	directory_entry->inode_number = 128;
+	directory_entry->name_size    = 4;
+
+	memory_copy(
+	 directory_entry->name,
+	 "test",
+	 4 );
+
+	/* Test that cloning adds a reference instead of copying the directory entry
+	 */
+	result = libfsxfs_directory_entry_clone(
+	          &cloned_directory_entry,
+	          directory_entry,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "cloned_directory_entry == directory_entry",
+	 (int) ( cloned_directory_entry == directory_entry ),
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "directory_arena->number_of_references",
+	 directory_arena->number_of_references,
+	 3 );
+
+	/* Test that the arena cannot be emptied while it is referenced
+	 */
+	result = libfsxfs_directory_arena_empty(
+	          directory_arena,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_directory_entry_free(
+	          &directory_entry,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the cloned directory entry remains valid after the arena is released by its owner
+	 */
+	result = libfsxfs_directory_arena_free(
+	          &directory_arena,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "directory_arena",
+	 directory_arena );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT64(
+	 "cloned_directory_entry->inode_number",
+	 cloned_directory_entry->inode_number,
+	 (uint64_t) 128 );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT8(
+	 "cloned_directory_entry->name_size",
+	 cloned_directory_entry->name_size,
+	 (uint8_t) 4 );
+
+	result = memory_compare(
+	          cloned_directory_entry->name,
+	          "test",
+	          4 );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Clean up
+	 */
+	result = libfsxfs_directory_entry_free(
+	          &cloned_directory_entry,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( directory_entry != NULL )
+	{
+		libfsxfs_directory_entry_free(
+		 &directory_entry,
+		 NULL );
+	}
+	if( cloned_directory_entry != NULL )
+	{
+		libfsxfs_directory_entry_free(
+		 &cloned_directory_entry,
+		 NULL );
+	}
+	if( directory_arena != NULL )
+	{
+		libfsxfs_directory_arena_free(
+		 &directory_arena,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSXFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSXFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSXFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSXFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSXFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSXFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_directory_arena_initialize",
+	 fsxfs_test_directory_arena_initialize );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_directory_arena_free",
+	 fsxfs_test_directory_arena_free );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_directory_arena_allocate",
+	 fsxfs_test_directory_arena_allocate );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_directory_arena_references",
+	 fsxfs_test_directory_arena_references );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
+}
+
@@ -0,0 +1,933 @@
+/*
+ * Library extent_map type test program
+ *
+ * Copyright (C) 2020-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsxfs_test_libcerror.h"
+#include "fsxfs_test_libfsxfs.h"
+#include "fsxfs_test_macros.h"
+#include "fsxfs_test_memory.h"
+#include "fsxfs_test_unused.h"
+
+#include "../libfsxfs/libfsxfs_extent_map.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
+
+/* Tests the libfsxfs_extent_map_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_extent_map_initialize(
+     void )
+{
+	libcerror_error_t *error          = NULL;
+	libfsxfs_extent_map_t *extent_map = NULL;
+	int result                        = 0;
+
+#if defined( HAVE_FSXFS_TEST_MEMORY )
+	int number_of_malloc_fail_tests   = 2;
+	int number_of_memset_fail_tests   = 1;
+	int test_number                   = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_extent_map_initialize(
+	          &extent_map,
+	          16,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "extent_map",
+	 extent_map );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_extent_map_free(
+	          &extent_map,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "extent_map",
+	 extent_map );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_extent_map_initialize(
+	          NULL,
+	          16,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	extent_map = (libfsxfs_extent_map_t *) 0x12345678UL;
+
+	result = libfsxfs_extent_map_initialize(
+	          &extent_map,
+	          16,
+	          &error );
+
+	extent_map = NULL;
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_extent_map_initialize(
+	          &extent_map,
+	          -1,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FSXFS_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsxfs_extent_map_initialize with malloc failing
+		 */
+		fsxfs_test_malloc_attempts_before_fail = test_number;
+
+		result = libfsxfs_extent_map_initialize(
+		          &extent_map,
+		          16,
+		          &error );
+
+		if( fsxfs_test_malloc_attempts_before_fail != -1 )
+		{
+			fsxfs_test_malloc_attempts_before_fail = -1;
+
+			if( extent_map != NULL )
+			{
+				libfsxfs_extent_map_free(
+				 &extent_map,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSXFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSXFS_TEST_ASSERT_IS_NULL(
+			 "extent_map",
+			 extent_map );
+
+			FSXFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsxfs_extent_map_initialize with memset failing
+		 */
+		fsxfs_test_memset_attempts_before_fail = test_number;
+
+		result = libfsxfs_extent_map_initialize(
+		          &extent_map,
+		          16,
+		          &error );
+
+		if( fsxfs_test_memset_attempts_before_fail != -1 )
+		{
+			fsxfs_test_memset_attempts_before_fail = -1;
+
+			if( extent_map != NULL )
+			{
+				libfsxfs_extent_map_free(
+				 &extent_map,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSXFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSXFS_TEST_ASSERT_IS_NULL(
+			 "extent_map",
+			 extent_map );
+
+			FSXFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FSXFS_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( extent_map != NULL )
+	{
+		libfsxfs_extent_map_free(
+		 &extent_map,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_extent_map_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_extent_map_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsxfs_extent_map_free(
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_extent_map_append_entry function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_extent_map_append_entry(
+     void )
+{
+	libcerror_error_t *error           = NULL;
+	libfsxfs_extent_map_entry_t *entry = NULL;
+	libfsxfs_extent_map_t *extent_map  = NULL;
+	int entry_index                    = 0;
+	int number_of_entries              = 0;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_extent_map_initialize(
+	          &extent_map,
+	          0,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "extent_map",
+	 extent_map );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases, the entries are resized while appending
+	 */
+	for( entry_index = 0;
+	     entry_index < 100;
+	     entry_index++ )
+	{
+		result = libfsxfs_extent_map_append_entry(
+		          extent_map,
+		          (off64_t) entry_index * 8192,
+		          (off64_t) ( 100 - entry_index ) * 4096,
+		          4096,
+		          0,
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libfsxfs_extent_map_get_number_of_entries(
+	          extent_map,
+	          &number_of_entries,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 100 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_extent_map_get_entry_by_index(
+	          extent_map,
+	          99,
+	          &entry,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "entry",
+	 entry );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT64(
+	 "entry->logical_offset",
+	 (int64_t) entry->logical_offset,
+	 (int64_t) ( 99 * 8192 ) );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT64(
+	 "entry->physical_offset",
+	 (int64_t) entry->physical_offset,
+	 (int64_t) 4096 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_extent_map_append_entry(
+	          NULL,
+	          (off64_t) 100 * 8192,
+	          0,
+	          4096,
+	          0,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_extent_map_append_entry(
+	          extent_map,
+	          -1,
+	          0,
+	          4096,
+	          0,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test an entry that overlaps with the last entry
+	 */
+	result = libfsxfs_extent_map_append_entry(
+	          extent_map,
+	          (off64_t) ( 99 * 8192 ) + 2048,
+	          0,
+	          4096,
+	          0,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_extent_map_get_entry_by_index(
+	          extent_map,
+	          100,
+	          &entry,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test that an entry that is logically and physically adjacent to the last entry is merged
+	 */
+	result = libfsxfs_extent_map_append_entry(
+	          extent_map,
+	          (off64_t) ( 99 * 8192 ) + 4096,
+	          8192,
+	          4096,
+	          0,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_extent_map_get_number_of_entries(
+	          extent_map,
+	          &number_of_entries,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 100 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_extent_map_get_entry_by_index(
+	          extent_map,
+	          99,
+	          &entry,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "entry",
+	 entry );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT64(
+	 "entry->size",
+	 (uint64_t) entry->size,
+	 (uint64_t) 8192 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that adjacent entries with different range flags are not merged
+	 */
+	result = libfsxfs_extent_map_append_entry(
+	          extent_map,
+	          (off64_t) 100 * 8192,
+	          12288,
+	          4096,
+	          LIBFSXFS_EXTENT_FLAG_IS_SPARSE,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_extent_map_get_number_of_entries(
+	          extent_map,
+	          &number_of_entries,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 101 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that logically adjacent sparse entries are merged
+	 */
+	result = libfsxfs_extent_map_append_entry(
+	          extent_map,
+	          (off64_t) ( 100 * 8192 ) + 4096,
+	          0,
+	          4096,
+	          LIBFSXFS_EXTENT_FLAG_IS_SPARSE,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_extent_map_get_number_of_entries(
+	          extent_map,
+	          &number_of_entries,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 101 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_extent_map_free(
+	          &extent_map,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "extent_map",
+	 extent_map );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( extent_map != NULL )
+	{
+		libfsxfs_extent_map_free(
+		 &extent_map,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_extent_map_get_entry_index_at_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_extent_map_get_entry_index_at_offset(
+     void )
+{
+	libcerror_error_t *error          = NULL;
+	libfsxfs_extent_map_t *extent_map = NULL;
+	int entry_index                   = 0;
+	int result                        = 0;
+
+	/* Initialize test
+	 * A fragmented map of 100000 entries of 4096 bytes with a gap of 4096 bytes between them
+	 */
+	result = libfsxfs_extent_map_initialize(
+	          &extent_map,
+	          100000,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "extent_map",
+	 extent_map );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( entry_index = 0;
+	     entry_index < 100000;
+	     entry_index++ )
+	{
+		result = libfsxfs_extent_map_append_entry(
+		          extent_map,
+		          (off64_t) entry_index * 8192,
+		          (off64_t) entry_index * 4096,
+		          4096,
+		          0,
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test regular cases
+	 */
+	result = libfsxfs_extent_map_get_entry_index_at_offset(
+	          extent_map,
+	          0,
+	          &entry_index,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "entry_index",
+	 entry_index,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_extent_map_get_entry_index_at_offset(
+	          extent_map,
+	          (off64_t) ( 54321 * 8192 ) + 4095,
+	          &entry_index,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "entry_index",
+	 entry_index,
+	 54321 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test an offset in the gap after an entry
+	 */
+	result = libfsxfs_extent_map_get_entry_index_at_offset(
+	          extent_map,
+	          (off64_t) ( 54321 * 8192 ) + 4096,
+	          &entry_index,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "entry_index",
+	 entry_index,
+	 54322 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test an offset beyond the last entry
+	 */
+	result = libfsxfs_extent_map_get_entry_index_at_offset(
+	          extent_map,
+	          (off64_t) 100000 * 8192,
+	          &entry_index,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "entry_index",
+	 entry_index,
+	 100000 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_extent_map_get_entry_index_at_offset(
+	          NULL,
+	          0,
+	          &entry_index,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_extent_map_get_entry_index_at_offset(
+	          extent_map,
+	          -1,
+	          &entry_index,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_extent_map_get_entry_index_at_offset(
+	          extent_map,
+	          0,
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_extent_map_free(
+	          &extent_map,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "extent_map",
+	 extent_map );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( extent_map != NULL )
+	{
+		libfsxfs_extent_map_free(
+		 &extent_map,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSXFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSXFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSXFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSXFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSXFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSXFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_extent_map_initialize",
+	 fsxfs_test_extent_map_initialize );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_extent_map_free",
+	 fsxfs_test_extent_map_free );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_extent_map_append_entry",
+	 fsxfs_test_extent_map_append_entry );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_extent_map_get_entry_index_at_offset",
+	 fsxfs_test_extent_map_get_entry_index_at_offset );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
+}
+
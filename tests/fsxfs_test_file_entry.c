@@ -21,12 +21,19 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
 #include <types.h>
+#include <wide_string.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
 #include <stdlib.h>
 #endif
 
+#include "fsxfs_test_functions.h"
+#include "fsxfs_test_getopt.h"
+#include "fsxfs_test_libbfio.h"
 #include "fsxfs_test_libcerror.h"
 #include "fsxfs_test_libfsxfs.h"
 #include "fsxfs_test_macros.h"
@@ -35,18 +42,1454 @@
 
 #include "../libfsxfs/libfsxfs_file_entry.h"
 
+#if !defined( LIBFSXFS_HAVE_BFIO )
+
+LIBFSXFS_EXTERN \
+int libfsxfs_check_volume_signature_file_io_handle(
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+LIBFSXFS_EXTERN \
+int libfsxfs_volume_open_file_io_handle(
+     libfsxfs_volume_t *volume,
+     libbfio_handle_t *file_io_handle,
+     int access_flags,
+     libfsxfs_error_t **error );
+
+#endif /* !defined( LIBFSXFS_HAVE_BFIO ) */
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER ) && SIZEOF_WCHAR_T != 2 && SIZEOF_WCHAR_T != 4
+#error Unsupported size of wchar_t
+#endif
+
+/* Creates and opens a source volume
+ * Returns 1 if successful or -1 on error
+ */
+int fsxfs_test_volume_open_source(
+     libfsxfs_volume_t **volume,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "fsxfs_test_volume_open_source";
+	int result            = 0;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsxfs_volume_initialize(
+	     volume,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize volume.",
+		 function );
+
+		goto on_error;
+	}
+	result = libfsxfs_volume_open_file_io_handle(
+	          *volume,
+	          file_io_handle,
+	          LIBFSXFS_OPEN_READ,
+	          error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open volume.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *volume != NULL )
+	{
+		libfsxfs_volume_free(
+		 volume,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Closes and frees a source volume
+ * Returns 1 if successful or -1 on error
+ */
+int fsxfs_test_volume_close_source(
+     libfsxfs_volume_t **volume,
+     libcerror_error_t **error )
+{
+	static char *function = "fsxfs_test_volume_close_source";
+	int result            = 0;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsxfs_volume_close(
+	     *volume,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close volume.",
+		 function );
+
+		result = -1;
+	}
+	if( libfsxfs_volume_free(
+	     volume,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free volume.",
+		 function );
+
+		result = -1;
+	}
+	return( result );
+}
+
+/* Retrieves the first regular file in the root directory of a volume
+ * Returns 1 if successful, 0 if no such file entry was found or -1 on error
+ */
+int fsxfs_test_file_entry_get_regular_file(
+     libfsxfs_volume_t *volume,
+     libfsxfs_file_entry_t **file_entry,
+     libcerror_error_t **error )
+{
+	libfsxfs_file_entry_t *root_directory = NULL;
+	libfsxfs_file_entry_t *sub_file_entry = NULL;
+	static char *function                 = "fsxfs_test_file_entry_get_regular_file";
+	uint16_t file_mode                    = 0;
+	int number_of_sub_file_entries        = 0;
+	int sub_file_entry_index              = 0;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsxfs_volume_get_root_directory(
+	     volume,
+	     &root_directory,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve root directory.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsxfs_file_entry_get_number_of_sub_file_entries(
+	     root_directory,
+	     &number_of_sub_file_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sub file entries.",
+		 function );
+
+		goto on_error;
+	}
+	for( sub_file_entry_index = 0;
+	     sub_file_entry_index < number_of_sub_file_entries;
+	     sub_file_entry_index++ )
+	{
+		if( libfsxfs_file_entry_get_sub_file_entry_by_index(
+		     root_directory,
+		     sub_file_entry_index,
+		     &sub_file_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub file entry: %d.",
+			 function,
+			 sub_file_entry_index );
+
+			goto on_error;
+		}
+		if( libfsxfs_file_entry_get_file_mode(
+		     sub_file_entry,
+		     &file_mode,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file mode of sub file entry: %d.",
+			 function,
+			 sub_file_entry_index );
+
+			goto on_error;
+		}
+		if( ( file_mode & 0xf000 ) == 0x8000 )
+		{
+			break;
+		}
+		if( libfsxfs_file_entry_free(
+		     &sub_file_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free sub file entry: %d.",
+			 function,
+			 sub_file_entry_index );
+
+			goto on_error;
+		}
+	}
+	if( libfsxfs_file_entry_free(
+	     &root_directory,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free root directory.",
+		 function );
+
+		goto on_error;
+	}
+	if( sub_file_entry == NULL )
+	{
+		return( 0 );
+	}
+	*file_entry = sub_file_entry;
+
+	return( 1 );
+
+on_error:
+	if( sub_file_entry != NULL )
+	{
+		libfsxfs_file_entry_free(
+		 &sub_file_entry,
+		 NULL );
+	}
+	if( root_directory != NULL )
+	{
+		libfsxfs_file_entry_free(
+		 &root_directory,
+		 NULL );
+	}
+	return( -1 );
+}
+
+
 /* Tests the libfsxfs_file_entry_free function
  * Returns 1 if successful or 0 if not
  */
-int fsxfs_test_file_entry_free(
-     void )
+int fsxfs_test_file_entry_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsxfs_file_entry_free(
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
+
+/* Tests the libfsxfs_file_entry_read_buffer_at_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_file_entry_read_buffer_at_offset(
+     libfsxfs_file_entry_t *file_entry )
+{
+	uint8_t buffer[ 16 ];
+
+	libcerror_error_t *error = NULL;
+	size64_t size            = 0;
+	size_t read_size         = 0;
+	ssize_t read_count       = 0;
+	off64_t offset           = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_file_entry_get_size(
+	          file_entry,
+	          &size,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_size = 16;
+
+	if( size < (size64_t) read_size )
+	{
+		read_size = (size_t) size;
+	}
+	offset = libfsxfs_file_entry_seek_offset(
+	          file_entry,
+	          0,
+	          SEEK_SET,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	read_count = libfsxfs_file_entry_read_buffer_at_offset(
+	              file_entry,
+	              buffer,
+	              read_size,
+	              0,
+	              &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) read_size );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the current offset is not changed
+	 */
+	result = libfsxfs_file_entry_get_offset(
+	          file_entry,
+	          &offset,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( size > 1 )
+	{
+		offset = libfsxfs_file_entry_seek_offset(
+		          file_entry,
+		          1,
+		          SEEK_SET,
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT64(
+		 "offset",
+		 offset,
+		 (int64_t) 1 );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		read_count = libfsxfs_file_entry_read_buffer_at_offset(
+		              file_entry,
+		              buffer,
+		              read_size,
+		              0,
+		              &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) read_size );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfsxfs_file_entry_get_offset(
+		          file_entry,
+		          &offset,
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT64(
+		 "offset",
+		 offset,
+		 (int64_t) 1 );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Read buffer at the end of the file
+	 */
+	read_count = libfsxfs_file_entry_read_buffer_at_offset(
+	              file_entry,
+	              buffer,
+	              16,
+	              (off64_t) size,
+	              &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	read_count = libfsxfs_file_entry_read_buffer_at_offset(
+	              NULL,
+	              buffer,
+	              16,
+	              0,
+	              &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libfsxfs_file_entry_read_buffer_at_offset(
+	              file_entry,
+	              NULL,
+	              16,
+	              0,
+	              &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libfsxfs_file_entry_read_buffer_at_offset(
+	              file_entry,
+	              buffer,
+	              (size_t) SSIZE_MAX + 1,
+	              0,
+	              &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libfsxfs_file_entry_read_buffer_at_offset(
+	              file_entry,
+	              buffer,
+	              16,
+	              -1,
+	              &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_file_entry_get_read_ahead_statistics function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_file_entry_get_read_ahead_statistics(
+     libfsxfs_file_entry_t *file_entry )
+{
+	uint8_t buffer[ 16 ];
+
+	libcerror_error_t *error  = NULL;
+	size64_t size             = 0;
+	size_t window_size        = 0;
+	ssize_t read_count        = 0;
+	off64_t offset            = 0;
+	uint64_t number_of_hits   = 0;
+	uint64_t number_of_misses = 0;
+	uint64_t previous_hits    = 0;
+	uint64_t previous_misses  = 0;
+	int read_index            = 0;
+	int result                = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_file_entry_get_read_ahead_statistics(
+	          file_entry,
+	          &window_size,
+	          &previous_hits,
+	          &previous_misses,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_file_entry_get_size(
+	          file_entry,
+	          &size,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Sequential reads are expected to be served from the read-ahead buffer.
+	 * The first read can be non sequential, due to earlier tests, hence the
+	 * read-ahead buffer is filled by the second read
+	 */
+	if( size >= 48 )
+	{
+		offset = libfsxfs_file_entry_seek_offset(
+		          file_entry,
+		          0,
+		          SEEK_SET,
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT64(
+		 "offset",
+		 offset,
+		 (int64_t) 0 );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		for( read_index = 0;
+		     read_index < 3;
+		     read_index++ )
+		{
+			read_count = libfsxfs_file_entry_read_buffer(
+			              file_entry,
+			              buffer,
+			              16,
+			              &error );
+
+			FSXFS_TEST_ASSERT_EQUAL_SSIZE(
+			 "read_count",
+			 read_count,
+			 (ssize_t) 16 );
+
+			FSXFS_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+		result = libfsxfs_file_entry_get_read_ahead_statistics(
+		          file_entry,
+		          &window_size,
+		          &number_of_hits,
+		          &number_of_misses,
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Inline data and reads with read-ahead disabled are not accounted for
+		 */
+		if( ( number_of_hits != previous_hits )
+		 || ( number_of_misses != previous_misses ) )
+		{
+			FSXFS_TEST_ASSERT_GREATER_THAN_INT(
+			 "window_size",
+			 (int) window_size,
+			 0 );
+
+			FSXFS_TEST_ASSERT_GREATER_THAN_INT(
+			 "number_of_hits",
+			 (int) ( number_of_hits - previous_hits ),
+			 0 );
+		}
+	}
+	/* Test error cases
+	 */
+	result = libfsxfs_file_entry_get_read_ahead_statistics(
+	          NULL,
+	          &window_size,
+	          &number_of_hits,
+	          &number_of_misses,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_file_entry_get_read_ahead_statistics(
+	          file_entry,
+	          NULL,
+	          &number_of_hits,
+	          &number_of_misses,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_file_entry_get_read_ahead_statistics(
+	          file_entry,
+	          &window_size,
+	          NULL,
+	          &number_of_misses,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_file_entry_get_read_ahead_statistics(
+	          file_entry,
+	          &window_size,
+	          &number_of_hits,
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_file_entry_get_next_data_range function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_file_entry_get_next_data_range(
+     libfsxfs_file_entry_t *file_entry )
+{
+	libcerror_error_t *error   = NULL;
+	size64_t data_range_size   = 0;
+	size64_t first_range_size  = 0;
+	size64_t size              = 0;
+	off64_t data_range_offset  = 0;
+	off64_t first_range_offset = 0;
+	off64_t offset             = 0;
+	int number_of_data_ranges  = 0;
+	int result                 = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_file_entry_get_size(
+	          file_entry,
+	          &size,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	do
+	{
+		result = libfsxfs_file_entry_get_next_data_range(
+		          file_entry,
+		          offset,
+		          &data_range_offset,
+		          &data_range_size,
+		          &error );
+
+		FSXFS_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( result != 0 )
+		{
+			/* A data range starts at or after the offset, is not empty
+			 * and does not extend past the end of the data
+			 */
+			FSXFS_TEST_ASSERT_LESS_THAN_UINT64(
+			 "offset",
+			 (uint64_t) offset,
+			 (uint64_t) data_range_offset + 1 );
+
+			FSXFS_TEST_ASSERT_NOT_EQUAL_INT64(
+			 "data_range_size",
+			 (int64_t) data_range_size,
+			 (int64_t) 0 );
+
+			FSXFS_TEST_ASSERT_LESS_THAN_UINT64(
+			 "data_range_end_offset",
+			 (uint64_t) data_range_offset + data_range_size,
+			 (uint64_t) size + 1 );
+
+			if( number_of_data_ranges == 0 )
+			{
+				first_range_offset = data_range_offset;
+				first_range_size   = data_range_size;
+			}
+			number_of_data_ranges++;
+
+			offset = data_range_offset + (off64_t) data_range_size;
+		}
+	}
+	while( result != 0 );
+
+	/* An offset inside a data range is returned as the start of the data range
+	 */
+	if( first_range_size > 1 )
+	{
+		result = libfsxfs_file_entry_get_next_data_range(
+		          file_entry,
+		          first_range_offset + 1,
+		          &data_range_offset,
+		          &data_range_size,
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT64(
+		 "data_range_offset",
+		 (int64_t) data_range_offset,
+		 (int64_t) first_range_offset + 1 );
+
+		FSXFS_TEST_ASSERT_EQUAL_UINT64(
+		 "data_range_size",
+		 (uint64_t) data_range_size,
+		 (uint64_t) first_range_size - 1 );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* There is no data range at or after the end of the data
+	 */
+	result = libfsxfs_file_entry_get_next_data_range(
+	          file_entry,
+	          (off64_t) size,
+	          &data_range_offset,
+	          &data_range_size,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_file_entry_get_next_data_range(
+	          NULL,
+	          0,
+	          &data_range_offset,
+	          &data_range_size,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_file_entry_get_next_data_range(
+	          file_entry,
+	          -1,
+	          &data_range_offset,
+	          &data_range_size,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_file_entry_get_next_data_range(
+	          file_entry,
+	          0,
+	          NULL,
+	          &data_range_size,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_file_entry_get_next_data_range(
+	          file_entry,
+	          0,
+	          &data_range_offset,
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_file_entry_read_vector function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_file_entry_read_vector(
+     libfsxfs_file_entry_t *file_entry )
+{
+	uint8_t expected_data[ 8 ];
+	uint8_t vector_data[ 4 ][ 8 ];
+	void *buffers[ 4 ];
+	size_t buffer_sizes[ 4 ];
+	off64_t offsets[ 4 ];
+	ssize_t read_counts[ 4 ];
+
+	libcerror_error_t *error    = NULL;
+	size64_t size               = 0;
+	ssize_t expected_read_count = 0;
+	ssize_t read_count          = 0;
+	int buffer_index            = 0;
+	int result                  = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_file_entry_get_size(
+	          file_entry,
+	          &size,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The ranges are not in logical order, the third range is partially
+	 * beyond the end of the data and the last range starts at the end
+	 */
+	offsets[ 0 ] = 16;
+	offsets[ 1 ] = 0;
+	offsets[ 2 ] = (off64_t) size - 4;
+	offsets[ 3 ] = (off64_t) size;
+
+	for( buffer_index = 0;
+	     buffer_index < 4;
+	     buffer_index++ )
+	{
+		buffers[ buffer_index ]      = vector_data[ buffer_index ];
+		buffer_sizes[ buffer_index ] = 8;
+		read_counts[ buffer_index ]  = -1;
+	}
+	/* Test regular cases
+	 */
+	if( size >= 24 )
+	{
+		read_count = libfsxfs_file_entry_read_vector(
+		              file_entry,
+		              buffers,
+		              buffer_sizes,
+		              offsets,
+		              read_counts,
+		              4,
+		              &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) 20 );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		for( buffer_index = 0;
+		     buffer_index < 4;
+		     buffer_index++ )
+		{
+			expected_read_count = libfsxfs_file_entry_read_buffer_at_offset(
+			                       file_entry,
+			                       expected_data,
+			                       8,
+			                       offsets[ buffer_index ],
+			                       &error );
+
+			FSXFS_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			FSXFS_TEST_ASSERT_EQUAL_SSIZE(
+			 "read_counts[ buffer_index ]",
+			 read_counts[ buffer_index ],
+			 expected_read_count );
+
+			result = memory_compare(
+			          vector_data[ buffer_index ],
+			          expected_data,
+			          (size_t) expected_read_count );
+
+			FSXFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 0 );
+		}
+	}
+	read_count = libfsxfs_file_entry_read_vector(
+	              file_entry,
+	              buffers,
+	              buffer_sizes,
+	              offsets,
+	              read_counts,
+	              0,
+	              &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	read_count = libfsxfs_file_entry_read_vector(
+	              NULL,
+	              buffers,
+	              buffer_sizes,
+	              offsets,
+	              read_counts,
+	              1,
+	              &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libfsxfs_file_entry_read_vector(
+	              file_entry,
+	              NULL,
+	              buffer_sizes,
+	              offsets,
+	              read_counts,
+	              1,
+	              &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libfsxfs_file_entry_read_vector(
+	              file_entry,
+	              buffers,
+	              NULL,
+	              offsets,
+	              read_counts,
+	              1,
+	              &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libfsxfs_file_entry_read_vector(
+	              file_entry,
+	              buffers,
+	              buffer_sizes,
+	              NULL,
+	              read_counts,
+	              1,
+	              &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libfsxfs_file_entry_read_vector(
+	              file_entry,
+	              buffers,
+	              buffer_sizes,
+	              offsets,
+	              NULL,
+	              1,
+	              &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libfsxfs_file_entry_read_vector(
+	              file_entry,
+	              buffers,
+	              buffer_sizes,
+	              offsets,
+	              read_counts,
+	              -1,
+	              &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	buffers[ 0 ] = NULL;
+
+	read_count = libfsxfs_file_entry_read_vector(
+	              file_entry,
+	              buffers,
+	              buffer_sizes,
+	              offsets,
+	              read_counts,
+	              1,
+	              &error );
+
+	buffers[ 0 ] = vector_data[ 0 ];
+
+	FSXFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	offsets[ 0 ] = -1;
+
+	read_count = libfsxfs_file_entry_read_vector(
+	              file_entry,
+	              buffers,
+	              buffer_sizes,
+	              offsets,
+	              read_counts,
+	              1,
+	              &error );
+
+	offsets[ 0 ] = 16;
+
+	FSXFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_file_entry_map_range function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_file_entry_map_range(
+     libfsxfs_file_entry_t *file_entry )
 {
+	const uint8_t *data      = NULL;
 	libcerror_error_t *error = NULL;
+	size_t data_size         = 0;
 	int result               = 0;
 
+	/* Test regular cases
+	 */
+	result = libfsxfs_file_entry_map_range(
+	          file_entry,
+	          0,
+	          16,
+	          &data,
+	          &data_size,
+	          &error );
+
+	/* The volume is opened using a file IO handle, hence it is not memory mapped
+	 */
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	/* Test error cases
 	 */
-	result = libfsxfs_file_entry_free(
+	result = libfsxfs_file_entry_map_range(
+	          NULL,
+	          0,
+	          16,
+	          &data,
+	          &data_size,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_file_entry_map_range(
+	          file_entry,
+	          -1,
+	          16,
+	          &data,
+	          &data_size,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_file_entry_map_range(
+	          file_entry,
+	          0,
+	          (size_t) SSIZE_MAX + 1,
+	          &data,
+	          &data_size,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_file_entry_map_range(
+	          file_entry,
+	          0,
+	          16,
+	          NULL,
+	          &data_size,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_file_entry_map_range(
+	          file_entry,
+	          0,
+	          16,
+	          &data,
 	          NULL,
 	          &error );
 
@@ -73,25 +1516,75 @@ on_error:
 	return( 0 );
 }
 
-#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
-
-#endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
-
 /* The main program
  */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
 int wmain(
-     int argc FSXFS_TEST_ATTRIBUTE_UNUSED,
-     wchar_t * const argv[] FSXFS_TEST_ATTRIBUTE_UNUSED )
+     int argc,
+     wchar_t * const argv[] )
 #else
 int main(
-     int argc FSXFS_TEST_ATTRIBUTE_UNUSED,
-     char * const argv[] FSXFS_TEST_ATTRIBUTE_UNUSED )
+     int argc,
+     char * const argv[] )
 #endif
 {
-	FSXFS_TEST_UNREFERENCED_PARAMETER( argc )
-	FSXFS_TEST_UNREFERENCED_PARAMETER( argv )
+	libbfio_handle_t *file_io_handle    = NULL;
+	libcerror_error_t *error            = NULL;
+	libfsxfs_file_entry_t *file_entry   = NULL;
+	libfsxfs_volume_t *volume           = NULL;
+	system_character_t *option_offset   = NULL;
+	system_character_t *source          = NULL;
+	system_integer_t option             = 0;
+	size_t string_length                = 0;
+	off64_t volume_offset               = 0;
+	int result                          = 0;
+
+	while( ( option = fsxfs_test_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "o:" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM ".\n",
+				 argv[ optind - 1 ] );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'o':
+				option_offset = optarg;
+
+				break;
+		}
+	}
+	if( optind < argc )
+	{
+		source = argv[ optind ];
+	}
+	if( option_offset != NULL )
+	{
+		string_length = system_string_length(
+		                 option_offset );
+
+		result = fsxfs_test_system_string_copy_from_64_bit_in_decimal(
+		          option_offset,
+		          string_length + 1,
+		          (uint64_t *) &volume_offset,
+		          &error );
 
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+	        FSXFS_TEST_ASSERT_IS_NULL(
+	         "error",
+	         error );
+	}
 #if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
 
 	/* TODO: add tests for libfsxfs_file_entry_initialize */
@@ -102,6 +1595,201 @@ int main(
 	 "libfsxfs_file_entry_free",
 	 fsxfs_test_file_entry_free );
 
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+	if( source != NULL )
+	{
+		result = libbfio_file_range_initialize(
+		          &file_io_handle,
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+	        FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	         "file_io_handle",
+	         file_io_handle );
+
+	        FSXFS_TEST_ASSERT_IS_NULL(
+	         "error",
+	         error );
+
+		string_length = system_string_length(
+		                 source );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libbfio_file_range_set_name_wide(
+		          file_io_handle,
+		          source,
+		          string_length,
+		          &error );
+#else
+		result = libbfio_file_range_set_name(
+		          file_io_handle,
+		          source,
+		          string_length,
+		          &error );
+#endif
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+	        FSXFS_TEST_ASSERT_IS_NULL(
+	         "error",
+	         error );
+
+		result = libbfio_file_range_set(
+		          file_io_handle,
+		          volume_offset,
+		          0,
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+	        FSXFS_TEST_ASSERT_IS_NULL(
+	         "error",
+	         error );
+
+		result = libfsxfs_check_volume_signature_file_io_handle(
+		          file_io_handle,
+		          &error );
+
+		FSXFS_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	if( result != 0 )
+	{
+		/* Initialize volume and file entry for tests
+		 */
+		result = fsxfs_test_volume_open_source(
+		          &volume,
+		          file_io_handle,
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSXFS_TEST_ASSERT_IS_NOT_NULL(
+		 "volume",
+		 volume );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = fsxfs_test_file_entry_get_regular_file(
+		          volume,
+		          &file_entry,
+		          &error );
+
+		FSXFS_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	if( file_entry != NULL )
+	{
+		FSXFS_TEST_RUN_WITH_ARGS(
+		 "libfsxfs_file_entry_read_buffer_at_offset",
+		 fsxfs_test_file_entry_read_buffer_at_offset,
+		 file_entry );
+
+		FSXFS_TEST_RUN_WITH_ARGS(
+		 "libfsxfs_file_entry_get_read_ahead_statistics",
+		 fsxfs_test_file_entry_get_read_ahead_statistics,
+		 file_entry );
+
+		FSXFS_TEST_RUN_WITH_ARGS(
+		 "libfsxfs_file_entry_get_next_data_range",
+		 fsxfs_test_file_entry_get_next_data_range,
+		 file_entry );
+
+		FSXFS_TEST_RUN_WITH_ARGS(
+		 "libfsxfs_file_entry_read_vector",
+		 fsxfs_test_file_entry_read_vector,
+		 file_entry );
+
+		FSXFS_TEST_RUN_WITH_ARGS(
+		 "libfsxfs_file_entry_map_range",
+		 fsxfs_test_file_entry_map_range,
+		 file_entry );
+
+		/* Clean up
+		 */
+		result = libfsxfs_file_entry_free(
+		          &file_entry,
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "file_entry",
+		 file_entry );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	if( volume != NULL )
+	{
+		result = fsxfs_test_volume_close_source(
+		          &volume,
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "volume",
+		 volume );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	if( file_io_handle != NULL )
+	{
+		result = libbfio_handle_free(
+		          &file_io_handle,
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+	         "file_io_handle",
+	         file_io_handle );
+
+	        FSXFS_TEST_ASSERT_IS_NULL(
+	         "error",
+	         error );
+	}
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+
 #if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
 
 	/* TODO: add tests for libfsxfs_file_entry_is_empty */
@@ -138,8 +1826,6 @@ int main(
 
 	/* TODO: add tests for libfsxfs_file_entry_read_buffer */
 
-	/* TODO: add tests for libfsxfs_file_entry_read_buffer_at_offset */
-
 	/* TODO: add tests for libfsxfs_file_entry_seek_offset */
 
 	/* TODO: add tests for libfsxfs_file_entry_get_offset */
@@ -155,6 +1841,29 @@ int main(
 	return( EXIT_SUCCESS );
 
 on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_entry != NULL )
+	{
+		libfsxfs_file_entry_free(
+		 &file_entry,
+		 NULL );
+	}
+	if( volume != NULL )
+	{
+		libfsxfs_volume_free(
+		 &volume,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
 	return( EXIT_FAILURE );
 }
 
@@ -27,6 +27,9 @@
 #include <stdlib.h>
 #endif
 
+#include "fsxfs_test_functions.h"
+#include "fsxfs_test_libbfio.h"
+#include "fsxfs_test_libcdata.h"
 #include "fsxfs_test_libcerror.h"
 #include "fsxfs_test_libfsxfs.h"
 #include "fsxfs_test_macros.h"
@@ -34,6 +37,42 @@
 #include "fsxfs_test_unused.h"
 
 #include "../libfsxfs/libfsxfs_inode_btree.h"
+#include "../libfsxfs/libfsxfs_inode_information.h"
+#include "../libfsxfs/libfsxfs_io_handle.h"
+
+uint8_t fsxfs_test_inode_btree_inode_information_data1[ 512 ] = {
+	0x58, 0x41, 0x47, 0x49, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
+	0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x32,
+	0x00, 0x00, 0x2b, 0x40, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaa, 0xf0, 0xa2, 0xfc, 0x3b, 0x18, 0x47, 0xa6,
+	0x8e, 0xce, 0x3d, 0x94, 0x3a, 0x9f, 0x12, 0x4d, 0x0e, 0x60, 0x3a, 0x66, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
 
 #if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
 
@@ -270,6 +309,521 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfsxfs_inode_btree_set_number_of_allocation_groups function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_inode_btree_set_number_of_allocation_groups(
+     void )
+{
+	libcerror_error_t *error            = NULL;
+	libfsxfs_inode_btree_t *inode_btree = NULL;
+	int number_of_entries               = 0;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_inode_btree_initialize(
+	          &inode_btree,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "inode_btree",
+	 inode_btree );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_inode_btree_set_number_of_allocation_groups(
+	          inode_btree,
+	          4,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_array_get_number_of_entries(
+	          inode_btree->inode_information_array,
+	          &number_of_entries,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 4 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_inode_btree_set_number_of_allocation_groups(
+	          NULL,
+	          4,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_inode_btree_set_number_of_allocation_groups(
+	          inode_btree,
+	          0,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_inode_btree_set_number_of_allocation_groups(
+	          inode_btree,
+	          (uint32_t) INT_MAX + 1,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_inode_btree_free(
+	          &inode_btree,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "inode_btree",
+	 inode_btree );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( inode_btree != NULL )
+	{
+		libfsxfs_inode_btree_free(
+		 &inode_btree,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_inode_btree_get_inode_information function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_inode_btree_get_inode_information(
+     void )
+{
+	uint8_t data[ 1536 ];
+
+	libbfio_handle_t *file_io_handle                       = NULL;
+	libcerror_error_t *error                               = NULL;
+	libfsxfs_inode_btree_t *inode_btree                    = NULL;
+	libfsxfs_inode_information_t *cached_inode_information = NULL;
+	libfsxfs_inode_information_t *inode_information        = NULL;
+	libfsxfs_io_handle_t *io_handle                        = NULL;
+	int result                                             = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_inode_btree_initialize(
+	          &inode_btree,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "inode_btree",
+	 inode_btree );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_inode_btree_set_number_of_allocation_groups(
+	          inode_btree,
+	          4,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->format_version        = 5;
+	io_handle->sector_size           = 512;
+	io_handle->block_size            = 4096;
+	io_handle->allocation_group_size = 4096;
+
+	/* The inode information (AGI) of the first allocation group is stored in the third sector
+	 */
+	memory_set(
+	 data,
+	 0,
+	 1024 );
+
+	memory_copy(
+	 &( data[ 1024 ] ),
+	 fsxfs_test_inode_btree_inode_information_data1,
+	 512 );
+
+	/* Initialize file IO handle
+	 */
+	result = fsxfs_test_open_file_io_handle(
+	          &file_io_handle,
+	          data,
+	          1536,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_inode_btree_get_inode_information(
+	          inode_btree,
+	          io_handle,
+	          file_io_handle,
+	          0,
+	          &inode_information,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "inode_information",
+	 inode_information );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test if the inode information is cached
+	 */
+	result = libfsxfs_inode_btree_get_inode_information(
+	          inode_btree,
+	          io_handle,
+	          file_io_handle,
+	          0,
+	          &cached_inode_information,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "cached_inode_information",
+	 ( cached_inode_information == inode_information ),
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	inode_information = NULL;
+
+	result = libfsxfs_inode_btree_get_inode_information(
+	          NULL,
+	          io_handle,
+	          file_io_handle,
+	          0,
+	          &inode_information,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_inode_btree_get_inode_information(
+	          inode_btree,
+	          NULL,
+	          file_io_handle,
+	          0,
+	          &inode_information,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_inode_btree_get_inode_information(
+	          inode_btree,
+	          io_handle,
+	          file_io_handle,
+	          -1,
+	          &inode_information,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_inode_btree_get_inode_information(
+	          inode_btree,
+	          io_handle,
+	          file_io_handle,
+	          4,
+	          &inode_information,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "inode_information",
+	 inode_information );
+
+	result = libfsxfs_inode_btree_get_inode_information(
+	          inode_btree,
+	          io_handle,
+	          file_io_handle,
+	          0,
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with data of the allocation group that cannot be read
+	 */
+	result = libfsxfs_inode_btree_get_inode_information(
+	          inode_btree,
+	          io_handle,
+	          file_io_handle,
+	          1,
+	          &inode_information,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up file IO handle
+	 */
+	result = fsxfs_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_inode_btree_free(
+	          &inode_btree,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "inode_btree",
+	 inode_btree );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libfsxfs_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	if( inode_btree != NULL )
+	{
+		libfsxfs_inode_btree_free(
+		 &inode_btree,
+		 NULL );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
 
 /* The main program
@@ -297,6 +851,14 @@ int main(
 	 "libfsxfs_inode_btree_free",
 	 fsxfs_test_inode_btree_free );
 
+	FSXFS_TEST_RUN(
+	 "libfsxfs_inode_btree_set_number_of_allocation_groups",
+	 fsxfs_test_inode_btree_set_number_of_allocation_groups );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_inode_btree_get_inode_information",
+	 fsxfs_test_inode_btree_get_inode_information );
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
@@ -0,0 +1,995 @@
+/*
+ * Library inode_cache type test program
+ *
+ * Copyright (C) 2020-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsxfs_test_libcdata.h"
+#include "fsxfs_test_libcerror.h"
+#include "fsxfs_test_libfsxfs.h"
+#include "fsxfs_test_macros.h"
+#include "fsxfs_test_memory.h"
+#include "fsxfs_test_unused.h"
+
+#include "../libfsxfs/libfsxfs_extent.h"
+#include "../libfsxfs/libfsxfs_inode.h"
+#include "../libfsxfs/libfsxfs_inode_cache.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
+
+/* Tests the libfsxfs_inode_cache_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_inode_cache_initialize(
+     void )
+{
+	libcerror_error_t *error            = NULL;
+	libfsxfs_inode_cache_t *inode_cache = NULL;
+	int result                          = 0;
+
+#if defined( HAVE_FSXFS_TEST_MEMORY )
+	int number_of_malloc_fail_tests     = 1;
+	int number_of_memset_fail_tests     = 1;
+	int test_number                     = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_inode_cache_initialize(
+	          &inode_cache,
+	          1024 * 1024,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "inode_cache",
+	 inode_cache );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_inode_cache_free(
+	          &inode_cache,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "inode_cache",
+	 inode_cache );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_inode_cache_initialize(
+	          NULL,
+	          1024 * 1024,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	inode_cache = (libfsxfs_inode_cache_t *) 0x12345678UL;
+
+	result = libfsxfs_inode_cache_initialize(
+	          &inode_cache,
+	          1024 * 1024,
+	          &error );
+
+	inode_cache = NULL;
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FSXFS_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsxfs_inode_cache_initialize with malloc failing
+		 */
+		fsxfs_test_malloc_attempts_before_fail = test_number;
+
+		result = libfsxfs_inode_cache_initialize(
+		          &inode_cache,
+		          1024 * 1024,
+		          &error );
+
+		if( fsxfs_test_malloc_attempts_before_fail != -1 )
+		{
+			fsxfs_test_malloc_attempts_before_fail = -1;
+
+			if( inode_cache != NULL )
+			{
+				libfsxfs_inode_cache_free(
+				 &inode_cache,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSXFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSXFS_TEST_ASSERT_IS_NULL(
+			 "inode_cache",
+			 inode_cache );
+
+			FSXFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsxfs_inode_cache_initialize with memset failing
+		 */
+		fsxfs_test_memset_attempts_before_fail = test_number;
+
+		result = libfsxfs_inode_cache_initialize(
+		          &inode_cache,
+		          1024 * 1024,
+		          &error );
+
+		if( fsxfs_test_memset_attempts_before_fail != -1 )
+		{
+			fsxfs_test_memset_attempts_before_fail = -1;
+
+			if( inode_cache != NULL )
+			{
+				libfsxfs_inode_cache_free(
+				 &inode_cache,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSXFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSXFS_TEST_ASSERT_IS_NULL(
+			 "inode_cache",
+			 inode_cache );
+
+			FSXFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FSXFS_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( inode_cache != NULL )
+	{
+		libfsxfs_inode_cache_free(
+		 &inode_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_inode_cache_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_inode_cache_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsxfs_inode_cache_free(
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_inode_cache_insert_inode and libfsxfs_inode_cache_get_inode_by_number functions
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_inode_cache_insert_inode(
+     void )
+{
+	libcerror_error_t *error            = NULL;
+	libfsxfs_inode_cache_t *inode_cache = NULL;
+	libfsxfs_inode_t *cached_inode      = NULL;
+	libfsxfs_inode_t *inode             = NULL;
+	size_t maximum_cache_size           = 0;
+	int number_of_inodes                = 0;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_inode_cache_initialize(
+	          &inode_cache,
+	          1024 * 1024,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "inode_cache",
+	 inode_cache );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_inode_initialize(
+	          &inode,
+	          256,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "inode",
+	 inode );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_inode_cache_get_inode_by_number(
+	          inode_cache,
+	          128,
+	          &cached_inode,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "cached_inode",
+	 cached_inode );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_inode_cache_insert_inode(
+	          inode_cache,
+	          128,
+	          inode,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_inode_cache_insert_inode(
+	          inode_cache,
+	          128,
+	          inode,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Release the reference of the caller, the cache retains its own reference
+	 */
+	result = libfsxfs_inode_free(
+	          &inode,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_inode_cache_get_inode_by_number(
+	          inode_cache,
+	          128,
+	          &cached_inode,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "cached_inode",
+	 cached_inode );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_inode_cache_get_number_of_inodes(
+	          inode_cache,
+	          &number_of_inodes,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_inodes",
+	 number_of_inodes,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_inode_cache_get_maximum_cache_size(
+	          inode_cache,
+	          &maximum_cache_size,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_EQUAL_SIZE(
+	 "maximum_cache_size",
+	 maximum_cache_size,
+	 (size_t) 1024 * 1024 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that evicted inodes remain valid while referenced
+	 */
+	result = libfsxfs_inode_cache_set_maximum_cache_size(
+	          inode_cache,
+	          0,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_inode_cache_get_number_of_inodes(
+	          inode_cache,
+	          &number_of_inodes,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_inodes",
+	 number_of_inodes,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_inode_cache_get_maximum_cache_size(
+	          inode_cache,
+	          &maximum_cache_size,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_EQUAL_SIZE(
+	 "maximum_cache_size",
+	 maximum_cache_size,
+	 (size_t) 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSXFS_TEST_ASSERT_EQUAL_SIZE(
+	 "cached_inode->data_size",
+	 cached_inode->data_size,
+	 (size_t) 256 );
+
+	result = libfsxfs_inode_cache_insert_inode(
+	          inode_cache,
+	          128,
+	          cached_inode,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_inode_cache_insert_inode(
+	          NULL,
+	          128,
+	          cached_inode,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_inode_cache_insert_inode(
+	          inode_cache,
+	          128,
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_inode_cache_get_inode_by_number(
+	          NULL,
+	          128,
+	          &inode,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_inode_cache_get_inode_by_number(
+	          inode_cache,
+	          128,
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_inode_free(
+	          &cached_inode,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "cached_inode",
+	 cached_inode );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_inode_cache_free(
+	          &inode_cache,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "inode_cache",
+	 inode_cache );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( cached_inode != NULL )
+	{
+		libfsxfs_inode_free(
+		 &cached_inode,
+		 NULL );
+	}
+	if( inode != NULL )
+	{
+		libfsxfs_inode_free(
+		 &inode,
+		 NULL );
+	}
+	if( inode_cache != NULL )
+	{
+		libfsxfs_inode_cache_free(
+		 &inode_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_inode_cache_update_inode function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_inode_cache_update_inode(
+     void )
+{
+	libcerror_error_t *error            = NULL;
+	libfsxfs_inode_cache_t *inode_cache = NULL;
+	libfsxfs_inode_t *cached_inode      = NULL;
+	libfsxfs_inode_t *inode             = NULL;
+	size_t current_size                 = 0;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_inode_cache_initialize(
+	          &inode_cache,
+	          1024 * 1024,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "inode_cache",
+	 inode_cache );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_inode_initialize(
+	          &inode,
+	          256,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "inode",
+	 inode );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_inode_cache_insert_inode(
+	          inode_cache,
+	          128,
+	          inode,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	current_size = inode_cache->shards[ 128 % LIBFSXFS_INODE_CACHE_NUMBER_OF_SHARDS ].current_size;
+
+	/* Test regular cases
+	 */
+	result = libcdata_array_initialize(
+	          &( inode->data_extents_array ),
+	          16,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_inode_cache_update_inode(
+	          inode_cache,
+	          128,
+	          inode,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSXFS_TEST_ASSERT_EQUAL_SIZE(
+	 "current_size",
+	 inode_cache->shards[ 128 % LIBFSXFS_INODE_CACHE_NUMBER_OF_SHARDS ].current_size,
+	 current_size + ( 16 * ( sizeof( libfsxfs_extent_t ) + sizeof( intptr_t * ) ) ) );
+
+	/* Test an inode that is not cached
+	 */
+	result = libfsxfs_inode_cache_update_inode(
+	          inode_cache,
+	          128 + LIBFSXFS_INODE_CACHE_NUMBER_OF_SHARDS,
+	          inode,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test an inode that exceeds the maximum size of the shard after the update
+	 */
+	result = libcdata_array_resize(
+	          inode->data_extents_array,
+	          4096,
+	          (int (*)(intptr_t **, libcerror_error_t **)) &libfsxfs_extent_free,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_inode_cache_update_inode(
+	          inode_cache,
+	          128,
+	          inode,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSXFS_TEST_ASSERT_EQUAL_SIZE(
+	 "current_size",
+	 inode_cache->shards[ 128 % LIBFSXFS_INODE_CACHE_NUMBER_OF_SHARDS ].current_size,
+	 (size_t) 0 );
+
+	result = libfsxfs_inode_cache_get_inode_by_number(
+	          inode_cache,
+	          128,
+	          &cached_inode,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "cached_inode",
+	 cached_inode );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_inode_cache_update_inode(
+	          NULL,
+	          128,
+	          inode,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_inode_cache_update_inode(
+	          inode_cache,
+	          128,
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_inode_free(
+	          &inode,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "inode",
+	 inode );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_inode_cache_free(
+	          &inode_cache,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "inode_cache",
+	 inode_cache );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( cached_inode != NULL )
+	{
+		libfsxfs_inode_free(
+		 &cached_inode,
+		 NULL );
+	}
+	if( inode != NULL )
+	{
+		libfsxfs_inode_free(
+		 &inode,
+		 NULL );
+	}
+	if( inode_cache != NULL )
+	{
+		libfsxfs_inode_cache_free(
+		 &inode_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSXFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSXFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSXFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSXFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSXFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSXFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_inode_cache_initialize",
+	 fsxfs_test_inode_cache_initialize );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_inode_cache_free",
+	 fsxfs_test_inode_cache_free );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_inode_cache_insert_inode",
+	 fsxfs_test_inode_cache_insert_inode );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_inode_cache_update_inode",
+	 fsxfs_test_inode_cache_update_inode );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
+}
+
@@ -0,0 +1,1101 @@
+/*
+ * Library inode_chunk_index type test program
+ *
+ * Copyright (C) 2020-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsxfs_test_libcerror.h"
+#include "fsxfs_test_libfsxfs.h"
+#include "fsxfs_test_macros.h"
+#include "fsxfs_test_memory.h"
+#include "fsxfs_test_unused.h"
+
+#include "../libfsxfs/libfsxfs_inode_chunk_index.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
+
+/* Tests the libfsxfs_inode_chunk_index_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_inode_chunk_index_initialize(
+     void )
+{
+	libcerror_error_t *error                        = NULL;
+	libfsxfs_inode_chunk_index_t *inode_chunk_index = NULL;
+	int result                                      = 0;
+
+#if defined( HAVE_FSXFS_TEST_MEMORY )
+	int number_of_malloc_fail_tests                 = 1;
+	int number_of_memset_fail_tests                 = 1;
+	int test_number                                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_inode_chunk_index_initialize(
+	          &inode_chunk_index,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "inode_chunk_index",
+	 inode_chunk_index );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_inode_chunk_index_free(
+	          &inode_chunk_index,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "inode_chunk_index",
+	 inode_chunk_index );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_inode_chunk_index_initialize(
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	inode_chunk_index = (libfsxfs_inode_chunk_index_t *) 0x12345678UL;
+
+	result = libfsxfs_inode_chunk_index_initialize(
+	          &inode_chunk_index,
+	          &error );
+
+	inode_chunk_index = NULL;
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FSXFS_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsxfs_inode_chunk_index_initialize with malloc failing
+		 */
+		fsxfs_test_malloc_attempts_before_fail = test_number;
+
+		result = libfsxfs_inode_chunk_index_initialize(
+		          &inode_chunk_index,
+		          &error );
+
+		if( fsxfs_test_malloc_attempts_before_fail != -1 )
+		{
+			fsxfs_test_malloc_attempts_before_fail = -1;
+
+			if( inode_chunk_index != NULL )
+			{
+				libfsxfs_inode_chunk_index_free(
+				 &inode_chunk_index,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSXFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSXFS_TEST_ASSERT_IS_NULL(
+			 "inode_chunk_index",
+			 inode_chunk_index );
+
+			FSXFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsxfs_inode_chunk_index_initialize with memset failing
+		 */
+		fsxfs_test_memset_attempts_before_fail = test_number;
+
+		result = libfsxfs_inode_chunk_index_initialize(
+		          &inode_chunk_index,
+		          &error );
+
+		if( fsxfs_test_memset_attempts_before_fail != -1 )
+		{
+			fsxfs_test_memset_attempts_before_fail = -1;
+
+			if( inode_chunk_index != NULL )
+			{
+				libfsxfs_inode_chunk_index_free(
+				 &inode_chunk_index,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSXFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSXFS_TEST_ASSERT_IS_NULL(
+			 "inode_chunk_index",
+			 inode_chunk_index );
+
+			FSXFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FSXFS_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( inode_chunk_index != NULL )
+	{
+		libfsxfs_inode_chunk_index_free(
+		 &inode_chunk_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_inode_chunk_index_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_inode_chunk_index_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsxfs_inode_chunk_index_free(
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_inode_chunk_index_append_chunk and libfsxfs_inode_chunk_index_get_chunk_by_inode_number functions
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_inode_chunk_index_get_chunk_by_inode_number(
+     void )
+{
+	libcerror_error_t *error                        = NULL;
+	libfsxfs_inode_chunk_index_t *inode_chunk_index = NULL;
+	uint64_t chunk_allocation_bitmap                = 0;
+	uint32_t chunk_inode_number                     = 0;
+	uint32_t chunk_index                            = 0;
+	int number_of_chunks                            = 0;
+	int result                                      = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_inode_chunk_index_initialize(
+	          &inode_chunk_index,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "inode_chunk_index",
+	 inode_chunk_index );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Append 100 chunks with a gap of 64 inodes between them
+	 */
+	for( chunk_index = 0;
+	     chunk_index < 100;
+	     chunk_index++ )
+	{
+		result = libfsxfs_inode_chunk_index_append_chunk(
+		          inode_chunk_index,
+		          128 + ( chunk_index * 128 ),
+		          (uint64_t) chunk_index,
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libfsxfs_inode_chunk_index_get_number_of_chunks(
+	          inode_chunk_index,
+	          &number_of_chunks,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_chunks",
+	 number_of_chunks,
+	 100 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_inode_chunk_index_get_chunk_by_inode_number(
+	          inode_chunk_index,
+	          128,
+	          &chunk_inode_number,
+	          &chunk_allocation_bitmap,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT32(
+	 "chunk_inode_number",
+	 chunk_inode_number,
+	 (uint32_t) 128 );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT64(
+	 "chunk_allocation_bitmap",
+	 chunk_allocation_bitmap,
+	 (uint64_t) 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_inode_chunk_index_get_chunk_by_inode_number(
+	          inode_chunk_index,
+	          128 + ( 57 * 128 ) + 63,
+	          &chunk_inode_number,
+	          &chunk_allocation_bitmap,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT32(
+	 "chunk_inode_number",
+	 chunk_inode_number,
+	 (uint32_t) ( 128 + ( 57 * 128 ) ) );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT64(
+	 "chunk_allocation_bitmap",
+	 chunk_allocation_bitmap,
+	 (uint64_t) 57 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Inode numbers before the first chunk, in a gap and after the last chunk
+	 */
+	result = libfsxfs_inode_chunk_index_get_chunk_by_inode_number(
+	          inode_chunk_index,
+	          127,
+	          &chunk_inode_number,
+	          &chunk_allocation_bitmap,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_inode_chunk_index_get_chunk_by_inode_number(
+	          inode_chunk_index,
+	          128 + 64,
+	          &chunk_inode_number,
+	          &chunk_allocation_bitmap,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_inode_chunk_index_get_chunk_by_inode_number(
+	          inode_chunk_index,
+	          128 + ( 100 * 128 ),
+	          &chunk_inode_number,
+	          &chunk_allocation_bitmap,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_inode_chunk_index_append_chunk(
+	          inode_chunk_index,
+	          128,
+	          0,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_inode_chunk_index_get_chunk_by_inode_number(
+	          NULL,
+	          128,
+	          &chunk_inode_number,
+	          &chunk_allocation_bitmap,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_inode_chunk_index_get_chunk_by_inode_number(
+	          inode_chunk_index,
+	          128,
+	          NULL,
+	          &chunk_allocation_bitmap,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_inode_chunk_index_get_chunk_by_inode_number(
+	          inode_chunk_index,
+	          128,
+	          &chunk_inode_number,
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_inode_chunk_index_free(
+	          &inode_chunk_index,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "inode_chunk_index",
+	 inode_chunk_index );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( inode_chunk_index != NULL )
+	{
+		libfsxfs_inode_chunk_index_free(
+		 &inode_chunk_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_inode_chunk_index_get_chunk_by_index function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_inode_chunk_index_get_chunk_by_index(
+     void )
+{
+	libcerror_error_t *error                        = NULL;
+	libfsxfs_inode_chunk_index_t *inode_chunk_index = NULL;
+	uint64_t chunk_allocation_bitmap                = 0;
+	uint32_t chunk_inode_number                     = 0;
+	int result                                      = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_inode_chunk_index_initialize(
+	          &inode_chunk_index,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "inode_chunk_index",
+	 inode_chunk_index );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_inode_chunk_index_append_chunk(
+	          inode_chunk_index,
+	          128,
+	          (uint64_t) 0xffffffff00000000ULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_inode_chunk_index_append_chunk(
+	          inode_chunk_index,
+	          256,
+	          (uint64_t) 1,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_inode_chunk_index_get_chunk_by_index(
+	          inode_chunk_index,
+	          1,
+	          &chunk_inode_number,
+	          &chunk_allocation_bitmap,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT32(
+	 "chunk_inode_number",
+	 chunk_inode_number,
+	 (uint32_t) 256 );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT64(
+	 "chunk_allocation_bitmap",
+	 chunk_allocation_bitmap,
+	 (uint64_t) 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_inode_chunk_index_get_chunk_by_index(
+	          NULL,
+	          0,
+	          &chunk_inode_number,
+	          &chunk_allocation_bitmap,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_inode_chunk_index_get_chunk_by_index(
+	          inode_chunk_index,
+	          -1,
+	          &chunk_inode_number,
+	          &chunk_allocation_bitmap,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_inode_chunk_index_get_chunk_by_index(
+	          inode_chunk_index,
+	          2,
+	          &chunk_inode_number,
+	          &chunk_allocation_bitmap,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_inode_chunk_index_get_chunk_by_index(
+	          inode_chunk_index,
+	          0,
+	          NULL,
+	          &chunk_allocation_bitmap,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_inode_chunk_index_get_chunk_by_index(
+	          inode_chunk_index,
+	          0,
+	          &chunk_inode_number,
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_inode_chunk_index_free(
+	          &inode_chunk_index,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "inode_chunk_index",
+	 inode_chunk_index );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( inode_chunk_index != NULL )
+	{
+		libfsxfs_inode_chunk_index_free(
+		 &inode_chunk_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_inode_chunk_index_get_next_allocated_inode_number function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_inode_chunk_index_get_next_allocated_inode_number(
+     void )
+{
+	libcerror_error_t *error                        = NULL;
+	libfsxfs_inode_chunk_index_t *inode_chunk_index = NULL;
+	uint32_t next_inode_number                      = 0;
+	int result                                      = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_inode_chunk_index_initialize(
+	          &inode_chunk_index,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "inode_chunk_index",
+	 inode_chunk_index );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_inode_chunk_index_get_next_allocated_inode_number(
+	          inode_chunk_index,
+	          0,
+	          &next_inode_number,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_inode_chunk_index_append_chunk(
+	          inode_chunk_index,
+	          128,
+	          (uint64_t) 0xffffffff00000000ULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_inode_chunk_index_append_chunk(
+	          inode_chunk_index,
+	          256,
+	          (uint64_t) 1,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_inode_chunk_index_get_next_allocated_inode_number(
+	          inode_chunk_index,
+	          0,
+	          &next_inode_number,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT32(
+	 "next_inode_number",
+	 next_inode_number,
+	 (uint32_t) 128 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_inode_chunk_index_get_next_allocated_inode_number(
+	          inode_chunk_index,
+	          150,
+	          &next_inode_number,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT32(
+	 "next_inode_number",
+	 next_inode_number,
+	 (uint32_t) 150 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_inode_chunk_index_get_next_allocated_inode_number(
+	          inode_chunk_index,
+	          160,
+	          &next_inode_number,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT32(
+	 "next_inode_number",
+	 next_inode_number,
+	 (uint32_t) 257 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_inode_chunk_index_get_next_allocated_inode_number(
+	          inode_chunk_index,
+	          256,
+	          &next_inode_number,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT32(
+	 "next_inode_number",
+	 next_inode_number,
+	 (uint32_t) 257 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_inode_chunk_index_get_next_allocated_inode_number(
+	          inode_chunk_index,
+	          319,
+	          &next_inode_number,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT32(
+	 "next_inode_number",
+	 next_inode_number,
+	 (uint32_t) 319 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_inode_chunk_index_get_next_allocated_inode_number(
+	          inode_chunk_index,
+	          320,
+	          &next_inode_number,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_inode_chunk_index_get_next_allocated_inode_number(
+	          NULL,
+	          0,
+	          &next_inode_number,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_inode_chunk_index_get_next_allocated_inode_number(
+	          inode_chunk_index,
+	          0,
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_inode_chunk_index_free(
+	          &inode_chunk_index,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "inode_chunk_index",
+	 inode_chunk_index );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( inode_chunk_index != NULL )
+	{
+		libfsxfs_inode_chunk_index_free(
+		 &inode_chunk_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSXFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSXFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSXFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSXFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSXFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSXFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_inode_chunk_index_initialize",
+	 fsxfs_test_inode_chunk_index_initialize );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_inode_chunk_index_free",
+	 fsxfs_test_inode_chunk_index_free );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_inode_chunk_index_get_chunk_by_inode_number",
+	 fsxfs_test_inode_chunk_index_get_chunk_by_inode_number );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_inode_chunk_index_get_chunk_by_index",
+	 fsxfs_test_inode_chunk_index_get_chunk_by_index );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_inode_chunk_index_get_next_allocated_inode_number",
+	 fsxfs_test_inode_chunk_index_get_next_allocated_inode_number );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
+}
+
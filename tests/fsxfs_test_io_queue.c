@@ -0,0 +1,602 @@
+/*
+ * Library io_queue functions test program
+ *
+ * Copyright (C) 2020-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsxfs_test_libcerror.h"
+#include "fsxfs_test_libfsxfs.h"
+#include "fsxfs_test_macros.h"
+#include "fsxfs_test_memory.h"
+#include "fsxfs_test_unused.h"
+
+#include "../libfsxfs/libfsxfs_io_queue.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
+
+/* Reads a buffer filled with the lower byte of the offset
+ * An offset of 0x10000 or more fails
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t fsxfs_test_io_queue_read_function(
+         intptr_t *io_handle FSXFS_TEST_ATTRIBUTE_UNUSED,
+         libbfio_handle_t *file_io_handle FSXFS_TEST_ATTRIBUTE_UNUSED,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t file_offset,
+         libcerror_error_t **error )
+{
+	static char *function = "fsxfs_test_io_queue_read_function";
+
+	FSXFS_TEST_UNREFERENCED_PARAMETER( io_handle )
+	FSXFS_TEST_UNREFERENCED_PARAMETER( file_io_handle )
+
+	if( file_offset >= 0x10000 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     buffer,
+	     (int) ( file_offset & 0xff ),
+	     buffer_size ) == NULL )
+	{
+		return( -1 );
+	}
+	return( (ssize_t) buffer_size );
+}
+
+/* Tests the libfsxfs_io_queue_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_io_queue_initialize(
+     void )
+{
+	libcerror_error_t *error      = NULL;
+	libfsxfs_io_queue_t *io_queue = NULL;
+	int result                    = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_io_queue_initialize(
+	          &io_queue,
+	          2,
+	          NULL,
+	          NULL,
+	          &fsxfs_test_io_queue_read_function,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "io_queue",
+	 io_queue );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_io_queue_free(
+	          &io_queue,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "io_queue",
+	 io_queue );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_io_queue_initialize(
+	          NULL,
+	          2,
+	          NULL,
+	          NULL,
+	          &fsxfs_test_io_queue_read_function,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_io_queue_initialize(
+	          &io_queue,
+	          0,
+	          NULL,
+	          NULL,
+	          &fsxfs_test_io_queue_read_function,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_io_queue_initialize(
+	          &io_queue,
+	          2,
+	          NULL,
+	          NULL,
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	io_queue = (libfsxfs_io_queue_t *) 0x12345678UL;
+
+	result = libfsxfs_io_queue_initialize(
+	          &io_queue,
+	          2,
+	          NULL,
+	          NULL,
+	          &fsxfs_test_io_queue_read_function,
+	          &error );
+
+	io_queue = NULL;
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_queue != NULL )
+	{
+		libfsxfs_io_queue_free(
+		 &io_queue,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_io_queue_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_io_queue_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsxfs_io_queue_free(
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_io_queue_submit_read and libfsxfs_io_queue_wait functions
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_io_queue_submit_read(
+     void )
+{
+	uint8_t buffers[ 16 ][ 512 ];
+
+	libfsxfs_io_queue_batch_t batch;
+
+	libcerror_error_t *error      = NULL;
+	libfsxfs_io_queue_t *io_queue = NULL;
+	int buffer_index              = 0;
+	int result                    = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_io_queue_initialize(
+	          &io_queue,
+	          4,
+	          NULL,
+	          NULL,
+	          &fsxfs_test_io_queue_read_function,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "io_queue",
+	 io_queue );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	batch.number_of_pending_reads = 0;
+	batch.number_of_failed_reads  = 0;
+
+	for( buffer_index = 0;
+	     buffer_index < 16;
+	     buffer_index++ )
+	{
+		result = libfsxfs_io_queue_submit_read(
+		          io_queue,
+		          &batch,
+		          buffers[ buffer_index ],
+		          512,
+		          (off64_t) buffer_index,
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libfsxfs_io_queue_wait(
+	          io_queue,
+	          &batch,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "batch.number_of_pending_reads",
+	 batch.number_of_pending_reads,
+	 0 );
+
+	for( buffer_index = 0;
+	     buffer_index < 16;
+	     buffer_index++ )
+	{
+		FSXFS_TEST_ASSERT_EQUAL_UINT8(
+		 "buffers[ buffer_index ][ 0 ]",
+		 buffers[ buffer_index ][ 0 ],
+		 (uint8_t) buffer_index );
+
+		FSXFS_TEST_ASSERT_EQUAL_UINT8(
+		 "buffers[ buffer_index ][ 511 ]",
+		 buffers[ buffer_index ][ 511 ],
+		 (uint8_t) buffer_index );
+	}
+	/* Test wait with a failed read
+	 */
+	result = libfsxfs_io_queue_submit_read(
+	          io_queue,
+	          &batch,
+	          buffers[ 0 ],
+	          512,
+	          0x10000,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_io_queue_wait(
+	          io_queue,
+	          &batch,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "batch.number_of_failed_reads",
+	 batch.number_of_failed_reads,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_io_queue_submit_read(
+	          NULL,
+	          &batch,
+	          buffers[ 0 ],
+	          512,
+	          0,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_io_queue_submit_read(
+	          io_queue,
+	          NULL,
+	          buffers[ 0 ],
+	          512,
+	          0,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_io_queue_submit_read(
+	          io_queue,
+	          &batch,
+	          NULL,
+	          512,
+	          0,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_io_queue_submit_read(
+	          io_queue,
+	          &batch,
+	          buffers[ 0 ],
+	          512,
+	          -1,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_io_queue_wait(
+	          NULL,
+	          &batch,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_io_queue_wait(
+	          io_queue,
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_io_queue_free(
+	          &io_queue,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "io_queue",
+	 io_queue );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_queue != NULL )
+	{
+		libfsxfs_io_queue_free(
+		 &io_queue,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSXFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSXFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSXFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSXFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSXFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSXFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_io_queue_initialize",
+	 fsxfs_test_io_queue_initialize );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_io_queue_free",
+	 fsxfs_test_io_queue_free );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_io_queue_submit_read",
+	 fsxfs_test_io_queue_submit_read );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
+}
+
@@ -0,0 +1,297 @@
+/*
+ * Library read_vector functions test program
+ *
+ * Copyright (C) 2020-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsxfs_test_libcerror.h"
+#include "fsxfs_test_libfsxfs.h"
+#include "fsxfs_test_macros.h"
+#include "fsxfs_test_memory.h"
+#include "fsxfs_test_unused.h"
+
+#include "../libfsxfs/libfsxfs_read_vector.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
+
+/* Tests the libfsxfs_read_vector_range_compare function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_read_vector_range_compare(
+     void )
+{
+	libfsxfs_read_vector_range_t first_range;
+	libfsxfs_read_vector_range_t second_range;
+
+	int result = 0;
+
+	first_range.physical_offset  = 4096;
+	first_range.offset           = 8192;
+	first_range.size             = 512;
+	first_range.buffer_index     = 0;
+
+	second_range.physical_offset = 4096;
+	second_range.offset          = 8192;
+	second_range.size            = 512;
+	second_range.buffer_index    = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_read_vector_range_compare(
+	          &first_range,
+	          &second_range );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	second_range.buffer_index = 1;
+
+	result = libfsxfs_read_vector_range_compare(
+	          &first_range,
+	          &second_range );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	second_range.offset = 0;
+
+	result = libfsxfs_read_vector_range_compare(
+	          &first_range,
+	          &second_range );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test that the physical offset takes precedence over the offset
+	 */
+	second_range.physical_offset = 8192;
+
+	result = libfsxfs_read_vector_range_compare(
+	          &first_range,
+	          &second_range );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	/* Test that ranges that are not stored sort first
+	 */
+	first_range.physical_offset = -1;
+
+	result = libfsxfs_read_vector_range_compare(
+	          &second_range,
+	          &first_range );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libfsxfs_read_vector_ranges_sort function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_read_vector_ranges_sort(
+     void )
+{
+	libfsxfs_read_vector_range_t *ranges = NULL;
+	libcerror_error_t *error             = NULL;
+	int number_of_ranges                 = 1000;
+	int range_index                      = 0;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	ranges = (libfsxfs_read_vector_range_t *) memory_allocate(
+	                                           sizeof( libfsxfs_read_vector_range_t ) * number_of_ranges );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "ranges",
+	 ranges );
+
+	/* Use physical offsets that are out of order and contain duplicates
+	 */
+	for( range_index = 0;
+	     range_index < number_of_ranges;
+	     range_index++ )
+	{
+		ranges[ range_index ].physical_offset = (off64_t) ( ( range_index * 7919 ) % 997 ) * 4096;
+		ranges[ range_index ].offset          = (off64_t) range_index * 512;
+		ranges[ range_index ].size            = 512;
+		ranges[ range_index ].buffer_index    = range_index;
+	}
+	/* Test regular cases
+	 */
+	result = libfsxfs_read_vector_ranges_sort(
+	          ranges,
+	          number_of_ranges,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( range_index = 1;
+	     range_index < number_of_ranges;
+	     range_index++ )
+	{
+		result = libfsxfs_read_vector_range_compare(
+		          &( ranges[ range_index - 1 ] ),
+		          &( ranges[ range_index ] ) );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+	}
+	result = libfsxfs_read_vector_ranges_sort(
+	          ranges,
+	          0,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_read_vector_ranges_sort(
+	          NULL,
+	          number_of_ranges,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_read_vector_ranges_sort(
+	          ranges,
+	          -1,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	memory_free(
+	 ranges );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( ranges != NULL )
+	{
+		memory_free(
+		 ranges );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSXFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSXFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSXFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSXFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSXFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSXFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_read_vector_range_compare",
+	 fsxfs_test_read_vector_range_compare );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_read_vector_ranges_sort",
+	 fsxfs_test_read_vector_ranges_sort );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
+}
+
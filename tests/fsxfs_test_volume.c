@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <narrow_string.h>
 #include <system_string.h>
 #include <types.h>
@@ -55,6 +56,13 @@ int libfsxfs_volume_open_file_io_handle(
      int access_flags,
      libfsxfs_error_t **error );
 
+LIBFSXFS_EXTERN \
+int libfsxfs_volume_open_file_io_pool(
+     libfsxfs_volume_t *volume,
+     libbfio_pool_t *file_io_pool,
+     int access_flags,
+     libfsxfs_error_t **error );
+
 #endif /* !defined( LIBFSXFS_HAVE_BFIO ) */
 
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER ) && SIZEOF_WCHAR_T != 2 && SIZEOF_WCHAR_T != 4
@@ -1002,56 +1010,84 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libfsxfs_volume_close function
+/* Tests the libfsxfs_volume_open_file_io_pool function
  * Returns 1 if successful or 0 if not
  */
-int fsxfs_test_volume_close(
-     void )
+int fsxfs_test_volume_open_file_io_pool(
+     const system_character_t *source )
 {
-	libcerror_error_t *error = NULL;
-	int result               = 0;
+	libbfio_handle_t *file_io_handle      = NULL;
+	libbfio_handle_t *pool_file_io_handle = NULL;
+	libbfio_pool_t *file_io_pool          = NULL;
+	libcerror_error_t *error              = NULL;
+	libfsxfs_volume_t *volume             = NULL;
+	size_t string_length                  = 0;
+	int entry_index                       = 0;
+	int result                            = 0;
 
-	/* Test error cases
+	/* Initialize test
 	 */
-	result = libfsxfs_volume_close(
-	          NULL,
+	result = libbfio_file_initialize(
+	          &file_io_handle,
 	          &error );
 
 	FSXFS_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	string_length = system_string_length(
+	                 source );
 
-	return( 1 );
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libbfio_file_set_name_wide(
+	          file_io_handle,
+	          source,
+	          string_length,
+	          &error );
+#else
+	result = libbfio_file_set_name(
+	          file_io_handle,
+	          source,
+	          string_length,
+	          &error );
+#endif
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	return( 0 );
-}
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-/* Tests the libfsxfs_volume_open and libfsxfs_volume_close functions
- * Returns 1 if successful or 0 if not
- */
-int fsxfs_test_volume_open_close(
-     const system_character_t *source )
-{
-	libcerror_error_t *error  = NULL;
-	libfsxfs_volume_t *volume = NULL;
-	int result                = 0;
+	result = libbfio_pool_initialize(
+	          &file_io_pool,
+	          0,
+	          LIBBFIO_POOL_UNLIMITED_NUMBER_OF_OPEN_HANDLES,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_pool",
+	 file_io_pool );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-	/* Initialize test
-	 */
 	result = libfsxfs_volume_initialize(
 	          &volume,
 	          &error );
@@ -1069,21 +1105,34 @@ int fsxfs_test_volume_open_close(
 	 "error",
 	 error );
 
-	/* Test open and close
+	/* Test open with an empty pool
 	 */
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	result = libfsxfs_volume_open_wide(
+	result = libfsxfs_volume_open_file_io_pool(
 	          volume,
-	          source,
+	          file_io_pool,
 	          LIBFSXFS_OPEN_READ,
 	          &error );
-#else
-	result = libfsxfs_volume_open(
-	          volume,
-	          source,
-	          LIBFSXFS_OPEN_READ,
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* The pool takes over management of the file IO handle
+	 */
+	result = libbfio_pool_append_handle(
+	          file_io_pool,
+	          &entry_index,
+	          file_io_handle,
+	          LIBBFIO_OPEN_READ,
 	          &error );
-#endif
 
 	FSXFS_TEST_ASSERT_EQUAL_INT(
 	 "result",
@@ -1094,44 +1143,65 @@ int fsxfs_test_volume_open_close(
 	 "error",
 	 error );
 
-	result = libfsxfs_volume_close(
+	file_io_handle = NULL;
+
+	/* Test open
+	 */
+	result = libfsxfs_volume_open_file_io_pool(
 	          volume,
+	          file_io_pool,
+	          LIBFSXFS_OPEN_READ,
 	          &error );
 
 	FSXFS_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 0 );
+	 1 );
 
 	FSXFS_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test open and close a second time to validate clean up on close
+	/* Test error cases
 	 */
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	result = libfsxfs_volume_open_wide(
-	          volume,
-	          source,
+	result = libfsxfs_volume_open_file_io_pool(
+	          NULL,
+	          file_io_pool,
 	          LIBFSXFS_OPEN_READ,
 	          &error );
-#else
-	result = libfsxfs_volume_open(
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test open when already opened
+	 */
+	result = libfsxfs_volume_open_file_io_pool(
 	          volume,
-	          source,
+	          file_io_pool,
 	          LIBFSXFS_OPEN_READ,
 	          &error );
-#endif
 
 	FSXFS_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
-	FSXFS_TEST_ASSERT_IS_NULL(
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
+	libcerror_error_free(
+	 &error );
+
 	result = libfsxfs_volume_close(
 	          volume,
 	          &error );
@@ -1145,10 +1215,12 @@ int fsxfs_test_volume_open_close(
 	 "error",
 	 error );
 
-	/* Clean up
+	/* The file IO handle opened by the library is closed by the library
 	 */
-	result = libfsxfs_volume_free(
-	          &volume,
+	result = libbfio_pool_get_handle(
+	          file_io_pool,
+	          0,
+	          &pool_file_io_handle,
 	          &error );
 
 	FSXFS_TEST_ASSERT_EQUAL_INT(
@@ -1156,59 +1228,45 @@ int fsxfs_test_volume_open_close(
 	 result,
 	 1 );
 
-	FSXFS_TEST_ASSERT_IS_NULL(
-	 "volume",
-	 volume );
-
 	FSXFS_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	return( 1 );
+	result = libbfio_handle_is_open(
+	          pool_file_io_handle,
+	          &error );
 
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	if( volume != NULL )
-	{
-		libfsxfs_volume_free(
-		 &volume,
-		 NULL );
-	}
-	return( 0 );
-}
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
 
-/* Tests the libfsxfs_volume_signal_abort function
- * Returns 1 if successful or 0 if not
- */
-int fsxfs_test_volume_signal_abort(
-     libfsxfs_volume_t *volume )
-{
-	libcerror_error_t *error = NULL;
-	int result               = 0;
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-	/* Test regular cases
-	 */
-	result = libfsxfs_volume_signal_abort(
+	result = libfsxfs_volume_open_file_io_pool(
 	          volume,
+	          NULL,
+	          LIBFSXFS_OPEN_READ,
 	          &error );
 
 	FSXFS_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
-	FSXFS_TEST_ASSERT_IS_NULL(
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = libfsxfs_volume_signal_abort(
-	          NULL,
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_volume_open_file_io_pool(
+	          volume,
+	          file_io_pool,
+	          -1,
 	          &error );
 
 	FSXFS_TEST_ASSERT_EQUAL_INT(
@@ -1223,56 +1281,2456 @@ int fsxfs_test_volume_signal_abort(
 	libcerror_error_free(
 	 &error );
 
-	return( 1 );
+	result = libfsxfs_volume_open_file_io_pool(
+	          volume,
+	          file_io_pool,
+	          LIBFSXFS_OPEN_WRITE,
+	          &error );
 
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	return( 0 );
-}
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-/* The main program
- */
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-int wmain(
-     int argc,
-     wchar_t * const argv[] )
-#else
-int main(
-     int argc,
-     char * const argv[] )
-#endif
-{
-	libbfio_handle_t *file_io_handle  = NULL;
-	libcerror_error_t *error          = NULL;
-	libfsxfs_volume_t *volume         = NULL;
-	system_character_t *option_offset = NULL;
-	system_character_t *source        = NULL;
-	system_integer_t option           = 0;
-	size_t string_length              = 0;
-	off64_t volume_offset             = 0;
-	int result                        = 0;
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-	while( ( option = fsxfs_test_getopt(
-	                   argc,
-	                   argv,
-	                   _SYSTEM_STRING( "o:" ) ) ) != (system_integer_t) -1 )
-	{
-		switch( option )
-		{
-			case (system_integer_t) '?':
-			default:
-				fprintf(
-				 stderr,
-				 "Invalid argument: %" PRIs_SYSTEM ".\n",
-				 argv[ optind - 1 ] );
+	libcerror_error_free(
+	 &error );
 
-				return( EXIT_FAILURE );
+	/* Test open with a file IO handle that was opened by the caller
+	 */
+	result = libbfio_pool_open(
+	          file_io_pool,
+	          0,
+	          LIBBFIO_OPEN_READ,
+	          &error );
 
-			case (system_integer_t) 'o':
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_volume_open_file_io_pool(
+	          volume,
+	          file_io_pool,
+	          LIBFSXFS_OPEN_READ,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_volume_close(
+	          volume,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The file IO handle opened by the caller is left open
+	 */
+	result = libbfio_pool_get_handle(
+	          file_io_pool,
+	          0,
+	          &pool_file_io_handle,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_is_open(
+	          pool_file_io_handle,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_pool_close(
+	          file_io_pool,
+	          0,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_volume_free(
+	          &volume,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "volume",
+	 volume );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_pool_free(
+	          &file_io_pool,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "file_io_pool",
+	 file_io_pool );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( volume != NULL )
+	{
+		libfsxfs_volume_free(
+		 &volume,
+		 NULL );
+	}
+	if( file_io_pool != NULL )
+	{
+		libbfio_pool_free(
+		 &file_io_pool,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_volume_close function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_volume_close(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsxfs_volume_close(
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_volume_open and libfsxfs_volume_close functions
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_volume_open_close(
+     const system_character_t *source )
+{
+	libcerror_error_t *error  = NULL;
+	libfsxfs_volume_t *volume = NULL;
+	int result                = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_volume_initialize(
+	          &volume,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "volume",
+	 volume );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open and close
+	 */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libfsxfs_volume_open_wide(
+	          volume,
+	          source,
+	          LIBFSXFS_OPEN_READ,
+	          &error );
+#else
+	result = libfsxfs_volume_open(
+	          volume,
+	          source,
+	          LIBFSXFS_OPEN_READ,
+	          &error );
+#endif
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_volume_close(
+	          volume,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open and close a second time to validate clean up on close
+	 */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libfsxfs_volume_open_wide(
+	          volume,
+	          source,
+	          LIBFSXFS_OPEN_READ,
+	          &error );
+#else
+	result = libfsxfs_volume_open(
+	          volume,
+	          source,
+	          LIBFSXFS_OPEN_READ,
+	          &error );
+#endif
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_volume_close(
+	          volume,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_volume_free(
+	          &volume,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "volume",
+	 volume );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( volume != NULL )
+	{
+		libfsxfs_volume_free(
+		 &volume,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_volume_signal_abort function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_volume_signal_abort(
+     libfsxfs_volume_t *volume )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_volume_signal_abort(
+	          volume,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_volume_signal_abort(
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_volume_set_maximum_read_ahead_size function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_volume_set_maximum_read_ahead_size(
+     void )
+{
+	libcerror_error_t *error  = NULL;
+	libfsxfs_volume_t *volume = NULL;
+	int result                = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_volume_initialize(
+	          &volume,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "volume",
+	 volume );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_volume_set_maximum_read_ahead_size(
+	          volume,
+	          0,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_volume_set_maximum_read_ahead_size(
+	          volume,
+	          4 * 1024 * 1024,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_volume_set_maximum_read_ahead_size(
+	          NULL,
+	          4 * 1024 * 1024,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_volume_set_maximum_read_ahead_size(
+	          volume,
+	          (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE + 1,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_volume_free(
+	          &volume,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "volume",
+	 volume );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( volume != NULL )
+	{
+		libfsxfs_volume_free(
+		 &volume,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_volume_set_number_of_io_threads function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_volume_set_number_of_io_threads(
+     void )
+{
+	libcerror_error_t *error  = NULL;
+	libfsxfs_volume_t *volume = NULL;
+	int result                = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_volume_initialize(
+	          &volume,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "volume",
+	 volume );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_volume_set_number_of_io_threads(
+	          volume,
+	          0,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_volume_set_number_of_io_threads(
+	          volume,
+	          LIBFSXFS_IO_QUEUE_MAXIMUM_NUMBER_OF_THREADS,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_volume_set_number_of_io_threads(
+	          volume,
+	          4,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_volume_set_number_of_io_threads(
+	          NULL,
+	          4,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_volume_set_number_of_io_threads(
+	          volume,
+	          -1,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_volume_set_number_of_io_threads(
+	          volume,
+	          LIBFSXFS_IO_QUEUE_MAXIMUM_NUMBER_OF_THREADS + 1,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_volume_free(
+	          &volume,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "volume",
+	 volume );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( volume != NULL )
+	{
+		libfsxfs_volume_free(
+		 &volume,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests opening and closing a volume with IO threads
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_volume_open_close_with_io_threads(
+     libbfio_handle_t *file_io_handle )
+{
+	libcerror_error_t *error  = NULL;
+	libfsxfs_volume_t *volume = NULL;
+	int result                = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_volume_initialize(
+	          &volume,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "volume",
+	 volume );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_volume_set_number_of_io_threads(
+	          volume,
+	          4,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open and close
+	 */
+	result = libfsxfs_volume_open_file_io_handle(
+	          volume,
+	          file_io_handle,
+	          LIBFSXFS_OPEN_READ,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_volume_close(
+	          volume,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_volume_free(
+	          &volume,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "volume",
+	 volume );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( volume != NULL )
+	{
+		libfsxfs_volume_free(
+		 &volume,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests opening and closing a volume with validation of the allocation groups
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_volume_open_close_with_validate_allocation_groups(
+     libbfio_handle_t *file_io_handle )
+{
+	libcerror_error_t *error                      = NULL;
+	libfsxfs_volume_t *volume                     = NULL;
+	uint32_t expected_number_of_allocation_groups = 0;
+	uint32_t number_of_allocation_groups          = 0;
+	int number_of_io_threads                      = 0;
+	int result                                    = 0;
+	int test_number                               = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_volume_initialize(
+	          &volume,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "volume",
+	 volume );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_volume_open_file_io_handle(
+	          volume,
+	          file_io_handle,
+	          LIBFSXFS_OPEN_READ,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_volume_get_number_of_allocation_groups(
+	          volume,
+	          &expected_number_of_allocation_groups,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_volume_close(
+	          volume,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_volume_set_validate_allocation_groups(
+	          volume,
+	          1,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open and close with the allocation groups read using the IO queue
+	 * and read sequentially
+	 */
+	for( test_number = 0;
+	     test_number < 2;
+	     test_number++ )
+	{
+		if( test_number == 0 )
+		{
+			number_of_io_threads = 4;
+		}
+		else
+		{
+			number_of_io_threads = 0;
+		}
+
+		result = libfsxfs_volume_set_number_of_io_threads(
+		          volume,
+		          number_of_io_threads,
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfsxfs_volume_open_file_io_handle(
+		          volume,
+		          file_io_handle,
+		          LIBFSXFS_OPEN_READ,
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfsxfs_volume_get_number_of_allocation_groups(
+		          volume,
+		          &number_of_allocation_groups,
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSXFS_TEST_ASSERT_EQUAL_UINT32(
+		 "number_of_allocation_groups",
+		 number_of_allocation_groups,
+		 expected_number_of_allocation_groups );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfsxfs_volume_close(
+		          volume,
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Clean up
+	 */
+	result = libfsxfs_volume_free(
+	          &volume,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "volume",
+	 volume );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( volume != NULL )
+	{
+		libfsxfs_volume_free(
+		 &volume,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_volume_set_verify_checksums function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_volume_set_verify_checksums(
+     void )
+{
+	libcerror_error_t *error  = NULL;
+	libfsxfs_volume_t *volume = NULL;
+	int result                = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_volume_initialize(
+	          &volume,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "volume",
+	 volume );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_volume_set_verify_checksums(
+	          volume,
+	          1,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_volume_set_verify_checksums(
+	          volume,
+	          0,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_volume_set_verify_checksums(
+	          NULL,
+	          1,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_volume_free(
+	          &volume,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "volume",
+	 volume );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( volume != NULL )
+	{
+		libfsxfs_volume_free(
+		 &volume,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests opening a volume with verification of the metadata checksums and reading all its file entries
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_volume_open_close_with_verify_checksums(
+     libbfio_handle_t *file_io_handle )
+{
+	libcerror_error_t *error          = NULL;
+	libfsxfs_file_entry_t *file_entry = NULL;
+	libfsxfs_volume_t *volume         = NULL;
+	uint64_t cookie                   = 0;
+	int number_of_file_entries        = 0;
+	int number_of_sub_file_entries    = 0;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_volume_initialize(
+	          &volume,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "volume",
+	 volume );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_volume_set_verify_checksums(
+	          volume,
+	          1,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open
+	 */
+	result = libfsxfs_volume_open_file_io_handle(
+	          volume,
+	          file_io_handle,
+	          LIBFSXFS_OPEN_READ,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test reading the inodes and directories with verification of the metadata checksums
+	 */
+	do
+	{
+		result = libfsxfs_volume_get_next_file_entry(
+		          volume,
+		          &cookie,
+		          &file_entry,
+		          &error );
+
+		FSXFS_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( result != 0 )
+		{
+			result = libfsxfs_file_entry_get_number_of_sub_file_entries(
+			          file_entry,
+			          &number_of_sub_file_entries,
+			          &error );
+
+			FSXFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			FSXFS_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = libfsxfs_file_entry_free(
+			          &file_entry,
+			          &error );
+
+			FSXFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			FSXFS_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			number_of_file_entries++;
+		}
+	}
+	while( result != 0 );
+
+	FSXFS_TEST_ASSERT_GREATER_THAN_INT(
+	 "number_of_file_entries",
+	 number_of_file_entries,
+	 0 );
+
+	/* Test close
+	 */
+	result = libfsxfs_volume_close(
+	          volume,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_volume_free(
+	          &volume,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "volume",
+	 volume );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_entry != NULL )
+	{
+		libfsxfs_file_entry_free(
+		 &file_entry,
+		 NULL );
+	}
+	if( volume != NULL )
+	{
+		libfsxfs_volume_free(
+		 &volume,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_volume_set_use_memory_map function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_volume_set_use_memory_map(
+     void )
+{
+	libcerror_error_t *error  = NULL;
+	libfsxfs_volume_t *volume = NULL;
+	int result                = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_volume_initialize(
+	          &volume,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "volume",
+	 volume );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_volume_set_use_memory_map(
+	          volume,
+	          0,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if defined( HAVE_LIBFSXFS_MEMORY_MAP_SUPPORT )
+	result = libfsxfs_volume_set_use_memory_map(
+	          volume,
+	          1,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#endif /* defined( HAVE_LIBFSXFS_MEMORY_MAP_SUPPORT ) */
+
+	/* Test error cases
+	 */
+	result = libfsxfs_volume_set_use_memory_map(
+	          NULL,
+	          1,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if !defined( HAVE_LIBFSXFS_MEMORY_MAP_SUPPORT )
+	result = libfsxfs_volume_set_use_memory_map(
+	          volume,
+	          1,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#endif /* !defined( HAVE_LIBFSXFS_MEMORY_MAP_SUPPORT ) */
+
+	/* Clean up
+	 */
+	result = libfsxfs_volume_free(
+	          &volume,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "volume",
+	 volume );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( volume != NULL )
+	{
+		libfsxfs_volume_free(
+		 &volume,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( HAVE_LIBFSXFS_MEMORY_MAP_SUPPORT )
+
+/* Tests opening and closing a memory mapped volume
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_volume_open_close_with_memory_map(
+     const system_character_t *source )
+{
+	libcerror_error_t *error              = NULL;
+	libfsxfs_file_entry_t *root_directory = NULL;
+	libfsxfs_volume_t *volume             = NULL;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_volume_initialize(
+	          &volume,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "volume",
+	 volume );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_volume_set_use_memory_map(
+	          volume,
+	          1,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open and close
+	 */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libfsxfs_volume_open_wide(
+	          volume,
+	          source,
+	          LIBFSXFS_OPEN_READ,
+	          &error );
+#else
+	result = libfsxfs_volume_open(
+	          volume,
+	          source,
+	          LIBFSXFS_OPEN_READ,
+	          &error );
+#endif
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test reading metadata
+	 */
+	result = libfsxfs_volume_get_root_directory(
+	          volume,
+	          &root_directory,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "root_directory",
+	 root_directory );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_file_entry_free(
+	          &root_directory,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_volume_close(
+	          volume,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_volume_free(
+	          &volume,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "volume",
+	 volume );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( root_directory != NULL )
+	{
+		libfsxfs_file_entry_free(
+		 &root_directory,
+		 NULL );
+	}
+	if( volume != NULL )
+	{
+		libfsxfs_volume_free(
+		 &volume,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( HAVE_LIBFSXFS_MEMORY_MAP_SUPPORT ) */
+
+/* Tests the libfsxfs_volume_get_number_of_allocation_groups function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_volume_get_number_of_allocation_groups(
+     libfsxfs_volume_t *volume )
+{
+	libcerror_error_t *error             = NULL;
+	libfsxfs_volume_t *unopened_volume   = NULL;
+	uint32_t number_of_allocation_groups = 0;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_volume_initialize(
+	          &unopened_volume,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "unopened_volume",
+	 unopened_volume );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_volume_get_number_of_allocation_groups(
+	          volume,
+	          &number_of_allocation_groups,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_GREATER_THAN_INT(
+	 "number_of_allocation_groups",
+	 (int) number_of_allocation_groups,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_volume_get_number_of_allocation_groups(
+	          NULL,
+	          &number_of_allocation_groups,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_volume_get_number_of_allocation_groups(
+	          unopened_volume,
+	          &number_of_allocation_groups,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_volume_get_number_of_allocation_groups(
+	          volume,
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_volume_free(
+	          &unopened_volume,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "unopened_volume",
+	 unopened_volume );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( unopened_volume != NULL )
+	{
+		libfsxfs_volume_free(
+		 &unopened_volume,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_volume_set_validate_allocation_groups function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_volume_set_validate_allocation_groups(
+     libfsxfs_volume_t *volume )
+{
+	libcerror_error_t *error           = NULL;
+	libfsxfs_volume_t *unopened_volume = NULL;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_volume_initialize(
+	          &unopened_volume,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "unopened_volume",
+	 unopened_volume );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_volume_set_validate_allocation_groups(
+	          unopened_volume,
+	          1,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_volume_set_validate_allocation_groups(
+	          unopened_volume,
+	          0,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_volume_set_validate_allocation_groups(
+	          NULL,
+	          1,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with a volume that is already open
+	 */
+	result = libfsxfs_volume_set_validate_allocation_groups(
+	          volume,
+	          1,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_volume_free(
+	          &unopened_volume,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "unopened_volume",
+	 unopened_volume );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( unopened_volume != NULL )
+	{
+		libfsxfs_volume_free(
+		 &unopened_volume,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_volume_verify_allocation_group function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_volume_verify_allocation_group(
+     libfsxfs_volume_t *volume )
+{
+	libcerror_error_t *error             = NULL;
+	libfsxfs_volume_t *unopened_volume   = NULL;
+	uint64_t metadata_size               = 0;
+	uint64_t number_of_inodes            = 0;
+	uint32_t number_of_allocation_groups = 0;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_volume_initialize(
+	          &unopened_volume,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "unopened_volume",
+	 unopened_volume );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_volume_get_number_of_allocation_groups(
+	          volume,
+	          &number_of_allocation_groups,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_volume_verify_allocation_group(
+	          volume,
+	          0,
+	          &number_of_inodes,
+	          &metadata_size,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The first allocation group contains at least the root directory inode
+	 */
+	FSXFS_TEST_ASSERT_NOT_EQUAL_INT64(
+	 "number_of_inodes",
+	 (int64_t) number_of_inodes,
+	 (int64_t) 0 );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_volume_verify_allocation_group(
+	          NULL,
+	          0,
+	          &number_of_inodes,
+	          &metadata_size,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_volume_verify_allocation_group(
+	          unopened_volume,
+	          0,
+	          &number_of_inodes,
+	          &metadata_size,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_volume_verify_allocation_group(
+	          volume,
+	          number_of_allocation_groups,
+	          &number_of_inodes,
+	          &metadata_size,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_volume_verify_allocation_group(
+	          volume,
+	          0,
+	          NULL,
+	          &metadata_size,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_volume_verify_allocation_group(
+	          volume,
+	          0,
+	          &number_of_inodes,
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_volume_free(
+	          &unopened_volume,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "unopened_volume",
+	 unopened_volume );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( unopened_volume != NULL )
+	{
+		libfsxfs_volume_free(
+		 &unopened_volume,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_volume_get_next_file_entry function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_volume_get_next_file_entry(
+     libfsxfs_volume_t *volume )
+{
+	libcerror_error_t *error              = NULL;
+	libfsxfs_file_entry_t *file_entry     = NULL;
+	libfsxfs_file_entry_t *root_directory = NULL;
+	libfsxfs_volume_t *unopened_volume    = NULL;
+	uint64_t cookie                       = 0;
+	uint64_t inode_number                 = 0;
+	uint64_t previous_cookie              = 0;
+	uint64_t root_inode_number            = 0;
+	int found_root_directory              = 0;
+	int number_of_file_entries            = 0;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_volume_initialize(
+	          &unopened_volume,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "unopened_volume",
+	 unopened_volume );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_volume_get_root_directory(
+	          volume,
+	          &root_directory,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_file_entry_get_inode_number(
+	          root_directory,
+	          &root_inode_number,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_file_entry_free(
+	          &root_directory,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	do
+	{
+		result = libfsxfs_volume_get_next_file_entry(
+		          volume,
+		          &cookie,
+		          &file_entry,
+		          &error );
+
+		FSXFS_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( result != 0 )
+		{
+			FSXFS_TEST_ASSERT_IS_NOT_NULL(
+			 "file_entry",
+			 file_entry );
+
+			result = libfsxfs_file_entry_get_inode_number(
+			          file_entry,
+			          &inode_number,
+			          &error );
+
+			FSXFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			FSXFS_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			/* The inodes are returned in ascending order and the cookie
+			 * resumes after the inode that was returned
+			 */
+			FSXFS_TEST_ASSERT_LESS_THAN_UINT64(
+			 "previous_cookie",
+			 previous_cookie,
+			 cookie );
+
+			FSXFS_TEST_ASSERT_EQUAL_UINT64(
+			 "cookie",
+			 cookie,
+			 inode_number + 1 );
+
+			if( inode_number == root_inode_number )
+			{
+				found_root_directory = 1;
+			}
+			result = libfsxfs_file_entry_free(
+			          &file_entry,
+			          &error );
+
+			FSXFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			FSXFS_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			previous_cookie = cookie;
+
+			number_of_file_entries++;
+		}
+	}
+	while( result != 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "file_entry",
+	 file_entry );
+
+	FSXFS_TEST_ASSERT_GREATER_THAN_INT(
+	 "number_of_file_entries",
+	 number_of_file_entries,
+	 0 );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "found_root_directory",
+	 found_root_directory,
+	 1 );
+
+	/* Test that iterating does not resume after the last file entry
+	 */
+	result = libfsxfs_volume_get_next_file_entry(
+	          volume,
+	          &cookie,
+	          &file_entry,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "file_entry",
+	 file_entry );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	cookie = 0;
+
+	result = libfsxfs_volume_get_next_file_entry(
+	          NULL,
+	          &cookie,
+	          &file_entry,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_volume_get_next_file_entry(
+	          unopened_volume,
+	          &cookie,
+	          &file_entry,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_volume_get_next_file_entry(
+	          volume,
+	          NULL,
+	          &file_entry,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_volume_get_next_file_entry(
+	          volume,
+	          &cookie,
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	file_entry = (libfsxfs_file_entry_t *) 0x12345678UL;
+
+	result = libfsxfs_volume_get_next_file_entry(
+	          volume,
+	          &cookie,
+	          &file_entry,
+	          &error );
+
+	file_entry = NULL;
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_volume_free(
+	          &unopened_volume,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "unopened_volume",
+	 unopened_volume );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_entry != NULL )
+	{
+		libfsxfs_file_entry_free(
+		 &file_entry,
+		 NULL );
+	}
+	if( root_directory != NULL )
+	{
+		libfsxfs_file_entry_free(
+		 &root_directory,
+		 NULL );
+	}
+	if( unopened_volume != NULL )
+	{
+		libfsxfs_volume_free(
+		 &unopened_volume,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc,
+     wchar_t * const argv[] )
+#else
+int main(
+     int argc,
+     char * const argv[] )
+#endif
+{
+	libbfio_handle_t *file_io_handle  = NULL;
+	libcerror_error_t *error          = NULL;
+	libfsxfs_volume_t *volume         = NULL;
+	system_character_t *option_offset = NULL;
+	system_character_t *source        = NULL;
+	system_integer_t option           = 0;
+	size_t string_length              = 0;
+	off64_t volume_offset             = 0;
+	int result                        = 0;
+
+	while( ( option = fsxfs_test_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "o:" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM ".\n",
+				 argv[ optind - 1 ] );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'o':
 				option_offset = optarg;
 
 				break;
@@ -1318,6 +3776,22 @@ int main(
 	 "libfsxfs_volume_free",
 	 fsxfs_test_volume_free );
 
+	FSXFS_TEST_RUN(
+	 "libfsxfs_volume_set_maximum_read_ahead_size",
+	 fsxfs_test_volume_set_maximum_read_ahead_size );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_volume_set_number_of_io_threads",
+	 fsxfs_test_volume_set_number_of_io_threads );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_volume_set_use_memory_map",
+	 fsxfs_test_volume_set_use_memory_map );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_volume_set_verify_checksums",
+	 fsxfs_test_volume_set_verify_checksums );
+
 #if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
 	if( source != NULL )
 	{
@@ -1413,6 +3887,11 @@ int main(
 		 fsxfs_test_volume_open_file_io_handle,
 		 source );
 
+		FSXFS_TEST_RUN_WITH_ARGS(
+		 "libfsxfs_volume_open_file_io_pool",
+		 fsxfs_test_volume_open_file_io_pool,
+		 source );
+
 		FSXFS_TEST_RUN(
 		 "libfsxfs_volume_close",
 		 fsxfs_test_volume_close );
@@ -1421,9 +3900,33 @@ int main(
 		 "libfsxfs_volume_open_close",
 		 fsxfs_test_volume_open_close,
 		 source );
+
+#if defined( HAVE_LIBFSXFS_MEMORY_MAP_SUPPORT )
+
+		FSXFS_TEST_RUN_WITH_ARGS(
+		 "libfsxfs_volume_open_close_with_memory_map",
+		 fsxfs_test_volume_open_close_with_memory_map,
+		 source );
+
+#endif /* defined( HAVE_LIBFSXFS_MEMORY_MAP_SUPPORT ) */
 	}
 	if( result != 0 )
 	{
+		FSXFS_TEST_RUN_WITH_ARGS(
+		 "libfsxfs_volume_open_close_with_io_threads",
+		 fsxfs_test_volume_open_close_with_io_threads,
+		 file_io_handle );
+
+		FSXFS_TEST_RUN_WITH_ARGS(
+		 "libfsxfs_volume_open_close_with_validate_allocation_groups",
+		 fsxfs_test_volume_open_close_with_validate_allocation_groups,
+		 file_io_handle );
+
+		FSXFS_TEST_RUN_WITH_ARGS(
+		 "libfsxfs_volume_open_close_with_verify_checksums",
+		 fsxfs_test_volume_open_close_with_verify_checksums,
+		 file_io_handle );
+
 		/* Initialize volume for tests
 		 */
 		result = fsxfs_test_volume_open_source(
@@ -1444,6 +3947,28 @@ int main(
 		 "error",
 		 error );
 
+		FSXFS_TEST_RUN_WITH_ARGS(
+		 "libfsxfs_volume_get_number_of_allocation_groups",
+		 fsxfs_test_volume_get_number_of_allocation_groups,
+		 volume );
+
+		FSXFS_TEST_RUN_WITH_ARGS(
+		 "libfsxfs_volume_set_validate_allocation_groups",
+		 fsxfs_test_volume_set_validate_allocation_groups,
+		 volume );
+
+		FSXFS_TEST_RUN_WITH_ARGS(
+		 "libfsxfs_volume_verify_allocation_group",
+		 fsxfs_test_volume_verify_allocation_group,
+		 volume );
+
+		FSXFS_TEST_RUN_WITH_ARGS(
+		 "libfsxfs_volume_get_next_file_entry",
+		 fsxfs_test_volume_get_next_file_entry,
+		 volume );
+
+		/* Signal abort last since it affects the other tests
+		 */
 		FSXFS_TEST_RUN_WITH_ARGS(
 		 "libfsxfs_volume_signal_abort",
 		 fsxfs_test_volume_signal_abort,
@@ -1453,8 +3978,6 @@ int main(
 
 		/* TODO: add tests for libfsxfs_volume_open_read */
 
-		/* TODO: add tests for libfsxfs_volume_read_allocation_groups */
-
 #endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
 
 /* TODO implement
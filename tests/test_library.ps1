@@ -6,8 +6,8 @@ $ExitSuccess = 0
 $ExitFailure = 1
 $ExitIgnore = 77
 
-$LibraryTests = "attribute_values attributes_leaf_block_header attributes_table attributes_table_header block_directory_footer block_directory_header btree_block btree_header buffer_data_handle directory_entry directory_table_header error extent file_system_block_header inode_btree inode_btree_record inode_information io_handle notify superblock"
-$LibraryTestsWithInput = "support volume"
+$LibraryTests = "attribute_values attributes_leaf_block_header attributes_table attributes_table_header block_cache block_directory_footer block_directory_header btree_block btree_header buffer_data_handle checksum dentry_cache directory directory_arena directory_entry directory_hash directory_table_header error extent extent_map file_system_block_header inode_btree inode_btree_record inode_cache inode_chunk_index inode_information io_handle io_queue memory_map notify read_vector superblock"
+$LibraryTestsWithInput = "file_entry support volume"
 $OptionSets = "offset"
 
 $InputGlob = "*"
@@ -7,8 +7,8 @@ EXIT_SUCCESS=0;
 EXIT_FAILURE=1;
 EXIT_IGNORE=77;
 
-LIBRARY_TESTS="attribute_values attributes_leaf_block_header attributes_table attributes_table_header block_directory_footer block_directory_header btree_block btree_header buffer_data_handle directory_entry directory_table_header error extent file_system_block_header inode_btree inode_btree_record inode_information io_handle notify superblock";
-LIBRARY_TESTS_WITH_INPUT="support volume";
+LIBRARY_TESTS="attribute_values attributes_leaf_block_header attributes_table attributes_table_header block_cache block_directory_footer block_directory_header btree_block btree_header buffer_data_handle checksum dentry_cache directory directory_arena directory_entry directory_hash directory_table_header error extent extent_map file_system_block_header inode_btree inode_btree_record inode_cache inode_chunk_index inode_information io_handle io_queue memory_map notify read_vector superblock";
+LIBRARY_TESTS_WITH_INPUT="file_entry support volume";
 OPTION_SETS=("offset");
 
 INPUT_GLOB="*";
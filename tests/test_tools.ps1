@@ -6,7 +6,7 @@ $ExitSuccess = 0
 $ExitFailure = 1
 $ExitIgnore = 77
 
-$ToolsTests = "info_handle mount_path_string output signal"
+$ToolsTests = "info_handle mount_path_string output signal verify_handle"
 $ToolsTestsWithInput = ""
 
 $InputGlob = "*"